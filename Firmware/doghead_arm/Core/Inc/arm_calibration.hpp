@@ -0,0 +1,22 @@
+/**
+ * @file arm_calibration.hpp
+ * @brief [自動產生] 機構校正結果 (連桿長度與關節零點)，請勿手動修改
+ * @details 產生器: Tools/arm_calibrate，來源: 設計值 (未校正)
+ *   arm_geometry.hpp 的 DogArmSpec 與 Robot_Loop 的關節零點皆引用此檔；
+ *   更新後請重新產生以幾何編譯的四個表格 (各表格以 static_assert 檢查產生時的幾何)：
+ *     ik_grid_table.cpp (ik_grid_gen)、workspace_map_table.cpp (workspace_map_gen)、
+ *     resolution_map_table.cpp (resolution_map_gen)、stroke_table_data.cpp (stroke_table_gen)
+ */
+
+#ifndef ARM_CALIBRATION_HPP
+#define ARM_CALIBRATION_HPP
+
+struct DogArmCalibration {
+    static constexpr float L1                = 100.0000f;  // 主動臂 (mm)
+    static constexpr float L2                = 150.0000f;  // 從動臂 (mm)
+    static constexpr float D                 = 60.0000f;   // 兩馬達間距 (mm)
+    static constexpr float JOINT1_OFFSET_DEG = 0.0000f;    // 加到 Motor_GetAngle 的零點修正 (Degree)
+    static constexpr float JOINT2_OFFSET_DEG = 0.0000f;
+};
+
+#endif // ARM_CALIBRATION_HPP
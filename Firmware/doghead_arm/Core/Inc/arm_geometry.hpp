@@ -0,0 +1,71 @@
+/**
+ * @file arm_geometry.hpp
+ * @brief 機構參數 (由 arm_calibration.hpp 提供校正值) 與對應的編譯期運動學型別
+ * @details
+ *  新增其他手臂版本時，仿照 DogArmSpec 定義一個 Spec，再以
+ *  BasicFiveBarKinematics<MathPolicy, StaticGeometry<NewSpec>> 實例化即可，
+ *  不需要任何執行期成本；幾何無效時 StaticGeometry 的 static_assert 會擋下編譯。
+ */
+
+#ifndef ARM_GEOMETRY_HPP
+#define ARM_GEOMETRY_HPP
+
+#include "kinematics.hpp"
+#include "arm_calibration.hpp"
+
+// ==========================================================
+// DogHead 五連桿參數 (單位: mm)
+// ==========================================================
+// 數值來自 arm_calibration.hpp (Tools/arm_calibrate 由觸點紀錄擬合產生，未校正時為設計值)
+struct DogArmSpec {
+    static constexpr float L1 = DogArmCalibration::L1;  // 主動臂 (連接馬達)
+    static constexpr float L2 = DogArmCalibration::L2;  // 從動臂 (連接末端)
+    static constexpr float D  = DogArmCalibration::D;   // 兩馬達間距
+};
+
+typedef StaticGeometry<DogArmSpec> DogArmGeometry;
+
+// 離線產生的表格 (IK 網格、工作空間 / 解析度地圖、筆畫表) 寫入產生時的幾何並以此 static_assert，
+// arm_calibration.hpp 更新後忘記重新產生時直接編譯失敗，不會送出以舊幾何算出的關節角
+constexpr bool dogArmGeometryMatches(float l1, float l2, float d) {
+    return DogArmSpec::L1 == l1 && DogArmSpec::L2 == l2 && DogArmSpec::D == d;
+}
+
+// ==========================================================
+// 書寫區 (紙張在手臂前方的固定矩形，單位: mm)
+// ==========================================================
+struct DogArmWritingArea {
+    static constexpr float X_MIN = -60.0f;
+    static constexpr float X_MAX = 120.0f;
+    static constexpr float Y_MIN = 100.0f;
+    static constexpr float Y_MAX = 200.0f;
+};
+
+// ==========================================================
+// 安全範圍 (Robot_Loop 的 FK 虛擬圍籬與工作空間地圖共用)
+// ==========================================================
+struct DogArmSafety {
+    static constexpr float Y_FENCE = 10.0f;  // 末端 Y 低於此值 (太靠近底座) 強制停止
+};
+
+// ==========================================================
+// 碰撞模型 (膠囊體，單位: mm，見 collision_checker.hpp)
+// ==========================================================
+// [請依實際機構量測修改] 目前為估計值
+struct DogArmCollisionSpec {
+    static constexpr float LINK_RADIUS = 6.0f;         // 連桿半寬 (含螺絲頭)
+    static constexpr float MOTOR_RADIUS = 15.0f;       // 馬達外殼半徑 (以兩軸心為圓心)
+    static constexpr float MIN_FOLD_ANGLE_DEG = 10.0f; // 共用關節的兩連桿最小夾角
+    // 壓紙條：書寫區上緣外側的一條橫桿
+    static constexpr float HOLDER_X_MIN = DogArmWritingArea::X_MIN - 20.0f;
+    static constexpr float HOLDER_X_MAX = DogArmWritingArea::X_MAX + 20.0f;
+    static constexpr float HOLDER_Y = DogArmWritingArea::Y_MAX + 20.0f;
+    static constexpr float HOLDER_RADIUS = 5.0f;
+};
+
+// 控制迴圈使用：多項式近似 + 編譯期幾何
+typedef BasicFiveBarKinematics<FastMath, DogArmGeometry> DogArmKinematics;
+// 離線工具 / 驗證使用：libm + 編譯期幾何
+typedef BasicFiveBarKinematics<PreciseMath, DogArmGeometry> DogArmPreciseKinematics;
+
+#endif // ARM_GEOMETRY_HPP
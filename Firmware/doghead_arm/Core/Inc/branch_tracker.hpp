@@ -0,0 +1,237 @@
+/**
+ * @file branch_tracker.hpp
+ * @brief 組裝模式 / 工作模式 (分支) 連續性追蹤：有狀態的 IK / FK 包裝
+ * @details
+ *  五連桿有兩種分支：
+ *    - 工作模式 (IK 分支)：每個手臂的手肘朝哪一側，θ1 = αL ± βL、θ2 = αR ∓ βR，共 4 種組合；
+ *      以 bi = L1 * ui · dEi/dθi 的正負號判斷 (solveIK 的 mode 1 為 b1 < 0, b2 > 0)
+ *    - 組裝模式 (FK 分支)：雙圓的兩個交點，以 det A = u1 x u2 的正負號區分
+ *  無狀態的 solveIK 固定使用呼叫端給的 mode，solveFK 以 P.y < 0 猜交點；
+ *  在工作空間邊緣這兩者都可能在相鄰 tick 間跳到另一個分支，對 PositionController
+ *  下達上百度的步階。BranchTracker 改以「最接近目前狀態」選解：
+ *    - observe()：由實測關節角做 FK，取離上一次末端位置最近的交點 (只有第一次沿用 Y >= 0 的判斷)；
+ *      再由該構型的 bi 正負號更新各臂的手肘方向 (|sin φi| 需超過 switch_band，避免在奇異點附近抖動)
+ *    - solveIK()：各臂兩個候選解中取離參考關節角最近的一個 (需近 hysteresis 以上才換邊)，
+ *      並平移 2π 的整數倍到參考角附近 (馬達角度是多圈連續值)
+ *  分支改變時記錄事件旗標，由 takeEvents() 讀取。
+ */
+
+#ifndef BRANCH_TRACKER_HPP
+#define BRANCH_TRACKER_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "kinematics.hpp"
+
+// 分支事件旗標 (BranchTracker::takeEvents)
+enum BranchEvent : uint32_t {
+    BRANCH_EVENT_ELBOW1 = 1u << 0,    // 左臂手肘方向改變
+    BRANCH_EVENT_ELBOW2 = 1u << 1,    // 右臂手肘方向改變
+    BRANCH_EVENT_ASSEMBLY = 1u << 2,  // 組裝模式改變 (穿過正向奇異)
+};
+
+/**
+ * @tparam Kinematics BasicFiveBarKinematics 的任一實例 (例如 DogArmKinematics)
+ */
+template <typename Kinematics>
+class BranchTracker {
+public:
+    /**
+     * @param kin 運動學解算器 (需比本物件活得久)
+     * @param solution_mode 初始工作模式 (同 solveIK 的 mode)
+     * @param switch_band observe 判定手肘換邊所需的最小 |sin φi|
+     * @param hysteresis_rad solveIK 換邊所需的最小關節距離差 (Rad)
+     */
+    explicit BranchTracker(const Kinematics& kin, int solution_mode = 1,
+                           float switch_band = 0.1f, float hysteresis_rad = 0.05f)
+        : _kin(kin), _switch_band(switch_band), _hysteresis(hysteresis_rad) {
+        reset(solution_mode);
+    }
+
+    // 回到初始分支並清除參考狀態 (下一次 observe 重新判定組裝模式)
+    void reset(int solution_mode = 1) {
+        _elbow1 = _elbow2 = (solution_mode >= 0) ? 1 : -1;
+        _assembly = 1;
+        _has_reference = false;
+        _theta1 = _theta2 = 0.0f;
+        _has_end = false;
+        _end.x = _end.y = 0.0f;
+        _events = 0;
+        _switch_count = 0;
+    }
+
+    /**
+     * @brief 有狀態的 FK：實測關節角 -> 末端，並更新目前的分支
+     * @param pose (可選) 輸出完整構型 (肘部已在 FK 中算出，不增加成本)，供碰撞檢查使用
+     * @return 末端座標，構型無解時回傳 (0, 0) (與 solveFK 相同)，分支狀態不變
+     */
+    Point2D observe(float theta1, float theta2, LinkagePose* pose = nullptr);
+
+    /**
+     * @brief 有狀態的 IK：各臂取最接近參考關節角的解
+     * @details 參考關節角為最後一次 observe() 或 solveIK() 的結果；兩者都還沒呼叫過時，
+     *          直接採用目前的手肘方向且不做 2π 平移
+     */
+    MotorAngles solveIK(Point2D target);
+
+    /**
+     * @brief 把其他來源 (IncrementalIk、查表) 的 IK 解平移 2π 整數倍到參考關節角附近
+     */
+    void unwrap(float* theta1, float* theta2) const {
+        if (!_has_reference) return;
+        *theta1 = _theta1 + wrapPi(*theta1 - _theta1);
+        *theta2 = _theta2 + wrapPi(*theta2 - _theta2);
+    }
+
+    /**
+     * @brief 目前的工作模式 (solveIK / IncrementalIk 的 mode)
+     * @return 1 / -1；兩臂手肘方向不一致 (solveIK 無法表示) 時為 0
+     */
+    int solutionMode() const { return (_elbow1 == _elbow2) ? _elbow1 : 0; }
+
+    int elbow1() const { return _elbow1; }
+    int elbow2() const { return _elbow2; }
+    int assemblyMode() const { return _assembly; }
+
+    // 讀取並清除事件旗標 (BranchEvent 的 OR)；與 observe / solveIK 在同一個 Task 呼叫
+    uint32_t takeEvents() {
+        uint32_t e = _events;
+        _events = 0;
+        return e;
+    }
+
+    // 累計分支切換次數
+    uint32_t switchCount() const { return _switch_count; }
+
+private:
+    static constexpr float TWO_PI = 6.28318531f;
+    static constexpr float INV_TWO_PI = 0.159154943f;
+
+    // 化簡到 [-π, π)
+    static float wrapPi(float a) {
+        return a - TWO_PI * std::floor(a * INV_TWO_PI + 0.5f);
+    }
+
+    void record(uint32_t event) {
+        _events |= event;
+        _switch_count++;
+    }
+
+    // 單臂：在兩個候選解 alpha ± beta 中選擇，elbow 為目前採用的符號
+    float chooseArm(float alpha, float beta, float reference, int* elbow, uint32_t event);
+
+    const Kinematics& _kin;
+    float _switch_band;
+    float _hysteresis;
+
+    // 分支狀態
+    int _elbow1;    // +1：左臂取 αL + βL
+    int _elbow2;    // +1：右臂取 αR - βR
+    int _assembly;  // +1：det A > 0
+
+    // 參考狀態
+    bool _has_reference;
+    float _theta1, _theta2;
+    bool _has_end;
+    Point2D _end;
+
+    uint32_t _events;
+    uint32_t _switch_count;
+};
+
+// ==========================================================
+// 樣板實作
+// ==========================================================
+
+template <typename Kinematics>
+Point2D BranchTracker<Kinematics>::observe(float theta1, float theta2, LinkagePose* pose) {
+    JointTrig trig = Kinematics::jointTrig(theta1, theta2);
+    FkAssemblies a;
+    const FiveBarGeometry& G = _kin.geometry();
+    bool ok = _kin.solveFKAssemblies(trig, &a);
+    if (pose) {
+        pose->base1 = {0.0f, 0.0f};
+        pose->base2 = {G.d, 0.0f};
+        pose->elbow1 = a.elbow1;
+        pose->elbow2 = a.elbow2;
+        pose->end = {0.0f, 0.0f};
+    }
+    if (!ok) {
+        Point2D none = {0, 0};
+        return none;
+    }
+
+    // 1. 組裝模式：取離上一次末端最近的交點 (兩交點只在正向奇異時重合，平常相距 2h)
+    //    第一次沒有參考位置，沿用 solveFK 的判斷 (末端在底座前方，Y >= 0)
+    if (!_has_end) {
+        _assembly = (a.assembly_pos.y < 0) ? -1 : 1;
+    } else {
+        const Point2D& same = (_assembly > 0) ? a.assembly_pos : a.assembly_neg;
+        const Point2D& other = (_assembly > 0) ? a.assembly_neg : a.assembly_pos;
+        float ds = (same.x - _end.x) * (same.x - _end.x) + (same.y - _end.y) * (same.y - _end.y);
+        float dn = (other.x - _end.x) * (other.x - _end.x) + (other.y - _end.y) * (other.y - _end.y);
+        if (dn < ds) {
+            _assembly = -_assembly;
+            record(BRANCH_EVENT_ASSEMBLY);
+        }
+    }
+    Point2D P = (_assembly > 0) ? a.assembly_pos : a.assembly_neg;
+    if (pose) pose->end = P;
+
+    // 2. 工作模式：bi 的正負號 (|bi| / (L1 * L2) = |sin φi|)
+    float b1 = (P.y - a.elbow1.y) * trig.c1 - (P.x - a.elbow1.x) * trig.s1;  // b1 / L1
+    float b2 = (P.y - a.elbow2.y) * trig.c2 - (P.x - a.elbow2.x) * trig.s2;  // b2 / L1
+    float band = _switch_band * G.l2;
+    int obs1 = (b1 < 0) ? 1 : -1;
+    int obs2 = (b2 > 0) ? 1 : -1;
+    if (obs1 != _elbow1 && std::fabs(b1) > band) {
+        _elbow1 = obs1;
+        record(BRANCH_EVENT_ELBOW1);
+    }
+    if (obs2 != _elbow2 && std::fabs(b2) > band) {
+        _elbow2 = obs2;
+        record(BRANCH_EVENT_ELBOW2);
+    }
+
+    _theta1 = theta1;
+    _theta2 = theta2;
+    _has_reference = true;
+    _end = P;
+    _has_end = true;
+    return P;
+}
+
+template <typename Kinematics>
+float BranchTracker<Kinematics>::chooseArm(float alpha, float beta, float reference, int* elbow, uint32_t event) {
+    float same = alpha + (float)(*elbow) * beta;
+    if (!_has_reference) return same;
+
+    float other = alpha - (float)(*elbow) * beta;
+    float d_same = wrapPi(same - reference);
+    float d_other = wrapPi(other - reference);
+    if (std::fabs(d_other) + _hysteresis < std::fabs(d_same)) {
+        *elbow = -*elbow;
+        record(event);
+        return reference + d_other;
+    }
+    return reference + d_same;
+}
+
+template <typename Kinematics>
+MotorAngles BranchTracker<Kinematics>::solveIK(Point2D target) {
+    MotorAngles result = {0, 0, false};
+    ArmAngles arm = _kin.solveArmAngles(target);
+    if (!arm.is_reachable) return result;
+
+    // 右臂的符號與左臂相反 (θ2 = αR - elbow2 * βR)，以 -βR 代入共用同一個選擇邏輯
+    result.theta1 = chooseArm(arm.alpha_L, arm.beta_L, _theta1, &_elbow1, BRANCH_EVENT_ELBOW1);
+    result.theta2 = chooseArm(arm.alpha_R, -arm.beta_R, _theta2, &_elbow2, BRANCH_EVENT_ELBOW2);
+    result.is_reachable = true;
+
+    _theta1 = result.theta1;
+    _theta2 = result.theta2;
+    _has_reference = true;
+    return result;
+}
+
+#endif // BRANCH_TRACKER_HPP
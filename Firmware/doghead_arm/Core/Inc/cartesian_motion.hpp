@@ -0,0 +1,148 @@
+/**
+ * @file cartesian_motion.hpp
+ * @brief 笛卡兒空間路徑插補 (控制頻率逐 tick) 與路徑偏差量測
+ * @details
+ *  Robot_SetTargetPosition 直接跳到終點的 IK 解，兩個關節各自走自己的輪廓，末端畫出的是曲線。
+ *  CartesianMotion 改在笛卡兒空間插補 PathInterpolator 的路徑 (直線 / 圓弧 / 三次 Bézier)：
+ *    - 路徑參數 s (沿路徑距離，mm) 由 SCurveGenerator 產生 (速度 v、加速度 a、加加速度 a / jerk_time)，
+ *      0 -> L 為 jerk 限制的 S 曲線速度輪廓；s 是弧長，曲線上的進給率與直線相同
+ *    - 每個 tick 輸出 CartesianState：pos = P(s)、vel = T s'、acc = T s'' + K s'²，
+ *      交給 KinematicFeedforward (IK + J^-1) 換算關節設定點，再進 PositionController
+ *  StraightnessMeter 以實測 (編碼器 FK) 的末端位置量測：
+ *    - 與路徑的最大 / RMS 垂直偏差 (直線時即直線度)
+ *    - 與當下命令點的最大距離 (追蹤誤差，包含沿路徑方向的落後)
+ */
+
+#ifndef CARTESIAN_MOTION_HPP
+#define CARTESIAN_MOTION_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "kinematics.hpp"
+#include "kinematic_feedforward.hpp"
+#include "scurve_generator.hpp"
+#include "path_interpolator.hpp"
+
+class CartesianMotion {
+public:
+    /**
+     * @param jerk_time 加速度由 0 爬到 a 的時間 (s)，決定 J = a / jerk_time
+     */
+    explicit CartesianMotion(float jerk_time = 0.05f)
+        : _s(1.0f, 1.0f, 1.0f), _jerk_time(jerk_time), _active(false) {
+        _last.pos = {0.0f, 0.0f};
+        _last.tangent = {1.0f, 0.0f};
+        _last.curvature = {0.0f, 0.0f};
+    }
+
+    /**
+     * @brief 開始沿 path 移動 (從靜止開始，停在終點)
+     * @param speed 最大沿路徑速度 (mm/s)
+     * @param accel 最大沿路徑加速度 (mm/s²)
+     * @return 參數不合法 (速度 / 加速度 <= 0) 時回傳 false，狀態不變
+     * @note 曲線上的向心加速度 K s'² 不在 accel 之內，小半徑圓弧請降低 speed
+     */
+    bool start(const PathInterpolator& path, float speed, float accel) {
+        if (!(speed > 0.0f) || !(accel > 0.0f)) return false;
+        _path = path;
+        _s.setLimits(speed, accel, accel / _jerk_time);
+        _s.reset(0.0f);
+        _last = _path.sample(0.0f);
+        _active = true;
+        return true;
+    }
+
+    // 直線 from -> to
+    bool startLinear(Point2D from, Point2D to, float speed, float accel) {
+        PathInterpolator line;
+        line.beginLine(from, to);
+        return start(line, speed, accel);
+    }
+
+    /**
+     * @brief 前進一個 tick
+     * @param out 輸出末端狀態 (移動結束後保持終點、速度 0)
+     * @return 本 tick 之後仍在移動時回傳 true
+     */
+    bool step(float dt, CartesianState* out) {
+        if (_active) {
+            _s.update(_path.length(), dt);
+            if (_s.getPosition() == _path.length() && _s.getVelocity() == 0.0f) _active = false;
+            _last = _path.sample(_s.getPosition());
+        }
+        float v = _s.getVelocity(), a = _s.getAcceleration();
+        out->pos = _last.pos;
+        out->vel.x = _last.tangent.x * v;
+        out->vel.y = _last.tangent.y * v;
+        out->acc.x = _last.tangent.x * a + _last.curvature.x * v * v;
+        out->acc.y = _last.tangent.y * a + _last.curvature.y * v * v;
+        return _active;
+    }
+
+    // 中止 (不減速)：呼叫端改用其他目標時使用
+    void cancel() { _active = false; }
+
+    bool active() const { return _active; }
+    float length() const { return _path.length(); }
+    float travelled() const { return _s.getPosition(); }
+    // 目前命令點的切線 (路徑偏差量測用)
+    Point2D tangent() const { return _last.tangent; }
+
+private:
+    SCurveGenerator _s;  // 沿路徑距離的 S 曲線
+    float _jerk_time;
+    PathInterpolator _path;
+    PathPoint _last;
+    bool _active;
+};
+
+/**
+ * @brief 直線度 / 路徑偏差量測結果
+ */
+struct StraightnessStats {
+    float max_deviation;  // 與路徑的最大垂直偏差 (mm)
+    float rms_deviation;  // 垂直偏差的 RMS (mm)
+    float max_tracking;   // 與當下命令點的最大距離 (mm)
+    float duration;       // 量測時間 (s)
+    uint32_t samples;
+};
+
+/**
+ * @brief 路徑偏差量測：實測點相對於當下命令點的法向距離 (cross-track)
+ * @details 直線上等於到直線的垂直距離；曲線上沿路徑的落後 d 造成的誤差約 κ d² / 2，
+ *          書寫速度下遠小於量測解析度
+ */
+class StraightnessMeter {
+public:
+    StraightnessMeter() { begin(); }
+
+    void begin() {
+        _sum_sq = 0.0f;
+        _stats = {0.0f, 0.0f, 0.0f, 0.0f, 0};
+    }
+
+    /**
+     * @param measured 實測末端位置 (FK)
+     * @param commanded 產生 measured 的命令點 (上一個 tick 的輸出)
+     * @param tangent 命令點的單位切線
+     */
+    void add(Point2D measured, Point2D commanded, Point2D tangent, float dt) {
+        float ex = measured.x - commanded.x, ey = measured.y - commanded.y;
+        float dev = std::fabs(tangent.x * ey - tangent.y * ex);
+        float trk = std::sqrt(ex * ex + ey * ey);
+        if (dev > _stats.max_deviation) _stats.max_deviation = dev;
+        if (trk > _stats.max_tracking) _stats.max_tracking = trk;
+        _sum_sq += dev * dev;
+        _stats.samples++;
+        _stats.duration += dt;
+        _stats.rms_deviation = std::sqrt(_sum_sq / (float)_stats.samples);
+    }
+
+    const StraightnessStats& stats() const { return _stats; }
+
+private:
+    float _sum_sq;
+    StraightnessStats _stats;
+};
+
+#endif // CARTESIAN_MOTION_HPP
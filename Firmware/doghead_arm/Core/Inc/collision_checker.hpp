@@ -0,0 +1,113 @@
+/**
+ * @file collision_checker.hpp
+ * @brief 膠囊體 (capsule) 碰撞 / 自我干涉檢查：連桿-連桿、連桿-底座、連桿-壓紙條
+ * @details
+ *  每根連桿視為「線段 + 半徑」的膠囊體，構型由 solveFKLinkage / BranchTracker::observe 取得
+ *  (肘部座標在 FK 中本來就會算出，不增加成本)：
+ *    L1a: 左馬達 -> 左肘   L1b: 右馬達 -> 右肘   L2a: 左肘 -> 末端   L2b: 右肘 -> 末端
+ *  檢查項目 (結果為 CollisionFlag 的 OR)：
+ *    - LINK_LINK      ：不相鄰的連桿對 (L1a-L1b、L1a-L2b、L1b-L2a) 的膠囊相交
+ *    - FOLD           ：共用關節的連桿對 (左肘、右肘、末端) 夾角小於下限 (摺疊互相擠壓)；
+ *                       兩桿長度固定，夾角條件化成一次內積比較
+ *    - BASE           ：主動臂掃到另一顆馬達外殼，或從動臂掃到兩馬達 (與之間的底座)
+ *    - PAPER_HOLDER   ：任一連桿碰到壓紙條
+ *  check() 全部使用距離平方與外積比較，不需要除法或開根號 (約 30 次點-線段測試)，
+ *  可以每個控制 tick 執行；firstCollision() 以同一份程式碼批次檢查整條規劃好的關節軌跡。
+ */
+
+#ifndef COLLISION_CHECKER_HPP
+#define COLLISION_CHECKER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include "kinematics.hpp"
+
+// 碰撞旗標 (CollisionChecker::check)
+enum CollisionFlag : uint32_t {
+    COLLISION_LINK_LINK = 1u << 0,     // 不相鄰的兩連桿相交
+    COLLISION_FOLD = 1u << 1,          // 共用關節的兩連桿夾角過小
+    COLLISION_BASE = 1u << 2,          // 連桿撞到馬達 / 底座
+    COLLISION_PAPER_HOLDER = 1u << 3,  // 連桿撞到壓紙條
+    COLLISION_INVALID = 1u << 4,       // 構型無解 (FK 失敗，連桿斷裂)
+};
+
+/**
+ * @brief 膠囊體：線段 ab 外擴 radius
+ */
+struct Capsule {
+    Point2D a, b;
+    float radius;
+};
+
+/**
+ * @brief 碰撞模型 (通常由 CollisionChecker::fromSpec 產生)
+ */
+struct CollisionModel {
+    float link_radius;    // 連桿半寬 (mm)
+    float motor_radius;   // 馬達外殼半徑 (mm)，以兩馬達軸心為圓心
+    float fold_dot_l1l2;  // 肘部：(E->B)·(E->P) 超過此值即為夾角過小 (= cos(min) * L1 * L2)
+    float fold_dot_l2l2;  // 末端：(P->E1)·(P->E2) 的門檻 (= cos(min) * L2 * L2)
+    Capsule holder;       // 壓紙條 (radius <= 0 表示沒有)
+};
+
+class CollisionChecker {
+public:
+    explicit CollisionChecker(const CollisionModel& model) : _m(model) {}
+
+    /**
+     * @brief 由碰撞規格 (例如 DogArmCollisionSpec) 與幾何建立模型
+     * @note 需要 cos，只在初始化時呼叫
+     */
+    template <typename Spec>
+    static CollisionModel fromSpec(const FiveBarGeometry& geo) {
+        float cos_min = std::cos(Spec::MIN_FOLD_ANGLE_DEG * 0.0174532925f);
+        CollisionModel m;
+        m.link_radius = Spec::LINK_RADIUS;
+        m.motor_radius = Spec::MOTOR_RADIUS;
+        m.fold_dot_l1l2 = cos_min * geo.l1 * geo.l2;
+        m.fold_dot_l2l2 = cos_min * geo.l2 * geo.l2;
+        m.holder = {{Spec::HOLDER_X_MIN, Spec::HOLDER_Y}, {Spec::HOLDER_X_MAX, Spec::HOLDER_Y}, Spec::HOLDER_RADIUS};
+        return m;
+    }
+
+    /**
+     * @brief 檢查單一構型
+     * @return CollisionFlag 的 OR，0 表示無碰撞
+     */
+    uint32_t check(const LinkagePose& pose) const;
+
+    /**
+     * @brief 最小表面間距 (mm)：所有受檢的膠囊對中最近的一對，負值表示已穿透
+     * @note 需要開根號與除法，供離線工具 / 規劃評估餘裕使用 (不含 FOLD 項)
+     */
+    float clearance(const LinkagePose& pose) const;
+
+    /**
+     * @brief 批次檢查整條關節軌跡
+     * @param theta1, theta2 關節角 (Rad)，長度 n
+     * @param flags (可選) 輸出第一個碰撞點的旗標
+     * @return 第一個碰撞 (或 FK 無解) 的索引，全部通過時回傳 n
+     */
+    template <typename Kinematics>
+    size_t firstCollision(const Kinematics& kin, const float* theta1, const float* theta2, size_t n,
+                          uint32_t* flags = nullptr) const {
+        for (size_t i = 0; i < n; ++i) {
+            LinkagePose pose;
+            uint32_t f = kin.solveFKLinkage(theta1[i], theta2[i], &pose) ? check(pose) : COLLISION_INVALID;
+            if (f) {
+                if (flags) *flags = f;
+                return i;
+            }
+        }
+        if (flags) *flags = 0;
+        return n;
+    }
+
+    const CollisionModel& model() const { return _m; }
+
+private:
+    CollisionModel _m;
+};
+
+#endif // COLLISION_CHECKER_HPP
@@ -0,0 +1,69 @@
+/**
+ * @file feedrate_override.hpp
+ * @brief 進給率覆寫 (0 ~ 200%)：即時縮放執行中軌跡的時間軸
+ * @details
+ *  軌跡 (路徑插補、線段佇列、PVT 點、筆畫表) 都以自己的「軌跡時間」τ 定義。覆寫值 s 讓 τ 以 s 倍速前進：
+ *    dτ = s dt，幾何路徑不變，只有快慢改變；s = 0 時停在路徑上 (暫停)，恢復後從原處接續。
+ *  s 本身由 S 曲線產生器從目前值過渡到要求值 (速度 / 加速度 / 加加速度都有上限)，
+ *  因此設定點的加速度連續、加加速度有界。軌跡給出的是對 τ 的導數，換成實際時間 (鏈鎖律)：
+ *    θ'  = θ_τ s
+ *    θ'' = θ_ττ s² + θ_τ s'
+ *  換算後的速度 / 加速度前饋經關節產生器 sync() 交給 PositionController::update。
+ *  注意：加速度隨 s² 放大，200% 時為規劃值的 4 倍 —— 用在規劃得保守的簡單字形上。
+ */
+
+#ifndef FEEDRATE_OVERRIDE_HPP
+#define FEEDRATE_OVERRIDE_HPP
+
+#include "scurve_generator.hpp"
+#include "kinematic_feedforward.hpp"
+
+class FeedrateOverride {
+public:
+    static constexpr float MAX_SCALE = 2.0f;   // 200%
+    static constexpr float MAX_RATE = 1.0f;    // 1/s (每秒最多改變 100%)
+    static constexpr float MAX_ACCEL = 4.0f;   // 1/s²
+    static constexpr float MAX_JERK = 32.0f;   // 1/s³
+
+    FeedrateOverride() : _ramp(MAX_RATE, MAX_ACCEL, MAX_JERK) { _ramp.reset(1.0f); }
+
+    // 立即回到 100% (開機)
+    void reset() { _ramp.reset(1.0f); }
+
+    /**
+     * @brief 前進一個控制 tick，s 往 target 過渡
+     * @param target 要求的縮放 (1 = 100%)，超出 [0, MAX_SCALE] 時截斷
+     */
+    void update(float target, float dt) {
+        if (!(target >= 0.0f)) target = 0.0f;  // 含 NaN
+        if (target > MAX_SCALE) target = MAX_SCALE;
+        _ramp.update(target, dt);
+    }
+
+    // 目前的縮放 s 與其變化率 s' (1/s)
+    float scale() const { return _ramp.getPosition() > 0.0f ? _ramp.getPosition() : 0.0f; }
+    float rate() const { return _ramp.getVelocity(); }
+
+    // 本 tick 的軌跡時間 (s)
+    float trajectoryDt(float dt) const { return scale() * dt; }
+
+    // 對軌跡時間的導數 -> 對實際時間的導數
+    void apply(JointSetpoint* sp) const {
+        const float s = scale(), ds = rate();
+        sp->acc = sp->acc * s * s + sp->vel * ds;
+        sp->vel *= s;
+    }
+
+    void apply(CartesianState* st) const {
+        const float s = scale(), ds = rate();
+        st->acc.x = st->acc.x * s * s + st->vel.x * ds;
+        st->acc.y = st->acc.y * s * s + st->vel.y * ds;
+        st->vel.x *= s;
+        st->vel.y *= s;
+    }
+
+private:
+    SCurveGenerator _ramp;  // 位置 = s
+};
+
+#endif // FEEDRATE_OVERRIDE_HPP
@@ -0,0 +1,76 @@
+/**
+ * @file five_bar_geometry.hpp
+ * @brief 五連桿幾何參數與預先計算的衍生常數
+ * @details
+ *  FiveBarGeometry 是 constexpr 字面型別：建構時一次算好平方、倒數、可達範圍，
+ *  IK/FK 內不再重複計算 L1*L1、2*L1*dist 等。
+ *
+ *  兩種幾何來源 (BasicFiveBarKinematics 的 Geometry 樣板參數)：
+ *    RuntimeGeometry     : 執行期建構 (離線工具、校正求解器)
+ *    StaticGeometry<Spec>: 編譯期常數，Spec 提供 static constexpr float L1 / L2 / D，
+ *                          所有衍生常數在編譯期折疊，並以 static_assert 檢查幾何有效
+ */
+
+#ifndef FIVE_BAR_GEOMETRY_HPP
+#define FIVE_BAR_GEOMETRY_HPP
+
+struct FiveBarGeometry {
+    float l1;          // 主動臂長度 (連接馬達)
+    float l2;          // 從動臂長度 (連接末端)
+    float d;           // 兩馬達軸心間距
+
+    float l1_sq;       // L1^2
+    float l2_sq;       // L2^2
+    float k;           // L1^2 - L2^2 (餘弦定理分子常數項)
+    float inv_l1;      // 1 / L1
+    float inv_2l1;     // 1 / (2 * L1)
+    float reach_max;   // L1 + L2 (兩臂拉直)
+    float reach_min;   // |L1 - L2| (兩臂摺疊)
+    float two_l2;      // 2 * L2 (FK 雙圓有交點的肘距上限)
+
+    constexpr FiveBarGeometry(float l1_, float l2_, float d_)
+        : l1(l1_), l2(l2_), d(d_),
+          l1_sq(l1_ * l1_), l2_sq(l2_ * l2_), k(l1_ * l1_ - l2_ * l2_),
+          inv_l1(1.0f / l1_), inv_2l1(0.5f / l1_),
+          reach_max(l1_ + l2_), reach_min((l1_ > l2_) ? (l1_ - l2_) : (l2_ - l1_)),
+          two_l2(2.0f * l2_) {}
+
+    /**
+     * @brief 幾何是否可組裝
+     * @note 連桿長度為正、兩馬達不重疊，且兩馬達的可達環形區域必須有交集
+     */
+    constexpr bool isValid() const {
+        return l1 > 0.0f && l2 > 0.0f && d > 0.0f && d < 2.0f * reach_max;
+    }
+};
+
+/**
+ * @brief 執行期幾何：常數在建構時計算一次
+ */
+class RuntimeGeometry {
+public:
+    constexpr RuntimeGeometry(const FiveBarGeometry& g) : _g(g) {}
+
+    constexpr const FiveBarGeometry& get() const { return _g; }
+
+private:
+    FiveBarGeometry _g;
+};
+
+/**
+ * @brief 編譯期幾何：不佔物件空間，常數來自 Spec
+ * @tparam Spec 需提供 static constexpr float L1, L2, D
+ */
+template <typename Spec>
+class StaticGeometry {
+public:
+    static constexpr FiveBarGeometry value = FiveBarGeometry(Spec::L1, Spec::L2, Spec::D);
+    static_assert(value.isValid(), "Invalid five-bar geometry: check L1/L2/D in the Spec");
+
+    constexpr const FiveBarGeometry& get() const { return value; }
+};
+
+template <typename Spec>
+constexpr FiveBarGeometry StaticGeometry<Spec>::value;
+
+#endif // FIVE_BAR_GEOMETRY_HPP
@@ -0,0 +1,141 @@
+/**
+ * @file fixed_kinematics.hpp
+ * @brief 定點數 (Q 格式) 五連桿正逆運動學，供 Timer ISR 使用
+ * @details
+ *  ISR 內若使用 FPU，每次中斷都會觸發 lazy stacking (多存 S0-S15/FPSCR)，且 libm / 多項式的
+ *  執行時間會隨輸入變化。這個版本只用整數運算：
+ *    - 長度 Q16.16 mm (int32)：範圍 ±32767 mm，解析度 1.5e-5 mm
+ *    - 角度 Q3.28 rad (int32)：範圍 ±8 rad (θ = α + β 最大可到 2π，Q2.29 會溢位)，解析度 3.7e-9 rad
+ *    - atan2 / 向量長度：CORDIC vectoring；sin / cos：CORDIC rotation
+ *    - sqrt：逐位元整數開方 (固定 32 次迭代)
+ *    - 乘法使用 SMULL (32x32 -> 64)，完全沒有除法
+ *    - 中間長度 (肘距、交點距離) 以 Q20 保留，最後才捨入回 Q16
+ *  所有迴圈的次數都是常數，執行時間與輸入無關 (除了不可達時的提早返回)。
+ *
+ *  成本 (固定)：
+ *    solveIK = 4 次 CORDIC vectoring + 2 次 isqrt64
+ *    solveFK = 3 次 CORDIC rotation (sincos) + 1 次 CORDIC vectoring + 1 次 isqrt64
+ *  Cortex-M4 預估 (每次 CORDIC 迭代約 12 cycles、isqrt64 為 64 位元運算，每次迭代約 14 cycles)：
+ *    solveIK 約 2.1k cycles、solveFK 約 1.7k cycles (180 MHz 下約 12 us / 10 us)；
+ *  Host 端等價性檢查與時間分佈見 Tools/fixed_kinematics_check.cpp，實機請以 DWT->CYCCNT 確認。
+ *
+ *  API 與 FiveBarKinematics 相同 (solveIK / solveFK / geometry)，只是座標與角度改為定點型別。
+ */
+
+#ifndef FIXED_KINEMATICS_HPP
+#define FIXED_KINEMATICS_HPP
+
+#include <cstdint>
+#include "five_bar_geometry.hpp"
+
+// ==========================================================
+// Q 格式定義
+// ==========================================================
+typedef int32_t q16_t;  // Q16.16 長度 (mm)
+typedef int32_t q28_t;  // Q3.28  角度 (rad)
+
+namespace fixedpoint {
+
+static constexpr int LENGTH_FRAC_BITS = 16;
+static constexpr int ANGLE_FRAC_BITS = 28;
+static constexpr int UNIT_FRAC_BITS = 30;  // sin / cos 輸出 Q1.30
+
+static constexpr q28_t ANGLE_PI = 843314857;       // π * 2^28
+static constexpr q28_t ANGLE_HALF_PI = 421657428;  // π/2 * 2^28
+
+// 轉換 (僅供初始化與 Host 工具使用，ISR 內不應呼叫)
+constexpr q16_t toQ16(float mm) { return (q16_t)(mm * 65536.0f + (mm >= 0.0f ? 0.5f : -0.5f)); }
+constexpr float fromQ16(q16_t v) { return (float)v * (1.0f / 65536.0f); }
+constexpr q28_t toQ28(float rad) { return (q28_t)(rad * 268435456.0f + (rad >= 0.0f ? 0.5f : -0.5f)); }
+constexpr float fromQ28(q28_t v) { return (float)v * (1.0f / 268435456.0f); }
+
+// CORDIC 核心 (fixed_kinematics.cpp)
+/**
+ * @brief vectoring 模式：同時求 atan2(y, x) 與 sqrt(x^2 + y^2)
+ * @param x, y 任意定點格式 (兩者相同)，內部以 CLZ 正規化
+ * @param magnitude 輸出向量長度 (與輸入同格式)，可為 nullptr
+ * @return 角度 Q3.28，範圍 (-π, π]
+ */
+q28_t atan2(int64_t y, int64_t x, int64_t* magnitude);
+
+/**
+ * @brief rotation 模式：sin / cos (Q1.30)，輸入 |angle| < 8 rad
+ */
+void sincos(q28_t angle, int32_t* s, int32_t* c);
+
+/**
+ * @brief 64 位元整數開方 (固定 32 次迭代)
+ */
+uint32_t isqrt64(uint64_t v);
+
+} // namespace fixedpoint
+
+// ==========================================================
+// 定點數版本的資料型別 (對應 Point2D / MotorAngles)
+// ==========================================================
+struct Point2Q {
+    q16_t x;
+    q16_t y;
+};
+
+struct MotorAnglesQ {
+    q28_t theta1;
+    q28_t theta2;
+    bool is_reachable;
+};
+
+/**
+ * @brief 定點幾何常數 (由 FiveBarGeometry 在編譯期換算)
+ */
+struct FixedFiveBarGeometry {
+    q16_t l1;
+    q16_t l2;
+    q16_t d;
+    q16_t reach_max;
+    q16_t reach_min;
+    q16_t two_l2;
+    int64_t l2_sq;  // L2^2，Q32 (mm^2)
+
+    constexpr explicit FixedFiveBarGeometry(const FiveBarGeometry& g)
+        : l1(fixedpoint::toQ16(g.l1)), l2(fixedpoint::toQ16(g.l2)), d(fixedpoint::toQ16(g.d)),
+          reach_max(fixedpoint::toQ16(g.reach_max)), reach_min(fixedpoint::toQ16(g.reach_min)),
+          two_l2(fixedpoint::toQ16(g.two_l2)),
+          l2_sq((int64_t)fixedpoint::toQ16(g.l2) * fixedpoint::toQ16(g.l2)) {}
+};
+
+class FixedFiveBarKinematics {
+public:
+    /**
+     * @brief 建構子 (與 FiveBarKinematics 相同參數，單位 mm)
+     */
+    FixedFiveBarKinematics(float l1, float l2, float d)
+        : _geo(FiveBarGeometry(l1, l2, d)) {}
+
+    /**
+     * @brief 建構子 (編譯期幾何，例如 DogArmGeometry::value)
+     */
+    constexpr explicit FixedFiveBarKinematics(const FiveBarGeometry& geo)
+        : _geo(geo) {}
+
+    const FixedFiveBarGeometry& geometry() const { return _geo; }
+
+    /**
+     * @brief 逆向運動學 (IK): (x, y) -> (theta1, theta2)
+     * @param target 末端座標 (Q16.16 mm)
+     * @param solution_mode 手肘模式，同 FiveBarKinematics::solveIK
+     * @return 角度 (Q3.28 rad)
+     */
+    MotorAnglesQ solveIK(Point2Q target, int solution_mode = 1) const;
+
+    /**
+     * @brief 正向運動學 (FK): (theta1, theta2) -> (x, y)
+     * @param theta1, theta2 兩馬達角度 (Q3.28 rad)
+     * @return 末端座標 (Q16.16 mm，若無解返回 0,0)
+     */
+    Point2Q solveFK(q28_t theta1, q28_t theta2) const;
+
+private:
+    FixedFiveBarGeometry _geo;
+};
+
+#endif // FIXED_KINEMATICS_HPP
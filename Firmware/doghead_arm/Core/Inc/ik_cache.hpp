@@ -0,0 +1,211 @@
+/**
+ * @file ik_cache.hpp
+ * @brief 固定大小的 IK 記憶快取：以量化後的 (x, y) 為鍵，重複的筆畫目標不必重新求解
+ * @details
+ *  書法作業會反覆寫同樣的字與部首，同一批笛卡兒座標一再出現。IkCache 記住最近的解：
+ *    - 鍵：(round(x / resolution), round(y / resolution), mode)
+ *    - 開放定址 (linear probing)，每個鍵最多探查 MAX_PROBE 格；只會原地替換、不刪除，
+ *      所以沒有墓碑，查詢遇到空格即可停止
+ *    - 探查範圍內都滿時以 CLOCK (second chance) 挑選犧牲者：存入與命中時設定 referenced，
+ *      掃過時清除，第一個 referenced == 0 的格子被替換
+ *  誤差保證：每筆記錄存下求解時的精確目標點 p0 與 J^-1 的 Frobenius 範數 s (>= 譜範數)，
+ *    命中條件為 |p - p0| * s <= tolerance，一階近似下 |θ(p) - θ(p0)| <= tolerance；
+ *    p == p0 (完全重複的目標) 時直接回傳原本的解，與重新求解的結果完全相同。
+ *    量化鍵只決定「去哪裡找」，超出容許誤差的命中視為 miss 並原地更新。
+ *  不配置記憶體，也不依賴平台，MCU 控制迴圈與 Host 軌跡編譯器共用同一份程式碼。
+ *  命中率 / 速度數據見 Tools/ik_cache_bench.cpp
+ */
+
+#ifndef IK_CACHE_HPP
+#define IK_CACHE_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "kinematics.hpp"
+
+/**
+ * @tparam Kinematics BasicFiveBarKinematics 的任一實例 (例如 DogArmKinematics)
+ * @tparam Capacity 格數，需為 2 的冪次 (每格 32 bytes)
+ */
+template <typename Kinematics, uint32_t Capacity = 128>
+class IkCache {
+    static_assert(Capacity >= 8 && (Capacity & (Capacity - 1)) == 0, "IkCache capacity must be a power of two >= 8");
+
+public:
+    /**
+     * @param kin 運動學解算器 (需比本物件活得久)
+     * @param resolution_mm 量化鍵的格寬 (mm)
+     * @param tolerance_rad 命中時允許的最大關節角誤差 (Rad)
+     */
+    explicit IkCache(const Kinematics& kin, float resolution_mm = 0.05f, float tolerance_rad = 1e-4f)
+        : _kin(kin), _inv_resolution(1.0f / resolution_mm), _tol_sq(tolerance_rad * tolerance_rad) {
+        clear();
+    }
+
+    /**
+     * @brief 查詢快取
+     * @return 命中 (且在容許誤差內) 時回傳 true 並寫入 *out
+     */
+    bool lookup(Point2D target, int solution_mode, MotorAngles* out);
+
+    /**
+     * @brief 存入一筆解 (target 必須是 solution 的精確目標點)；不可達或逆向奇異的解不存
+     */
+    void insert(Point2D target, int solution_mode, const MotorAngles& solution);
+
+    /**
+     * @brief 查詢，miss 時以 solver(target, solution_mode) 求解並存入
+     * @param solver 回傳 MotorAngles 的可呼叫物件 (例如包裝 IncrementalIk::solve 的 lambda)
+     */
+    template <typename Solver>
+    MotorAngles solve(Point2D target, int solution_mode, Solver solver) {
+        MotorAngles result;
+        if (lookup(target, solution_mode, &result)) return result;
+        result = solver(target, solution_mode);
+        insert(target, solution_mode, result);
+        return result;
+    }
+
+    // miss 時使用封閉解 solveIK
+    MotorAngles solve(Point2D target, int solution_mode = 1) {
+        const Kinematics& kin = _kin;
+        return solve(target, solution_mode, [&kin](Point2D p, int mode) { return kin.solveIK(p, mode); });
+    }
+
+    // 清空所有記錄與統計 (幾何或校正改變後必須呼叫)
+    void clear() {
+        for (uint32_t i = 0; i < Capacity; ++i) _slots[i].used = 0;
+        _size = 0;
+        _hand = 0;
+        resetCounters();
+    }
+
+    // 統計 (遙測用)
+    uint32_t hits() const { return _hits; }
+    uint32_t misses() const { return _misses; }
+    uint32_t evictions() const { return _evictions; }
+    uint32_t size() const { return _size; }
+    static constexpr uint32_t capacity() { return Capacity; }
+    void resetCounters() { _hits = _misses = _evictions = 0; }
+
+private:
+    // 每個鍵的最大探查長度
+    static constexpr uint32_t MAX_PROBE = 8;
+
+    struct Entry {
+        int32_t kx, ky;         // 量化鍵
+        float x, y;             // 求解時的精確目標點 (mm)
+        float theta1, theta2;   // 解 (Rad)
+        float sensitivity;      // |J^-1|_F (rad/mm)
+        int8_t mode;            // 手肘模式
+        uint8_t referenced;     // CLOCK 參考位元
+        uint8_t used;
+    };
+
+    int32_t quantize(float v) const { return (int32_t)std::floor(v * _inv_resolution + 0.5f); }
+
+    static uint32_t home(int32_t kx, int32_t ky, int mode) {
+        uint32_t h = (uint32_t)kx * 0x9E3779B1u ^ (uint32_t)ky * 0x85EBCA77u ^ (uint32_t)(mode + 1) * 0xC2B2AE3Du;
+        h ^= h >> 15;
+        return h & (Capacity - 1);
+    }
+
+    // 命中條件：一階誤差 |p - p0| * |J^-1| <= tolerance
+    bool withinTolerance(const Entry& e, Point2D p) const {
+        float dx = p.x - e.x;
+        float dy = p.y - e.y;
+        return (dx * dx + dy * dy) * (e.sensitivity * e.sensitivity) <= _tol_sq;
+    }
+
+    const Kinematics& _kin;
+    float _inv_resolution;
+    float _tol_sq;
+
+    Entry _slots[Capacity];
+    uint32_t _size;
+    uint32_t _hand;  // CLOCK 起點輪替，避免總是替換探查範圍的第一格
+
+    uint32_t _hits;
+    uint32_t _misses;
+    uint32_t _evictions;
+};
+
+// ==========================================================
+// 樣板實作
+// ==========================================================
+
+template <typename Kinematics, uint32_t Capacity>
+bool IkCache<Kinematics, Capacity>::lookup(Point2D target, int mode, MotorAngles* out) {
+    const int32_t kx = quantize(target.x);
+    const int32_t ky = quantize(target.y);
+    uint32_t idx = home(kx, ky, mode);
+    for (uint32_t i = 0; i < MAX_PROBE; ++i, idx = (idx + 1) & (Capacity - 1)) {
+        Entry& e = _slots[idx];
+        if (!e.used) break;  // 只替換不刪除：空格之後不會有這個鍵
+        if (e.kx != kx || e.ky != ky || e.mode != mode) continue;
+        if (!withinTolerance(e, target)) break;
+        e.referenced = 1;
+        out->theta1 = e.theta1;
+        out->theta2 = e.theta2;
+        out->is_reachable = true;
+        _hits++;
+        return true;
+    }
+    _misses++;
+    return false;
+}
+
+template <typename Kinematics, uint32_t Capacity>
+void IkCache<Kinematics, Capacity>::insert(Point2D target, int mode, const MotorAngles& solution) {
+    if (!solution.is_reachable) return;
+    Jacobian2x2 inv_j = _kin.inverseJacobian(solution.theta1, solution.theta2);
+    if (!inv_j.is_valid) return;
+
+    const int32_t kx = quantize(target.x);
+    const int32_t ky = quantize(target.y);
+    const uint32_t start = home(kx, ky, mode);
+
+    // 1. 同一個鍵 (容許誤差外的舊記錄) 或空格
+    Entry* slot = nullptr;
+    uint32_t idx = start;
+    for (uint32_t i = 0; i < MAX_PROBE; ++i, idx = (idx + 1) & (Capacity - 1)) {
+        Entry& e = _slots[idx];
+        if (!e.used) {
+            slot = &e;
+            _size++;
+            break;
+        }
+        if (e.kx == kx && e.ky == ky && e.mode == mode) {
+            slot = &e;
+            break;
+        }
+    }
+
+    // 2. 探查範圍全滿：CLOCK 挑選犧牲者 (最多繞兩圈，第二圈必定找得到)
+    if (!slot) {
+        uint32_t offset = _hand++ % MAX_PROBE;
+        for (uint32_t i = 0; i < 2 * MAX_PROBE; ++i, offset = (offset + 1) % MAX_PROBE) {
+            Entry& e = _slots[(start + offset) & (Capacity - 1)];
+            if (!e.referenced) {
+                slot = &e;
+                break;
+            }
+            e.referenced = 0;
+        }
+        _evictions++;
+    }
+
+    slot->kx = kx;
+    slot->ky = ky;
+    slot->x = target.x;
+    slot->y = target.y;
+    slot->theta1 = solution.theta1;
+    slot->theta2 = solution.theta2;
+    slot->sensitivity = std::sqrt(inv_j.m11 * inv_j.m11 + inv_j.m12 * inv_j.m12 +
+                                  inv_j.m21 * inv_j.m21 + inv_j.m22 * inv_j.m22);
+    slot->mode = (int8_t)mode;
+    slot->referenced = 1;  // 新記錄先給一次機會 (與 CLOCK 載入分頁相同)
+    slot->used = 1;
+}
+
+#endif // IK_CACHE_HPP
@@ -0,0 +1,64 @@
+/**
+ * @file ik_lookup_grid.hpp
+ * @brief 查表式逆運動學：書寫區預先算好的 (theta1, theta2) 網格 + 雙線性內插
+ * @details
+ *  - 網格由 Host 工具 Tools/ik_grid_gen 以 FiveBarKinematics::solveIK 產生，
+ *    輸出 Core/Src/ik_grid_table.cpp (const 陣列，放在 Flash)
+ *  - 角度以 int16 定點儲存：theta = offset + raw * angle_lsb，
+ *    每個關節各自一個 offset，讓書寫區內的角度範圍不跨越 int16 邊界
+ *  - 每次查表：4 個 int16 讀取 + 3 次線性內插，沒有任何超越函數
+ */
+
+#ifndef IK_LOOKUP_GRID_HPP
+#define IK_LOOKUP_GRID_HPP
+
+#include <cstdint>
+#include "kinematics.hpp"
+
+/**
+ * @brief 網格表格描述 (由產生器輸出)
+ */
+struct IkGridTable {
+    float x_min;            // 第 0 欄的 X 座標 (mm)
+    float y_min;            // 第 0 列的 Y 座標 (mm)
+    float step;             // 格距 (mm)
+    float inv_step;         // 1 / 格距
+    uint16_t nx;            // X 方向節點數
+    uint16_t ny;            // Y 方向節點數
+    float angle_lsb;        // 每個 LSB 對應的角度 (Rad)
+    float theta1_offset;    // theta1 的零點 (Rad)
+    float theta2_offset;    // theta2 的零點 (Rad)
+    float max_error;        // 產生器量測到的最大內插誤差 (Rad)
+    const int16_t* theta1;  // [ny][nx]，列優先
+    const int16_t* theta2;  // [ny][nx]
+};
+
+class IkLookupGrid {
+public:
+    explicit IkLookupGrid(const IkGridTable& table) : _t(table) {}
+
+    /**
+     * @brief 目標點是否落在網格範圍內
+     */
+    bool contains(Point2D p) const {
+        float fx = (p.x - _t.x_min) * _t.inv_step;
+        float fy = (p.y - _t.y_min) * _t.inv_step;
+        return fx >= 0.0f && fy >= 0.0f && fx <= (float)(_t.nx - 1) && fy <= (float)(_t.ny - 1);
+    }
+
+    /**
+     * @brief 查表 IK (雙線性內插)
+     * @return 網格外的點回傳 is_reachable = false，呼叫端應改用解析解
+     */
+    MotorAngles lookup(Point2D p) const;
+
+    const IkGridTable& table() const { return _t; }
+
+private:
+    const IkGridTable& _t;
+};
+
+// 產生的書寫區網格 (Core/Src/ik_grid_table.cpp)
+extern const IkGridTable IK_GRID_DOGARM;
+
+#endif // IK_LOOKUP_GRID_HPP
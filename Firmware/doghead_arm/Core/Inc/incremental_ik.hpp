@@ -0,0 +1,172 @@
+/**
+ * @file incremental_ik.hpp
+ * @brief 熱啟動增量逆運動學：以上一個 tick 的解為初值做牛頓修正
+ * @details
+ *  1kHz 控制迴圈中相鄰兩個目標點只差數 µm，逐次從頭解 IK 相當浪費。
+ *  IncrementalIk 保存上一次的 (θ, sin/cos θ, P, J^-1)：
+ *    1. Δθ = J^-1(θ_prev) * (target - P_prev)
+ *    2. sin/cos 以小角度旋轉更新 (|Δθ| 很小時 3 階泰勒展開已達 float 精度，不必重算 sincos)，
+ *       每 TRIG_RESYNC_PERIOD 次或 |Δθ| 過大時才重新呼叫 Math::sincos，避免捨入誤差累積
+ *    3. 以 solveFKWithInverseJacobian(trig) 取得新的 P 與 J^-1 (下一步 / 下一個 tick 直接沿用)
+ *    4. 殘差 |target - P| <= tol 即接受，否則再迭代一次 (最多 max_iterations 次)
+ *  以下情況退回封閉解 solveIK 並重新播種：
+ *    - 尚未初始化 / reset() 之後
+ *    - 目標跳動超過 max_step (例如抬筆移到下一筆畫)
+ *    - 逆雅可比失效 (接近逆向奇異) 或迭代後殘差仍超過 tol
+ *    - 迭代結果的手肘模式與要求的 solution_mode 不同 (穿越奇異點換了組裝分支)
+ *  牛頓法本身是局部的，只要每步都通過上述模式檢查，手肘組裝模式就會自動保持一致。
+ *
+ *  每次牛頓步的成本 = 1 次構型求解 (1 sqrt + 3 除法，無超越函數)，
+ *  封閉解為 2 atan2 + 2 acos + 2 sqrt；比較數據見 Tools/incremental_ik_bench.cpp
+ */
+
+#ifndef INCREMENTAL_IK_HPP
+#define INCREMENTAL_IK_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "kinematics.hpp"
+
+/**
+ * @tparam Kinematics BasicFiveBarKinematics 的任一實例 (例如 DogArmKinematics)
+ */
+template <typename Kinematics>
+class IncrementalIk {
+public:
+    /**
+     * @param kin 運動學解算器 (需比本物件活得久)
+     * @param max_step_mm 目標跳動超過此距離直接用封閉解 (mm)
+     * @param tol_mm 牛頓迭代可接受的末端殘差 (mm)
+     * @param max_iterations 每個 tick 最多的牛頓步數
+     */
+    explicit IncrementalIk(const Kinematics& kin, float max_step_mm = 1.0f,
+                           float tol_mm = 1e-3f, int max_iterations = 2)
+        : _kin(kin), _max_step_sq(max_step_mm * max_step_mm), _tol_sq(tol_mm * tol_mm),
+          _max_iterations(max_iterations), _valid(false), _mode(1), _trig_age(0),
+          _newton_count(0), _fallback_count(0) {}
+
+    /**
+     * @brief 求解 IK (語意同 Kinematics::solveIK)
+     */
+    MotorAngles solve(Point2D target, int solution_mode = 1);
+
+    // 清除熱啟動狀態 (下一次呼叫必定走封閉解)
+    void reset() { _valid = false; }
+
+    // 統計：牛頓路徑 / 封閉解路徑的呼叫次數
+    uint32_t newtonCount() const { return _newton_count; }
+    uint32_t fallbackCount() const { return _fallback_count; }
+
+private:
+    // 小角度旋轉的適用範圍 (rad)：0.05^4 / 24 = 2.6e-7，與 FastMath sincos 誤差同級
+    static constexpr float SMALL_ANGLE = 0.05f;
+    // 每隔多少次增量更新重新精確計算 sin/cos
+    static constexpr uint32_t TRIG_RESYNC_PERIOD = 64;
+
+    MotorAngles closedForm(Point2D target, int solution_mode);
+
+    // (s, c) 旋轉 d：sin(θ+d) = s cos d + c sin d, cos(θ+d) = c cos d - s sin d
+    static void rotate(float* s, float* c, float d) {
+        float d2 = d * d;
+        float sd = d * (1.0f - d2 * (1.0f / 6.0f));
+        float cd = 1.0f - 0.5f * d2;
+        float s0 = *s;
+        *s = s0 * cd + *c * sd;
+        *c = *c * cd - s0 * sd;
+    }
+
+    const Kinematics& _kin;
+    float _max_step_sq;
+    float _tol_sq;
+    int _max_iterations;
+
+    // 熱啟動狀態
+    bool _valid;
+    int _mode;
+    float _theta1, _theta2;  // 上一次的解 (Rad)
+    JointTrig _trig;         // sin/cos(_theta1, _theta2)
+    uint32_t _trig_age;      // 距離上次精確計算 sin/cos 的增量次數
+    Point2D _end;            // FK(_theta1, _theta2)
+    Jacobian2x2 _inv_j;      // J^-1(_theta1, _theta2)
+
+    uint32_t _newton_count;
+    uint32_t _fallback_count;
+};
+
+// ==========================================================
+// 樣板實作
+// ==========================================================
+
+template <typename Kinematics>
+MotorAngles IncrementalIk<Kinematics>::solve(Point2D target, int solution_mode) {
+    if (_valid && solution_mode == _mode) {
+        float ex = target.x - _end.x;
+        float ey = target.y - _end.y;
+
+        if (ex * ex + ey * ey <= _max_step_sq) {
+            float t1 = _theta1;
+            float t2 = _theta2;
+            JointTrig trig = _trig;
+            uint32_t age = _trig_age;
+            Jacobian2x2 inv_j = _inv_j;
+
+            for (int i = 0; i < _max_iterations && inv_j.is_valid; ++i) {
+                float d1 = inv_j.m11 * ex + inv_j.m12 * ey;
+                float d2 = inv_j.m21 * ex + inv_j.m22 * ey;
+                t1 += d1;
+                t2 += d2;
+
+                if (++age >= TRIG_RESYNC_PERIOD || std::fabs(d1) > SMALL_ANGLE || std::fabs(d2) > SMALL_ANGLE) {
+                    trig = Kinematics::jointTrig(t1, t2);
+                    age = 0;
+                } else {
+                    rotate(&trig.s1, &trig.c1, d1);
+                    rotate(&trig.s2, &trig.c2, d2);
+                }
+
+                int mode;
+                Point2D p = _kin.solveFKWithInverseJacobian(trig, &inv_j, &mode);
+                if (mode != solution_mode) break;  // 換了組裝分支
+
+                ex = target.x - p.x;
+                ey = target.y - p.y;
+                if (ex * ex + ey * ey <= _tol_sq && inv_j.is_valid) {
+                    _theta1 = t1;
+                    _theta2 = t2;
+                    _trig = trig;
+                    _trig_age = age;
+                    _end = p;
+                    _inv_j = inv_j;
+                    _newton_count++;
+
+                    MotorAngles result = {t1, t2, true};
+                    return result;
+                }
+            }
+        }
+    }
+
+    return closedForm(target, solution_mode);
+}
+
+template <typename Kinematics>
+MotorAngles IncrementalIk<Kinematics>::closedForm(Point2D target, int solution_mode) {
+    _fallback_count++;
+    MotorAngles result = _kin.solveIK(target, solution_mode);
+    if (!result.is_reachable) {
+        _valid = false;
+        return result;
+    }
+
+    // 重新播種：存下封閉解對應的 FK 與 J^-1，下一個 tick 從這裡開始迭代
+    _theta1 = result.theta1;
+    _theta2 = result.theta2;
+    _trig = Kinematics::jointTrig(result.theta1, result.theta2);
+    _trig_age = 0;
+    _end = _kin.solveFKWithInverseJacobian(_trig, &_inv_j);
+    _mode = solution_mode;
+    _valid = _inv_j.is_valid;
+    return result;
+}
+
+#endif // INCREMENTAL_IK_HPP
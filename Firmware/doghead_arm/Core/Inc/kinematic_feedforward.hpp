@@ -0,0 +1,78 @@
+/**
+ * @file kinematic_feedforward.hpp
+ * @brief 運動學前饋：笛卡兒位置 / 速度 / 加速度 -> 關節位置 / 速度 / 加速度
+ * @details
+ *  原本 TrajectoryPlanner 對 IK 輸出做差分再經 alpha = 0.7 低通，前饋會延遲一個 tick 且被衰減。
+ *  路徑產生器已知末端的速度與加速度時，直接用微分運動學換算：
+ *    θ   = IK(p)                        (IncrementalIk，熱啟動牛頓修正)
+ *    θ'  = J^-1 * v
+ *    θ'' = J^-1 * (a - J' * θ')         (BasicFiveBarKinematics::jointRates)
+ *  輸出單位為 Degree / Deg/s / Deg/s²，可直接餵給 PositionController::update。
+ */
+
+#ifndef KINEMATIC_FEEDFORWARD_HPP
+#define KINEMATIC_FEEDFORWARD_HPP
+
+#include "kinematics.hpp"
+#include "incremental_ik.hpp"
+
+/**
+ * @brief 末端的運動狀態 (路徑產生器的輸出)
+ */
+struct CartesianState {
+    Point2D pos;  // mm
+    Point2D vel;  // mm/s
+    Point2D acc;  // mm/s²
+};
+
+/**
+ * @brief 單一關節的 PID 設定點 (Degree 單位，對應 PositionController::update 的參數)
+ */
+struct JointSetpoint {
+    float pos;  // Degree
+    float vel;  // Deg/s
+    float acc;  // Deg/s²
+};
+
+template <typename Kinematics>
+class KinematicFeedforward {
+public:
+    /**
+     * @param kin 運動學解算器 (提供 jointRates)
+     * @param ik  位置解算 (與控制迴圈其他路徑共用同一個熱啟動狀態)
+     */
+    KinematicFeedforward(const Kinematics& kin, IncrementalIk<Kinematics>& ik)
+        : _kin(kin), _ik(ik) {}
+
+    /**
+     * @brief 換算一個 tick 的關節設定點
+     * @param state 末端狀態
+     * @param joint1, joint2 輸出設定點 (Degree)
+     * @return 不可達時回傳 false (輸出不變)；接近逆向奇異時位置照常輸出，速度 / 加速度前饋為 0
+     */
+    bool update(const CartesianState& state, JointSetpoint* joint1, JointSetpoint* joint2,
+                int solution_mode = 1) {
+        MotorAngles q = _ik.solve(state.pos, solution_mode);
+        if (!q.is_reachable) return false;
+
+        JointRates r = _kin.jointRates(q.theta1, q.theta2, state.vel, state.acc);
+        if (!r.is_valid) {
+            r.vel1 = r.vel2 = 0.0f;
+            r.acc1 = r.acc2 = 0.0f;
+        }
+
+        joint1->pos = Kinematics::rad2deg(q.theta1);
+        joint1->vel = Kinematics::rad2deg(r.vel1);
+        joint1->acc = Kinematics::rad2deg(r.acc1);
+        joint2->pos = Kinematics::rad2deg(q.theta2);
+        joint2->vel = Kinematics::rad2deg(r.vel2);
+        joint2->acc = Kinematics::rad2deg(r.acc2);
+        return true;
+    }
+
+private:
+    const Kinematics& _kin;
+    IncrementalIk<Kinematics>& _ik;
+};
+
+#endif // KINEMATIC_FEEDFORWARD_HPP
@@ -1,12 +1,19 @@
 /**
  * @file kinematics.hpp
  * @brief 平面五連桿機構 正逆運動學解算器
+ * @details 以 MathPolicy 樣板參數切換 libm (PreciseMath) 與多項式近似 (FastMath)，
+ *          Geometry 樣板參數切換執行期幾何 (RuntimeGeometry) 與編譯期幾何 (StaticGeometry<Spec>)。
+ *          FiveBarKinematics / FastFiveBarKinematics 為執行期幾何的兩種常用實例
  */
 
 #ifndef KINEMATICS_HPP
 #define KINEMATICS_HPP
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "kinematics_math.hpp"
+#include "five_bar_geometry.hpp"
 
 struct Point2D {
     float x;
@@ -19,16 +26,104 @@ struct MotorAngles {
     bool is_reachable; // 是否在工作範圍內
 };
 
-class FiveBarKinematics {
+/**
+ * @brief 2x2 微分運動學矩陣
+ * @note jacobian():        [dx/dθ1 dx/dθ2; dy/dθ1 dy/dθ2]  (mm/rad)
+ *       inverseJacobian(): [dθ1/dx dθ1/dy; dθ2/dx dθ2/dy]  (rad/mm)
+ */
+struct Jacobian2x2 {
+    float m11, m12;
+    float m21, m22;
+    bool is_valid; // 位於對應的奇異構型 (矩陣發散) 時為 false
+};
+
+/**
+ * @brief 關節角速度 / 角加速度 (微分運動學前饋的輸出)
+ */
+struct JointRates {
+    float vel1, vel2;  // dθ/dt (Rad/s)
+    float acc1, acc2;  // d²θ/dt² (Rad/s²)
+    bool is_valid;     // 逆向奇異 (J^-1 發散) 或構型無解時為 false
+};
+
+/**
+ * @brief 兩個關節角的 sin / cos (FK 唯一需要的超越函數結果)
+ */
+struct JointTrig {
+    float s1, c1;
+    float s2, c2;
+};
+
+/**
+ * @brief IK 中與分支無關的部分：各臂的方位角 α 與肘部夾角 β (Rad)
+ * @details 左臂 θ1 = αL ± βL，右臂 θ2 = αR ∓ βR；solveIK 的 mode 1 取上面的符號。
+ *          兩臂的手肘方向 (工作模式) 可以各自選擇，共 4 種組合
+ */
+struct ArmAngles {
+    float alpha_L, beta_L;
+    float alpha_R, beta_R;
+    bool is_reachable;
+};
+
+/**
+ * @brief FK 的兩個組裝模式 (以兩肘為圓心、半徑 L2 的雙圓交點)
+ */
+struct FkAssemblies {
+    Point2D elbow1, elbow2;
+    Point2D assembly_pos;  // 位於 E1 -> E2 左側 (det A > 0)，書寫區內的正常組裝
+    Point2D assembly_neg;  // 另一個交點 (det A < 0)
+};
+
+/**
+ * @brief 完整構型：兩馬達軸心、兩肘與末端 (碰撞檢查使用)
+ */
+struct LinkagePose {
+    Point2D base1, base2;    // 馬達軸心 (0, 0)、(D, 0)
+    Point2D elbow1, elbow2;
+    Point2D end;
+};
+
+// ==========================================================
+// 批次解算核心 (kinematics.cpp)
+// ==========================================================
+// 與 MathPolicy 無關：SIMD 核心一律使用 vector_math.hpp 的多項式
+namespace kinematics_batch {
+void solveIK(const FiveBarGeometry& geo,
+             const float* x, const float* y,
+             float* theta1, float* theta2, uint32_t* reachable,
+             size_t n, int solution_mode);
+void solveFK(const FiveBarGeometry& geo,
+             const float* theta1, const float* theta2,
+             float* x, float* y, size_t n);
+} // namespace kinematics_batch
+
+/**
+ * @brief 五連桿正逆運動學
+ * @tparam MathPolicy 數學策略 (PreciseMath / FastMath，見 kinematics_math.hpp)
+ * @tparam Geometry   幾何來源 (RuntimeGeometry / StaticGeometry<Spec>，見 five_bar_geometry.hpp)
+ */
+template <typename MathPolicy, typename Geometry = RuntimeGeometry>
+class BasicFiveBarKinematics {
 public:
+    typedef MathPolicy Math;
+
     /**
-     * @brief 建構子
+     * @brief 建構子 (執行期幾何)
      * @param l1 主動臂長度 (連接馬達的短臂)
      * @param l2 從動臂長度 (連接末端的長臂)
      * @param d  兩馬達軸心間距
      */
-    FiveBarKinematics(float l1, float l2, float d)
-        : L1(l1), L2(l2), D(d) {}
+    BasicFiveBarKinematics(float l1, float l2, float d)
+        : _geo(FiveBarGeometry(l1, l2, d)) {}
+
+    /**
+     * @brief 建構子 (編譯期幾何 StaticGeometry<Spec> 不需任何參數)
+     */
+    explicit BasicFiveBarKinematics(const Geometry& geo = Geometry())
+        : _geo(geo) {}
+
+    // 幾何參數與衍生常數
+    const FiveBarGeometry& geometry() const { return _geo.get(); }
 
     /**
      * @brief 逆向運動學 (IK): (x, y) -> (theta1, theta2)
@@ -36,21 +131,432 @@ public:
      * @param solution_mode 手肘模式 (1: 手肘向外/上, -1: 手肘向內/下) -> 書法機通常選 1
      * @return 計算出的角度
      */
-    MotorAngles solveIK(Point2D target, int solution_mode = 1);
+    MotorAngles solveIK(Point2D target, int solution_mode = 1) const;
+
+    /**
+     * @brief IK 的分支無關部分 (α, β)，呼叫端自行決定每個手臂的手肘方向
+     * @note 成本與 solveIK 相同；solveIK 即為此函式 + 固定的手肘方向
+     */
+    ArmAngles solveArmAngles(Point2D target) const;
 
     /**
      * @brief 正向運動學 (FK): (theta1, theta2) -> (x, y)
      * @param angles 兩馬達角度 (Rad)
      * @return 末端座標 (若無解返回 0,0)
+     * @note 兩個交點中固定取 det A > 0 的一個，除非它的 Y < 0；
+     *       需要依照連續性選擇組裝模式時請改用 solveFKAssemblies (見 branch_tracker.hpp)
+     */
+    Point2D solveFK(float theta1, float theta2) const;
+
+    /**
+     * @brief FK 並輸出所有關節與肘部座標 (與 solveFK 同成本，組裝模式的選法也相同)
+     * @return 構型無解時回傳 false (pose->end 為 (0, 0))
+     */
+    bool solveFKLinkage(const JointTrig& trig, LinkagePose* pose) const;
+
+    bool solveFKLinkage(float theta1, float theta2, LinkagePose* pose) const {
+        return solveFKLinkage(jointTrig(theta1, theta2), pose);
+    }
+
+    /**
+     * @brief 兩個組裝模式的 FK 解一次算完 (與 solveFK 同成本)
+     * @return 構型無解 (肘距 > 2 * L2 或兩肘重合) 時回傳 false
+     */
+    bool solveFKAssemblies(const JointTrig& trig, FkAssemblies* out) const;
+
+    // ------------------------------------------------------
+    // 微分運動學 (與 solveFK 共用肘部座標，封閉解)
+    // ------------------------------------------------------
+    // 由 |P - E1| = |P - E2| = L2 對時間微分：
+    //   A * dP = B * dθ,  A = [u1^T; u2^T],  B = diag(u1·dE1/dθ1, u2·dE2/dθ2),  ui = P - Ei
+    //   J = A^-1 * B,  J^-1 = B^-1 * A
+    //   det(A) = 0 -> 從動臂共線 (正向奇異，J 發散)
+    //   B_ii = 0   -> 主/從動臂拉直或摺疊 (逆向奇異，J^-1 發散)
+
+    /**
+     * @brief 雅可比矩陣 dP/dθ (mm/rad)
+     */
+    Jacobian2x2 jacobian(float theta1, float theta2) const;
+
+    /**
+     * @brief 逆雅可比矩陣 dθ/dP (rad/mm)，前饋可直接用 θ' = J^-1 * v
      */
-    Point2D solveFK(float theta1, float theta2);
+    Jacobian2x2 inverseJacobian(float theta1, float theta2) const;
+
+    /**
+     * @brief 可操作度 (Yoshikawa) w = |det J| (mm^2/rad^2)
+     * @return 無解或正向奇異時回傳 0
+     */
+    float manipulability(float theta1, float theta2) const;
+
+    /**
+     * @brief 與奇異構型的距離 (0 = 奇異, 1 = 最佳)
+     * @details min(|sin φ1|, |sin φ2|, |sin ψ|)，φi 為第 i 臂主/從動臂夾角，
+     *          ψ 為兩從動臂夾角；與長度單位無關，可直接當作減速比例
+     */
+    float singularityDistance(float theta1, float theta2) const;
+
+    /**
+     * @brief 末端速度 / 加速度 -> 關節角速度 / 角加速度 (封閉解，只解一次構型)
+     * @param velocity 末端速度 (mm/s)
+     * @param acceleration 末端加速度 (mm/s²)
+     * @details θ' = J^-1 * v，θ'' = J^-1 * (a - J' * θ')；
+     *          J' 不另外組出來，直接對約束 |P - Ei|^2 = L2^2 微分兩次：
+     *            bi * θi'' = ui · a + |v - Ei'|^2 + L1 * θi'^2 * (ui · (cos θi, sin θi))
+     */
+    JointRates jointRates(float theta1, float theta2, Point2D velocity, Point2D acceleration) const;
+
+    /**
+     * @brief FK 與逆雅可比一次算完 (只解一次構型)，供牛頓迭代使用
+     * @param inv_jacobian 輸出 dθ/dP；逆向奇異時 is_valid = false
+     * @param solution_mode (可選) 輸出此構型對應的 IK 手肘模式 (1 / -1)，
+     *                      兩臂模式不一致 (solveIK 無法產生的構型) 時為 0
+     * @return 末端座標，構型無解時回傳 (0, 0) 且 inv_jacobian->is_valid = false
+     */
+    Point2D solveFKWithInverseJacobian(const JointTrig& trig, Jacobian2x2* inv_jacobian,
+                                       int* solution_mode = nullptr) const;
+
+    Point2D solveFKWithInverseJacobian(float theta1, float theta2, Jacobian2x2* inv_jacobian,
+                                       int* solution_mode = nullptr) const {
+        return solveFKWithInverseJacobian(jointTrig(theta1, theta2), inv_jacobian, solution_mode);
+    }
+
+    /**
+     * @brief 計算兩關節角的 sin / cos (呼叫端可自行增量更新後傳給上面的 JointTrig 版本)
+     */
+    static JointTrig jointTrig(float theta1, float theta2) {
+        JointTrig t;
+        Math::sincos(theta1, &t.s1, &t.c1);
+        Math::sincos(theta2, &t.s2, &t.c2);
+        return t;
+    }
+
+    /**
+     * @brief 批次逆向運動學 (SoA): x[], y[] -> theta1[], theta2[]
+     * @param x, y 末端座標陣列 (長度 n)
+     * @param theta1, theta2 輸出角度陣列 (Rad)，不可達的點輸出 0
+     * @param reachable 可達位元遮罩：第 i 點對應 reachable[i / 32] 的第 (i % 32) 位元，
+     *                  長度需為 reachableMaskWords(n)
+     * @param n 點數
+     * @param solution_mode 手肘模式，同 solveIK
+     * @note Host (x86) 使用 SSE2/AVX 一次處理 4/8 點；Cortex-M4 使用單精度 FPU 多項式逐點計算。
+     *       三角函數為多項式近似 (見 vector_math.hpp)：工作區內精度與 solveIK 相同 (~5e-7 rad)，
+     *       只有在兩臂接近拉直/摺疊的邊界 (acos 病態) 差異會到 2e-5 rad
+     */
+    void solveIKBatch(const float* x, const float* y,
+                      float* theta1, float* theta2, uint32_t* reachable,
+                      size_t n, int solution_mode = 1) const {
+        kinematics_batch::solveIK(geometry(), x, y, theta1, theta2, reachable, n, solution_mode);
+    }
+
+    /**
+     * @brief 批次正向運動學 (SoA): theta1[], theta2[] -> x[], y[]
+     * @note 無解的構型輸出 (0, 0)，與 solveFK 相同
+     */
+    void solveFKBatch(const float* theta1, const float* theta2,
+                      float* x, float* y, size_t n) const {
+        kinematics_batch::solveFK(geometry(), theta1, theta2, x, y, n);
+    }
+
+    // 批次 IK 可達遮罩所需的 uint32_t 個數
+    static constexpr size_t reachableMaskWords(size_t n) { return (n + 31) / 32; }
 
     // 輔助：角度轉換
     static float deg2rad(float deg) { return deg * 0.0174532925f; }
     static float rad2deg(float rad) { return rad * 57.2957795f; }
 
 private:
-    float L1, L2, D;
+
+    // 微分運動學共用項：A 的兩列 (u1, u2) 與 B 的對角 (b1, b2)
+    struct DiffTerms {
+        float u1x, u1y, u2x, u2y;
+        float b1, b2;
+        float det_a;
+        Point2D end;
+    };
+    bool diffTerms(const JointTrig& trig, DiffTerms* t) const;
+    Jacobian2x2 invertTerms(const DiffTerms& t) const;
+
+    // 奇異判斷門檻 (正規化 sin 值)
+    static constexpr float SINGULAR_EPS = 1e-4f;
+
+    // 輔助函式：限制 acos 輸入範圍，避免 NaN
+    static float clip(float n, float lower, float upper) {
+        return std::fmax(lower, std::fmin(n, upper));
+    }
+
+    Geometry _geo;
 };
 
+// 精確版 (libm)，離線工具與驗證使用
+typedef BasicFiveBarKinematics<PreciseMath> FiveBarKinematics;
+// 快速版 (多項式近似)，1kHz 控制迴圈使用
+typedef BasicFiveBarKinematics<FastMath> FastFiveBarKinematics;
+
+// ==========================================================
+// 樣板實作
+// ==========================================================
+
+template <typename MathPolicy, typename Geometry>
+ArmAngles BasicFiveBarKinematics<MathPolicy, Geometry>::solveArmAngles(Point2D P) const {
+    const FiveBarGeometry& G = geometry();
+    ArmAngles result = {0, 0, 0, 0, false};
+
+    // --- 1. 左臂 ---
+    // 以左馬達 (0,0) 為原點，目標 P(x,y)
+    float dist_L = Math::sqrt(P.x * P.x + P.y * P.y);
+
+    // 檢查是否超出範圍 (兩臂拉直或摺疊)
+    if (dist_L > G.reach_max || dist_L < G.reach_min) {
+        return result; // Unreachable
+    }
+
+    // 餘弦定理求內角
+    // L2^2 = L1^2 + dist^2 - 2*L1*dist*cos(beta)
+    // -> cos(beta) = (L1^2 - L2^2 + dist^2) / (2*L1) / dist
+    result.alpha_L = Math::atan2(P.y, P.x);
+    float cos_beta_L = (G.k + dist_L * dist_L) * G.inv_2l1 / dist_L;
+    result.beta_L = Math::acos(clip(cos_beta_L, -1.0f, 1.0f));
+
+    // --- 2. 右臂 ---
+    // 以右馬達 (D,0) 為原點，將 P 轉換到右馬達座標系 -> P'(x-D, y)
+    float x_R = P.x - G.d;
+    float y_R = P.y;
+    float dist_R = Math::sqrt(x_R * x_R + y_R * y_R);
+
+    if (dist_R > G.reach_max || dist_R < G.reach_min) {
+        return result; // Unreachable
+    }
+
+    result.alpha_R = Math::atan2(y_R, x_R);
+    float cos_beta_R = (G.k + dist_R * dist_R) * G.inv_2l1 / dist_R;
+    result.beta_R = Math::acos(clip(cos_beta_R, -1.0f, 1.0f));
+
+    result.is_reachable = true;
+    return result;
+}
+
+template <typename MathPolicy, typename Geometry>
+MotorAngles BasicFiveBarKinematics<MathPolicy, Geometry>::solveIK(Point2D P, int mode) const {
+    MotorAngles result;
+    result.is_reachable = false;
+    result.theta1 = 0;
+    result.theta2 = 0;
+
+    ArmAngles arm = solveArmAngles(P);
+    if (!arm.is_reachable) return result;
+
+    // mode 決定手肘是向左彎還是向右彎 (通常取 +)
+    result.theta1 = arm.alpha_L + (float)mode * arm.beta_L;
+
+    // 右臂的手肘方向通常與左臂相反 (對稱)，所以這裡是 alpha - beta
+    // 但具體取決於你的 mode 定義，這裡假設 mode=1 是 "手肘皆向外"
+    result.theta2 = arm.alpha_R - (float)mode * arm.beta_R;
+
+    result.is_reachable = true;
+    return result;
+}
+
+template <typename MathPolicy, typename Geometry>
+bool BasicFiveBarKinematics<MathPolicy, Geometry>::solveFKAssemblies(const JointTrig& trig, FkAssemblies* out) const {
+    const FiveBarGeometry& G = geometry();
+
+    // 1. 算出兩個肘部 (Elbow) 座標
+    float E1_x = G.l1 * trig.c1;
+    float E1_y = G.l1 * trig.s1;
+
+    float E2_x = G.d + G.l1 * trig.c2;
+    float E2_y = G.l1 * trig.s2;
+
+    out->elbow1 = {E1_x, E1_y};
+    out->elbow2 = {E2_x, E2_y};
+
+    // 2. 求兩個圓的交點 (以 E1, E2 為圓心，半徑皆為 L2)
+    // 這是經典的雙圓交點問題
+    float dx = E2_x - E1_x;
+    float dy = E2_y - E1_y;
+    float d2 = dx * dx + dy * dy;
+
+    // 檢查是否有解
+    if (d2 > G.two_l2 * G.two_l2 || d2 == 0) {
+        out->assembly_pos = {0, 0}; // 構型錯誤 (斷裂或重疊)
+        out->assembly_neg = {0, 0};
+        return false;
+    }
+
+    // 簡化的幾何解法
+    // 兩半徑相等 (L2=L2)，交點連線通過肘距中點 M，且 a = d/2
+    // h/d = sqrt(L2^2 - d^2/4) / d = sqrt(L2^2/d^2 - 1/4)：只需 1 次除法 + 1 次 sqrt
+    float h_over_d = Math::sqrt(std::fmax(0.0f, G.l2_sq / d2 - 0.25f));
+
+    float x2 = E1_x + 0.5f * dx;
+    float y2 = E1_y + 0.5f * dy;
+
+    // 兩個交點：M ± h * (-dy, dx) / d
+    // 取 + 的一個時 u1 x u2 = 2 * h * d > 0
+    out->assembly_pos = {x2 - h_over_d * dy, y2 + h_over_d * dx};
+    out->assembly_neg = {x2 + h_over_d * dy, y2 - h_over_d * dx};
+    return true;
+}
+
+template <typename MathPolicy, typename Geometry>
+bool BasicFiveBarKinematics<MathPolicy, Geometry>::solveFKLinkage(const JointTrig& trig, LinkagePose* pose) const {
+    FkAssemblies a;
+    bool ok = solveFKAssemblies(trig, &a);
+    pose->base1 = {0.0f, 0.0f};
+    pose->base2 = {geometry().d, 0.0f};
+    pose->elbow1 = a.elbow1;
+    pose->elbow2 = a.elbow2;
+
+    // 書法機通常是向前伸 (Y > ElbowY)，取 det A > 0 的解；
+    // 如果算出來 Y 是負的 (往後指)，取另一個解
+    pose->end = (a.assembly_pos.y < 0) ? a.assembly_neg : a.assembly_pos;
+    return ok;
+}
+
+template <typename MathPolicy, typename Geometry>
+Point2D BasicFiveBarKinematics<MathPolicy, Geometry>::solveFK(float theta1, float theta2) const {
+    LinkagePose pose;
+    solveFKLinkage(jointTrig(theta1, theta2), &pose);
+    return pose.end;
+}
+
+template <typename MathPolicy, typename Geometry>
+bool BasicFiveBarKinematics<MathPolicy, Geometry>::diffTerms(const JointTrig& trig, DiffTerms* t) const {
+    LinkagePose pose;
+    bool ok = solveFKLinkage(trig, &pose);
+    t->end = pose.end;
+    if (!ok) return false;
+
+    const float l1 = geometry().l1;
+    t->u1x = pose.end.x - pose.elbow1.x;
+    t->u1y = pose.end.y - pose.elbow1.y;
+    t->u2x = pose.end.x - pose.elbow2.x;
+    t->u2y = pose.end.y - pose.elbow2.y;
+
+    // dEi/dθi = L1 * (-sin θi, cos θi)
+    t->b1 = l1 * (t->u1y * trig.c1 - t->u1x * trig.s1);
+    t->b2 = l1 * (t->u2y * trig.c2 - t->u2x * trig.s2);
+    t->det_a = t->u1x * t->u2y - t->u1y * t->u2x;
+    return true;
+}
+
+template <typename MathPolicy, typename Geometry>
+Jacobian2x2 BasicFiveBarKinematics<MathPolicy, Geometry>::jacobian(float theta1, float theta2) const {
+    Jacobian2x2 J = {0, 0, 0, 0, false};
+    DiffTerms t;
+    if (!diffTerms(jointTrig(theta1, theta2), &t)) return J;
+    if (std::fabs(t.det_a) < SINGULAR_EPS * geometry().l2_sq) return J;
+
+    // J = A^-1 * B
+    float inv_det = 1.0f / t.det_a;
+    J.m11 = t.u2y * t.b1 * inv_det;
+    J.m12 = -t.u1y * t.b2 * inv_det;
+    J.m21 = -t.u2x * t.b1 * inv_det;
+    J.m22 = t.u1x * t.b2 * inv_det;
+    J.is_valid = true;
+    return J;
+}
+
+template <typename MathPolicy, typename Geometry>
+Jacobian2x2 BasicFiveBarKinematics<MathPolicy, Geometry>::inverseJacobian(float theta1, float theta2) const {
+    DiffTerms t;
+    if (!diffTerms(jointTrig(theta1, theta2), &t)) {
+        Jacobian2x2 Ji = {0, 0, 0, 0, false};
+        return Ji;
+    }
+    return invertTerms(t);
+}
+
+template <typename MathPolicy, typename Geometry>
+Point2D BasicFiveBarKinematics<MathPolicy, Geometry>::solveFKWithInverseJacobian(const JointTrig& trig, Jacobian2x2* inv_jacobian,
+                                                                               int* solution_mode) const {
+    DiffTerms t;
+    if (!diffTerms(trig, &t)) {
+        *inv_jacobian = {0, 0, 0, 0, false};
+        if (solution_mode) *solution_mode = 0;
+        return t.end;
+    }
+    *inv_jacobian = invertTerms(t);
+    if (solution_mode) {
+        // bi 的正負號 = 主/從動臂夾角 φi 的方向：mode 1 為 b1 < 0, b2 > 0
+        *solution_mode = (t.b1 < 0 && t.b2 > 0) ? 1 : (t.b1 > 0 && t.b2 < 0) ? -1 : 0;
+    }
+    return t.end;
+}
+
+template <typename MathPolicy, typename Geometry>
+Jacobian2x2 BasicFiveBarKinematics<MathPolicy, Geometry>::invertTerms(const DiffTerms& t) const {
+    Jacobian2x2 Ji = {0, 0, 0, 0, false};
+    const float eps = SINGULAR_EPS * geometry().l1 * geometry().l2;
+    if (std::fabs(t.b1) < eps || std::fabs(t.b2) < eps) return Ji;
+
+    // J^-1 = B^-1 * A
+    float inv_b1 = 1.0f / t.b1;
+    float inv_b2 = 1.0f / t.b2;
+    Ji.m11 = t.u1x * inv_b1;
+    Ji.m12 = t.u1y * inv_b1;
+    Ji.m21 = t.u2x * inv_b2;
+    Ji.m22 = t.u2y * inv_b2;
+    Ji.is_valid = true;
+    return Ji;
+}
+
+template <typename MathPolicy, typename Geometry>
+JointRates BasicFiveBarKinematics<MathPolicy, Geometry>::jointRates(float theta1, float theta2,
+                                                                   Point2D velocity, Point2D acceleration) const {
+    JointRates r = {0, 0, 0, 0, false};
+    JointTrig trig = jointTrig(theta1, theta2);
+    DiffTerms t;
+    if (!diffTerms(trig, &t)) return r;
+    const float l1 = geometry().l1;
+    const float eps = SINGULAR_EPS * l1 * geometry().l2;
+    if (std::fabs(t.b1) < eps || std::fabs(t.b2) < eps) return r;
+    float inv_b1 = 1.0f / t.b1;
+    float inv_b2 = 1.0f / t.b2;
+
+    // 1. 速度：bi * θi' = ui · v
+    r.vel1 = (t.u1x * velocity.x + t.u1y * velocity.y) * inv_b1;
+    r.vel2 = (t.u2x * velocity.x + t.u2y * velocity.y) * inv_b2;
+
+    // 2. 從動臂的相對速度 v - Ei'，Ei' = L1 * θi' * (-sin θi, cos θi)
+    float w1x = velocity.x + l1 * r.vel1 * trig.s1;
+    float w1y = velocity.y - l1 * r.vel1 * trig.c1;
+    float w2x = velocity.x + l1 * r.vel2 * trig.s2;
+    float w2y = velocity.y - l1 * r.vel2 * trig.c2;
+
+    // 3. 加速度 (含向心項，等價於 J^-1 * (a - J' * θ'))
+    float n1 = t.u1x * acceleration.x + t.u1y * acceleration.y + w1x * w1x + w1y * w1y
+             + l1 * r.vel1 * r.vel1 * (t.u1x * trig.c1 + t.u1y * trig.s1);
+    float n2 = t.u2x * acceleration.x + t.u2y * acceleration.y + w2x * w2x + w2y * w2y
+             + l1 * r.vel2 * r.vel2 * (t.u2x * trig.c2 + t.u2y * trig.s2);
+    r.acc1 = n1 * inv_b1;
+    r.acc2 = n2 * inv_b2;
+    r.is_valid = true;
+    return r;
+}
+
+template <typename MathPolicy, typename Geometry>
+float BasicFiveBarKinematics<MathPolicy, Geometry>::manipulability(float theta1, float theta2) const {
+    DiffTerms t;
+    if (!diffTerms(jointTrig(theta1, theta2), &t)) return 0.0f;
+    if (std::fabs(t.det_a) < SINGULAR_EPS * geometry().l2_sq) return 0.0f;
+    // det J = det B / det A
+    return std::fabs(t.b1 * t.b2 / t.det_a);
+}
+
+template <typename MathPolicy, typename Geometry>
+float BasicFiveBarKinematics<MathPolicy, Geometry>::singularityDistance(float theta1, float theta2) const {
+    DiffTerms t;
+    if (!diffTerms(jointTrig(theta1, theta2), &t)) return 0.0f;
+    const FiveBarGeometry& G = geometry();
+
+    // |bi| = L1 * L2 * |sin φi|,  |det A| = L2^2 * |sin ψ|
+    float inv_l1l2 = G.inv_l1 / G.l2;
+    float sin_phi1 = std::fabs(t.b1) * inv_l1l2;
+    float sin_phi2 = std::fabs(t.b2) * inv_l1l2;
+    float sin_psi = std::fabs(t.det_a) / G.l2_sq;
+    return std::fmin(sin_psi, std::fmin(sin_phi1, sin_phi2));
+}
+
 #endif // KINEMATICS_HPP
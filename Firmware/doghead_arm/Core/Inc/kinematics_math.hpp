@@ -0,0 +1,86 @@
+/**
+ * @file kinematics_math.hpp
+ * @brief 運動學用的數學策略 (Math Policy)：PreciseMath / FastMath
+ * @details
+ *  BasicFiveBarKinematics<MathPolicy> 透過這裡的靜態函式呼叫 sqrt / atan2 / acos / sincos，
+ *  編譯期決定要用 libm 還是多項式近似，不會有任何虛擬函式或分支成本。
+ *
+ *  Policy 需提供：
+ *    static float sqrt(float a);
+ *    static float atan2(float y, float x);
+ *    static float acos(float c);            // c 已限制在 [-1, 1]
+ *    static void  sincos(float a, float* s, float* c);
+ */
+
+#ifndef KINEMATICS_MATH_HPP
+#define KINEMATICS_MATH_HPP
+
+#include <cmath>
+#include "vector_math.hpp"
+
+/**
+ * @brief 精確版：直接呼叫 libm (newlib atan2f/acosf/sinf/cosf)
+ */
+struct PreciseMath {
+    static float sqrt(float a) { return std::sqrt(a); }
+    static float atan2(float y, float x) { return std::atan2(y, x); }
+    static float acos(float c) { return std::acos(c); }
+    static void sincos(float a, float* s, float* c) {
+        *s = std::sin(a);
+        *c = std::cos(a);
+    }
+};
+
+/**
+ * @brief 快速版：低階 minimax 多項式 (Abramowitz & Stegun 4.4.45 / 4.4.47)
+ * @details 最大誤差 (對 double 參考值，全定義域掃描)：
+ *   - atan2  : 1.2e-5 rad  (1 次除法 + 5 項多項式)
+ *   - acos   : 6.8e-5 rad  (1 次 sqrt + 4 項多項式)
+ *   - sincos : 1.0e-7      (與 vector_math.hpp 同一份 Cephes 多項式，無除法)
+ *   - sqrt   : 硬體 VSQRT.F32 (Host 端為 std::sqrt)，不設 errno
+ *  全工作空間掃描 (Tools/kinematics_accuracy)：IK 關節角最大誤差 7.9e-5 rad，
+ *  小於編碼器 1 count (13-Pin: 400 x 50 = 20000 count/rev -> 3.1e-4 rad)；
+ *  書寫區 FK(IK(p)) 往返誤差最大 9.6 um。
+ */
+struct FastMath {
+    static float sqrt(float a) {
+#if defined(__ARM_FP) && !defined(__SOFTFP__)
+        float r;
+        __asm__("vsqrt.f32 %0, %1" : "=t"(r) : "t"(a));
+        return r;
+#else
+        return std::sqrt(a);
+#endif
+    }
+
+    static float atan2(float y, float x) {
+        float ax = std::fabs(x);
+        float ay = std::fabs(y);
+        float num = (ax < ay) ? ax : ay;
+        float den = (ax < ay) ? ay : ax;
+        if (den == 0.0f) return 0.0f;
+
+        // A&S 4.4.47: atan(t), 0 <= t <= 1, |err| <= 1e-5
+        float t = num / den;
+        float t2 = t * t;
+        float r = t * (0.9998660f + t2 * (-0.3302995f + t2 * (0.1801410f
+                    + t2 * (-0.0851330f + t2 * 0.0208351f))));
+
+        if (ay > ax) r = 1.57079632679f - r;
+        if (x < 0.0f) r = 3.14159265359f - r;
+        return (y < 0.0f) ? -r : r;
+    }
+
+    static float acos(float c) {
+        // A&S 4.4.45: acos(a) = sqrt(1 - a) * P(a), 0 <= a <= 1, |err| <= 6.7e-5
+        float a = std::fabs(c);
+        float r = sqrt(1.0f - a) * (1.5707288f + a * (-0.2121144f + a * (0.0742610f + a * -0.0187293f)));
+        return (c < 0.0f) ? 3.14159265359f - r : r;
+    }
+
+    static void sincos(float a, float* s, float* c) {
+        vmath::sincos<vmath::ScalarOps>(a, s, c);
+    }
+};
+
+#endif // KINEMATICS_MATH_HPP
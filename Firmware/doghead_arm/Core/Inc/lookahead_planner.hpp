@@ -0,0 +1,147 @@
+/**
+ * @file lookahead_planner.hpp
+ * @brief 多段直線的轉角圓化 (corner blending) 與 jerk 限制的前瞻速度執行
+ * @details
+ *  點到點移動在每個線段交界都必須停下，30 段的字大部分時間花在加減速。
+ *  LookaheadPlanner 保存最多 CAPACITY 段尚未走完的線段 (靜態陣列)，把轉角換成圓化曲線後連續走完：
+ *    - 轉角圓化：兩線段夾角 (轉向角) φ 的角點 V 以三次 Bézier (V - u1 d, V, V, V + u2 d) 取代，
+ *      兩端曲率為 0 (與直線 G2 相接，加速度不跳)。曲線中點距角點 d sin(φ/2) / 4，
+ *      取 d = 4δ / sin(φ/2) 使圓化剛好切到距角點 δ，命令路徑與原折線的偏差 <= δ cos(φ/2) <= δ；
+ *      d 另受兩段各一半長度限制 (短線段上圓化得更少，偏差 < δ)。
+ *      δ = 0、折返 (φ -> π) 或 d 太小時改為在角點停下；直行 (φ -> 0) 不圓化，只取兩段標稱速度的較小者
+ *    - 圓化曲線的速度上限：min(兩段標稱速度, sqrt(a / κmax), (J / max|dκ/ds|)^(1/3))，
+ *      即法向加速度 v²κ <= a、法向 jerk v³ dκ/ds <= J (J = a / jerk_time，同 CartesianMotion)
+ *    - 執行：沿路徑距離 s 的線上 S 曲線 (同 SCurveGenerator：加速候選 + 最大煞車檢查 + 二分 jerk)，
+ *      |s''| <= a、|s'''| <= J；前方每個速度上限點 (圓化起點、停止角點、最後一段終點) 都要能以最大煞車
+ *      降到該上限，只檢查煞停距離 (加上 v_cap T) 內的點
+ *    - 加入線段時若新的圓化起點已來不及減速 (串流太慢、佇列只剩目前這段)，該轉角改為停下
+ *  每個 tick 輸出 CartesianState (pos、vel = T s'、acc = T s'' + K s'²)，與 CartesianMotion 走同一條
+ *  IK + 運動學前饋路徑。
+ *  Tools/lookahead_planner_check 在 5 種筆畫上的結果 (δ = 0.05 / 0.2 / 0.5 mm，相對 δ = 0 逐角停下)：
+ *  36 邊形 2.3-2.5x、S 曲線 3.2x；星形、鋸齒與螺旋 1.00x —— 這些銳角在 δ 與 jerk 限制下圓化比停下更慢，
+ *  planner 會判斷出來改為停下，所以不會比點到點差，但也沒有加速。命令路徑偏差 <= δ 由建構保證，check 工具也會驗證。
+ *  成本：加入一段 O(前瞻範圍) (圓化曲率取樣 17 點 + 一次煞車檢查)；每個 tick 約 BISECT_ITERATIONS 次煞車距離計算 × 前瞻範圍內的上限點數，
+ *  進入圓化時建一次 Bézier 弧長表。
+ */
+
+#ifndef LOOKAHEAD_PLANNER_HPP
+#define LOOKAHEAD_PLANNER_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "kinematics.hpp"
+#include "kinematic_feedforward.hpp"
+#include "path_interpolator.hpp"
+
+class LookaheadPlanner {
+public:
+    // 前瞻的線段數 (每段 48 bytes)
+    static constexpr uint32_t CAPACITY = 32;
+
+    /**
+     * @param junction_deviation 轉角容許偏差 δ (mm)：圓化曲線與角點的最大距離，0 表示每個轉角都停下 (點到點)
+     * @param jerk_time 加速度從 0 到 a 的時間 (s)，J = a / jerk_time
+     */
+    explicit LookaheadPlanner(float junction_deviation = 0.05f, float jerk_time = 0.05f);
+
+    // 只影響之後加入的轉角
+    void setJunctionDeviation(float mm) { _junction_deviation = (mm > 0.0f) ? mm : 0.0f; }
+    float junctionDeviation() const { return _junction_deviation; }
+
+    /**
+     * @brief 設定下一段的起點 (只在閒置時有效，移動中下一段一律接在最後一段的終點)
+     */
+    void setStart(Point2D p);
+
+    /**
+     * @brief 加入一段直線：從目前最後一段的終點到 end
+     * @param v_max 標稱速度 (mm/s)
+     * @param a_max 加速度 (mm/s²)
+     * @return 已滿或參數不合法時回傳 false；長度為 0 的線段直接忽略 (回傳 true)
+     */
+    bool append(Point2D end, float v_max, float a_max);
+
+    /**
+     * @brief 前進一個 tick
+     * @param out 輸出末端狀態 (閒置時保持最後的位置、速度 0)
+     * @return 本 tick 之後仍有線段要走時回傳 true
+     */
+    bool step(float dt, CartesianState* out);
+
+    // 丟棄所有線段並停在目前的命令點 (不減速：呼叫端改用其他目標時使用)
+    void clear();
+
+    bool active() const { return _count > 0; }
+    bool full() const { return _count >= CAPACITY; }
+    uint32_t size() const { return _count; }
+    // 最後一段的終點 (下一段的起點)
+    Point2D tail() const { return _tail; }
+    // 目前命令點的切線 (路徑偏差量測用)
+    Point2D tangent() const { return _tangent; }
+    // 目前沿路徑的速度 (mm/s)
+    float velocity() const { return _v; }
+
+private:
+    static constexpr int BISECT_ITERATIONS = 12;
+
+    struct Block {
+        Point2D start;
+        Point2D dir;          // 單位方向
+        float length;         // mm
+        float v_nominal;      // 標稱速度
+        float accel;          // 加速度
+        float jerk;           // accel / jerk_time
+        float trim_in;        // 起點被前一個圓化佔用的長度 (mm)
+        float trim_out;       // 終點圓化的 d (mm)，0 表示沒有圓化
+        float v_junction;     // 終點轉角的速度上限 (圓化曲線全程 / 沒有圓化時在角點；最後一段為 0)
+        float blend_length;   // 圓化曲線弧長 (mm)
+    };
+
+    Block& block(uint32_t i) { return _blocks[(_head + i) % CAPACITY]; }
+    const Block& block(uint32_t i) const { return _blocks[(_head + i) % CAPACITY]; }
+
+    // 第 i 段直線部分 (扣掉兩端圓化) 的長度
+    float lineLength(uint32_t i) const;
+    // 目前這一塊 (直線或圓化) 的長度與速度上限
+    float pieceLength() const;
+    float pieceCap() const;
+    // 從第 0 段到第一個停止角點 (不停下連續走完的部分) 的最小加速度 / jerk，整段輪廓都以它為限
+    void chainLimits(float* accel, float* jerk) const;
+    // 佇列中最高的標稱速度 (決定要往前檢查多遠)
+    float peakSpeed() const;
+
+    /**
+     * @brief 從目前位置前進 dp、狀態變成 (v, a) 後立刻最大煞車，前方速度上限點中最嚴重的超出距離
+     * @param v_cap 目前這一塊的速度上限 (不低於它的上限點不必檢查)
+     * @param v_peak peakSpeed()
+     * @return > 0 表示某個上限點來不及減速
+     */
+    float overshoot(float dp, float v, float a, float v_cap, float v_peak, float A, float J) const;
+
+    // 在第 i 段與第 i + 1 段之間建立轉角 (圓化 / 停下 / 直行)；目前狀態來不及時改為停下
+    void joinBlocks(uint32_t i);
+    // 只看幾何與速度決定轉角的形狀
+    void shapeJunction(uint32_t i);
+
+    // 進入第 0 段終點的圓化時建 Bézier
+    void beginBlend();
+    void pop();
+
+    Block _blocks[CAPACITY];
+    uint32_t _head;
+    uint32_t _count;
+    float _junction_deviation;
+    float _jerk_time;
+
+    Point2D _tail;        // 最後一段的終點
+    bool _in_blend;       // 目前在第 0 段終點的圓化曲線上
+    float _s;             // 目前這一塊已走的距離 (mm)
+    float _v;             // 沿路徑速度 (mm/s)
+    float _a;             // 沿路徑加速度 (mm/s²)
+    Point2D _pos;         // 目前命令點
+    Point2D _tangent;
+    Point2D _curvature;   // d²P/ds²
+    PathInterpolator _blend;
+};
+
+#endif // LOOKAHEAD_PLANNER_HPP
@@ -12,6 +12,54 @@
 extern "C" {
 #endif
 
+// PVT 軌跡點 (關節角 Degree、關節角速度 Deg/s、筆高、從上一點到達此點的時間 s)
+typedef struct {
+    float theta1, theta2, omega1, omega2, z, duration;
+} TrajectoryPoint;
+
+// 筆畫線段：從上一段的終點 (或目前的命令點) 直線移動到 (x, y)，標稱速度 v mm/s、加速度 a mm/s²
+typedef struct {
+    float x, y, v, a;
+} StrokeSegment;
+
+// 路徑移動的直線度 / 路徑偏差報告 (Robot_MoveLinear / MoveArc / MoveBezier，以編碼器 FK 量測)
+typedef struct {
+    float max_deviation_mm;       // 與路徑的最大垂直偏差
+    float rms_deviation_mm;       // 垂直偏差的 RMS
+    float max_tracking_error_mm;  // 與當下命令點的最大距離 (含沿線落後)
+    float duration_s;             // 量測時間 (插補時間 + 停止後 0.1s)
+    uint32_t samples;
+    bool complete;                // false：移動 (或停止後的量測) 尚未結束
+} StraightnessReport;
+
+// 軌跡緩衝區狀態 (遙測用)
+typedef struct {
+    uint32_t level;           // 目前待執行的點數
+    uint32_t capacity;        // 容量
+    uint32_t high_watermark;  // 曾經到達的最大點數
+    uint32_t overruns;        // 緩衝區滿而被拒絕的點數
+    uint32_t underruns;       // 控制迴圈要取點時緩衝區為空的次數
+} TrajectoryBufferStats;
+
+// 壓縮軌跡串流的解碼統計 (Robot_FeedTrajectoryStream)
+typedef struct {
+    uint32_t blocks;          // CRC 正確的區塊數
+    uint32_t points;          // 放入軌跡緩衝區的點數
+    uint32_t crc_errors;      // CRC 錯誤而丟棄的區塊數
+    uint32_t format_errors;   // 標頭 / varint 不合法而丟棄的區塊數
+    uint32_t dropped_points;  // 緩衝區空間不足而丟棄的點數 (同時計入 overruns)
+} TrajectoryStreamStats;
+
+// 筆畫表播放狀態 (Robot_PlayStrokeTable)
+typedef struct {
+    bool active;           // 移向起點或播放中
+    bool approaching;      // 正在移向表格起點 (尚未開始播放)
+    bool pen_down;         // 目前的分段是書寫 (否則為空移)
+    uint32_t table;        // 最近一次要求播放的表格索引
+    uint32_t tick;         // 目前的樣本索引
+    uint32_t total_ticks;  // 表格長度 (tick = 1ms)
+} PlaybackStatus;
+
 // 初始化機器人 (馬達、PID)
 void Robot_Init(void);
 
@@ -19,8 +67,116 @@ void Robot_Init(void);
 // dt_seconds: 距離上次呼叫的時間差 (秒)，例如 1ms = 0.001f
 void Robot_Loop(float dt_seconds);
 
+// 目標 API (SetTargetPosition / SetTargetState / MoveLinear / MoveArc / MoveBezier) 可在其他 Task 呼叫：
+// 可達性與碰撞在呼叫端檢查，通過後交給控制迴圈，在下一個 tick 開始執行；
+// 還有 2 個要求沒被控制迴圈接手時 (佇列已滿) 同樣回傳 false
+
 // 設定目標位置 (使用運動學解算)
-void Robot_SetTargetPosition(float x, float y);
+// 回傳 false：目標不可達或在虛擬圍籬之下 (工作空間地圖判定)，目標維持不變
+bool Robot_SetTargetPosition(float x, float y);
+
+// 設定目標狀態 (位置 mm、速度 mm/s、加速度 mm/s²)
+// 速度 / 加速度經微分運動學換算成關節前饋 (不經關節 S 曲線產生器的估計)
+// 回傳 false：同 Robot_SetTargetPosition，或目標在奇異構型附近 (非 Robot_IsWritable，前饋不經降速)
+bool Robot_SetTargetState(float x, float y, float vx, float vy, float ax, float ay);
+
+// 送入軌跡點 (只能由單一 Task 呼叫，例如 CommTask)；不配置記憶體、不阻塞
+// 回傳實際放入的點數，緩衝區滿時只放入前面放得下的部分
+// 控制迴圈以三次 Hermite 在點間插補 (20~100Hz 的點即可，C¹ 連續並帶解析的速度 / 加速度前饋)；
+// 第一點的 duration 從開始執行時起算，路徑移動 / 線段佇列進行中時等它們結束才開始。
+// 緩衝區在速度不為 0 的點之後斷流時，以 S 曲線平滑停在最後一點 (計入 underruns)
+uint32_t Robot_PushTrajectory(const TrajectoryPoint* points, uint32_t count);
+
+// 送入壓縮的軌跡串流 (trajectory_codec.hpp 的區塊格式，每點約 4~6 bytes)，可在任意位置切段
+// 只能由呼叫 Robot_PushTrajectory 的同一個 Task 呼叫；點直接解碼進軌跡緩衝區，區塊 CRC 正確才生效
+// 回傳本次放入的點數
+uint32_t Robot_FeedTrajectoryStream(const uint8_t* data, uint32_t length);
+
+// 壓縮軌跡串流的解碼統計
+void Robot_GetTrajectoryStreamStats(TrajectoryStreamStats* stats);
+
+// 中止 PVT 軌跡與筆畫表播放：清空緩衝區，從目前的設定點平滑停下
+void Robot_StopTrajectory(void);
+
+// 內建筆畫表 (Tools/stroke_table_gen 離線編譯進 Flash 的關節角序列) 的數量與名稱 (索引超出時回傳 NULL)
+uint32_t Robot_GetStrokeTableCount(void);
+const char* Robot_GetStrokeTableName(uint32_t index);
+
+// 播放筆畫表：先以 S 曲線移到表格起點，再逐 tick 輸出表格中的關節角與前饋 (不做 IK)
+// 回傳 false：索引超出、測試模式，或目前的手肘構型與表格編譯時不同；其他目標 API 會中止播放
+bool Robot_PlayStrokeTable(uint32_t index);
+
+// 筆畫表播放狀態
+void Robot_GetPlaybackStatus(PlaybackStatus* status);
+
+// 軌跡緩衝區狀態 (填充量、最高水位、overrun / underrun 計數)
+void Robot_GetTrajectoryBufferStats(TrajectoryBufferStats* stats);
+
+// 笛卡兒直線移動：從目前的命令點 (或實測位置) 以 1kHz 直線插補到 (x, y)
+// v：最大速度 mm/s、a：最大加速度 mm/s² (S 曲線速度輪廓)，插補點經 IK + 運動學前饋送進 PID
+// 回傳 false：參數不合法、直線經過不可書寫區域 (不可達或奇異構型附近，見 Robot_IsWritable) 或終點構型碰撞，
+// 目前的動作不受影響
+bool Robot_MoveLinear(float x, float y, float v, float a);
+
+// 圓弧移動：從目前的命令點繞圓心 (cx, cy) 掃過 sweep_deg 度 (逆時針為正)，沿弧長等進給率插補
+// 回傳 false：同 Robot_MoveLinear，或起點與圓心重合
+bool Robot_MoveArc(float cx, float cy, float sweep_deg, float v, float a);
+
+// 三次 Bézier 移動：起點為目前的命令點，(x1, y1)、(x2, y2) 為控制點，(x3, y3) 為終點
+// 以弧長參數化 (進給率與控制點分布無關)；回傳值同 Robot_MoveLinear
+bool Robot_MoveBezier(float x1, float y1, float x2, float y2, float x3, float y3, float v, float a);
+
+// 送入筆畫線段 (只能由單一 Task 呼叫，例如 CommTask)；不配置記憶體、不阻塞
+// 線段由前瞻規劃器串成連續 (jerk 限制) 的速度輪廓：轉角以不超過容許偏差的圓化曲線通過，
+// 銳角等圓化反而比停下慢的轉角停在角點，佇列的最後一段停在終點
+// 回傳實際放入的段數；其他目標 API (SetTargetPosition / Move*) 會清空尚未走完的線段
+uint32_t Robot_QueueSegments(const StrokeSegment* segments, uint32_t count);
+
+// 轉角容許偏差 (mm，預設 0.05)：圓化曲線與角點的最大距離，越大轉角越快、圓化越多；0 表示每個轉角都停下
+// (只影響之後併入的轉角)
+void Robot_SetJunctionDeviation(float mm);
+
+// 取出並清除「經過不可書寫區域或終點碰撞而被丟棄」的線段數 (該段之後的佇列一併丟棄)
+uint32_t Robot_TakeRejectedSegments(void);
+
+// 進給率覆寫 (percent：0 ~ 200，100 = 原速)：即時縮放路徑移動、線段佇列、PVT 軌跡與筆畫表的時間軸，
+// 路徑形狀不變；以 jerk 限制的斜坡過渡 (每秒最多 100%)，速度 / 加速度前饋一併換算。
+// 0 表示停在路徑上 (暫停)；點對點移動 (SetTargetPosition / SetTargetState) 與移向表格起點不受影響
+void Robot_SetFeedrateOverride(float percent);
+
+// 目前實際的進給率 (percent，過渡中為斜坡上的值)
+float Robot_GetFeedrateOverride(void);
+
+// 路徑移動 (含線段佇列、PVT 軌跡與筆畫表播放) 是否仍在進行
+bool Robot_IsMoving(void);
+
+// 最近一次路徑移動的直線度 / 路徑偏差報告
+void Robot_GetStraightnessReport(StraightnessReport* report);
+
+// 工作空間地圖查詢 (O(1))：可達且遠離奇異構型，路徑規劃可逐點檢查
+bool Robot_IsWritable(float x, float y);
+
+// 編碼器量化造成的最壞位置不確定度 (mm，解析度地圖查表)；書寫區外回傳 -1
+float Robot_GetPositionUncertainty(float x, float y);
+
+// 最近一次實測構型的碰撞旗標 (CollisionFlag：bit0 連桿互撞、bit1 摺疊、bit2 底座、bit3 壓紙條、bit4 無解)
+uint32_t Robot_GetCollisionFlags(void);
+
+// 碰撞檢查開關 (預設開啟)：開啟時碰撞構型強制停止，會碰撞的目標點被拒絕
+void Robot_SetCollisionCheck(bool enable);
+
+// 讀取並清除分支切換事件 (BranchEvent 旗標：bit0/1 左/右臂手肘方向、bit2 組裝模式)
+// 可在任一 Task 呼叫：以原子交換取走，與控制迴圈同時產生的事件不會遺失
+uint32_t Robot_TakeBranchEvents(void);
+
+// IK 查表模式 (書寫區網格 + 雙線性內插，網格外自動改用解析解)
+void Robot_SetIkGridMode(bool enable);
+
+// IK 記憶快取模式 (重複的筆畫目標直接取用先前的解，誤差 <= 1e-4 rad)
+void Robot_SetIkCacheMode(bool enable);
+
+// IK 記憶快取統計 (遙測用)：命中、未命中、替換次數
+void Robot_GetIkCacheStats(uint32_t* hits, uint32_t* misses, uint32_t* evictions);
 
 // 測試模式控制
 void Robot_SetTestMode(bool enable);
@@ -0,0 +1,47 @@
+/**
+ * @file motor_params.h
+ * @brief 關節馬達機械參數 (MotorConfig_t 的數值來源) 與關節控制參數
+ * @details 不依賴 HAL，Motor_System_Config / robot_arm_core.cpp 與 Host 工具 (解析度地圖、控制模擬等) 共用同一份數值
+ */
+#ifndef MOTOR_PARAMS_H
+#define MOTOR_PARAMS_H
+
+// 關節 1 (13-Pin 馬達 - 24H702U030)
+#define JOINT1_MAX_RPM      6000
+#define JOINT1_ENCODER_PPR  100.0f  // Nidec 規格書值
+#define JOINT1_GEAR_RATIO   50.0f   // [請依實際減速比修改] 假設 50:1
+
+// 關節 2 (8-Pin 馬達 - 24H220Q231)
+#define JOINT2_MAX_RPM      6300
+#define JOINT2_ENCODER_PPR  100.0f  // Nidec 規格書值
+#define JOINT2_GEAR_RATIO   30.0f   // [請依實際減速比修改] 假設 30:1
+
+// 輸出軸速度上限 (Deg/s)：控制迴圈的 S 曲線產生器與 Host 時間最佳化 (topp_retime) 共用
+// (不超過 JOINTn_MAX_RPM / JOINTn_GEAR_RATIO 換算的馬達能力；關節 1 的 360 即 JOINT1_PID_MAX_RPM 換算的值)
+#define JOINT1_MAX_VELOCITY 360.0f
+#define JOINT2_MAX_VELOCITY 360.0f
+
+// 輸出軸加速度上限 (Deg/s²)：控制迴圈的 S 曲線產生器與 Host 時間最佳化 (topp_retime) 共用
+#define JOINT1_MAX_ACCEL    1800.0f
+#define JOINT2_MAX_ACCEL    1800.0f
+
+// 關節位置迴路 PositionController 的增益 (robot_arm_core.cpp 的 joint1_pid / joint2_pid；Tools/joint_sim.hpp 的模擬)
+// Kv：速度前饋 (RPM per Deg/s 的倍數)，Ka：加速度前饋，MAX_RPM：輸出限幅
+#define JOINT1_PID_KP       5.0f
+#define JOINT1_PID_KI       0.1f
+#define JOINT1_PID_KD       0.0f
+#define JOINT1_PID_KV       1.0f
+#define JOINT1_PID_KA       0.1f
+#define JOINT1_PID_MAX_RPM  3000.0f
+
+#define JOINT2_PID_KP       8.0f
+#define JOINT2_PID_KI       0.2f
+#define JOINT2_PID_KD       0.0f
+#define JOINT2_PID_KV       1.0f
+#define JOINT2_PID_KA       0.15f
+#define JOINT2_PID_MAX_RPM  4000.0f
+
+// STM32 Encoder Mode x4 (上下緣都計數)：馬達轉一圈 = PPR * 4 counts
+#define ENCODER_COUNTS_PER_PULSE 4.0f
+
+#endif // MOTOR_PARAMS_H
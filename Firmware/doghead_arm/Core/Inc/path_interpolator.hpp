@@ -0,0 +1,102 @@
+/**
+ * @file path_interpolator.hpp
+ * @brief 筆畫路徑基元：直線、圓弧、三次 Bézier，以弧長 s 取樣
+ * @details
+ *  上位機每個筆畫只需送幾個係數 (115200 baud 下遠比逐點傳送省)，由 MCU 在控制頻率展開。
+ *  所有基元都以「沿路徑的距離 s (mm)」參數化，路徑速度 = ds/dt，進給率因此與曲率無關；
+ *  sample(s) 回傳位置、單位切線 T = dP/ds 與曲率向量 K = d²P/ds²，
+ *  末端速度 = T s'、加速度 = T s'' + K s'² (CartesianMotion 使用)。
+ *    - 直線：P0 + T s
+ *    - 圓弧：由圓心與掃掠角 (逆時針為正) 定義，φ = φ0 + s / R；
+ *            sin/cos 以小角度旋轉增量更新 (同 IncrementalIk)，每 TRIG_RESYNC_PERIOD 次重新精確計算
+ *    - Bézier：begin 時以前向差分 (每步 3 次加法 / 座標，不做乘法) 走 BEZIER_STEPS 等分 t，
+ *            累加弦長得到 s(t) 表，並記下各節點的 dt/ds = 1/|B'|；取樣時以單調游標找區間、
+ *            以三次 Hermite (節點斜率 dt/ds) 內插回 t，再以 Horner 求 B、B'、B''。
+ *            線性內插 t 在 |B'| 變化大的曲線上會有數 % 的速度漣波，Hermite 內插後降到 0.1% 以下
+ *  s 超出 [0, length] 時夾在端點。
+ */
+
+#ifndef PATH_INTERPOLATOR_HPP
+#define PATH_INTERPOLATOR_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "kinematics.hpp"
+
+enum PathType : uint8_t {
+    PATH_LINE = 0,
+    PATH_ARC = 1,
+    PATH_BEZIER = 2,
+};
+
+/**
+ * @brief 路徑上一點 (對弧長 s 的微分)
+ */
+struct PathPoint {
+    Point2D pos;        // mm
+    Point2D tangent;    // dP/ds (單位向量)
+    Point2D curvature;  // d²P/ds² (大小 = 曲率 1/R，指向曲率中心)
+};
+
+class PathInterpolator {
+public:
+    // Bézier 弧長表的分段數 (兩個表格各 BEZIER_STEPS + 1 個 float)
+    static constexpr uint32_t BEZIER_STEPS = 64;
+
+    PathInterpolator() { beginLine({0.0f, 0.0f}, {0.0f, 0.0f}); }
+
+    // 直線 from -> to
+    void beginLine(Point2D from, Point2D to);
+
+    /**
+     * @brief 圓弧：從 from 繞 center 掃過 sweep_rad (逆時針為正)
+     * @return 半徑為 0 (from 與圓心重合) 時回傳 false
+     */
+    bool beginArc(Point2D from, Point2D center, float sweep_rad);
+
+    // 三次 Bézier：控制點 p0 (起點)、p1、p2、p3 (終點)
+    void beginBezier(Point2D p0, Point2D p1, Point2D p2, Point2D p3);
+
+    /**
+     * @brief 取樣弧長 s 處
+     * @note s 通常單調遞增 (每個 tick 前進一點)，Bézier 游標 / 圓弧增量旋轉在此情況下為 O(1)
+     */
+    PathPoint sample(float s);
+
+    PathType type() const { return _type; }
+    float length() const { return _length; }
+    Point2D start() const { return _p0; }
+    Point2D end() const { return _end; }
+
+private:
+    static constexpr float SMALL_ANGLE = 0.05f;
+    static constexpr uint32_t TRIG_RESYNC_PERIOD = 64;
+
+    PathPoint sampleArc(float s);
+    PathPoint sampleBezier(float s);
+
+    PathType _type;
+    float _length;
+    Point2D _p0;
+    Point2D _end;
+
+    // 直線
+    Point2D _dir;
+
+    // 圓弧
+    Point2D _center;
+    float _radius;
+    float _phi0;
+    float _turn;          // +1 逆時針 / -1 順時針
+    float _arc_s;         // _arc_sin / _arc_cos 對應的 s
+    float _arc_sin, _arc_cos;
+    uint32_t _arc_age;
+
+    // Bézier：B(t) = p0 + c t + b t² + a t³
+    Point2D _a, _b, _c;
+    float _s_table[BEZIER_STEPS + 1];     // 第 i 個 t = i / BEZIER_STEPS 的累積弦長
+    float _dtds_table[BEZIER_STEPS + 1];  // 同一節點的 dt/ds = 1 / |B'(t)| (B' = 0 時為 0)
+    uint32_t _cursor;
+};
+
+#endif // PATH_INTERPOLATOR_HPP
@@ -0,0 +1,122 @@
+/**
+ * @file pvt_interpolator.hpp
+ * @brief PVT 軌跡點 (20~100Hz) 的三次 Hermite 插補，逐 tick 輸出關節設定點
+ * @details
+ *  上位機只送稀疏的 TrajectoryPoint (關節角 θ、角速度 ω、到達時間 T)，控制迴圈每 1ms 在相鄰兩點間
+ *  以三次 Hermite 多項式重建軌跡：
+ *    θ(t) = c0 + c1 t + c2 t² + c3 t³，t ∈ [0, T]
+ *    c0 = θ0、c1 = ω0、c2 = (3 Δθ / T - 2 ω0 - ω1) / T、c3 = (ω0 + ω1 - 2 Δθ / T) / T²
+ *  兩端的位置與速度都等於軌跡點，段與段之間 C¹ 連續 (加速度可在軌跡點處跳動)；
+ *  速度 / 加速度前饋直接取多項式的解析導數，不需差分。
+ *  點距 h 時的插補誤差約 h⁴ θ'''' / 384，50Hz 的書寫筆畫遠小於編碼器 1 count，
+ *  串流頻寬只有逐 tick 送設定點的 1/10 ~ 1/50。
+ *
+ *  執行規則：
+ *    - start() 以目前的設定點 (位置 / 速度) 為第一段的起點，第一個軌跡點的 duration 從此刻起算
+ *    - 一段走完就從來源取下一點，多走的時間帶進下一段 (不累積時間誤差)
+ *    - 最後一點速度為 0 且來源已空：正常結束 (不計入 underrun)
+ *    - 最後一點速度不為 0 但來源已空 (上位機來不及)：結束並回傳 false，由呼叫端以 S 曲線產生器
+ *      從當下的速度 / 加速度平滑停到最後一點 (SpscRingBuffer::pop 會計入 underruns)
+ *  每個 tick 只有兩個三次式求值 (無 sqrt、無除法)，換段時 4 次除法。
+ *  step() 的 dt 是軌跡時間：進給率覆寫時由呼叫端縮放 (可為 0)，輸出的導數也是對軌跡時間。
+ */
+
+#ifndef PVT_INTERPOLATOR_HPP
+#define PVT_INTERPOLATOR_HPP
+
+#include <cstdint>
+#include "mainpp.h"
+#include "kinematic_feedforward.hpp"
+
+// 段長下限 (一個控制週期)：duration 為 0 或極短的點不會造成除以 0
+const float PVT_MIN_SEGMENT_TIME = 0.001f;
+
+class PvtInterpolator {
+public:
+    PvtInterpolator() : _t(0.0f), _T(1.0f), _active(false) {
+        _end = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        _c1 = _c2 = {0.0f, 0.0f, 0.0f, 0.0f};
+    }
+
+    /**
+     * @brief 從目前的設定點開始執行 (下一次 step() 取第一個軌跡點)
+     */
+    void start(const JointSetpoint& joint1, const JointSetpoint& joint2) {
+        _end = {joint1.pos, joint2.pos, joint1.vel, joint2.vel, 0.0f, 0.0f};
+        _t = 0.0f;
+        _T = 0.0f;  // 起點本身是長度 0 的一段，第一次 step() 就換到第一個軌跡點
+        _active = true;
+    }
+
+    /**
+     * @brief 前進一個 tick
+     * @param source 軌跡點來源 (提供 bool pop(TrajectoryPoint*) 與 bool empty()，例如 SpscRingBuffer)
+     * @param joint1, joint2 輸出設定點 (Degree)；結束後不變
+     * @return 本 tick 有輸出時回傳 true；結束 (正常或 underrun) 時回傳 false
+     */
+    template <typename Source>
+    bool step(float dt, Source& source, JointSetpoint* joint1, JointSetpoint* joint2) {
+        if (!_active) return false;
+        _t += dt;
+        while (_t >= _T) {
+            // 最後一點靜止且沒有後續：停在該點，不去 pop (避免把正常結束算成 underrun)
+            if (_end.omega1 == 0.0f && _end.omega2 == 0.0f && source.empty()) {
+                _active = false;
+                *joint1 = {_end.theta1, 0.0f, 0.0f};
+                *joint2 = {_end.theta2, 0.0f, 0.0f};
+                return true;
+            }
+            TrajectoryPoint next;
+            if (!source.pop(&next)) {
+                _active = false;
+                return false;
+            }
+            _t -= _T;
+            beginSegment(next);
+        }
+        *joint1 = evaluate(_c1, _t);
+        *joint2 = evaluate(_c2, _t);
+        return true;
+    }
+
+    // 中止 (不減速)：呼叫端改用其他目標時使用
+    void stop() { _active = false; }
+
+    bool active() const { return _active; }
+    // 目前這段的終點 (結束或 underrun 後的停止目標)
+    float endTheta1() const { return _end.theta1; }
+    float endTheta2() const { return _end.theta2; }
+
+private:
+    struct Cubic {
+        float c0, c1, c2, c3;
+    };
+
+    // 以目前這段的終點為起點，接到 next (duration 不到 PVT_MIN_SEGMENT_TIME 時以下限計)
+    void beginSegment(const TrajectoryPoint& next) {
+        _T = (next.duration > PVT_MIN_SEGMENT_TIME) ? next.duration : PVT_MIN_SEGMENT_TIME;
+        _c1 = hermite(_end.theta1, _end.omega1, next.theta1, next.omega1, _T);
+        _c2 = hermite(_end.theta2, _end.omega2, next.theta2, next.omega2, _T);
+        _end = next;
+    }
+
+    static Cubic hermite(float p0, float v0, float p1, float v1, float T) {
+        float inv_T = 1.0f / T;
+        float slope = (p1 - p0) * inv_T;
+        return {p0, v0, (3.0f * slope - 2.0f * v0 - v1) * inv_T, (v0 + v1 - 2.0f * slope) * inv_T * inv_T};
+    }
+
+    static JointSetpoint evaluate(const Cubic& c, float t) {
+        return {c.c0 + t * (c.c1 + t * (c.c2 + t * c.c3)),
+                c.c1 + t * (2.0f * c.c2 + t * 3.0f * c.c3),
+                2.0f * c.c2 + 6.0f * c.c3 * t};
+    }
+
+    Cubic _c1, _c2;        // 目前這段兩個關節的多項式 (Degree，t 以段起點為 0)
+    TrajectoryPoint _end;  // 目前這段的終點
+    float _t;              // 段內時間 (s)
+    float _T;              // 段長 (s)
+    bool _active;
+};
+
+#endif // PVT_INTERPOLATOR_HPP
@@ -0,0 +1,113 @@
+/**
+ * @file resolution_map.hpp
+ * @brief 編碼器量化 -> 笛卡兒解析度地圖：書寫區各處的最小可分辨位移與最壞位置不確定度
+ * @details
+ *  關節角由編碼器計數量化，一個 count = 2π / (PPR * 4 * 減速比) (motor_params.h)；
+ *  經過五連桿的雅可比 J 後，同樣的關節量化在書寫區不同位置對應的末端誤差差異很大。
+ *  - 地圖由 Host 工具 Tools/resolution_map_gen 產生，輸出 Core/Src/resolution_map_table.cpp
+ *  - 每格兩個值 (單位 table.unit_mm)，取格內所有取樣點的最大值 (保守)：
+ *      resolution  ：任一關節走 1 count 造成的最大末端位移 max(|J e1| q1, |J e2| q2)
+ *      uncertainty ：Motor_GetAngle 把計數截斷成整數 count，實際角度落在 [n q, (n+1) q)，
+ *                    末端最壞誤差 = max |J (e1, e2)|，ei ∈ [0, qi] (取矩形的三個非原點頂點)
+ *  - bestRegion() 供作業規劃把字放在不確定度最小的位置
+ */
+
+#ifndef RESOLUTION_MAP_HPP
+#define RESOLUTION_MAP_HPP
+
+#include <cstdint>
+#include "kinematics.hpp"
+
+/**
+ * @brief 地圖表格描述 (由產生器輸出)
+ */
+struct ResolutionMapTable {
+    float x_min;                  // 第 0 欄格子的左緣 X 座標 (mm)
+    float y_min;                  // 第 0 列格子的下緣 Y 座標 (mm)
+    float cell;                   // 格子邊長 (mm)
+    float inv_cell;               // 1 / 格子邊長
+    uint16_t nx;                  // X 方向格數
+    uint16_t ny;                  // Y 方向格數
+    float unit_mm;                // 表格數值的單位 (mm / LSB)
+    const uint16_t* resolution;   // [ny][nx]，列優先
+    const uint16_t* uncertainty;  // [ny][nx]
+};
+
+class ResolutionMap {
+public:
+    explicit ResolutionMap(const ResolutionMapTable& table) : _t(table) {}
+
+    /**
+     * @brief 單一 count 的最大末端位移 (mm)
+     * @return 地圖外回傳 -1
+     */
+    float resolutionAt(float x, float y) const { return value(_t.resolution, x, y); }
+
+    /**
+     * @brief 編碼器量化造成的最壞位置不確定度 (mm)
+     * @return 地圖外回傳 -1
+     */
+    float uncertaintyAt(float x, float y) const { return value(_t.uncertainty, x, y); }
+
+    /**
+     * @brief 在地圖內找 width x height 的矩形 (例如一個字的外框)，使框內最壞不確定度最小
+     * @param origin 輸出矩形左下角 (mm)，對齊格線
+     * @param worst_mm (可選) 輸出該矩形內的最壞不確定度 (mm)
+     * @return 矩形比地圖大時回傳 false
+     * @note 逐格暴力搜尋 O(nx * ny * 框內格數)，書寫區 5mm 格約數萬次比較，
+     *       屬於作業規劃 (非控制迴圈) 的成本
+     */
+    bool bestRegion(float width, float height, Point2D* origin, float* worst_mm = nullptr) const;
+
+    const ResolutionMapTable& table() const { return _t; }
+
+private:
+    float value(const uint16_t* plane, float x, float y) const {
+        float fx = (x - _t.x_min) * _t.inv_cell;
+        float fy = (y - _t.y_min) * _t.inv_cell;
+        if (!(fx >= 0.0f && fy >= 0.0f)) return -1.0f;  // 同時擋掉 NaN
+        uint32_t ix = (uint32_t)fx;
+        uint32_t iy = (uint32_t)fy;
+        if (ix >= _t.nx || iy >= _t.ny) return -1.0f;
+        return (float)plane[iy * _t.nx + ix] * _t.unit_mm;
+    }
+
+    const ResolutionMapTable& _t;
+};
+
+inline bool ResolutionMap::bestRegion(float width, float height, Point2D* origin, float* worst_mm) const {
+    // 矩形覆蓋的格數 (部分覆蓋也算)
+    uint32_t wx = (uint32_t)(width * _t.inv_cell + 0.999f);
+    uint32_t wy = (uint32_t)(height * _t.inv_cell + 0.999f);
+    if (wx < 1) wx = 1;
+    if (wy < 1) wy = 1;
+    if (wx > _t.nx || wy > _t.ny) return false;
+
+    uint32_t best = 0xFFFFFFFFu;
+    uint32_t best_ix = 0, best_iy = 0;
+    for (uint32_t iy = 0; iy + wy <= _t.ny; ++iy) {
+        for (uint32_t ix = 0; ix + wx <= _t.nx; ++ix) {
+            uint32_t worst = 0;
+            for (uint32_t j = 0; j < wy && worst < best; ++j) {
+                const uint16_t* row = _t.uncertainty + (iy + j) * _t.nx + ix;
+                for (uint32_t i = 0; i < wx; ++i)
+                    if (row[i] > worst) worst = row[i];
+            }
+            if (worst < best) {
+                best = worst;
+                best_ix = ix;
+                best_iy = iy;
+            }
+        }
+    }
+
+    origin->x = _t.x_min + (float)best_ix * _t.cell;
+    origin->y = _t.y_min + (float)best_iy * _t.cell;
+    if (worst_mm) *worst_mm = (float)best * _t.unit_mm;
+    return true;
+}
+
+// 產生的書寫區解析度地圖 (Core/Src/resolution_map_table.cpp)
+extern const ResolutionMapTable RESOLUTION_MAP_DOGARM;
+
+#endif // RESOLUTION_MAP_HPP
@@ -0,0 +1,96 @@
+/**
+ * @file scurve_generator.hpp
+ * @brief 線上 (online) 加加速度限制的 S 曲線單軸軌跡產生器
+ * @details
+ *  取代原本的「目標差分 + 一階濾波」TrajectoryPlanner：每個 tick 依目前狀態 (p, v, a) 與目標位置
+ *  選出本 tick 的加加速度 j (|j| <= J)，再以三次多項式精確積分，輸出的 p / v / a 彼此一致
+ *  (v 就是 p 的導數)，可直接交給 PositionController::update 當作目標與前饋。
+ *  在速度 V、加速度 A、加加速度 J 的限制下，點到點移動為 7 段式 (加加速 / 等加速 / 減加速 /
+ *  等速 / 加減速 / 等減速 / 減減速) 的時間最佳輪廓，短距離時自動退化成沒有等速或等加速段的形狀。
+ *
+ *  每個 tick 的決策 (與 Reflexxes / 非線性濾波器同一類的「能不能及時停下」判斷)：
+ *    1. 加速候選：朝目標加速，a 追蹤 min(A, sqrt(2J (V - v)))，在 v 到達 V 時剛好把 a 收回 0
+ *    2. 以候選 j 積分一步後，計算「立即開始最大煞車」的停止距離 (封閉解，1 次 sqrt)
+ *    3. 不會超過目標就採用候選；否則在 [最大煞車, 候選] 之間二分搜尋 j，
+ *       使停止點剛好落在目標上 (停止距離對 j 單調)，煞車段自然走出 7 段式的後半
+ *  目標在移動中途改變 (包括改到反方向) 時不需要任何特殊處理，下一個 tick 的判斷就會重新規劃。
+ *  成本：加速段 1 次 sqrt；煞車段約 BISECT_ITERATIONS + 2 次 sqrt (Cortex-M4F 約數 µs)。
+ *
+ *  注意：產生器追的是「停在目標」，目標以 20~100Hz 連續跳動 (串流路徑) 時會落後約 v * sqrt(v / J)；
+ *        這類路徑請用 Robot_SetTargetState (運動學前饋) 或 PVT 點，產生器此時以 sync() 跟隨。
+ */
+
+#ifndef SCURVE_GENERATOR_HPP
+#define SCURVE_GENERATOR_HPP
+
+#include <cstdint>
+#include <cmath>
+
+class SCurveGenerator {
+public:
+    /**
+     * @param max_velocity 速度上限 V (單位/s，關節使用 Deg/s)
+     * @param max_acceleration 加速度上限 A (單位/s²)
+     * @param max_jerk 加加速度上限 J (單位/s³)
+     */
+    SCurveGenerator(float max_velocity, float max_acceleration, float max_jerk)
+        : _v_max(max_velocity), _a_max(max_acceleration), _j_max(max_jerk) {
+        reset(0.0f);
+    }
+
+    /**
+     * @brief 前進一個 tick
+     * @param target 目標位置 (可在移動中途任意改變)
+     * @param dt 時間間隔 (s)
+     * @param max_velocity 本 tick 的速度上限 (例如接近奇異構型時降速)，<= 0 表示使用建構時的 V
+     */
+    void update(float target, float dt, float max_velocity = 0.0f);
+
+    // 停在 pos (開機、測試模式結束或停機後，以實測位置重新對齊)
+    void reset(float pos) { sync(pos, 0.0f, 0.0f); }
+
+    // 直接設定狀態 (外部軌跡接管期間逐 tick 跟隨，交還控制時從該狀態平滑接續)
+    void sync(float pos, float vel, float acc) {
+        _pos = pos;
+        _vel = vel;
+        _acc = acc;
+        _jerk = 0.0f;
+    }
+
+    void setLimits(float max_velocity, float max_acceleration, float max_jerk) {
+        _v_max = max_velocity;
+        _a_max = max_acceleration;
+        _j_max = max_jerk;
+    }
+
+    float getPosition() const { return _pos; }
+    float getVelocity() const { return _vel; }
+    float getAcceleration() const { return _acc; }
+    float getJerk() const { return _jerk; }
+
+    /**
+     * @brief 從 (v, a) 以最大煞車 (先把 a 推到 -A，再收回 0) 停下所走的位移
+     * @note 公開給規劃工具估算停止距離；J / A 使用目前的限制
+     */
+    float stoppingDistance(float vel, float acc) const;
+
+private:
+    static constexpr int BISECT_ITERATIONS = 12;
+
+    // 套用 jerk 一個 tick 後的狀態 (相對位移)
+    struct Step {
+        float dp, v, a;
+    };
+    static Step integrate(float v, float a, float j, float dt) {
+        Step s;
+        s.dp = dt * (v + dt * (0.5f * a + dt * (j * (1.0f / 6.0f))));
+        s.v = v + dt * (a + 0.5f * j * dt);
+        s.a = a + j * dt;
+        return s;
+    }
+
+    float _v_max, _a_max, _j_max;
+    float _pos, _vel, _acc, _jerk;
+};
+
+#endif // SCURVE_GENERATOR_HPP
@@ -0,0 +1,195 @@
+/**
+ * @file spsc_ring_buffer.hpp
+ * @brief 固定容量、單一生產者 / 單一消費者 (SPSC) 的無鎖環形緩衝區
+ * @details
+ *  供 CommTask (上位機 / micro-ROS 送入軌跡點) 與 1kHz ControlTask (取出執行) 之間傳遞資料：
+ *    - 靜態陣列，不做任何動態配置 (取代 std::queue 的 deque 配置)
+ *    - push / pop 皆為 wait-free：只讀對方的索引 (acquire)、寫自己的索引 (release)，
+ *      不關中斷、不用 mutex，生產者與消費者可以是不同的 Task 或 ISR
+ *    - 索引為自由遞增的 uint32_t，以 & (Capacity - 1) 取位置，滿 / 空不需要保留一格
+ *    - 生產者與消費者的索引各自對齊到 SPSC_CACHE_LINE_SIZE，避免 false sharing
+ *      (Cortex-M4 沒有 data cache，對 MCU 無影響；Host 工具與 Cortex-M7 才有差)
+ *  統計：
+ *    - highWatermark() ：push 之後觀察到的最大填充量 (評估容量是否足夠)
+ *    - overruns()      ：緩衝區已滿而被拒絕的元素數 (生產者太快)
+ *    - underruns()     ：緩衝區為空時的 pop 次數 (消費者餓死，軌跡斷流)
+ *  規則：push* / reserve / commit 只能由同一個執行緒呼叫，pop* / peek / drop / discard 只能由另一個固定的執行緒呼叫；
+ *        size() / 統計值兩邊都可以讀 (只是當下的快照)
+ */
+
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <cstdint>
+#include <atomic>
+
+#ifndef SPSC_CACHE_LINE_SIZE
+#define SPSC_CACHE_LINE_SIZE 32
+#endif
+
+/**
+ * @tparam T 元素型別 (需可複製)
+ * @tparam Capacity 容量，必須是 2 的次方
+ */
+template <typename T, uint32_t Capacity>
+class SpscRingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscRingBuffer() : _head(0), _high_watermark(0), _overruns(0), _tail(0), _underruns(0) {}
+
+    // ==========================================================
+    // 生產者
+    // ==========================================================
+
+    /**
+     * @brief 放入一個元素
+     * @return 已滿時回傳 false (計入 overruns)
+     */
+    bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail >= Capacity) {
+            _overruns.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _buf[head & MASK] = item;
+        _head.store(head + 1, std::memory_order_release);
+        updateWatermark(head + 1 - tail);
+        return true;
+    }
+
+    /**
+     * @brief 一次放入多個元素 (只發佈一次索引，消費者看到的是整批)
+     * @return 實際放入的數量；空間不足時只放入前面放得下的部分，其餘計入 overruns
+     */
+    uint32_t pushBulk(const T* items, uint32_t count) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        uint32_t space = Capacity - (head - tail);
+        uint32_t n = (count < space) ? count : space;
+        for (uint32_t i = 0; i < n; ++i) _buf[(head + i) & MASK] = items[i];
+        if (n < count) _overruns.fetch_add(count - n, std::memory_order_relaxed);
+        if (n == 0) return 0;
+        _head.store(head + n, std::memory_order_release);
+        updateWatermark(head + n - tail);
+        return n;
+    }
+
+    /**
+     * @brief 取得尚未發佈的第 offset 個空位，讓生產者就地寫入 (例如串流解碼器直接把點解在緩衝區裡)
+     * @return 空間不足時回傳 nullptr (不計入 overruns)
+     * @note 寫入的元素在 commit() 之前消費者看不到；head 只由生產者移動，指標在 commit() 之前都有效
+     */
+    T* reserve(uint32_t offset) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        if (head - tail + offset >= Capacity) return nullptr;
+        return &_buf[(head + offset) & MASK];
+    }
+
+    /**
+     * @brief 發佈 reserve() 寫好的前 count 個元素 (只發佈一次索引)
+     * @param rejected 放不下而被丟棄的元素數，計入 overruns
+     */
+    void commit(uint32_t count, uint32_t rejected = 0) {
+        if (rejected) _overruns.fetch_add(rejected, std::memory_order_relaxed);
+        if (count == 0) return;
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        _head.store(head + count, std::memory_order_release);
+        updateWatermark(head + count - tail);
+    }
+
+    // ==========================================================
+    // 消費者
+    // ==========================================================
+
+    /**
+     * @brief 取出一個元素
+     * @return 為空時回傳 false (計入 underruns)，*item 不變
+     */
+    bool pop(T* item) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) {
+            _underruns.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        *item = _buf[tail & MASK];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 查看第 index 個待取元素 (0 = 下一個 pop 的元素)，不取出
+     * @return 元素數不足時回傳 nullptr (不計入 underruns)
+     * @note 指標在消費者下一次 pop 之前有效
+     */
+    const T* peek(uint32_t index = 0) const {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        if (head - tail <= index) return nullptr;
+        return &_buf[(tail + index) & MASK];
+    }
+
+    /**
+     * @brief 丟掉前 count 個待取元素 (搭配 peek 就地讀取較大的元素，不必複製)
+     * @return 實際丟掉的數量
+     */
+    uint32_t drop(uint32_t count = 1) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        uint32_t n = (count < head - tail) ? count : head - tail;
+        _tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // 丟掉所有待取元素 (消費者端呼叫，例如急停)
+    void discard() {
+        _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // ==========================================================
+    // 狀態 / 統計 (任一端皆可讀)
+    // ==========================================================
+    uint32_t size() const {
+        uint32_t tail = _tail.load(std::memory_order_acquire);
+        uint32_t head = _head.load(std::memory_order_acquire);
+        return head - tail;
+    }
+    uint32_t space() const { return Capacity - size(); }
+    bool empty() const { return size() == 0; }
+    static constexpr uint32_t capacity() { return Capacity; }
+
+    uint32_t highWatermark() const { return _high_watermark.load(std::memory_order_relaxed); }
+    uint32_t overruns() const { return _overruns.load(std::memory_order_relaxed); }
+    uint32_t underruns() const { return _underruns.load(std::memory_order_relaxed); }
+
+    // 清除統計 (資料不動)；與 push / pop 同時呼叫時可能漏掉一筆計數
+    void resetStats() {
+        _high_watermark.store(0, std::memory_order_relaxed);
+        _overruns.store(0, std::memory_order_relaxed);
+        _underruns.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t MASK = Capacity - 1;
+
+    // 水位只由生產者更新，單純 load / store 即可
+    void updateWatermark(uint32_t level) {
+        if (level > _high_watermark.load(std::memory_order_relaxed))
+            _high_watermark.store(level, std::memory_order_relaxed);
+    }
+
+    // 生產者寫、消費者讀
+    alignas(SPSC_CACHE_LINE_SIZE) std::atomic<uint32_t> _head;
+    std::atomic<uint32_t> _high_watermark;
+    std::atomic<uint32_t> _overruns;
+    // 消費者寫、生產者讀
+    alignas(SPSC_CACHE_LINE_SIZE) std::atomic<uint32_t> _tail;
+    std::atomic<uint32_t> _underruns;
+    alignas(SPSC_CACHE_LINE_SIZE) T _buf[Capacity];
+};
+
+#endif // SPSC_RING_BUFFER_HPP
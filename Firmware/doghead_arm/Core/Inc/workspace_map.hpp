@@ -0,0 +1,79 @@
+/**
+ * @file workspace_map.hpp
+ * @brief 工作空間地圖：可達 / 遠離奇異構型的笛卡兒格子 bitmap + O(1) 查詢
+ * @details
+ *  - 地圖由 Host 工具 Tools/workspace_map_gen 產生，輸出 Core/Src/workspace_map_table.cpp
+ *    (const 陣列，放在 Flash)
+ *  - 每格兩個 bit：
+ *      reachable：格內所有取樣點 (含四個角) 都解得出 IK，且在 Y 虛擬圍籬之上
+ *      writable ：reachable，且 singularityDistance 全部 >= min_singularity
+ *    判定是保守的：格內只要有一個取樣點不合格，整格就不算
+ *  - reachable 但非 writable 的格子即為奇異構型附近的帶狀區域
+ *  - 查詢：2 次乘法 + 1 次讀取，路徑規劃可以逐點檢查，不必等控制迴圈逐 tick 發現解不出來
+ */
+
+#ifndef WORKSPACE_MAP_HPP
+#define WORKSPACE_MAP_HPP
+
+#include <cstdint>
+#include "kinematics.hpp"
+
+/**
+ * @brief 地圖表格描述 (由產生器輸出)
+ */
+struct WorkspaceMapTable {
+    float x_min;                // 第 0 欄格子的左緣 X 座標 (mm)
+    float y_min;                // 第 0 列格子的下緣 Y 座標 (mm)
+    float cell;                 // 格子邊長 (mm)
+    float inv_cell;             // 1 / 格子邊長
+    uint16_t nx;                // X 方向格數
+    uint16_t ny;                // Y 方向格數
+    float min_singularity;      // writable 的 singularityDistance 門檻
+    const uint32_t* reachable;  // bit (iy * nx + ix)，LSB first
+    const uint32_t* writable;   // 同上
+};
+
+class WorkspaceMap {
+public:
+    explicit WorkspaceMap(const WorkspaceMapTable& table) : _t(table) {}
+
+    /**
+     * @brief 可以安全書寫：可達且遠離奇異構型 (地圖外一律 false)
+     */
+    bool isWritable(float x, float y) const { return test(_t.writable, x, y); }
+    bool isWritable(Point2D p) const { return test(_t.writable, p.x, p.y); }
+
+    /**
+     * @brief 可達 (IK 有解、在圍籬之上)，可能很接近奇異構型
+     */
+    bool isReachable(float x, float y) const { return test(_t.reachable, x, y); }
+    bool isReachable(Point2D p) const { return test(_t.reachable, p.x, p.y); }
+
+    /**
+     * @brief 可達但位於奇異構型附近的帶狀區域 (需要降速)
+     */
+    bool isNearSingular(float x, float y) const {
+        return isReachable(x, y) && !isWritable(x, y);
+    }
+
+    const WorkspaceMapTable& table() const { return _t; }
+
+private:
+    bool test(const uint32_t* plane, float x, float y) const {
+        float fx = (x - _t.x_min) * _t.inv_cell;
+        float fy = (y - _t.y_min) * _t.inv_cell;
+        if (!(fx >= 0.0f && fy >= 0.0f)) return false;  // 同時擋掉 NaN
+        uint32_t ix = (uint32_t)fx;
+        uint32_t iy = (uint32_t)fy;
+        if (ix >= _t.nx || iy >= _t.ny) return false;
+        uint32_t bit = iy * _t.nx + ix;
+        return (plane[bit >> 5] >> (bit & 31u)) & 1u;
+    }
+
+    const WorkspaceMapTable& _t;
+};
+
+// 產生的工作空間地圖 (Core/Src/workspace_map_table.cpp)
+extern const WorkspaceMapTable WORKSPACE_MAP_DOGARM;
+
+#endif // WORKSPACE_MAP_HPP
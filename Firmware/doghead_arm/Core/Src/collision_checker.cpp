@@ -0,0 +1,135 @@
+/**
+ * @file collision_checker.cpp
+ * @brief 膠囊體碰撞檢查實作 (2D 線段距離測試)
+ */
+
+#include "collision_checker.hpp"
+
+// ==========================================================
+// 2D 幾何輔助
+// ==========================================================
+
+static inline float cross(float ax, float ay, float bx, float by) { return ax * by - ay * bx; }
+
+/**
+ * @brief |p - 線段 ab| < r (不需要除法)
+ * @details 投影落在端點外側時比較端點距離；落在線段內時 dist^2 = cross^2 / |ab|^2，
+ *          兩邊同乘 |ab|^2 改成 cross^2 < r^2 * |ab|^2
+ */
+static bool pointSegmentWithin(Point2D p, Point2D a, Point2D b, float r2) {
+    float abx = b.x - a.x, aby = b.y - a.y;
+    float apx = p.x - a.x, apy = p.y - a.y;
+    float dot = apx * abx + apy * aby;
+    if (dot <= 0.0f) return apx * apx + apy * apy < r2;
+    float len2 = abx * abx + aby * aby;
+    if (dot >= len2) {
+        float bpx = p.x - b.x, bpy = p.y - b.y;
+        return bpx * bpx + bpy * bpy < r2;
+    }
+    float c = cross(abx, aby, apx, apy);
+    return c * c < r2 * len2;
+}
+
+// 線段 ab 與 cd 嚴格相交 (端點接觸 / 共線由距離測試處理)
+static bool segmentsCross(Point2D a, Point2D b, Point2D c, Point2D d) {
+    float o1 = cross(b.x - a.x, b.y - a.y, c.x - a.x, c.y - a.y);
+    float o2 = cross(b.x - a.x, b.y - a.y, d.x - a.x, d.y - a.y);
+    float o3 = cross(d.x - c.x, d.y - c.y, a.x - c.x, a.y - c.y);
+    float o4 = cross(d.x - c.x, d.y - c.y, b.x - c.x, b.y - c.y);
+    return (o1 * o2 < 0.0f) && (o3 * o4 < 0.0f);
+}
+
+/**
+ * @brief 兩膠囊 (半徑和 r) 相交：線段相交，或四個端點到對方線段的距離 < r
+ */
+static bool segmentsWithin(Point2D a, Point2D b, Point2D c, Point2D d, float r) {
+    float r2 = r * r;
+    return segmentsCross(a, b, c, d) ||
+           pointSegmentWithin(a, c, d, r2) || pointSegmentWithin(b, c, d, r2) ||
+           pointSegmentWithin(c, a, b, r2) || pointSegmentWithin(d, a, b, r2);
+}
+
+// 點到線段的距離 (clearance 使用)
+static float pointSegmentDistance(Point2D p, Point2D a, Point2D b) {
+    float abx = b.x - a.x, aby = b.y - a.y;
+    float len2 = abx * abx + aby * aby;
+    float t = (len2 > 0.0f) ? ((p.x - a.x) * abx + (p.y - a.y) * aby) / len2 : 0.0f;
+    t = std::fmax(0.0f, std::fmin(1.0f, t));
+    return std::hypot(p.x - (a.x + t * abx), p.y - (a.y + t * aby));
+}
+
+static float segmentDistance(Point2D a, Point2D b, Point2D c, Point2D d) {
+    if (segmentsCross(a, b, c, d)) return 0.0f;
+    return std::fmin(std::fmin(pointSegmentDistance(a, c, d), pointSegmentDistance(b, c, d)),
+                     std::fmin(pointSegmentDistance(c, a, b), pointSegmentDistance(d, a, b)));
+}
+
+// ==========================================================
+// CollisionChecker
+// ==========================================================
+
+uint32_t CollisionChecker::check(const LinkagePose& p) const {
+    uint32_t flags = 0;
+    const float r = _m.link_radius;
+
+    // 1. 不相鄰的連桿對
+    if (segmentsWithin(p.base1, p.elbow1, p.base2, p.elbow2, 2.0f * r) ||
+        segmentsWithin(p.base1, p.elbow1, p.elbow2, p.end, 2.0f * r) ||
+        segmentsWithin(p.base2, p.elbow2, p.elbow1, p.end, 2.0f * r)) {
+        flags |= COLLISION_LINK_LINK;
+    }
+
+    // 2. 共用關節的連桿夾角：cos(夾角) * |u| * |v| = u·v，桿長固定，直接比較內積
+    float d1 = (p.base1.x - p.elbow1.x) * (p.end.x - p.elbow1.x) + (p.base1.y - p.elbow1.y) * (p.end.y - p.elbow1.y);
+    float d2 = (p.base2.x - p.elbow2.x) * (p.end.x - p.elbow2.x) + (p.base2.y - p.elbow2.y) * (p.end.y - p.elbow2.y);
+    float de = (p.elbow1.x - p.end.x) * (p.elbow2.x - p.end.x) + (p.elbow1.y - p.end.y) * (p.elbow2.y - p.end.y);
+    if (d1 > _m.fold_dot_l1l2 || d2 > _m.fold_dot_l1l2 || de > _m.fold_dot_l2l2) {
+        flags |= COLLISION_FOLD;
+    }
+
+    // 3. 底座：主動臂對另一顆馬達，從動臂對兩馬達之間的整段底座
+    const float rb = _m.motor_radius + r;
+    const float rb2 = rb * rb;
+    if (pointSegmentWithin(p.base2, p.base1, p.elbow1, rb2) ||
+        pointSegmentWithin(p.base1, p.base2, p.elbow2, rb2) ||
+        segmentsWithin(p.elbow1, p.end, p.base1, p.base2, rb) ||
+        segmentsWithin(p.elbow2, p.end, p.base1, p.base2, rb)) {
+        flags |= COLLISION_BASE;
+    }
+
+    // 4. 壓紙條
+    if (_m.holder.radius > 0.0f) {
+        const Capsule& h = _m.holder;
+        const float rh = h.radius + r;
+        if (segmentsWithin(p.base1, p.elbow1, h.a, h.b, rh) ||
+            segmentsWithin(p.base2, p.elbow2, h.a, h.b, rh) ||
+            segmentsWithin(p.elbow1, p.end, h.a, h.b, rh) ||
+            segmentsWithin(p.elbow2, p.end, h.a, h.b, rh)) {
+            flags |= COLLISION_PAPER_HOLDER;
+        }
+    }
+    return flags;
+}
+
+float CollisionChecker::clearance(const LinkagePose& p) const {
+    const float r = _m.link_radius;
+    float c = segmentDistance(p.base1, p.elbow1, p.base2, p.elbow2) - 2.0f * r;
+    c = std::fmin(c, segmentDistance(p.base1, p.elbow1, p.elbow2, p.end) - 2.0f * r);
+    c = std::fmin(c, segmentDistance(p.base2, p.elbow2, p.elbow1, p.end) - 2.0f * r);
+
+    const float rb = _m.motor_radius + r;
+    c = std::fmin(c, pointSegmentDistance(p.base2, p.base1, p.elbow1) - rb);
+    c = std::fmin(c, pointSegmentDistance(p.base1, p.base2, p.elbow2) - rb);
+    c = std::fmin(c, segmentDistance(p.elbow1, p.end, p.base1, p.base2) - rb);
+    c = std::fmin(c, segmentDistance(p.elbow2, p.end, p.base1, p.base2) - rb);
+
+    if (_m.holder.radius > 0.0f) {
+        const Capsule& h = _m.holder;
+        const float rh = h.radius + r;
+        c = std::fmin(c, segmentDistance(p.base1, p.elbow1, h.a, h.b) - rh);
+        c = std::fmin(c, segmentDistance(p.base2, p.elbow2, h.a, h.b) - rh);
+        c = std::fmin(c, segmentDistance(p.elbow1, p.end, h.a, h.b) - rh);
+        c = std::fmin(c, segmentDistance(p.elbow2, p.end, h.a, h.b) - rh);
+    }
+    return c;
+}
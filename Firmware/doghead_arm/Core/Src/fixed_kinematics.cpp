@@ -0,0 +1,276 @@
+/**
+ * @file fixed_kinematics.cpp
+ * @brief 定點數五連桿運動學實作 (CORDIC + 整數開方，無 FPU、無除法)
+ */
+
+#include "fixed_kinematics.hpp"
+
+namespace fixedpoint {
+
+// ==========================================================
+// CORDIC 常數
+// ==========================================================
+static const int CORDIC_ITERATIONS = 26;  // 殘餘角度誤差 <= atan(2^-25) = 3e-8 rad
+
+// atan(2^-i)，Q3.28
+static const int32_t CORDIC_ATAN[CORDIC_ITERATIONS] = {
+    210828714, 124459457, 65760959, 33381290, 16755422, 8385879, 4193963, 2097109,
+    1048571, 524287, 262144, 131072, 65536, 32768, 16384, 8192,
+    4096, 2048, 1024, 512, 256, 128, 64, 32,
+    16, 8,
+};
+
+// 1 / prod(sqrt(1 + 2^-2i)) = 0.607252935，Q1.30
+static const int32_t CORDIC_INV_GAIN = 652032874;
+
+static const q28_t ANGLE_TWO_PI = 1686629713;
+
+// vectoring 前把輸入正規化到 [2^28, 2^29)：
+// 旋轉後長度 <= sqrt(2) * 2^29 * 1.647 < 2^31，且保留最多有效位元
+static const int CORDIC_INPUT_BITS = 29;
+
+// 條件取負：mask = 0 -> v, mask = -1 -> -v (不產生分支)
+static inline int32_t negateIf(int32_t v, int32_t mask) {
+    return (v ^ mask) - mask;
+}
+
+// 帶號位移：sh > 0 右移，sh < 0 左移 (避免對負數左移的未定義行為)
+static inline int64_t shiftSigned(int64_t v, int sh) {
+    return (sh >= 0) ? (v >> sh) : (int64_t)((uint64_t)v << -sh);
+}
+
+static inline int bitLength(uint64_t v) {
+    return v ? 64 - __builtin_clzll(v) : 0;
+}
+
+// ==========================================================
+// CORDIC vectoring：atan2 + 向量長度
+// ==========================================================
+q28_t atan2(int64_t y, int64_t x, int64_t* magnitude) {
+    uint64_t ax = (x < 0) ? (uint64_t)(-x) : (uint64_t)x;
+    uint64_t ay = (y < 0) ? (uint64_t)(-y) : (uint64_t)y;
+    if ((ax | ay) == 0) {
+        if (magnitude) *magnitude = 0;
+        return 0;
+    }
+
+    // 1. 正規化
+    int sh = bitLength(ax | ay) - CORDIC_INPUT_BITS;
+    int32_t xs = (int32_t)shiftSigned(x, sh);
+    int32_t ys = (int32_t)shiftSigned(y, sh);
+
+    // 2. 左半平面先轉 ±90°，讓 CORDIC 的收斂範圍 (±99.7°) 涵蓋整圈
+    int32_t z = 0;
+    if (xs < 0) {
+        int32_t t = xs;
+        if (ys >= 0) {
+            xs = ys;
+            ys = -t;
+            z = ANGLE_HALF_PI;
+        } else {
+            xs = -ys;
+            ys = t;
+            z = -ANGLE_HALF_PI;
+        }
+    }
+
+    // 3. 迭代：把 y 轉到 0，累積的旋轉角即為 atan2
+    for (int i = 0; i < CORDIC_ITERATIONS; ++i) {
+        int32_t mask = ys >> 31;  // y < 0 -> -1
+        int32_t dx = negateIf(ys >> i, mask);
+        int32_t dy = negateIf(xs >> i, mask);
+        xs += dx;
+        ys -= dy;
+        z += negateIf(CORDIC_ATAN[i], mask);
+    }
+
+    // 4. 長度 = x / 增益，再還原正規化的位移
+    if (magnitude) {
+        int64_t r = ((int64_t)xs * CORDIC_INV_GAIN) >> UNIT_FRAC_BITS;
+        *magnitude = shiftSigned(r, -sh);
+    }
+    return z;
+}
+
+// ==========================================================
+// CORDIC rotation：sin / cos
+// ==========================================================
+void sincos(q28_t angle, int32_t* s, int32_t* c) {
+    // 1. 化簡到 [-π, π]，再折到 [-π/2, π/2] (記錄是否需要取負)
+    int32_t z = angle;
+    if (z > ANGLE_PI) z -= ANGLE_TWO_PI;
+    else if (z < -ANGLE_PI) z += ANGLE_TWO_PI;
+
+    int32_t flip = 0;
+    if (z > ANGLE_HALF_PI) {
+        z -= ANGLE_PI;
+        flip = -1;
+    } else if (z < -ANGLE_HALF_PI) {
+        z += ANGLE_PI;
+        flip = -1;
+    }
+
+    // 2. 從 (1/增益, 0) 開始旋轉，結束時剛好是單位長度
+    int32_t x = CORDIC_INV_GAIN;
+    int32_t y = 0;
+    for (int i = 0; i < CORDIC_ITERATIONS; ++i) {
+        int32_t mask = z >> 31;  // z < 0 -> 反向旋轉
+        int32_t dx = negateIf(y >> i, mask);
+        int32_t dy = negateIf(x >> i, mask);
+        x -= dx;
+        y += dy;
+        z -= negateIf(CORDIC_ATAN[i], mask);
+    }
+
+    *c = negateIf(x, flip);
+    *s = negateIf(y, flip);
+}
+
+// ==========================================================
+// 整數開方 (逐位元，固定 32 次，無分支)
+// ==========================================================
+uint32_t isqrt64(uint64_t v) {
+    uint64_t rem = v;
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    for (int i = 0; i < 32; ++i) {
+        uint64_t trial = root + bit;
+        uint64_t take = (uint64_t)0 - (uint64_t)(rem >= trial);  // 全 1 或全 0
+        rem -= trial & take;
+        root = (root >> 1) + (bit & take);
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+} // namespace fixedpoint
+
+using namespace fixedpoint;
+
+// 內部長度多保留 4 個小數位元 (Q20)，避免肘距 / 交點距離在中途被捨入到 Q16：
+// 300mm 的平方在 Q40 仍 < 2^57，不會溢位
+static const int INTERNAL_EXTRA_BITS = 4;
+
+static inline q16_t roundToQ16(int64_t v) {
+    return (q16_t)((v + (1 << (INTERNAL_EXTRA_BITS - 1))) >> INTERNAL_EXTRA_BITS);
+}
+
+// ==========================================================
+// 輔助：肘部夾角 β = acos((L1^2 - L2^2 + dist^2) / (2 * L1 * dist))
+// ==========================================================
+// 令 n = L1^2 - L2^2 + dist^2、m = 2 * L1 * dist，則
+//   m - n = L2^2 - (dist - L1)^2,  m + n = (dist + L1)^2 - L2^2
+//   β = atan2(sqrt((m - n)(m + n)), n)
+// 不需要除法，也不需要 acos
+static q28_t elbowAngle(int64_t dist, int64_t l1, int64_t l2_sq) {
+    // dist, l1: Q20；l2_sq: Q40
+    int64_t dm = dist - l1;
+    int64_t dp = dist + l1;
+    int64_t m_minus_n = l2_sq - dm * dm;  // Q40
+    int64_t m_plus_n = dp * dp - l2_sq;   // Q40
+    if (m_minus_n < 0) m_minus_n = 0;     // 邊界上的捨入
+    if (m_plus_n < 0) m_plus_n = 0;
+
+    // 縮到 31 位元以內，乘積才不會溢位 (只有比例有意義)
+    int sh = bitLength((uint64_t)(m_minus_n | m_plus_n)) - 31;
+    if (sh > 0) {
+        m_minus_n >>= sh;
+        m_plus_n >>= sh;
+    }
+
+    int64_t s = isqrt64((uint64_t)(m_minus_n * m_plus_n));
+    int64_t n = (m_plus_n - m_minus_n) >> 1;
+    return atan2(s, n, nullptr);
+}
+
+// ==========================================================
+// 逆向運動學
+// ==========================================================
+MotorAnglesQ FixedFiveBarKinematics::solveIK(Point2Q target, int solution_mode) const {
+    MotorAnglesQ result;
+    result.is_reachable = false;
+    result.theta1 = 0;
+    result.theta2 = 0;
+    const FixedFiveBarGeometry& G = _geo;
+
+    // 1. 左右馬達到目標點的距離 (Q20) 與方位角
+    int64_t x = (int64_t)target.x << INTERNAL_EXTRA_BITS;
+    int64_t y = (int64_t)target.y << INTERNAL_EXTRA_BITS;
+    int64_t dist_L, dist_R;
+    q28_t alpha_L = atan2(y, x, &dist_L);
+    q28_t alpha_R = atan2(y, x - ((int64_t)G.d << INTERNAL_EXTRA_BITS), &dist_R);
+
+    // 檢查是否超出範圍
+    const int64_t reach_max = (int64_t)G.reach_max << INTERNAL_EXTRA_BITS;
+    const int64_t reach_min = (int64_t)G.reach_min << INTERNAL_EXTRA_BITS;
+    if (dist_L > reach_max || dist_L < reach_min) return result;
+    if (dist_R > reach_max || dist_R < reach_min) return result;
+
+    // 2. 肘部夾角
+    const int64_t l1 = (int64_t)G.l1 << INTERNAL_EXTRA_BITS;
+    const int64_t l2_sq = G.l2_sq << (2 * INTERNAL_EXTRA_BITS);
+    q28_t beta_L = elbowAngle(dist_L, l1, l2_sq);
+    q28_t beta_R = elbowAngle(dist_R, l1, l2_sq);
+
+    // 3. 組合 (與 FiveBarKinematics 相同的手肘模式定義)
+    if (solution_mode >= 0) {
+        result.theta1 = alpha_L + beta_L;
+        result.theta2 = alpha_R - beta_R;
+    } else {
+        result.theta1 = alpha_L - beta_L;
+        result.theta2 = alpha_R + beta_R;
+    }
+    result.is_reachable = true;
+    return result;
+}
+
+// ==========================================================
+// 正向運動學
+// ==========================================================
+Point2Q FixedFiveBarKinematics::solveFK(q28_t theta1, q28_t theta2) const {
+    const FixedFiveBarGeometry& G = _geo;
+    Point2Q P = {0, 0};
+
+    // 1. 兩個肘部座標 (Q16 * Q1.30 -> Q20)
+    const int UNIT_TO_Q20 = UNIT_FRAC_BITS - INTERNAL_EXTRA_BITS;
+    int32_t s1, c1, s2, c2;
+    sincos(theta1, &s1, &c1);
+    sincos(theta2, &s2, &c2);
+
+    int64_t E1_x = ((int64_t)G.l1 * c1) >> UNIT_TO_Q20;
+    int64_t E1_y = ((int64_t)G.l1 * s1) >> UNIT_TO_Q20;
+    int64_t E2_x = ((int64_t)G.d << INTERNAL_EXTRA_BITS) + (((int64_t)G.l1 * c2) >> UNIT_TO_Q20);
+    int64_t E2_y = ((int64_t)G.l1 * s2) >> UNIT_TO_Q20;
+
+    // 2. 肘距與方向
+    int64_t dx = E2_x - E1_x;
+    int64_t dy = E2_y - E1_y;
+    int64_t d;
+    q28_t phi = atan2(dy, dx, &d);
+
+    // 檢查是否有解
+    if (d > ((int64_t)G.two_l2 << INTERNAL_EXTRA_BITS) || d == 0) return P;
+
+    // 3. 交點到中點的距離 h = sqrt(L2^2 - d^2 / 4) (Q40 開方 -> Q20)
+    int64_t h_sq = (G.l2_sq << (2 * INTERNAL_EXTRA_BITS)) - ((d * d) >> 2);
+    if (h_sq < 0) h_sq = 0;
+    int64_t h = isqrt64((uint64_t)h_sq);
+
+    // 4. 交點 = 中點 ± h * (-sin φ, cos φ)
+    int32_t sp, cp;
+    sincos(phi, &sp, &cp);
+    int64_t hx = (h * sp) >> UNIT_FRAC_BITS;
+    int64_t hy = (h * cp) >> UNIT_FRAC_BITS;
+    int64_t mx = E1_x + (dx >> 1);
+    int64_t my = E1_y + (dy >> 1);
+
+    // 與 FiveBarKinematics 相同：Y 為負 (往後指) 時取另一個解
+    if (my + hy >= 0) {
+        P.x = roundToQ16(mx - hx);
+        P.y = roundToQ16(my + hy);
+    } else {
+        P.x = roundToQ16(mx + hx);
+        P.y = roundToQ16(my - hy);
+    }
+    return P;
+}
@@ -35,6 +35,8 @@ extern Motor_t motor_joint_8pin;
 // 全域除錯變數 (可在 Live Watch 中觀察)
 volatile float debug_speed_m1 = 0.0f;
 volatile float debug_speed_m2 = 0.0f;
+volatile uint32_t debug_control_stack_free = 0;  // ControlTask 歷史最少剩餘 stack (words)
+volatile uint32_t debug_comm_stack_free = 0;     // CommTask 歷史最少剩餘 stack (words)
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -54,7 +56,16 @@ volatile float debug_speed_m2 = 0.0f;
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN Variables */
-
+// ControlTask stack (words)：Robot_Loop 的 frame 約 416 B，每個 tick 再往下呼叫
+// IkCache::solve -> IncrementalIk::solve -> solveIK (Host -fstack-usage 合計約 800 B)，
+// 加上 FPU 例外框架 104 B 與中斷巢狀，256 words 沒有餘裕；實機以 debug_control_stack_free 確認
+#define CONTROL_TASK_STACK_WORDS 512
+// CommTask stack (words)：目標 API 在呼叫端做可達性 / 碰撞檢查 (Robot_MoveArc -> startPath -> targetCollides
+// -> solveIK / CollisionChecker::check，Host -fstack-usage 合計約 500 B)，加上 printf 浮點格式化 (newlib 約 700 B)
+// 與 FPU 例外框架，256 words 不夠；實機以 debug_comm_stack_free 確認
+// (heap 20000 B：defaultTask 12000 + ControlTask 2048 + CommTask 2048 + Idle / Timer 1536 + TCB，約剩 1.7 KB)
+#define COMM_TASK_STACK_WORDS 512
+static TaskHandle_t controlTaskHandle = NULL;
 /* USER CODE END Variables */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -111,6 +122,8 @@ void CommTask(void *argument)
     // 讀取並儲存當前馬達速度 (由 ControlTask 中的 Motor_Update 更新)
     debug_speed_m1 = Motor_GetVelocity(&motor_joint_13pin);
     debug_speed_m2 = Motor_GetVelocity(&motor_joint_8pin);
+    debug_control_stack_free = uxTaskGetStackHighWaterMark(controlTaskHandle);
+    debug_comm_stack_free = uxTaskGetStackHighWaterMark(NULL);
 
     // 範例：定期輸出診斷資訊
     // 你可以在這裡讀取馬達狀態、編碼器位置等，然後透過 UART 輸出
@@ -118,7 +131,8 @@ void CommTask(void *argument)
     
     // 每 1 秒輸出一次 (10Hz * 10 = 1s)
     if (counter % 10 == 0) {
-      printf("M1 RPM: %.2f, M2 RPM: %.2f\r\n", debug_speed_m1, debug_speed_m2);
+      printf("M1 RPM: %.2f, M2 RPM: %.2f, stack free: Control %lu / Comm %lu words\r\n", debug_speed_m1, debug_speed_m2,
+             (unsigned long)debug_control_stack_free, (unsigned long)debug_comm_stack_free);
     }
     
     // 未來在這裡處理：
@@ -136,11 +150,10 @@ void CommTask(void *argument)
 void MX_FREERTOS_Init(void)
 {
   // 建立控制任務 (最高優先級 = 3)
-  TaskHandle_t controlTaskHandle = NULL;
   xTaskCreate(
     ControlTask,           // 任務函式
     "ControlTask",         // 任務名稱 (用於除錯)
-    256,                   // Stack 大小 (單位: words, 1 word = 4 bytes)
+    CONTROL_TASK_STACK_WORDS, // Stack 大小 (單位: words, 1 word = 4 bytes)
     NULL,                  // 任務參數
     3,                     // 優先級 (數字越大優先級越高)
     &controlTaskHandle     // 任務控制代碼
@@ -151,7 +164,7 @@ void MX_FREERTOS_Init(void)
   xTaskCreate(
     CommTask,
     "CommTask",
-    256,
+    COMM_TASK_STACK_WORDS,
     NULL,
     2,
     &commTaskHandle
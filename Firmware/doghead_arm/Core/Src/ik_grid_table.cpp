@@ -0,0 +1,133 @@
+/**
+ * @file ik_grid_table.cpp
+ * @brief [自動產生] 書寫區 IK 查表網格，請勿手動修改
+ * @details 產生器: Tools/ik_grid_gen --step 2.000
+ *   幾何 L1=100.000 L2=150.000 D=60.000 mm，書寫區 X[-60.0, 120.0] Y[100.0, 200.0] mm
+ *   91 x 51 節點 (18564 bytes)，最大內插誤差 2.03e-04 rad / 0.0150 mm
+ */
+
+#include "ik_lookup_grid.hpp"
+#include "arm_geometry.hpp"
+
+// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)
+static_assert(dogArmGeometryMatches(100.0f, 150.0f, 60.0f),
+              "ik_grid_table.cpp was generated for another geometry: rerun Tools/ik_grid_gen");
+
+static const int16_t IK_GRID_THETA1[4641] = {
+    11209, 11157, 11100, 11038, 10972, 10901, 10825, 10744, 10657, 10566, 10469, 10367, 10260, 10147, 10029, 9905, 9775, 9640, 9499, 9352, 9199, 9041, 8878, 8708, 8533, 8353, 8167, 7976, 7779, 7578, 7372, 7161, 6945, 6726, 6502, 6274, 6042, 5806, 5568, 5326, 5082, 4834, 4585, 4333, 4080, 3825, 3568, 3310, 3052, 2792, 2532, 2271, 2010, 1750, 1489, 1229, 969, 709, 451, 193, -64, -320, -575, -829, -1081, -1332, -1582, -1831, -2078, -2323, -2568, -2810, -3051, -3291, -3529, -3766, -4001, -4234, -4467, -4697, -4927, -5154, -5381, -5606, -5830, -6053, -6274, -6495, -6714, -6932, -7149,
+    10948, 10894, 10835, 10773, 10705, 10633, 10556, 10474, 10388, 10296, 10199, 10097, 9989, 9877, 9759, 9635, 9506, 9372, 9232, 9087, 8936, 8780, 8618, 8451, 8279, 8101, 7919, 7731, 7538, 7340, 7138, 6932, 6720, 6505, 6286, 6063, 5836, 5606, 5372, 5136, 4897, 4655, 4412, 4165, 3918, 3668, 3417, 3165, 2912, 2657, 2403, 2147, 1892, 1636, 1381, 1125, 870, 616, 361, 108, -145, -396, -647, -897, -1146, -1393, -1640, -1885, -2129, -2371, -2612, -2852, -3090, -3327, -3563, -3797, -4030, -4262, -4492, -4720, -4948, -5174, -5399, -5623, -5845, -6066, -6287, -6506, -6724, -6941, -7157,
+    10690, 10635, 10575, 10511, 10443, 10370, 10293, 10210, 10123, 10031, 9934, 9832, 9724, 9612, 9495, 9372, 9244, 9110, 8972, 8828, 8679, 8525, 8365, 8201, 8031, 7856, 7676, 7492, 7302, 7108, 6910, 6707, 6500, 6290, 6075, 5856, 5634, 5409, 5181, 4950, 4716, 4479, 4241, 4000, 3757, 3513, 3268, 3021, 2773, 2524, 2274, 2024, 1774, 1523, 1272, 1022, 771, 521, 271, 22, -226, -474, -721, -967, -1212, -1456, -1699, -1941, -2181, -2421, -2659, -2896, -3132, -3366, -3599, -3831, -4062, -4291, -4519, -4746, -4972, -5196, -5420, -5642, -5863, -6083, -6302, -6520, -6737, -6953, -7168,
+    10435, 10379, 10319, 10254, 10185, 10112, 10033, 9951, 9863, 9771, 9674, 9572, 9465, 9353, 9236, 9114, 8987, 8855, 8717, 8575, 8428, 8275, 8118, 7956, 7788, 7616, 7439, 7258, 7072, 6882, 6687, 6488, 6285, 6078, 5868, 5654, 5437, 5216, 4993, 4766, 4537, 4306, 4072, 3837, 3599, 3360, 3120, 2878, 2635, 2391, 2146, 1901, 1655, 1409, 1163, 917, 671, 425, 180, -65, -309, -553, -796, -1039, -1280, -1521, -1760, -1999, -2237, -2473, -2708, -2943, -3176, -3408, -3638, -3868, -4097, -4324, -4550, -4775, -4999, -5222, -5443, -5664, -5883, -6102, -6320, -6536, -6752, -6967, -7181,
+    10185, 10128, 10067, 10001, 9931, 9857, 9779, 9696, 9608, 9515, 9418, 9317, 9210, 9098, 8982, 8861, 8735, 8604, 8468, 8327, 8182, 8031, 7876, 7716, 7551, 7382, 7208, 7029, 6847, 6660, 6468, 6273, 6074, 5872, 5665, 5456, 5243, 5027, 4808, 4586, 4362, 4135, 3906, 3676, 3443, 3209, 2973, 2736, 2498, 2259, 2019, 1778, 1537, 1296, 1054, 813, 571, 329, 88, -153, -394, -634, -873, -1112, -1350, -1587, -1824, -2059, -2294, -2527, -2760, -2991, -3222, -3451, -3680, -3907, -4134, -4359, -4583, -4806, -5028, -5249, -5469, -5689, -5907, -6124, -6340, -6556, -6771, -6985, -7198,
+    9938, 9880, 9818, 9752, 9682, 9607, 9528, 9445, 9357, 9265, 9168, 9066, 8960, 8849, 8733, 8613, 8488, 8358, 8224, 8085, 7941, 7792, 7639, 7481, 7319, 7152, 6981, 6805, 6626, 6442, 6254, 6063, 5868, 5669, 5466, 5261, 5052, 4840, 4626, 4408, 4189, 3967, 3743, 3516, 3288, 3059, 2828, 2595, 2362, 2127, 1892, 1656, 1419, 1182, 945, 707, 470, 232, -5, -242, -479, -716, -951, -1187, -1421, -1655, -1889, -2121, -2353, -2584, -2814, -3042, -3271, -3498, -3724, -3949, -4173, -4396, -4619, -4840, -5060, -5280, -5498, -5716, -5933, -6149, -6364, -6578, -6792, -7005, -7217,
+    9694, 9635, 9573, 9506, 9435, 9361, 9281, 9198, 9110, 9018, 8921, 8820, 8714, 8604, 8489, 8370, 8246, 8117, 7984, 7846, 7704, 7558, 7406, 7251, 7091, 6927, 6758, 6586, 6409, 6229, 6044, 5856, 5664, 5469, 5271, 5069, 4864, 4657, 4446, 4233, 4018, 3800, 3581, 3359, 3135, 2910, 2684, 2456, 2227, 1996, 1765, 1534, 1301, 1068, 835, 602, 368, 134, -99, -333, -566, -799, -1031, -1263, -1495, -1725, -1956, -2185, -2414, -2642, -2869, -3096, -3321, -3546, -3770, -3993, -4215, -4436, -4657, -4876, -5095, -5313, -5530, -5746, -5961, -6176, -6390, -6603, -6815, -7027, -7239,
+    9453, 9394, 9331, 9264, 9193, 9118, 9038, 8955, 8867, 8775, 8679, 8578, 8473, 8363, 8249, 8131, 8008, 7881, 7749, 7613, 7472, 7328, 7178, 7025, 6867, 6706, 6540, 6370, 6196, 6019, 5838, 5653, 5465, 5273, 5078, 4880, 4680, 4476, 4270, 4061, 3849, 3636, 3420, 3203, 2984, 2763, 2540, 2317, 2092, 1866, 1639, 1411, 1183, 954, 725, 495, 265, 36, -194, -424, -654, -883, -1112, -1341, -1569, -1797, -2024, -2251, -2477, -2702, -2927, -3151, -3374, -3597, -3818, -4039, -4259, -4479, -4697, -4915, -5132, -5348, -5563, -5778, -5992, -6206, -6418, -6630, -6842, -7053, -7263,
+    9215, 9155, 9092, 9025, 8954, 8878, 8799, 8715, 8628, 8536, 8440, 8340, 8235, 8126, 8013, 7896, 7774, 7648, 7518, 7383, 7244, 7101, 6954, 6803, 6648, 6488, 6325, 6158, 5987, 5813, 5635, 5453, 5268, 5080, 4889, 4695, 4497, 4298, 4095, 3890, 3683, 3473, 3262, 3048, 2833, 2616, 2398, 2178, 1958, 1736, 1513, 1289, 1065, 840, 614, 388, 162, -64, -290, -517, -743, -969, -1195, -1420, -1646, -1871, -2095, -2319, -2542, -2765, -2987, -3209, -3429, -3650, -3869, -4088, -4306, -4523, -4740, -4956, -5171, -5386, -5600, -5813, -6026, -6238, -6449, -6660, -6871, -7081, -7290,
+    8980, 8920, 8856, 8789, 8717, 8642, 8563, 8479, 8392, 8300, 8205, 8105, 8001, 7893, 7781, 7664, 7544, 7419, 7290, 7157, 7020, 6879, 6734, 6585, 6432, 6275, 6114, 5950, 5782, 5610, 5435, 5257, 5075, 4890, 4702, 4511, 4318, 4121, 3923, 3721, 3518, 3312, 3105, 2895, 2684, 2471, 2257, 2041, 1824, 1606, 1387, 1167, 946, 725, 503, 281, 59, -164, -387, -610, -833, -1056, -1279, -1501, -1724, -1946, -2167, -2388, -2609, -2829, -3049, -3268, -3487, -3705, -3922, -4139, -4355, -4570, -4785, -5000, -5213, -5426, -5639, -5851, -6062, -6273, -6483, -6693, -6902, -7111, -7320,
+    8748, 8687, 8623, 8556, 8484, 8409, 8330, 8246, 8159, 8068, 7973, 7874, 7771, 7663, 7552, 7437, 7317, 7194, 7067, 6935, 6800, 6660, 6517, 6370, 6219, 6065, 5906, 5745, 5579, 5410, 5238, 5063, 4884, 4702, 4518, 4330, 4140, 3947, 3752, 3555, 3355, 3153, 2949, 2743, 2536, 2326, 2116, 1904, 1691, 1476, 1261, 1045, 828, 610, 392, 173, -46, -265, -485, -705, -925, -1144, -1364, -1584, -1803, -2022, -2241, -2460, -2678, -2895, -3113, -3330, -3546, -3762, -3977, -4192, -4406, -4620, -4833, -5046, -5258, -5469, -5680, -5891, -6101, -6310, -6520, -6728, -6937, -7145, -7352,
+    8518, 8457, 8393, 8325, 8254, 8179, 8099, 8017, 7930, 7839, 7744, 7646, 7543, 7437, 7327, 7213, 7094, 6972, 6846, 6716, 6583, 6445, 6304, 6159, 6010, 5858, 5702, 5542, 5380, 5213, 5044, 4871, 4696, 4517, 4336, 4152, 3965, 3775, 3583, 3389, 3193, 2995, 2794, 2592, 2388, 2183, 1976, 1767, 1558, 1347, 1135, 923, 709, 495, 280, 65, -151, -367, -584, -800, -1017, -1234, -1451, -1667, -1884, -2100, -2317, -2533, -2748, -2964, -3179, -3393, -3607, -3821, -4034, -4247, -4460, -4671, -4883, -5094, -5304, -5514, -5724, -5933, -6142, -6350, -6558, -6766, -6973, -7180, -7387,
+    8290, 8230, 8166, 8098, 8026, 7951, 7872, 7790, 7703, 7613, 7519, 7421, 7319, 7214, 7105, 6991, 6874, 6754, 6629, 6501, 6369, 6233, 6093, 5950, 5804, 5653, 5500, 5343, 5183, 5019, 4852, 4683, 4510, 4334, 4156, 3975, 3791, 3605, 3416, 3226, 3033, 2838, 2641, 2442, 2242, 2040, 1836, 1631, 1425, 1218, 1009, 800, 590, 379, 168, -44, -257, -470, -683, -897, -1111, -1325, -1539, -1753, -1966, -2180, -2394, -2607, -2821, -3034, -3246, -3459, -3671, -3882, -4094, -4305, -4515, -4725, -4935, -5145, -5354, -5562, -5770, -5978, -6186, -6393, -6600, -6806, -7013, -7219, -7425,
+    8065, 8005, 7940, 7873, 7801, 7726, 7648, 7565, 7479, 7390, 7296, 7199, 7098, 6994, 6885, 6773, 6657, 6538, 6415, 6288, 6157, 6023, 5886, 5745, 5600, 5452, 5301, 5146, 4988, 4827, 4663, 4496, 4326, 4153, 3978, 3800, 3619, 3436, 3251, 3063, 2874, 2682, 2488, 2293, 2096, 1897, 1697, 1495, 1293, 1089, 884, 678, 471, 263, 55, -154, -364, -574, -784, -995, -1206, -1417, -1628, -1839, -2050, -2262, -2473, -2684, -2895, -3105, -3316, -3526, -3736, -3946, -4155, -4364, -4573, -4782, -4990, -5197, -5405, -5612, -5819, -6026, -6232, -6438, -6644, -6849, -7055, -7260, -7465,
+    7842, 7782, 7718, 7650, 7579, 7504, 7425, 7344, 7258, 7169, 7076, 6980, 6880, 6776, 6669, 6558, 6443, 6325, 6203, 6078, 5949, 5817, 5681, 5542, 5399, 5253, 5104, 4952, 4796, 4638, 4476, 4312, 4144, 3974, 3802, 3627, 3449, 3269, 3087, 2902, 2716, 2527, 2337, 2144, 1950, 1755, 1558, 1360, 1160, 960, 758, 555, 351, 147, -59, -265, -471, -678, -886, -1093, -1302, -1510, -1718, -1927, -2136, -2345, -2553, -2762, -2971, -3179, -3387, -3596, -3804, -4011, -4219, -4426, -4633, -4840, -5046, -5253, -5459, -5664, -5870, -6075, -6280, -6485, -6690, -6895, -7099, -7303, -7508,
+    7622, 7561, 7497, 7429, 7358, 7284, 7206, 7124, 7039, 6951, 6859, 6763, 6664, 6561, 6455, 6345, 6231, 6114, 5994, 5870, 5743, 5612, 5478, 5341, 5200, 5056, 4909, 4759, 4606, 4450, 4291, 4129, 3965, 3797, 3627, 3455, 3280, 3103, 2924, 2742, 2559, 2373, 2186, 1997, 1806, 1613, 1420, 1224, 1028, 830, 632, 432, 231, 30, -173, -376, -579, -784, -988, -1193, -1399, -1604, -1810, -2016, -2223, -2429, -2635, -2842, -3048, -3255, -3461, -3667, -3873, -4079, -4285, -4490, -4695, -4901, -5105, -5310, -5515, -5719, -5923, -6127, -6331, -6535, -6739, -6942, -7146, -7349, -7553,
+    7403, 7342, 7278, 7211, 7140, 7066, 6988, 6907, 6823, 6735, 6643, 6548, 6450, 6348, 6243, 6134, 6022, 5906, 5787, 5665, 5539, 5410, 5278, 5143, 5004, 4862, 4717, 4569, 4418, 4264, 4108, 3948, 3786, 3622, 3454, 3285, 3113, 2938, 2762, 2583, 2403, 2220, 2036, 1849, 1662, 1472, 1281, 1089, 896, 701, 505, 308, 111, -88, -287, -488, -688, -890, -1092, -1294, -1497, -1700, -1904, -2107, -2311, -2515, -2719, -2923, -3128, -3332, -3536, -3740, -3944, -4148, -4352, -4556, -4760, -4963, -5167, -5370, -5573, -5776, -5979, -6182, -6385, -6588, -6790, -6993, -7195, -7398, -7601,
+    7186, 7125, 7061, 6994, 6924, 6850, 6773, 6692, 6608, 6521, 6430, 6336, 6239, 6138, 6034, 5926, 5815, 5701, 5583, 5462, 5338, 5211, 5080, 4946, 4809, 4670, 4527, 4381, 4232, 4081, 3926, 3769, 3610, 3447, 3283, 3116, 2946, 2775, 2601, 2425, 2247, 2068, 1886, 1703, 1518, 1331, 1143, 954, 764, 572, 379, 185, -10, -206, -403, -600, -798, -997, -1196, -1396, -1596, -1797, -1998, -2199, -2401, -2603, -2805, -3007, -3209, -3411, -3613, -3815, -4018, -4220, -4422, -4624, -4826, -5028, -5230, -5432, -5634, -5836, -6037, -6239, -6441, -6642, -6844, -7046, -7248, -7449, -7651,
+    6970, 6910, 6846, 6780, 6709, 6636, 6559, 6479, 6396, 6309, 6219, 6126, 6029, 5929, 5826, 5720, 5610, 5497, 5381, 5261, 5139, 5013, 4884, 4752, 4617, 4479, 4338, 4194, 4048, 3898, 3746, 3592, 3434, 3275, 3112, 2948, 2781, 2612, 2441, 2268, 2093, 1916, 1737, 1556, 1374, 1191, 1006, 819, 631, 442, 252, 61, -131, -325, -519, -713, -909, -1105, -1302, -1499, -1697, -1895, -2094, -2293, -2492, -2692, -2892, -3091, -3292, -3492, -3692, -3892, -4093, -4293, -4494, -4694, -4895, -5095, -5296, -5496, -5697, -5897, -6098, -6298, -6499, -6700, -6900, -7101, -7302, -7503, -7704,
+    6757, 6696, 6633, 6567, 6497, 6424, 6348, 6268, 6185, 6099, 6010, 5918, 5822, 5723, 5621, 5516, 5407, 5295, 5180, 5062, 4941, 4817, 4690, 4560, 4426, 4290, 4151, 4009, 3865, 3718, 3568, 3415, 3260, 3103, 2943, 2781, 2617, 2450, 2282, 2111, 1939, 1764, 1588, 1411, 1231, 1050, 868, 684, 499, 312, 125, -64, -253, -444, -635, -828, -1021, -1214, -1409, -1603, -1799, -1995, -2191, -2388, -2585, -2782, -2980, -3178, -3376, -3574, -3773, -3971, -4170, -4369, -4568, -4766, -4965, -5165, -5364, -5563, -5762, -5961, -6161, -6360, -6560, -6759, -6959, -7159, -7359, -7560, -7760,
+    6544, 6484, 6421, 6355, 6286, 6213, 6138, 6059, 5977, 5891, 5803, 5711, 5617, 5519, 5417, 5313, 5206, 5095, 4982, 4865, 4745, 4623, 4497, 4369, 4237, 4103, 3966, 3826, 3684, 3538, 3391, 3240, 3088, 2933, 2775, 2615, 2454, 2289, 2123, 1955, 1785, 1614, 1440, 1265, 1088, 910, 730, 549, 366, 182, -3, -189, -376, -564, -753, -942, -1133, -1324, -1516, -1709, -1902, -2096, -2290, -2484, -2679, -2875, -3070, -3266, -3462, -3659, -3855, -4052, -4249, -4446, -4643, -4841, -5038, -5236, -5434, -5632, -5829, -6028, -6226, -6424, -6623, -6821, -7020, -7220, -7419, -7619, -7819,
+    6334, 6274, 6211, 6145, 6076, 6004, 5929, 5851, 5770, 5685, 5597, 5507, 5413, 5316, 5216, 5113, 5006, 4897, 4785, 4670, 4551, 4430, 4306, 4179, 4050, 3917, 3782, 3644, 3503, 3360, 3215, 3067, 2916, 2763, 2608, 2450, 2291, 2129, 1966, 1800, 1632, 1463, 1292, 1119, 945, 769, 592, 413, 233, 52, -130, -314, -499, -684, -871, -1058, -1246, -1435, -1625, -1815, -2006, -2198, -2390, -2582, -2775, -2968, -3162, -3356, -3550, -3745, -3940, -4135, -4330, -4526, -4721, -4917, -5113, -5309, -5506, -5702, -5899, -6096, -6293, -6491, -6688, -6886, -7084, -7283, -7481, -7680, -7880,
+    6124, 6065, 6002, 5937, 5868, 5797, 5722, 5645, 5564, 5480, 5393, 5303, 5210, 5114, 5015, 4913, 4808, 4700, 4589, 4476, 4359, 4239, 4117, 3991, 3863, 3733, 3599, 3463, 3324, 3183, 3040, 2894, 2745, 2594, 2441, 2286, 2129, 1970, 1808, 1645, 1480, 1313, 1144, 974, 802, 629, 454, 278, 100, -79, -259, -440, -622, -805, -990, -1175, -1361, -1547, -1735, -1923, -2112, -2301, -2491, -2681, -2872, -3064, -3255, -3447, -3640, -3833, -4026, -4219, -4413, -4607, -4801, -4996, -5190, -5385, -5580, -5776, -5971, -6167, -6363, -6560, -6756, -6953, -7150, -7348, -7546, -7744, -7943,
+    5916, 5857, 5795, 5730, 5662, 5591, 5517, 5440, 5360, 5277, 5191, 5102, 5010, 4915, 4817, 4716, 4612, 4505, 4395, 4283, 4168, 4049, 3928, 3805, 3678, 3549, 3418, 3283, 3147, 3007, 2866, 2722, 2575, 2427, 2276, 2123, 1968, 1810, 1651, 1490, 1328, 1163, 997, 829, 659, 488, 316, 142, -34, -210, -388, -567, -746, -927, -1109, -1292, -1476, -1660, -1846, -2032, -2218, -2406, -2594, -2782, -2971, -3160, -3350, -3541, -3731, -3923, -4114, -4306, -4498, -4690, -4883, -5076, -5270, -5463, -5657, -5851, -6046, -6240, -6436, -6631, -6827, -7023, -7219, -7416, -7614, -7811, -8010,
+    5708, 5650, 5588, 5524, 5456, 5386, 5312, 5236, 5157, 5075, 4989, 4901, 4810, 4716, 4619, 4519, 4417, 4311, 4203, 4091, 3977, 3861, 3741, 3619, 3494, 3367, 3237, 3105, 2970, 2832, 2692, 2550, 2406, 2259, 2111, 1960, 1807, 1652, 1495, 1336, 1175, 1013, 849, 683, 516, 347, 177, 5, -168, -342, -517, -694, -871, -1050, -1230, -1411, -1592, -1775, -1958, -2142, -2326, -2512, -2698, -2884, -3071, -3259, -3447, -3636, -3825, -4014, -4204, -4394, -4585, -4776, -4967, -5159, -5351, -5543, -5736, -5929, -6122, -6316, -6510, -6705, -6900, -7095, -7291, -7487, -7684, -7881, -8079,
+    5502, 5444, 5383, 5319, 5252, 5182, 5109, 5034, 4955, 4873, 4789, 4702, 4612, 4519, 4423, 4324, 4222, 4118, 4011, 3901, 3789, 3673, 3555, 3435, 3312, 3186, 3057, 2927, 2794, 2658, 2520, 2380, 2237, 2093, 1946, 1797, 1646, 1493, 1339, 1182, 1023, 863, 701, 538, 373, 206, 38, -131, -302, -474, -647, -822, -997, -1174, -1351, -1530, -1709, -1890, -2071, -2253, -2436, -2619, -2803, -2988, -3173, -3359, -3545, -3732, -3920, -4107, -4296, -4485, -4674, -4863, -5053, -5244, -5434, -5626, -5817, -6009, -6201, -6394, -6587, -6781, -6975, -7170, -7365, -7560, -7757, -7953, -8151,
+    5297, 5239, 5178, 5115, 5048, 4979, 4907, 4832, 4754, 4674, 4590, 4504, 4414, 4322, 4227, 4130, 4029, 3926, 3820, 3712, 3601, 3487, 3370, 3251, 3129, 3005, 2879, 2750, 2618, 2484, 2348, 2210, 2069, 1927, 1782, 1635, 1486, 1335, 1182, 1028, 871, 713, 554, 392, 229, 65, -101, -268, -437, -607, -778, -950, -1124, -1298, -1474, -1650, -1828, -2006, -2185, -2365, -2546, -2728, -2910, -3093, -3276, -3461, -3645, -3831, -4016, -4203, -4389, -4577, -4765, -4953, -5141, -5331, -5520, -5710, -5901, -6092, -6283, -6475, -6667, -6860, -7053, -7247, -7441, -7637, -7832, -8028, -8225,
+    5092, 5035, 4975, 4912, 4846, 4777, 4706, 4632, 4554, 4475, 4392, 4306, 4218, 4127, 4033, 3937, 3837, 3735, 3631, 3523, 3414, 3301, 3186, 3068, 2948, 2826, 2701, 2573, 2443, 2311, 2177, 2040, 1902, 1761, 1618, 1473, 1326, 1177, 1026, 874, 719, 563, 406, 246, 86, -77, -241, -406, -572, -740, -909, -1080, -1251, -1424, -1597, -1772, -1947, -2124, -2301, -2479, -2658, -2838, -3018, -3199, -3381, -3564, -3747, -3931, -4115, -4300, -4485, -4671, -4857, -5044, -5232, -5420, -5608, -5797, -5986, -6176, -6367, -6558, -6749, -6941, -7134, -7327, -7521, -7715, -7911, -8106, -8303,
+    4888, 4831, 4772, 4709, 4644, 4576, 4505, 4432, 4355, 4276, 4195, 4110, 4023, 3933, 3840, 3744, 3646, 3545, 3442, 3336, 3227, 3116, 3002, 2886, 2768, 2647, 2523, 2397, 2269, 2139, 2006, 1871, 1734, 1595, 1454, 1311, 1166, 1019, 870, 720, 567, 413, 258, 100, -59, -219, -381, -544, -709, -874, -1042, -1210, -1379, -1550, -1722, -1894, -2068, -2242, -2418, -2594, -2771, -2949, -3128, -3308, -3488, -3669, -3850, -4033, -4215, -4399, -4583, -4767, -4952, -5138, -5324, -5511, -5698, -5886, -6075, -6263, -6453, -6643, -6834, -7025, -7217, -7410, -7603, -7797, -7992, -8187, -8384,
+    4685, 4628, 4569, 4508, 4443, 4376, 4306, 4233, 4157, 4079, 3998, 3914, 3828, 3739, 3647, 3553, 3456, 3356, 3254, 3149, 3042, 2932, 2820, 2705, 2588, 2468, 2346, 2222, 2095, 1967, 1836, 1703, 1567, 1430, 1291, 1150, 1006, 861, 714, 566, 415, 263, 109, -46, -203, -362, -522, -683, -845, -1009, -1175, -1341, -1509, -1677, -1847, -2018, -2190, -2362, -2536, -2711, -2886, -3063, -3240, -3418, -3596, -3775, -3956, -4136, -4318, -4500, -4682, -4865, -5049, -5234, -5419, -5604, -5791, -5978, -6165, -6353, -6542, -6731, -6921, -7112, -7303, -7495, -7688, -7881, -8076, -8271, -8467,
+    4482, 4426, 4368, 4306, 4242, 4176, 4106, 4034, 3960, 3882, 3802, 3719, 3634, 3546, 3455, 3362, 3266, 3167, 3066, 2963, 2857, 2748, 2637, 2524, 2408, 2290, 2170, 2047, 1922, 1795, 1665, 1534, 1401, 1265, 1127, 988, 846, 703, 558, 411, 263, 112, -40, -193, -348, -505, -663, -822, -983, -1145, -1308, -1473, -1639, -1806, -1974, -2143, -2313, -2484, -2656, -2829, -3003, -3177, -3353, -3529, -3706, -3884, -4063, -4242, -4422, -4602, -4784, -4966, -5148, -5332, -5516, -5700, -5886, -6071, -6258, -6445, -6633, -6822, -7011, -7201, -7392, -7583, -7775, -7969, -8163, -8358, -8554,
+    4279, 4224, 4166, 4106, 4042, 3976, 3908, 3836, 3762, 3686, 3607, 3525, 3440, 3353, 3263, 3171, 3076, 2979, 2879, 2777, 2672, 2565, 2455, 2343, 2229, 2112, 1993, 1872, 1749, 1623, 1495, 1366, 1234, 1100, 964, 826, 686, 545, 402, 256, 110, -39, -189, -341, -494, -649, -805, -962, -1121, -1282, -1443, -1606, -1770, -1935, -2101, -2269, -2437, -2606, -2777, -2948, -3120, -3293, -3467, -3642, -3818, -3994, -4171, -4349, -4528, -4707, -4887, -5068, -5250, -5432, -5615, -5798, -5983, -6168, -6353, -6540, -6727, -6915, -7103, -7293, -7483, -7674, -7866, -8059, -8253, -8448, -8644,
+    4077, 4022, 3965, 3905, 3843, 3777, 3709, 3639, 3566, 3490, 3412, 3331, 3247, 3161, 3072, 2981, 2887, 2791, 2692, 2591, 2488, 2382, 2274, 2163, 2050, 1935, 1817, 1697, 1576, 1452, 1325, 1197, 1067, 935, 800, 664, 526, 386, 245, 101, -44, -190, -339, -489, -640, -793, -948, -1103, -1261, -1419, -1579, -1740, -1902, -2066, -2230, -2396, -2563, -2730, -2899, -3069, -3240, -3411, -3584, -3757, -3931, -4106, -4282, -4459, -4636, -4814, -4993, -5173, -5353, -5534, -5716, -5899, -6082, -6266, -6451, -6637, -6823, -7011, -7199, -7388, -7577, -7768, -7960, -8152, -8346, -8541, -8737,
+    3875, 3821, 3764, 3705, 3643, 3579, 3511, 3442, 3369, 3294, 3217, 3137, 3054, 2969, 2881, 2791, 2699, 2604, 2506, 2406, 2304, 2199, 2092, 1983, 1871, 1757, 1641, 1523, 1402, 1280, 1155, 1029, 900, 769, 637, 502, 366, 228, 88, -54, -197, -343, -489, -637, -787, -938, -1091, -1245, -1401, -1558, -1716, -1875, -2036, -2198, -2360, -2525, -2690, -2856, -3023, -3191, -3360, -3531, -3702, -3874, -4046, -4220, -4395, -4570, -4746, -4923, -5101, -5280, -5459, -5639, -5820, -6002, -6184, -6368, -6552, -6737, -6922, -7109, -7297, -7485, -7675, -7865, -8056, -8249, -8443, -8637, -8833,
+    3673, 3619, 3563, 3505, 3444, 3380, 3314, 3245, 3173, 3099, 3022, 2943, 2862, 2777, 2691, 2602, 2510, 2416, 2320, 2221, 2120, 2017, 1911, 1803, 1692, 1580, 1465, 1348, 1229, 1108, 985, 860, 733, 604, 473, 340, 205, 68, -70, -210, -352, -495, -640, -787, -935, -1085, -1236, -1388, -1542, -1697, -1854, -2011, -2170, -2331, -2492, -2654, -2818, -2983, -3149, -3315, -3483, -3652, -3821, -3992, -4164, -4336, -4509, -4683, -4859, -5034, -5211, -5389, -5567, -5746, -5926, -6107, -6289, -6471, -6655, -6839, -7024, -7211, -7398, -7586, -7775, -7965, -8156, -8349, -8542, -8737, -8933,
+    3471, 3418, 3363, 3305, 3244, 3181, 3116, 3048, 2977, 2904, 2828, 2750, 2669, 2586, 2500, 2412, 2322, 2229, 2134, 2036, 1936, 1834, 1729, 1623, 1514, 1402, 1289, 1174, 1056, 936, 815, 691, 565, 438, 308, 177, 44, -91, -228, -367, -507, -649, -792, -937, -1084, -1232, -1381, -1532, -1684, -1838, -1993, -2149, -2306, -2465, -2625, -2786, -2948, -3111, -3276, -3441, -3607, -3775, -3943, -4112, -4283, -4454, -4626, -4799, -4973, -5148, -5323, -5500, -5677, -5856, -6035, -6215, -6396, -6578, -6761, -6944, -7129, -7315, -7502, -7689, -7878, -8068, -8259, -8452, -8645, -8840, -9037,
+    3268, 3216, 3162, 3105, 3045, 2983, 2918, 2851, 2781, 2708, 2634, 2556, 2477, 2394, 2310, 2223, 2133, 2042, 1947, 1851, 1752, 1651, 1548, 1442, 1335, 1225, 1113, 999, 882, 764, 644, 522, 397, 271, 143, 13, -118, -252, -387, -524, -663, -803, -945, -1088, -1233, -1380, -1527, -1677, -1828, -1980, -2133, -2288, -2444, -2601, -2759, -2919, -3080, -3241, -3404, -3568, -3733, -3899, -4067, -4235, -4404, -4574, -4745, -4917, -5090, -5263, -5438, -5614, -5790, -5968, -6146, -6326, -6506, -6687, -6869, -7053, -7237, -7422, -7609, -7796, -7985, -8175, -8366, -8558, -8752, -8948, -9144,
+    3066, 3014, 2961, 2904, 2845, 2784, 2720, 2653, 2584, 2513, 2439, 2363, 2284, 2203, 2119, 2033, 1945, 1854, 1761, 1666, 1568, 1468, 1366, 1262, 1156, 1047, 936, 823, 709, 592, 473, 352, 229, 104, -22, -151, -281, -413, -547, -682, -819, -958, -1098, -1240, -1384, -1529, -1675, -1823, -1972, -2123, -2275, -2428, -2582, -2738, -2895, -3053, -3213, -3373, -3535, -3698, -3861, -4026, -4192, -4359, -4527, -4696, -4866, -5037, -5209, -5381, -5555, -5730, -5906, -6082, -6260, -6439, -6618, -6799, -6981, -7164, -7348, -7533, -7719, -7906, -8095, -8285, -8476, -8669, -8863, -9058, -9256,
+    2863, 2812, 2759, 2704, 2645, 2585, 2522, 2456, 2388, 2317, 2244, 2169, 2091, 2011, 1928, 1843, 1756, 1666, 1574, 1480, 1384, 1285, 1184, 1081, 976, 869, 759, 648, 534, 419, 301, 182, 60, -63, -188, -315, -444, -575, -707, -841, -977, -1114, -1253, -1393, -1535, -1679, -1824, -1970, -2118, -2267, -2418, -2569, -2723, -2877, -3033, -3190, -3348, -3507, -3667, -3829, -3991, -4155, -4320, -4485, -4652, -4820, -4989, -5159, -5330, -5502, -5675, -5849, -6024, -6200, -6377, -6555, -6734, -6914, -7096, -7278, -7462, -7646, -7832, -8020, -8208, -8398, -8590, -8783, -8977, -9173, -9371,
+    2659, 2609, 2557, 2502, 2445, 2385, 2323, 2258, 2191, 2121, 2049, 1975, 1898, 1818, 1737, 1653, 1567, 1478, 1387, 1294, 1199, 1101, 1002, 900, 796, 690, 582, 471, 359, 245, 129, 11, -109, -231, -355, -481, -608, -737, -868, -1001, -1135, -1271, -1408, -1548, -1688, -1830, -1974, -2119, -2265, -2413, -2562, -2713, -2864, -3017, -3172, -3327, -3484, -3642, -3801, -3962, -4123, -4286, -4449, -4614, -4780, -4947, -5115, -5284, -5454, -5625, -5797, -5970, -6144, -6320, -6496, -6674, -6853, -7032, -7213, -7396, -7579, -7764, -7950, -8137, -8326, -8516, -8707, -8901, -9096, -9292, -9491,
+    2455, 2406, 2355, 2301, 2244, 2185, 2124, 2060, 1993, 1925, 1853, 1780, 1704, 1626, 1545, 1462, 1377, 1290, 1200, 1108, 1014, 917, 819, 718, 615, 510, 404, 295, 184, 71, -44, -161, -280, -401, -523, -647, -773, -901, -1031, -1162, -1295, -1429, -1565, -1703, -1842, -1983, -2125, -2269, -2414, -2560, -2708, -2857, -3008, -3160, -3313, -3467, -3623, -3779, -3937, -4097, -4257, -4418, -4581, -4745, -4910, -5076, -5243, -5411, -5580, -5750, -5922, -6094, -6268, -6443, -6619, -6796, -6974, -7154, -7334, -7516, -7700, -7884, -8070, -8258, -8447, -8637, -8829, -9023, -9219, -9416, -9616,
+    2250, 2202, 2151, 2098, 2042, 1984, 1924, 1861, 1795, 1727, 1657, 1585, 1510, 1432, 1353, 1271, 1187, 1100, 1012, 921, 828, 733, 635, 536, 434, 330, 225, 117, 7, -105, -218, -334, -451, -571, -692, -815, -939, -1066, -1194, -1324, -1455, -1589, -1723, -1860, -1998, -2137, -2278, -2420, -2564, -2709, -2856, -3004, -3153, -3304, -3456, -3609, -3763, -3919, -4076, -4234, -4393, -4554, -4715, -4878, -5042, -5207, -5373, -5541, -5709, -5879, -6049, -6221, -6395, -6569, -6744, -6921, -7099, -7278, -7459, -7641, -7824, -8009, -8195, -8382, -8572, -8763, -8955, -9150, -9346, -9544, -9745,
+    2044, 1997, 1947, 1895, 1840, 1783, 1723, 1661, 1596, 1529, 1460, 1389, 1315, 1238, 1160, 1079, 996, 910, 823, 733, 641, 547, 451, 352, 252, 149, 45, -62, -170, -281, -393, -507, -624, -742, -862, -983, -1107, -1232, -1359, -1487, -1618, -1749, -1883, -2018, -2155, -2293, -2432, -2573, -2716, -2860, -3005, -3152, -3300, -3450, -3600, -3752, -3906, -4060, -4216, -4373, -4531, -4691, -4852, -5014, -5177, -5341, -5506, -5673, -5841, -6010, -6180, -6352, -6524, -6698, -6873, -7050, -7227, -7406, -7587, -7769, -7952, -8137, -8323, -8511, -8701, -8892, -9086, -9281, -9478, -9678, -9880,
+    1837, 1791, 1742, 1690, 1636, 1580, 1521, 1460, 1397, 1331, 1262, 1192, 1119, 1043, 966, 886, 804, 720, 633, 544, 453, 360, 265, 168, 69, -32, -136, -241, -348, -458, -569, -682, -797, -914, -1032, -1153, -1275, -1399, -1525, -1652, -1781, -1912, -2044, -2178, -2313, -2450, -2588, -2728, -2870, -3012, -3157, -3302, -3449, -3598, -3747, -3898, -4050, -4204, -4359, -4515, -4672, -4831, -4991, -5152, -5314, -5478, -5642, -5808, -5976, -6144, -6314, -6485, -6657, -6831, -7005, -7182, -7359, -7538, -7719, -7901, -8084, -8269, -8456, -8644, -8835, -9027, -9221, -9417, -9616, -9817, -10020,
+    1629, 1583, 1535, 1485, 1432, 1376, 1319, 1258, 1196, 1131, 1063, 994, 922, 847, 771, 692, 611, 528, 442, 355, 265, 173, 79, -17, -115, -215, -318, -422, -528, -636, -746, -858, -972, -1087, -1205, -1324, -1445, -1568, -1692, -1818, -1946, -2075, -2206, -2339, -2473, -2609, -2746, -2885, -3025, -3167, -3310, -3454, -3600, -3748, -3896, -4046, -4197, -4350, -4504, -4659, -4816, -4973, -5133, -5293, -5454, -5617, -5781, -5947, -6113, -6281, -6451, -6621, -6793, -6967, -7141, -7317, -7495, -7674, -7854, -8037, -8220, -8406, -8593, -8782, -8973, -9166, -9362, -9559, -9759, -9961, -10166,
+    1419, 1375, 1327, 1278, 1226, 1171, 1115, 1055, 994, 930, 863, 795, 724, 650, 575, 497, 417, 335, 250, 164, 75, -16, -109, -204, -301, -400, -501, -604, -709, -816, -925, -1035, -1148, -1262, -1379, -1497, -1616, -1738, -1861, -1986, -2113, -2241, -2371, -2502, -2635, -2770, -2906, -3044, -3183, -3323, -3465, -3609, -3754, -3900, -4048, -4197, -4347, -4499, -4652, -4806, -4962, -5119, -5277, -5437, -5598, -5760, -5923, -6088, -6254, -6422, -6591, -6761, -6933, -7106, -7281, -7457, -7634, -7814, -7995, -8177, -8361, -8547, -8735, -8925, -9117, -9311, -9508, -9707, -9908, -10112, -10319,
+    1208, 1164, 1118, 1070, 1019, 965, 909, 851, 790, 727, 662, 594, 524, 452, 377, 301, 222, 140, 57, -28, -116, -206, -297, -391, -487, -585, -685, -787, -891, -997, -1104, -1214, -1325, -1439, -1554, -1671, -1789, -1910, -2032, -2156, -2281, -2408, -2537, -2667, -2799, -2933, -3068, -3204, -3342, -3482, -3623, -3765, -3909, -4055, -4201, -4349, -4499, -4650, -4802, -4956, -5111, -5267, -5425, -5584, -5744, -5906, -6069, -6233, -6399, -6566, -6735, -6905, -7077, -7250, -7424, -7601, -7778, -7958, -8139, -8322, -8507, -8694, -8882, -9073, -9266, -9462, -9660, -9860, -10064, -10270, -10479,
+    995, 952, 907, 859, 809, 757, 702, 645, 585, 523, 459, 392, 323, 252, 178, 103, 25, -55, -138, -222, -308, -397, -488, -581, -675, -772, -871, -972, -1075, -1179, -1286, -1394, -1505, -1617, -1731, -1847, -1964, -2083, -2204, -2327, -2452, -2578, -2705, -2834, -2965, -3098, -3232, -3367, -3504, -3643, -3783, -3924, -4067, -4212, -4358, -4505, -4654, -4804, -4955, -5108, -5262, -5418, -5575, -5734, -5893, -6055, -6217, -6382, -6547, -6714, -6883, -7053, -7224, -7397, -7572, -7749, -7927, -8107, -8288, -8472, -8658, -8845, -9035, -9227, -9422, -9619, -9818, -10021, -10226, -10435, -10648,
+    780, 738, 694, 648, 599, 547, 493, 437, 378, 317, 254, 188, 121, 50, -22, -97, -174, -253, -334, -417, -503, -590, -680, -772, -865, -961, -1059, -1159, -1260, -1364, -1469, -1577, -1686, -1797, -1910, -2025, -2141, -2259, -2379, -2501, -2624, -2749, -2876, -3004, -3134, -3265, -3398, -3533, -3669, -3806, -3946, -4086, -4228, -4372, -4517, -4663, -4811, -4961, -5112, -5264, -5417, -5573, -5729, -5887, -6047, -6207, -6370, -6534, -6699, -6866, -7034, -7204, -7376, -7550, -7725, -7901, -8080, -8260, -8443, -8627, -8814, -9003, -9194, -9387, -9583, -9782, -9984, -10189, -10397, -10609, -10824,
+    562, 522, 479, 433, 386, 335, 282, 227, 170, 110, 47, -17, -84, -153, -224, -298, -374, -452, -532, -614, -699, -785, -874, -964, -1057, -1152, -1248, -1347, -1448, -1550, -1655, -1761, -1869, -1979, -2091, -2204, -2320, -2437, -2556, -2676, -2799, -2923, -3048, -3176, -3304, -3435, -3567, -3701, -3836, -3973, -4111, -4251, -4392, -4535, -4679, -4825, -4972, -5121, -5271, -5423, -5576, -5730, -5887, -6044, -6203, -6364, -6526, -6690, -6855, -7022, -7191, -7361, -7533, -7706, -7882, -8059, -8238, -8420, -8603, -8788, -8976, -9166, -9359, -9554, -9752, -9953, -10158, -10365, -10577, -10792, -11011,
+    342, 303, 261, 217, 170, 121, 69, 15, -41, -100, -161, -225, -290, -359, -429, -501, -576, -653, -732, -813, -897, -982, -1070, -1159, -1251, -1344, -1440, -1538, -1637, -1739, -1842, -1947, -2054, -2163, -2274, -2387, -2501, -2617, -2735, -2855, -2976, -3099, -3224, -3350, -3478, -3607, -3739, -3871, -4006, -4142, -4279, -4418, -4559, -4701, -4844, -4989, -5136, -5284, -5434, -5585, -5738, -5892, -6048, -6205, -6364, -6525, -6687, -6850, -7016, -7183, -7351, -7522, -7694, -7868, -8044, -8222, -8402, -8585, -8769, -8956, -9145, -9337, -9531, -9729, -9929, -10133, -10340, -10551, -10766, -10985, -11209,
+};
+
+static const int16_t IK_GRID_THETA2[4641] = {
+    7149, 6932, 6714, 6495, 6274, 6053, 5830, 5606, 5381, 5154, 4927, 4697, 4467, 4234, 4001, 3766, 3529, 3291, 3051, 2810, 2568, 2323, 2078, 1831, 1582, 1332, 1081, 829, 575, 320, 64, -193, -451, -709, -969, -1229, -1489, -1750, -2010, -2271, -2532, -2792, -3052, -3310, -3568, -3825, -4080, -4333, -4585, -4834, -5082, -5326, -5568, -5806, -6042, -6274, -6502, -6726, -6945, -7161, -7372, -7578, -7779, -7976, -8167, -8353, -8533, -8708, -8878, -9041, -9199, -9352, -9499, -9640, -9775, -9905, -10029, -10147, -10260, -10367, -10469, -10566, -10657, -10744, -10825, -10901, -10972, -11038, -11100, -11157, -11209,
+    7157, 6941, 6724, 6506, 6287, 6066, 5845, 5623, 5399, 5174, 4948, 4720, 4492, 4262, 4030, 3797, 3563, 3327, 3090, 2852, 2612, 2371, 2129, 1885, 1640, 1393, 1146, 897, 647, 396, 145, -108, -361, -616, -870, -1125, -1381, -1636, -1892, -2147, -2403, -2657, -2912, -3165, -3417, -3668, -3918, -4165, -4412, -4655, -4897, -5136, -5372, -5606, -5836, -6063, -6286, -6505, -6720, -6932, -7138, -7340, -7538, -7731, -7919, -8101, -8279, -8451, -8618, -8780, -8936, -9087, -9232, -9372, -9506, -9635, -9759, -9877, -9989, -10097, -10199, -10296, -10388, -10474, -10556, -10633, -10705, -10773, -10835, -10894, -10948,
+    7168, 6953, 6737, 6520, 6302, 6083, 5863, 5642, 5420, 5196, 4972, 4746, 4520, 4291, 4062, 3831, 3599, 3366, 3132, 2896, 2659, 2421, 2181, 1941, 1699, 1456, 1212, 967, 721, 474, 226, -22, -271, -521, -771, -1022, -1272, -1523, -1774, -2024, -2274, -2524, -2773, -3021, -3268, -3513, -3757, -4000, -4241, -4479, -4716, -4950, -5181, -5409, -5634, -5856, -6075, -6290, -6500, -6707, -6910, -7108, -7302, -7492, -7676, -7856, -8031, -8201, -8365, -8525, -8679, -8828, -8972, -9110, -9244, -9372, -9495, -9612, -9724, -9832, -9934, -10031, -10123, -10210, -10293, -10370, -10443, -10511, -10575, -10635, -10690,
+    7181, 6967, 6752, 6536, 6320, 6102, 5883, 5664, 5443, 5222, 4999, 4775, 4550, 4324, 4097, 3868, 3638, 3408, 3176, 2943, 2708, 2473, 2237, 1999, 1760, 1521, 1280, 1039, 796, 553, 309, 65, -180, -425, -671, -917, -1163, -1409, -1655, -1901, -2146, -2391, -2635, -2878, -3120, -3360, -3599, -3837, -4072, -4306, -4537, -4766, -4993, -5216, -5437, -5654, -5868, -6078, -6285, -6488, -6687, -6882, -7072, -7258, -7439, -7616, -7788, -7956, -8118, -8275, -8428, -8575, -8717, -8855, -8987, -9114, -9236, -9353, -9465, -9572, -9674, -9771, -9863, -9951, -10033, -10112, -10185, -10254, -10319, -10379, -10435,
+    7198, 6985, 6771, 6556, 6340, 6124, 5907, 5689, 5469, 5249, 5028, 4806, 4583, 4359, 4134, 3907, 3680, 3451, 3222, 2991, 2760, 2527, 2294, 2059, 1824, 1587, 1350, 1112, 873, 634, 394, 153, -88, -329, -571, -813, -1054, -1296, -1537, -1778, -2019, -2259, -2498, -2736, -2973, -3209, -3443, -3676, -3906, -4135, -4362, -4586, -4808, -5027, -5243, -5456, -5665, -5872, -6074, -6273, -6468, -6660, -6847, -7029, -7208, -7382, -7551, -7716, -7876, -8031, -8182, -8327, -8468, -8604, -8735, -8861, -8982, -9098, -9210, -9317, -9418, -9515, -9608, -9696, -9779, -9857, -9931, -10001, -10067, -10128, -10185,
+    7217, 7005, 6792, 6578, 6364, 6149, 5933, 5716, 5498, 5280, 5060, 4840, 4619, 4396, 4173, 3949, 3724, 3498, 3271, 3042, 2814, 2584, 2353, 2121, 1889, 1655, 1421, 1187, 951, 716, 479, 242, 5, -232, -470, -707, -945, -1182, -1419, -1656, -1892, -2127, -2362, -2595, -2828, -3059, -3288, -3516, -3743, -3967, -4189, -4408, -4626, -4840, -5052, -5261, -5466, -5669, -5868, -6063, -6254, -6442, -6626, -6805, -6981, -7152, -7319, -7481, -7639, -7792, -7941, -8085, -8224, -8358, -8488, -8613, -8733, -8849, -8960, -9066, -9168, -9265, -9357, -9445, -9528, -9607, -9682, -9752, -9818, -9880, -9938,
+    7239, 7027, 6815, 6603, 6390, 6176, 5961, 5746, 5530, 5313, 5095, 4876, 4657, 4436, 4215, 3993, 3770, 3546, 3321, 3096, 2869, 2642, 2414, 2185, 1956, 1725, 1495, 1263, 1031, 799, 566, 333, 99, -134, -368, -602, -835, -1068, -1301, -1534, -1765, -1996, -2227, -2456, -2684, -2910, -3135, -3359, -3581, -3800, -4018, -4233, -4446, -4657, -4864, -5069, -5271, -5469, -5664, -5856, -6044, -6229, -6409, -6586, -6758, -6927, -7091, -7251, -7406, -7558, -7704, -7846, -7984, -8117, -8246, -8370, -8489, -8604, -8714, -8820, -8921, -9018, -9110, -9198, -9281, -9361, -9435, -9506, -9573, -9635, -9694,
+    7263, 7053, 6842, 6630, 6418, 6206, 5992, 5778, 5563, 5348, 5132, 4915, 4697, 4479, 4259, 4039, 3818, 3597, 3374, 3151, 2927, 2702, 2477, 2251, 2024, 1797, 1569, 1341, 1112, 883, 654, 424, 194, -36, -265, -495, -725, -954, -1183, -1411, -1639, -1866, -2092, -2317, -2540, -2763, -2984, -3203, -3420, -3636, -3849, -4061, -4270, -4476, -4680, -4880, -5078, -5273, -5465, -5653, -5838, -6019, -6196, -6370, -6540, -6706, -6867, -7025, -7178, -7327, -7472, -7613, -7749, -7881, -8008, -8131, -8249, -8363, -8473, -8578, -8679, -8775, -8867, -8955, -9038, -9118, -9193, -9264, -9331, -9394, -9453,
+    7290, 7081, 6871, 6660, 6449, 6238, 6026, 5813, 5600, 5386, 5171, 4956, 4740, 4523, 4306, 4088, 3869, 3650, 3429, 3209, 2987, 2765, 2542, 2319, 2095, 1871, 1646, 1420, 1195, 969, 743, 517, 290, 64, -162, -388, -614, -840, -1065, -1289, -1513, -1736, -1958, -2178, -2398, -2616, -2833, -3048, -3262, -3473, -3683, -3890, -4095, -4298, -4497, -4695, -4889, -5080, -5268, -5453, -5635, -5813, -5987, -6158, -6325, -6488, -6648, -6803, -6954, -7101, -7244, -7383, -7518, -7648, -7774, -7896, -8013, -8126, -8235, -8340, -8440, -8536, -8628, -8715, -8799, -8878, -8954, -9025, -9092, -9155, -9215,
+    7320, 7111, 6902, 6693, 6483, 6273, 6062, 5851, 5639, 5426, 5213, 5000, 4785, 4570, 4355, 4139, 3922, 3705, 3487, 3268, 3049, 2829, 2609, 2388, 2167, 1946, 1724, 1501, 1279, 1056, 833, 610, 387, 164, -59, -281, -503, -725, -946, -1167, -1387, -1606, -1824, -2041, -2257, -2471, -2684, -2895, -3105, -3312, -3518, -3721, -3923, -4121, -4318, -4511, -4702, -4890, -5075, -5257, -5435, -5610, -5782, -5950, -6114, -6275, -6432, -6585, -6734, -6879, -7020, -7157, -7290, -7419, -7544, -7664, -7781, -7893, -8001, -8105, -8205, -8300, -8392, -8479, -8563, -8642, -8717, -8789, -8856, -8920, -8980,
+    7352, 7145, 6937, 6728, 6520, 6310, 6101, 5891, 5680, 5469, 5258, 5046, 4833, 4620, 4406, 4192, 3977, 3762, 3546, 3330, 3113, 2895, 2678, 2460, 2241, 2022, 1803, 1584, 1364, 1144, 925, 705, 485, 265, 46, -173, -392, -610, -828, -1045, -1261, -1476, -1691, -1904, -2116, -2326, -2536, -2743, -2949, -3153, -3355, -3555, -3752, -3947, -4140, -4330, -4518, -4702, -4884, -5063, -5238, -5410, -5579, -5745, -5906, -6065, -6219, -6370, -6517, -6660, -6800, -6935, -7067, -7194, -7317, -7437, -7552, -7663, -7771, -7874, -7973, -8068, -8159, -8246, -8330, -8409, -8484, -8556, -8623, -8687, -8748,
+    7387, 7180, 6973, 6766, 6558, 6350, 6142, 5933, 5724, 5514, 5304, 5094, 4883, 4671, 4460, 4247, 4034, 3821, 3607, 3393, 3179, 2964, 2748, 2533, 2317, 2100, 1884, 1667, 1451, 1234, 1017, 800, 584, 367, 151, -65, -280, -495, -709, -923, -1135, -1347, -1558, -1767, -1976, -2183, -2388, -2592, -2794, -2995, -3193, -3389, -3583, -3775, -3965, -4152, -4336, -4517, -4696, -4871, -5044, -5213, -5380, -5542, -5702, -5858, -6010, -6159, -6304, -6445, -6583, -6716, -6846, -6972, -7094, -7213, -7327, -7437, -7543, -7646, -7744, -7839, -7930, -8017, -8099, -8179, -8254, -8325, -8393, -8457, -8518,
+    7425, 7219, 7013, 6806, 6600, 6393, 6186, 5978, 5770, 5562, 5354, 5145, 4935, 4725, 4515, 4305, 4094, 3882, 3671, 3459, 3246, 3034, 2821, 2607, 2394, 2180, 1966, 1753, 1539, 1325, 1111, 897, 683, 470, 257, 44, -168, -379, -590, -800, -1009, -1218, -1425, -1631, -1836, -2040, -2242, -2442, -2641, -2838, -3033, -3226, -3416, -3605, -3791, -3975, -4156, -4334, -4510, -4683, -4852, -5019, -5183, -5343, -5500, -5653, -5804, -5950, -6093, -6233, -6369, -6501, -6629, -6754, -6874, -6991, -7105, -7214, -7319, -7421, -7519, -7613, -7703, -7790, -7872, -7951, -8026, -8098, -8166, -8230, -8290,
+    7465, 7260, 7055, 6849, 6644, 6438, 6232, 6026, 5819, 5612, 5405, 5198, 4990, 4782, 4573, 4364, 4155, 3946, 3736, 3526, 3316, 3105, 2895, 2684, 2473, 2262, 2050, 1839, 1628, 1417, 1206, 995, 784, 574, 364, 154, -55, -263, -471, -678, -884, -1089, -1293, -1495, -1697, -1897, -2096, -2293, -2488, -2682, -2874, -3063, -3251, -3436, -3619, -3800, -3978, -4153, -4326, -4496, -4663, -4827, -4988, -5146, -5301, -5452, -5600, -5745, -5886, -6023, -6157, -6288, -6415, -6538, -6657, -6773, -6885, -6994, -7098, -7199, -7296, -7390, -7479, -7565, -7648, -7726, -7801, -7873, -7940, -8005, -8065,
+    7508, 7303, 7099, 6895, 6690, 6485, 6280, 6075, 5870, 5665, 5459, 5253, 5046, 4840, 4633, 4426, 4219, 4011, 3804, 3596, 3387, 3179, 2971, 2762, 2553, 2345, 2136, 1927, 1718, 1510, 1302, 1093, 886, 678, 471, 265, 59, -147, -351, -555, -758, -960, -1160, -1360, -1558, -1755, -1950, -2144, -2337, -2527, -2716, -2902, -3087, -3269, -3449, -3627, -3802, -3974, -4144, -4312, -4476, -4638, -4796, -4952, -5104, -5253, -5399, -5542, -5681, -5817, -5949, -6078, -6203, -6325, -6443, -6558, -6669, -6776, -6880, -6980, -7076, -7169, -7258, -7344, -7425, -7504, -7579, -7650, -7718, -7782, -7842,
+    7553, 7349, 7146, 6942, 6739, 6535, 6331, 6127, 5923, 5719, 5515, 5310, 5105, 4901, 4695, 4490, 4285, 4079, 3873, 3667, 3461, 3255, 3048, 2842, 2635, 2429, 2223, 2016, 1810, 1604, 1399, 1193, 988, 784, 579, 376, 173, -30, -231, -432, -632, -830, -1028, -1224, -1420, -1613, -1806, -1997, -2186, -2373, -2559, -2742, -2924, -3103, -3280, -3455, -3627, -3797, -3965, -4129, -4291, -4450, -4606, -4759, -4909, -5056, -5200, -5341, -5478, -5612, -5743, -5870, -5994, -6114, -6231, -6345, -6455, -6561, -6664, -6763, -6859, -6951, -7039, -7124, -7206, -7284, -7358, -7429, -7497, -7561, -7622,
+    7601, 7398, 7195, 6993, 6790, 6588, 6385, 6182, 5979, 5776, 5573, 5370, 5167, 4963, 4760, 4556, 4352, 4148, 3944, 3740, 3536, 3332, 3128, 2923, 2719, 2515, 2311, 2107, 1904, 1700, 1497, 1294, 1092, 890, 688, 488, 287, 88, -111, -308, -505, -701, -896, -1089, -1281, -1472, -1662, -1849, -2036, -2220, -2403, -2583, -2762, -2938, -3113, -3285, -3454, -3622, -3786, -3948, -4108, -4264, -4418, -4569, -4717, -4862, -5004, -5143, -5278, -5410, -5539, -5665, -5787, -5906, -6022, -6134, -6243, -6348, -6450, -6548, -6643, -6735, -6823, -6907, -6988, -7066, -7140, -7211, -7278, -7342, -7403,
+    7651, 7449, 7248, 7046, 6844, 6642, 6441, 6239, 6037, 5836, 5634, 5432, 5230, 5028, 4826, 4624, 4422, 4220, 4018, 3815, 3613, 3411, 3209, 3007, 2805, 2603, 2401, 2199, 1998, 1797, 1596, 1396, 1196, 997, 798, 600, 403, 206, 10, -185, -379, -572, -764, -954, -1143, -1331, -1518, -1703, -1886, -2068, -2247, -2425, -2601, -2775, -2946, -3116, -3283, -3447, -3610, -3769, -3926, -4081, -4232, -4381, -4527, -4670, -4809, -4946, -5080, -5211, -5338, -5462, -5583, -5701, -5815, -5926, -6034, -6138, -6239, -6336, -6430, -6521, -6608, -6692, -6773, -6850, -6924, -6994, -7061, -7125, -7186,
+    7705, 7503, 7302, 7101, 6900, 6700, 6499, 6298, 6098, 5897, 5697, 5496, 5296, 5095, 4895, 4694, 4494, 4293, 4093, 3892, 3692, 3492, 3292, 3091, 2892, 2692, 2492, 2293, 2094, 1895, 1697, 1499, 1302, 1105, 909, 713, 519, 325, 131, -61, -252, -442, -631, -819, -1006, -1191, -1374, -1556, -1737, -1916, -2093, -2268, -2441, -2612, -2781, -2948, -3112, -3275, -3434, -3592, -3746, -3898, -4048, -4194, -4338, -4479, -4617, -4752, -4884, -5013, -5139, -5261, -5381, -5497, -5610, -5720, -5826, -5929, -6029, -6126, -6219, -6309, -6396, -6479, -6559, -6636, -6709, -6780, -6846, -6910, -6970,
+    7760, 7560, 7359, 7159, 6959, 6759, 6560, 6360, 6161, 5961, 5762, 5563, 5364, 5165, 4965, 4766, 4568, 4369, 4170, 3971, 3773, 3574, 3376, 3178, 2980, 2782, 2585, 2388, 2191, 1995, 1799, 1603, 1409, 1214, 1021, 828, 635, 444, 253, 64, -125, -312, -499, -684, -868, -1050, -1231, -1411, -1588, -1764, -1939, -2111, -2282, -2450, -2617, -2781, -2943, -3103, -3260, -3415, -3568, -3718, -3865, -4009, -4151, -4290, -4426, -4560, -4690, -4817, -4941, -5062, -5180, -5295, -5407, -5516, -5621, -5723, -5822, -5918, -6010, -6099, -6185, -6268, -6348, -6424, -6497, -6567, -6633, -6696, -6757,
+    7819, 7619, 7419, 7220, 7020, 6821, 6623, 6424, 6226, 6028, 5829, 5632, 5434, 5236, 5038, 4841, 4643, 4446, 4249, 4052, 3855, 3659, 3462, 3266, 3070, 2875, 2679, 2484, 2290, 2096, 1902, 1709, 1516, 1324, 1133, 942, 753, 564, 376, 189, 3, -182, -366, -549, -730, -910, -1088, -1265, -1440, -1614, -1785, -1955, -2123, -2289, -2454, -2615, -2775, -2933, -3088, -3240, -3391, -3538, -3684, -3826, -3966, -4103, -4237, -4369, -4497, -4623, -4745, -4865, -4982, -5095, -5206, -5313, -5417, -5519, -5617, -5711, -5803, -5891, -5977, -6059, -6138, -6213, -6286, -6355, -6421, -6484, -6544,
+    7880, 7680, 7481, 7283, 7084, 6886, 6688, 6491, 6293, 6096, 5899, 5702, 5506, 5309, 5113, 4917, 4721, 4526, 4330, 4135, 3940, 3745, 3550, 3356, 3162, 2968, 2775, 2582, 2390, 2198, 2006, 1815, 1625, 1435, 1246, 1058, 871, 684, 499, 314, 130, -52, -233, -413, -592, -769, -945, -1119, -1292, -1463, -1632, -1800, -1966, -2129, -2291, -2450, -2608, -2763, -2916, -3066, -3215, -3360, -3503, -3644, -3782, -3917, -4050, -4179, -4306, -4430, -4551, -4670, -4785, -4897, -5006, -5113, -5216, -5316, -5413, -5507, -5597, -5685, -5770, -5851, -5929, -6004, -6076, -6145, -6211, -6274, -6334,
+    7943, 7744, 7546, 7348, 7150, 6953, 6756, 6560, 6363, 6167, 5971, 5776, 5580, 5385, 5190, 4996, 4801, 4607, 4413, 4219, 4026, 3833, 3640, 3447, 3255, 3064, 2872, 2681, 2491, 2301, 2112, 1923, 1735, 1547, 1361, 1175, 990, 805, 622, 440, 259, 79, -100, -278, -454, -629, -802, -974, -1144, -1313, -1480, -1645, -1808, -1970, -2129, -2286, -2441, -2594, -2745, -2894, -3040, -3183, -3324, -3463, -3599, -3733, -3863, -3991, -4117, -4239, -4359, -4476, -4589, -4700, -4808, -4913, -5015, -5114, -5210, -5303, -5393, -5480, -5564, -5645, -5722, -5797, -5868, -5937, -6002, -6065, -6124,
+    8010, 7811, 7614, 7416, 7219, 7023, 6827, 6631, 6436, 6240, 6046, 5851, 5657, 5463, 5270, 5076, 4883, 4690, 4498, 4306, 4114, 3923, 3731, 3541, 3350, 3160, 2971, 2782, 2594, 2406, 2218, 2032, 1846, 1660, 1476, 1292, 1109, 927, 746, 567, 388, 210, 34, -142, -316, -488, -659, -829, -997, -1163, -1328, -1490, -1651, -1810, -1968, -2123, -2276, -2427, -2575, -2722, -2866, -3007, -3147, -3283, -3418, -3549, -3678, -3805, -3928, -4049, -4168, -4283, -4395, -4505, -4612, -4716, -4817, -4915, -5010, -5102, -5191, -5277, -5360, -5440, -5517, -5591, -5662, -5730, -5795, -5857, -5916,
+    8079, 7881, 7684, 7487, 7291, 7095, 6900, 6705, 6510, 6316, 6122, 5929, 5736, 5543, 5351, 5159, 4967, 4776, 4585, 4394, 4204, 4014, 3825, 3636, 3447, 3259, 3071, 2884, 2698, 2512, 2326, 2142, 1958, 1775, 1592, 1411, 1230, 1050, 871, 694, 517, 342, 168, -5, -177, -347, -516, -683, -849, -1013, -1175, -1336, -1495, -1652, -1807, -1960, -2111, -2259, -2406, -2550, -2692, -2832, -2970, -3105, -3237, -3367, -3494, -3619, -3741, -3861, -3977, -4091, -4203, -4311, -4417, -4519, -4619, -4716, -4810, -4901, -4989, -5075, -5157, -5236, -5312, -5386, -5456, -5524, -5588, -5650, -5708,
+    8151, 7953, 7757, 7560, 7365, 7170, 6975, 6781, 6587, 6394, 6201, 6009, 5817, 5626, 5434, 5244, 5053, 4863, 4674, 4485, 4296, 4107, 3920, 3732, 3545, 3359, 3173, 2988, 2803, 2619, 2436, 2253, 2071, 1890, 1709, 1530, 1351, 1174, 997, 822, 647, 474, 302, 131, -38, -206, -373, -538, -701, -863, -1023, -1182, -1339, -1493, -1646, -1797, -1946, -2093, -2237, -2380, -2520, -2658, -2794, -2927, -3057, -3186, -3312, -3435, -3555, -3673, -3789, -3901, -4011, -4118, -4222, -4324, -4423, -4519, -4612, -4702, -4789, -4873, -4955, -5034, -5109, -5182, -5252, -5319, -5383, -5444, -5502,
+    8225, 8028, 7832, 7637, 7441, 7247, 7053, 6860, 6667, 6475, 6283, 6092, 5901, 5710, 5520, 5331, 5141, 4953, 4765, 4577, 4389, 4203, 4016, 3831, 3645, 3461, 3276, 3093, 2910, 2728, 2546, 2365, 2185, 2006, 1828, 1650, 1474, 1298, 1124, 950, 778, 607, 437, 268, 101, -65, -229, -392, -554, -713, -871, -1028, -1182, -1335, -1486, -1635, -1782, -1927, -2069, -2210, -2348, -2484, -2618, -2750, -2879, -3005, -3129, -3251, -3370, -3487, -3601, -3712, -3820, -3926, -4029, -4130, -4227, -4322, -4414, -4504, -4590, -4674, -4754, -4832, -4907, -4979, -5048, -5115, -5178, -5239, -5297,
+    8303, 8106, 7911, 7715, 7521, 7327, 7134, 6941, 6749, 6558, 6367, 6176, 5986, 5797, 5608, 5420, 5232, 5044, 4857, 4671, 4485, 4300, 4115, 3931, 3747, 3564, 3381, 3199, 3018, 2838, 2658, 2479, 2301, 2124, 1947, 1772, 1597, 1424, 1251, 1080, 909, 740, 572, 406, 241, 77, -86, -246, -406, -563, -719, -874, -1026, -1177, -1326, -1473, -1618, -1761, -1902, -2040, -2177, -2311, -2443, -2573, -2701, -2826, -2948, -3068, -3186, -3301, -3414, -3523, -3631, -3735, -3837, -3937, -4033, -4127, -4218, -4306, -4392, -4475, -4554, -4632, -4706, -4777, -4846, -4912, -4975, -5035, -5092,
+    8384, 8187, 7992, 7797, 7603, 7410, 7217, 7025, 6834, 6643, 6453, 6263, 6075, 5886, 5698, 5511, 5324, 5138, 4952, 4767, 4583, 4399, 4215, 4033, 3850, 3669, 3488, 3308, 3128, 2949, 2771, 2594, 2418, 2242, 2068, 1894, 1722, 1550, 1379, 1210, 1042, 874, 709, 544, 381, 219, 59, -100, -258, -413, -567, -720, -870, -1019, -1166, -1311, -1454, -1595, -1734, -1871, -2006, -2139, -2269, -2397, -2523, -2647, -2768, -2886, -3002, -3116, -3227, -3336, -3442, -3545, -3646, -3744, -3840, -3933, -4023, -4110, -4195, -4276, -4355, -4432, -4505, -4576, -4644, -4709, -4772, -4831, -4888,
+    8467, 8271, 8076, 7881, 7688, 7495, 7303, 7112, 6921, 6731, 6542, 6353, 6165, 5978, 5791, 5604, 5419, 5234, 5049, 4865, 4682, 4500, 4318, 4136, 3956, 3775, 3596, 3418, 3240, 3063, 2886, 2711, 2536, 2362, 2190, 2018, 1847, 1677, 1509, 1341, 1175, 1009, 845, 683, 522, 362, 203, 46, -109, -263, -415, -566, -714, -861, -1006, -1150, -1291, -1430, -1567, -1703, -1836, -1967, -2095, -2222, -2346, -2468, -2588, -2705, -2820, -2932, -3042, -3149, -3254, -3356, -3456, -3553, -3647, -3739, -3828, -3914, -3998, -4079, -4157, -4233, -4306, -4376, -4443, -4508, -4569, -4628, -4685,
+    8554, 8358, 8163, 7969, 7775, 7583, 7392, 7201, 7011, 6822, 6633, 6445, 6258, 6071, 5886, 5700, 5516, 5332, 5148, 4966, 4784, 4602, 4422, 4242, 4063, 3884, 3706, 3529, 3353, 3177, 3003, 2829, 2656, 2484, 2313, 2143, 1974, 1806, 1639, 1473, 1308, 1145, 983, 822, 663, 505, 348, 193, 40, -112, -263, -411, -558, -703, -846, -988, -1127, -1265, -1401, -1534, -1665, -1795, -1922, -2047, -2170, -2290, -2408, -2524, -2637, -2748, -2857, -2963, -3066, -3167, -3266, -3362, -3455, -3546, -3634, -3719, -3802, -3882, -3960, -4034, -4106, -4176, -4242, -4306, -4368, -4426, -4482,
+    8644, 8448, 8253, 8059, 7866, 7674, 7483, 7293, 7103, 6915, 6727, 6540, 6353, 6168, 5983, 5798, 5615, 5432, 5250, 5068, 4887, 4707, 4528, 4349, 4171, 3994, 3818, 3642, 3467, 3293, 3120, 2948, 2777, 2606, 2437, 2269, 2101, 1935, 1770, 1606, 1443, 1282, 1121, 962, 805, 649, 494, 341, 189, 39, -110, -256, -402, -545, -686, -826, -964, -1100, -1234, -1366, -1495, -1623, -1749, -1872, -1993, -2112, -2229, -2343, -2455, -2565, -2672, -2777, -2879, -2979, -3076, -3171, -3263, -3353, -3440, -3525, -3607, -3686, -3762, -3836, -3908, -3976, -4042, -4106, -4166, -4224, -4279,
+    8737, 8541, 8346, 8152, 7960, 7768, 7577, 7388, 7199, 7011, 6823, 6637, 6451, 6266, 6082, 5899, 5716, 5534, 5353, 5173, 4993, 4814, 4636, 4459, 4282, 4106, 3931, 3757, 3584, 3411, 3240, 3069, 2899, 2730, 2563, 2396, 2230, 2066, 1902, 1740, 1579, 1419, 1261, 1103, 948, 793, 640, 489, 339, 190, 44, -101, -245, -386, -526, -664, -800, -935, -1067, -1197, -1325, -1452, -1576, -1697, -1817, -1935, -2050, -2163, -2274, -2382, -2488, -2591, -2692, -2791, -2887, -2981, -3072, -3161, -3247, -3331, -3412, -3490, -3566, -3639, -3709, -3777, -3843, -3905, -3965, -4022, -4077,
+    8833, 8637, 8443, 8249, 8056, 7865, 7675, 7485, 7297, 7109, 6922, 6737, 6552, 6368, 6184, 6002, 5820, 5639, 5459, 5280, 5101, 4923, 4746, 4570, 4395, 4220, 4046, 3874, 3702, 3531, 3360, 3191, 3023, 2856, 2690, 2525, 2360, 2198, 2036, 1875, 1716, 1558, 1401, 1245, 1091, 938, 787, 637, 489, 343, 197, 54, -88, -228, -366, -502, -637, -769, -900, -1029, -1155, -1280, -1402, -1523, -1641, -1757, -1871, -1983, -2092, -2199, -2304, -2406, -2506, -2604, -2699, -2791, -2881, -2969, -3054, -3137, -3217, -3294, -3369, -3442, -3511, -3579, -3643, -3705, -3764, -3821, -3875,
+    8933, 8737, 8542, 8349, 8156, 7965, 7775, 7586, 7398, 7211, 7024, 6839, 6655, 6471, 6289, 6107, 5926, 5746, 5567, 5389, 5211, 5034, 4859, 4683, 4509, 4336, 4164, 3992, 3821, 3652, 3483, 3315, 3149, 2983, 2818, 2654, 2492, 2331, 2170, 2011, 1854, 1697, 1542, 1388, 1236, 1085, 935, 787, 640, 495, 352, 210, 70, -68, -205, -340, -473, -604, -733, -860, -985, -1108, -1229, -1348, -1465, -1580, -1692, -1803, -1911, -2017, -2120, -2221, -2320, -2416, -2510, -2602, -2691, -2777, -2862, -2943, -3022, -3099, -3173, -3245, -3314, -3380, -3444, -3505, -3563, -3619, -3673,
+    9037, 8840, 8645, 8452, 8259, 8068, 7878, 7689, 7502, 7315, 7129, 6944, 6761, 6578, 6396, 6215, 6035, 5856, 5677, 5500, 5323, 5148, 4973, 4799, 4626, 4454, 4283, 4112, 3943, 3775, 3607, 3441, 3276, 3111, 2948, 2786, 2625, 2465, 2306, 2149, 1993, 1838, 1684, 1532, 1381, 1232, 1084, 937, 792, 649, 507, 367, 228, 91, -44, -177, -308, -438, -565, -691, -815, -936, -1056, -1174, -1289, -1402, -1514, -1623, -1729, -1834, -1936, -2036, -2134, -2229, -2322, -2412, -2500, -2586, -2669, -2750, -2828, -2904, -2977, -3048, -3116, -3181, -3244, -3305, -3363, -3418, -3471,
+    9144, 8948, 8752, 8558, 8366, 8175, 7985, 7796, 7609, 7422, 7237, 7053, 6869, 6687, 6506, 6326, 6146, 5968, 5790, 5614, 5438, 5263, 5090, 4917, 4745, 4574, 4404, 4235, 4067, 3899, 3733, 3568, 3404, 3241, 3080, 2919, 2759, 2601, 2444, 2288, 2133, 1980, 1828, 1677, 1527, 1380, 1233, 1088, 945, 803, 663, 524, 387, 252, 118, -13, -143, -271, -397, -522, -644, -764, -882, -999, -1113, -1225, -1335, -1442, -1548, -1651, -1752, -1851, -1947, -2042, -2133, -2223, -2310, -2394, -2477, -2556, -2634, -2708, -2781, -2851, -2918, -2983, -3045, -3105, -3162, -3216, -3268,
+    9256, 9058, 8863, 8669, 8476, 8285, 8095, 7906, 7719, 7533, 7348, 7164, 6981, 6799, 6618, 6439, 6260, 6082, 5906, 5730, 5555, 5381, 5209, 5037, 4866, 4696, 4527, 4359, 4192, 4026, 3861, 3698, 3535, 3373, 3213, 3053, 2895, 2738, 2582, 2428, 2275, 2123, 1972, 1823, 1675, 1529, 1384, 1240, 1098, 958, 819, 682, 547, 413, 281, 151, 22, -104, -229, -352, -473, -592, -709, -823, -936, -1047, -1156, -1262, -1366, -1468, -1568, -1666, -1761, -1854, -1945, -2033, -2119, -2203, -2284, -2363, -2439, -2513, -2584, -2653, -2720, -2784, -2845, -2904, -2961, -3014, -3066,
+    9371, 9173, 8977, 8783, 8590, 8398, 8208, 8020, 7832, 7646, 7462, 7278, 7096, 6914, 6734, 6555, 6377, 6200, 6024, 5849, 5675, 5502, 5330, 5159, 4989, 4820, 4652, 4485, 4320, 4155, 3991, 3829, 3667, 3507, 3348, 3190, 3033, 2877, 2723, 2569, 2418, 2267, 2118, 1970, 1824, 1679, 1535, 1393, 1253, 1114, 977, 841, 707, 575, 444, 315, 188, 63, -60, -182, -301, -419, -534, -648, -759, -869, -976, -1081, -1184, -1285, -1384, -1480, -1574, -1666, -1756, -1843, -1928, -2011, -2091, -2169, -2244, -2317, -2388, -2456, -2522, -2585, -2645, -2703, -2759, -2812, -2863,
+    9491, 9292, 9096, 8901, 8707, 8516, 8326, 8137, 7950, 7764, 7579, 7396, 7213, 7032, 6853, 6674, 6496, 6320, 6144, 5970, 5797, 5625, 5454, 5284, 5115, 4947, 4780, 4614, 4449, 4286, 4123, 3962, 3801, 3642, 3484, 3327, 3172, 3017, 2864, 2713, 2562, 2413, 2265, 2119, 1974, 1830, 1688, 1548, 1408, 1271, 1135, 1001, 868, 737, 608, 481, 355, 231, 109, -11, -129, -245, -359, -471, -582, -690, -796, -900, -1002, -1101, -1199, -1294, -1387, -1478, -1567, -1653, -1737, -1818, -1898, -1975, -2049, -2121, -2191, -2258, -2323, -2385, -2445, -2502, -2557, -2609, -2659,
+    9616, 9416, 9219, 9023, 8829, 8637, 8447, 8258, 8070, 7884, 7700, 7516, 7334, 7154, 6974, 6796, 6619, 6443, 6268, 6094, 5922, 5750, 5580, 5411, 5243, 5076, 4910, 4745, 4581, 4418, 4257, 4097, 3937, 3779, 3623, 3467, 3313, 3160, 3008, 2857, 2708, 2560, 2414, 2269, 2125, 1983, 1842, 1703, 1565, 1429, 1295, 1162, 1031, 901, 773, 647, 523, 401, 280, 161, 44, -71, -184, -295, -404, -510, -615, -718, -819, -917, -1014, -1108, -1200, -1290, -1377, -1462, -1545, -1626, -1704, -1780, -1853, -1925, -1993, -2060, -2124, -2185, -2244, -2301, -2355, -2406, -2455,
+    9745, 9544, 9346, 9150, 8955, 8763, 8572, 8382, 8195, 8009, 7824, 7641, 7459, 7278, 7099, 6921, 6744, 6569, 6395, 6221, 6049, 5879, 5709, 5541, 5373, 5207, 5042, 4878, 4715, 4554, 4393, 4234, 4076, 3919, 3763, 3609, 3456, 3304, 3153, 3004, 2856, 2709, 2564, 2420, 2278, 2137, 1998, 1860, 1723, 1589, 1455, 1324, 1194, 1066, 939, 815, 692, 571, 451, 334, 218, 105, -7, -117, -225, -330, -434, -536, -635, -733, -828, -921, -1012, -1100, -1187, -1271, -1353, -1432, -1510, -1585, -1657, -1727, -1795, -1861, -1924, -1984, -2042, -2098, -2151, -2202, -2250,
+    9880, 9678, 9478, 9281, 9086, 8892, 8701, 8511, 8323, 8137, 7952, 7769, 7587, 7406, 7227, 7050, 6873, 6698, 6524, 6352, 6180, 6010, 5841, 5673, 5506, 5341, 5177, 5014, 4852, 4691, 4531, 4373, 4216, 4060, 3906, 3752, 3600, 3450, 3300, 3152, 3005, 2860, 2716, 2573, 2432, 2293, 2155, 2018, 1883, 1749, 1618, 1487, 1359, 1232, 1107, 983, 862, 742, 624, 507, 393, 281, 170, 62, -45, -149, -252, -352, -451, -547, -641, -733, -823, -910, -996, -1079, -1160, -1238, -1315, -1389, -1460, -1529, -1596, -1661, -1723, -1783, -1840, -1895, -1947, -1997, -2044,
+    10020, 9817, 9616, 9417, 9221, 9027, 8835, 8644, 8456, 8269, 8084, 7901, 7719, 7538, 7359, 7182, 7005, 6831, 6657, 6485, 6314, 6144, 5976, 5808, 5642, 5478, 5314, 5152, 4991, 4831, 4672, 4515, 4359, 4204, 4050, 3898, 3747, 3598, 3449, 3302, 3157, 3012, 2870, 2728, 2588, 2450, 2313, 2178, 2044, 1912, 1781, 1652, 1525, 1399, 1275, 1153, 1032, 914, 797, 682, 569, 458, 348, 241, 136, 32, -69, -168, -265, -360, -453, -544, -633, -720, -804, -886, -966, -1043, -1119, -1192, -1262, -1331, -1397, -1460, -1521, -1580, -1636, -1690, -1742, -1791, -1837,
+    10166, 9961, 9759, 9559, 9362, 9166, 8973, 8782, 8593, 8406, 8220, 8037, 7854, 7674, 7495, 7317, 7141, 6967, 6793, 6621, 6451, 6281, 6113, 5947, 5781, 5617, 5454, 5293, 5133, 4973, 4816, 4659, 4504, 4350, 4197, 4046, 3896, 3748, 3600, 3454, 3310, 3167, 3025, 2885, 2746, 2609, 2473, 2339, 2206, 2075, 1946, 1818, 1692, 1568, 1445, 1324, 1205, 1087, 972, 858, 746, 636, 528, 422, 318, 215, 115, 17, -79, -173, -265, -355, -442, -528, -611, -692, -771, -847, -922, -994, -1063, -1131, -1196, -1258, -1319, -1376, -1432, -1485, -1535, -1583, -1629,
+    10319, 10112, 9908, 9707, 9508, 9311, 9117, 8925, 8735, 8547, 8361, 8177, 7995, 7814, 7634, 7457, 7281, 7106, 6933, 6761, 6591, 6422, 6254, 6088, 5923, 5760, 5598, 5437, 5277, 5119, 4962, 4806, 4652, 4499, 4347, 4197, 4048, 3900, 3754, 3609, 3465, 3323, 3183, 3044, 2906, 2770, 2635, 2502, 2371, 2241, 2113, 1986, 1861, 1738, 1616, 1497, 1379, 1262, 1148, 1035, 925, 816, 709, 604, 501, 400, 301, 204, 109, 16, -75, -164, -250, -335, -417, -497, -575, -650, -724, -795, -863, -930, -994, -1055, -1115, -1171, -1226, -1278, -1327, -1375, -1419,
+    10479, 10270, 10064, 9860, 9660, 9462, 9266, 9073, 8882, 8694, 8507, 8322, 8139, 7958, 7778, 7601, 7424, 7250, 7077, 6905, 6735, 6566, 6399, 6233, 6069, 5906, 5744, 5584, 5425, 5267, 5111, 4956, 4802, 4650, 4499, 4349, 4201, 4055, 3909, 3765, 3623, 3482, 3342, 3204, 3068, 2933, 2799, 2667, 2537, 2408, 2281, 2156, 2032, 1910, 1789, 1671, 1554, 1439, 1325, 1214, 1104, 997, 891, 787, 685, 585, 487, 391, 297, 206, 116, 28, -57, -140, -222, -301, -377, -452, -524, -594, -662, -727, -790, -851, -909, -965, -1019, -1070, -1118, -1164, -1208,
+    10648, 10435, 10226, 10021, 9818, 9619, 9422, 9227, 9035, 8845, 8658, 8472, 8288, 8107, 7927, 7749, 7572, 7397, 7224, 7053, 6883, 6714, 6547, 6382, 6217, 6055, 5893, 5734, 5575, 5418, 5262, 5108, 4955, 4804, 4654, 4505, 4358, 4212, 4067, 3924, 3783, 3643, 3504, 3367, 3232, 3098, 2965, 2834, 2705, 2578, 2452, 2327, 2204, 2083, 1964, 1847, 1731, 1617, 1505, 1394, 1286, 1179, 1075, 972, 871, 772, 675, 581, 488, 397, 308, 222, 138, 55, -25, -103, -178, -252, -323, -392, -459, -523, -585, -645, -702, -757, -809, -859, -907, -952, -995,
+    10824, 10609, 10397, 10189, 9984, 9782, 9583, 9387, 9194, 9003, 8814, 8627, 8443, 8260, 8080, 7901, 7725, 7550, 7376, 7204, 7034, 6866, 6699, 6534, 6370, 6207, 6047, 5887, 5729, 5573, 5417, 5264, 5112, 4961, 4811, 4663, 4517, 4372, 4228, 4086, 3946, 3806, 3669, 3533, 3398, 3265, 3134, 3004, 2876, 2749, 2624, 2501, 2379, 2259, 2141, 2025, 1910, 1797, 1686, 1577, 1469, 1364, 1260, 1159, 1059, 961, 865, 772, 680, 590, 503, 417, 334, 253, 174, 97, 22, -50, -121, -188, -254, -317, -378, -437, -493, -547, -599, -648, -694, -738, -780,
+    11011, 10792, 10577, 10365, 10158, 9953, 9752, 9554, 9359, 9166, 8976, 8788, 8603, 8420, 8238, 8059, 7882, 7706, 7533, 7361, 7191, 7022, 6855, 6690, 6526, 6364, 6203, 6044, 5887, 5730, 5576, 5423, 5271, 5121, 4972, 4825, 4679, 4535, 4392, 4251, 4111, 3973, 3836, 3701, 3567, 3435, 3304, 3176, 3048, 2923, 2799, 2676, 2556, 2437, 2320, 2204, 2091, 1979, 1869, 1761, 1655, 1550, 1448, 1347, 1248, 1152, 1057, 964, 874, 785, 699, 614, 532, 452, 374, 298, 224, 153, 84, 17, -47, -110, -170, -227, -282, -335, -386, -433, -479, -522, -562,
+    11209, 10985, 10766, 10551, 10340, 10133, 9929, 9729, 9531, 9337, 9145, 8956, 8769, 8585, 8402, 8222, 8044, 7868, 7694, 7522, 7351, 7183, 7016, 6850, 6687, 6525, 6364, 6205, 6048, 5892, 5738, 5585, 5434, 5284, 5136, 4989, 4844, 4701, 4559, 4418, 4279, 4142, 4006, 3871, 3739, 3607, 3478, 3350, 3224, 3099, 2976, 2855, 2735, 2617, 2501, 2387, 2274, 2163, 2054, 1947, 1842, 1739, 1637, 1538, 1440, 1344, 1251, 1159, 1070, 982, 897, 813, 732, 653, 576, 501, 429, 359, 290, 225, 161, 100, 41, -15, -69, -121, -170, -217, -261, -303, -342,
+};
+
+const IkGridTable IK_GRID_DOGARM = {
+    -60.0f, 100.0f,   // x_min, y_min
+    2.0f, 0.5f,   // step, inv_step
+    91, 51,   // nx, ny
+    9.58738019e-05f,   // angle_lsb
+    2.56014681f, 0.581445694f,   // theta1_offset, theta2_offset
+    0.00020301342f,   // max_error (rad)
+    IK_GRID_THETA1,
+    IK_GRID_THETA2,
+};
@@ -0,0 +1,43 @@
+/**
+ * @file ik_lookup_grid.cpp
+ * @brief 查表式逆運動學實作
+ */
+
+#include "ik_lookup_grid.hpp"
+
+MotorAngles IkLookupGrid::lookup(Point2D p) const {
+    MotorAngles result;
+    result.is_reachable = false;
+    result.theta1 = 0;
+    result.theta2 = 0;
+
+    // 1. 轉成網格座標
+    float fx = (p.x - _t.x_min) * _t.inv_step;
+    float fy = (p.y - _t.y_min) * _t.inv_step;
+    if (fx < 0.0f || fy < 0.0f || fx > (float)(_t.nx - 1) || fy > (float)(_t.ny - 1)) {
+        return result; // 網格外
+    }
+
+    // 2. 找出所在格子 (右/上邊界上的點歸到最後一格)
+    int ix = (int)fx;
+    int iy = (int)fy;
+    if (ix > _t.nx - 2) ix = _t.nx - 2;
+    if (iy > _t.ny - 2) iy = _t.ny - 2;
+    float tx = fx - (float)ix;
+    float ty = fy - (float)iy;
+
+    // 3. 雙線性內插 (在 LSB 單位下運算，最後才換成 Rad)
+    int idx = iy * _t.nx + ix;
+    const int16_t* a = _t.theta1 + idx;
+    const int16_t* b = _t.theta2 + idx;
+
+    float a0 = (float)a[0] + tx * (float)(a[1] - a[0]);
+    float a1 = (float)a[_t.nx] + tx * (float)(a[_t.nx + 1] - a[_t.nx]);
+    float b0 = (float)b[0] + tx * (float)(b[1] - b[0]);
+    float b1 = (float)b[_t.nx] + tx * (float)(b[_t.nx + 1] - b[_t.nx]);
+
+    result.theta1 = _t.theta1_offset + (a0 + ty * (a1 - a0)) * _t.angle_lsb;
+    result.theta2 = _t.theta2_offset + (b0 + ty * (b1 - b0)) * _t.angle_lsb;
+    result.is_reachable = true;
+    return result;
+}
@@ -1,100 +1,151 @@
 /**
  * @file kinematics.cpp
- * @brief 五連桿運動學實作
+ * @brief 五連桿運動學實作 (批次 SoA 解算核心)
+ * @note 單點 solveIK / solveFK 為樣板，實作在 kinematics.hpp
  */
 
 #include "kinematics.hpp"
+#include "vector_math.hpp"
 #include <cmath>
-
-// 輔助函式：限制 acos 輸入範圍，避免 NaN
-static float clip(float n, float lower, float upper) {
-    return std::fmax(lower, std::fmin(n, upper));
+#include <cstring>
+
+// ==========================================================
+// 批次解算 (SoA)
+// ==========================================================
+// 同一份核心以 Ops 樣板展開成 Scalar / SSE2 / AVX 三種寬度，
+// 每次處理 Ops::width 點，回傳該組的可達位元。
+
+template <class Ops>
+static uint32_t ikBlock(const float* px, const float* py, float* t1, float* t2,
+                        const FiveBarGeometry& G, float mode) {
+    typedef typename Ops::V V;
+    typedef typename Ops::M M;
+
+    const V zero = Ops::set1(0.0f);
+    const V reach_max = Ops::set1(G.reach_max);
+    const V reach_min = Ops::set1(G.reach_min);
+    const V k = Ops::set1(G.k);                     // L1^2 - L2^2
+    const V inv_2l1 = Ops::set1(G.inv_2l1);
+    const V lo = Ops::set1(-1.0f);
+    const V hi = Ops::set1(1.0f);
+    const V m = Ops::set1(mode);
+
+    V x = Ops::load(px);
+    V y = Ops::load(py);
+    V x_r = Ops::sub(x, Ops::set1(G.d));
+
+    // 左臂 (原點 (0,0))
+    V dl2 = Ops::add(Ops::mul(x, x), Ops::mul(y, y));
+    V dl = Ops::sqrt(dl2);
+    // 右臂 (原點 (D,0))
+    V dr2 = Ops::add(Ops::mul(x_r, x_r), Ops::mul(y, y));
+    V dr = Ops::sqrt(dr2);
+
+    M ok = Ops::mask_and(Ops::mask_and(Ops::le(dl, reach_max), Ops::le(reach_min, dl)),
+                         Ops::mask_and(Ops::le(dr, reach_max), Ops::le(reach_min, dr)));
+
+    // cos(beta) = (L1^2 + dist^2 - L2^2) / (2 * L1 * dist)
+    // 不可達的 lane 可能除以 0，結果最後會被 select 蓋掉
+    V cos_bl = Ops::div(Ops::mul(Ops::add(k, dl2), inv_2l1), dl);
+    V cos_br = Ops::div(Ops::mul(Ops::add(k, dr2), inv_2l1), dr);
+    V beta_l = vmath::acos<Ops>(Ops::max(lo, Ops::min(cos_bl, hi)));
+    V beta_r = vmath::acos<Ops>(Ops::max(lo, Ops::min(cos_br, hi)));
+
+    V th1 = Ops::add(vmath::atan2<Ops>(y, x), Ops::mul(m, beta_l));
+    V th2 = Ops::sub(vmath::atan2<Ops>(y, x_r), Ops::mul(m, beta_r));
+
+    Ops::store(t1, Ops::select(ok, th1, zero));
+    Ops::store(t2, Ops::select(ok, th2, zero));
+    return Ops::bits(ok);
 }
 
-MotorAngles FiveBarKinematics::solveIK(Point2D P, int mode) {
-    MotorAngles result;
-    result.is_reachable = false;
-    result.theta1 = 0;
-    result.theta2 = 0;
-
-    // --- 1. 計算左臂角度 (Theta 1) ---
-    // 以左馬達 (0,0) 為原點，目標 P(x,y)
-    float dist_L = std::sqrt(P.x * P.x + P.y * P.y);
+template <class Ops>
+static void fkBlock(const float* pt1, const float* pt2, float* px, float* py,
+                    const FiveBarGeometry& G) {
+    typedef typename Ops::V V;
+    typedef typename Ops::M M;
+
+    const V zero = Ops::set1(0.0f);
+    const V l1 = Ops::set1(G.l1);
+
+    V c1, s1, c2, s2;
+    vmath::sincos<Ops>(Ops::load(pt1), &s1, &c1);
+    vmath::sincos<Ops>(Ops::load(pt2), &s2, &c2);
+
+    // 兩個肘部座標
+    V e1x = Ops::mul(l1, c1);
+    V e1y = Ops::mul(l1, s1);
+    V e2x = Ops::add(Ops::set1(G.d), Ops::mul(l1, c2));
+    V e2y = Ops::mul(l1, s2);
+
+    V dx = Ops::sub(e2x, e1x);
+    V dy = Ops::sub(e2y, e1y);
+    V d2 = Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy));
+    V d = Ops::sqrt(d2);
+    M ok = Ops::mask_and(Ops::le(d, Ops::set1(G.two_l2)), Ops::gt(d, zero));
+
+    // 兩圓半徑皆為 L2，中點在 a = d/2
+    V a = Ops::mul(Ops::set1(0.5f), d);
+    V h = Ops::sqrt(Ops::max(zero, Ops::sub(Ops::set1(G.l2_sq), Ops::mul(a, a))));
+    V inv_d = Ops::div(Ops::set1(1.0f), Ops::select(ok, d, Ops::set1(1.0f)));
+    V ux = Ops::mul(dx, inv_d);
+    V uy = Ops::mul(dy, inv_d);
+    V mx = Ops::add(e1x, Ops::mul(a, ux));
+    V my = Ops::add(e1y, Ops::mul(a, uy));
+
+    V x = Ops::sub(mx, Ops::mul(h, uy));
+    V y = Ops::add(my, Ops::mul(h, ux));
+
+    // 與 solveFK 相同：Y 為負時改取另一個交點
+    M flip = Ops::lt(y, zero);
+    x = Ops::select(flip, Ops::add(mx, Ops::mul(h, uy)), x);
+    y = Ops::select(flip, Ops::sub(my, Ops::mul(h, ux)), y);
+
+    Ops::store(px, Ops::select(ok, x, zero));
+    Ops::store(py, Ops::select(ok, y, zero));
+}
 
-    // 檢查是否超出範圍 (兩臂拉直或摺疊)
-    if (dist_L > (L1 + L2) || dist_L < std::fabs(L1 - L2)) {
-        return result; // Unreachable
+#if defined(__AVX__)
+typedef vmath::AvxOps BatchOps;
+#elif defined(__SSE2__)
+typedef vmath::Sse2Ops BatchOps;
+#else
+typedef vmath::ScalarOps BatchOps;  // Cortex-M4: 單精度 FPU 逐點
+#endif
+
+namespace kinematics_batch {
+
+void solveIK(const FiveBarGeometry& geo,
+             const float* x, const float* y,
+             float* theta1, float* theta2, uint32_t* reachable,
+             size_t n, int mode) {
+    const size_t W = BatchOps::width;  // 32 可被 1/4/8 整除，同一組不會跨 word
+    const float m = (float)mode;
+    std::memset(reachable, 0, FiveBarKinematics::reachableMaskWords(n) * sizeof(uint32_t));
+
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        uint32_t bits = ikBlock<BatchOps>(x + i, y + i, theta1 + i, theta2 + i, geo, m);
+        reachable[i / 32] |= bits << (i % 32);
     }
-
-    // 餘弦定理求內角
-    // L2^2 = L1^2 + dist^2 - 2*L1*dist*cos(beta)
-    float alpha_L = std::atan2(P.y, P.x);
-    float cos_beta_L = (L1 * L1 + dist_L * dist_L - L2 * L2) / (2 * L1 * dist_L);
-    float beta_L = std::acos(clip(cos_beta_L, -1.0f, 1.0f));
-
-    // mode 決定手肘是向左彎還是向右彎 (通常取 +)
-    result.theta1 = alpha_L + (float)mode * beta_L;
-
-
-    // --- 2. 計算右臂角度 (Theta 2) ---
-    // 以右馬達 (D,0) 為原點，將 P 轉換到右馬達座標系 -> P'(x-D, y)
-    float x_R = P.x - D;
-    float y_R = P.y;
-    float dist_R = std::sqrt(x_R * x_R + y_R * y_R);
-
-    if (dist_R > (L1 + L2) || dist_R < std::fabs(L1 - L2)) {
-        return result; // Unreachable
+    for (; i < n; ++i) {
+        uint32_t bits = ikBlock<vmath::ScalarOps>(x + i, y + i, theta1 + i, theta2 + i, geo, m);
+        reachable[i / 32] |= bits << (i % 32);
     }
-
-    float alpha_R = std::atan2(y_R, x_R);
-    float cos_beta_R = (L1 * L1 + dist_R * dist_R - L2 * L2) / (2 * L1 * dist_R);
-    float beta_R = std::acos(clip(cos_beta_R, -1.0f, 1.0f));
-
-    // 右臂的手肘方向通常與左臂相反 (對稱)，所以這裡是 alpha - beta
-    // 但具體取決於你的 mode 定義，這裡假設 mode=1 是 "手肘皆向外"
-    result.theta2 = alpha_R - (float)mode * beta_R;
-
-    result.is_reachable = true;
-    return result;
 }
 
-Point2D FiveBarKinematics::solveFK(float theta1, float theta2) {
-    // 1. 算出兩個肘部 (Elbow) 座標
-    float E1_x = L1 * std::cos(theta1);
-    float E1_y = L1 * std::sin(theta1);
-
-    float E2_x = D + L1 * std::cos(theta2);
-    float E2_y = L1 * std::sin(theta2);
-
-    // 2. 求兩個圓的交點 (以 E1, E2 為圓心，半徑皆為 L2)
-    // 這是經典的雙圓交點問題
-    float d2 = (E2_x - E1_x) * (E2_x - E1_x) + (E2_y - E1_y) * (E2_y - E1_y);
-    float d = std::sqrt(d2);
+void solveFK(const FiveBarGeometry& geo,
+             const float* theta1, const float* theta2,
+             float* x, float* y, size_t n) {
+    const size_t W = BatchOps::width;
 
-    // 檢查是否有解
-    if (d > (L2 + L2) || d == 0) {
-        return {0, 0}; // 構型錯誤 (斷裂或重疊)
+    size_t i = 0;
+    for (; i + W <= n; i += W) {
+        fkBlock<BatchOps>(theta1 + i, theta2 + i, x + i, y + i, geo);
     }
-
-    // 簡化的幾何解法
-    // 找出兩圓連線的中點 M
-    float a = (d2) / (2 * d); // 因為兩半徑相等 L2=L2，簡化公式
-    float h = std::sqrt(std::fmax(0.0f, L2 * L2 - a * a));
-
-    float x2 = E1_x + a * (E2_x - E1_x) / d;
-    float y2 = E1_y + a * (E2_y - E1_y) / d;
-
-    // 兩個交點，取決於手臂是向前伸還是向後
-    // 書法機通常是向前伸 (Y > ElbowY)，這裡取其中一個解
-    Point2D P;
-    P.x = x2 - h * (E2_y - E1_y) / d;
-    P.y = y2 + h * (E2_x - E1_x) / d;
-
-    // 如果算出來 Y 是負的 (往後指)，可能要取另一個解 (+h 改 -h)
-    if (P.y < 0) {
-         P.x = x2 + h * (E2_y - E1_y) / d;
-         P.y = y2 - h * (E2_x - E1_x) / d;
+    for (; i < n; ++i) {
+        fkBlock<vmath::ScalarOps>(theta1 + i, theta2 + i, x + i, y + i, geo);
     }
-
-    return P;
 }
+
+} // namespace kinematics_batch
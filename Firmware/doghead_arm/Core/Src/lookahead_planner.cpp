@@ -0,0 +1,427 @@
+/**
+ * @file lookahead_planner.cpp
+ * @brief 轉角圓化與前瞻速度執行實作
+ */
+
+#include "lookahead_planner.hpp"
+
+static inline float clampf(float x, float lo, float hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+// 轉向角餘弦超過此值視為直行、低於負值視為折返
+static const float JUNCTION_COS_EPS = 0.999999f;
+// 圓化的 d 小於此值 (mm) 時改為在角點停下 (曲率太大，圓化速度也快不了)
+static const float MIN_BLEND_TRIM = 1e-3f;
+// 圓化曲率取樣：t 在 [0, 0.5] 的等分數 (曲線對 t = 0.5 對稱)，須為偶數 (Simpson 積分弧長)
+static const int BLEND_SAMPLES = 16;
+
+// 套用 jerk 一個 tick 後的狀態 (相對位移)，同 SCurveGenerator
+struct Step {
+    float dp, v, a;
+};
+static inline Step integrate(float v, float a, float j, float dt) {
+    Step s;
+    s.dp = dt * (v + dt * (0.5f * a + dt * (j * (1.0f / 6.0f))));
+    s.v = v + dt * (a + 0.5f * j * dt);
+    s.a = a + j * dt;
+    return s;
+}
+
+/**
+ * @brief 從 (v, a) 以最大煞車降到 v_end 走的距離 (SCurveGenerator::stoppingDistance 平移 v_end)
+ * @param time 非 nullptr 時回傳煞車時間
+ * @note 降到 v_end 的時間不超過降到 0 的時間，所以距離 <= 煞停距離 + v_end × 煞停時間 (前瞻範圍依此截斷)
+ */
+static float brakeDistance(float v, float a, float v_end, float A, float J, float* time) {
+    float w = v - v_end;
+    // 立刻以 +J 收回 a 就不會超過 v_end：已低於 v_end 時不必煞車；還高於 v_end (正在減速) 時
+    // 取收回途中降到 v_end 的距離 (w + a t + J t²/2 = 0 的小根，在邊界上與下面的輪廓連續)
+    if (w + a * std::fabs(a) / (2.0f * J) <= 0.0f) {
+        float t = 0.0f;
+        if (w > 0.0f) {
+            float disc = a * a - 2.0f * J * w;
+            t = (-a - std::sqrt(disc > 0.0f ? disc : 0.0f)) / J;
+        }
+        if (time) *time = t;
+        return t * (v + t * (0.5f * a + t * (J * (1.0f / 6.0f))));
+    }
+
+    // 煞車輪廓：a 以 -J 推到 -Ap，維持 t2，再以 +J 收回 0 時剛好降到 v_end
+    float q = J * w + 0.5f * a * a;
+    float ap, t2 = 0.0f;
+    if (q >= A * A) {
+        ap = A;
+        t2 = (q - A * A) / (J * A);
+    } else {
+        ap = std::sqrt(q);
+    }
+    float t1 = (a + ap) / J;
+    if (t1 < 0.0f) t1 = 0.0f;
+    float t3 = ap / J;
+
+    float d = t1 * (w + t1 * (0.5f * a - t1 * (J * (1.0f / 6.0f))));
+    float w1 = w + t1 * (a - 0.5f * J * t1);
+    d += t2 * (w1 - 0.5f * ap * t2);
+    float w2 = w1 - ap * t2;
+    d += t3 * (w2 + t3 * (-0.5f * ap + t3 * (J * (1.0f / 6.0f))));
+    float t = t1 + t2 + t3;
+    if (time) *time = t;
+    return d + v_end * t;
+}
+
+// 從靜止以 jerk J、加速度 A 走完距離 x 的時間 (不計速度上限)：停在角點時兩段各走 d 所需的時間
+static float timeFromRest(float x, float A, float J) {
+    float t1 = A / J;
+    float x1 = J * t1 * t1 * t1 * (1.0f / 6.0f);
+    if (x <= x1) return std::cbrt(6.0f * x / J);
+    // a 到達 A 之後以 A 等加速：x - x1 = v1 t + A t² / 2
+    float v1 = 0.5f * A * t1;
+    return t1 + (std::sqrt(v1 * v1 + 2.0f * A * (x - x1)) - v1) / A;
+}
+
+LookaheadPlanner::LookaheadPlanner(float junction_deviation, float jerk_time)
+    : _head(0), _count(0), _junction_deviation(0.0f), _jerk_time(jerk_time > 0.0f ? jerk_time : 0.05f) {
+    setJunctionDeviation(junction_deviation);
+    _curvature = {0.0f, 0.0f};
+    _tangent = {1.0f, 0.0f};
+    setStart({0.0f, 0.0f});
+}
+
+void LookaheadPlanner::setStart(Point2D p) {
+    if (_count > 0) return;
+    _tail = p;
+    _pos = p;
+    _in_blend = false;
+    _s = 0.0f;
+    _v = 0.0f;
+    _a = 0.0f;
+}
+
+void LookaheadPlanner::clear() {
+    _head = 0;
+    _count = 0;
+    _tail = _pos;
+    _in_blend = false;
+    _s = 0.0f;
+    _v = 0.0f;
+    _a = 0.0f;
+    _curvature = {0.0f, 0.0f};
+}
+
+// ==========================================================
+// 線段與圓化的幾何
+// ==========================================================
+
+float LookaheadPlanner::lineLength(uint32_t i) const {
+    const Block& b = block(i);
+    float len = b.length - b.trim_in - b.trim_out;
+    return (len > 0.0f) ? len : 0.0f;
+}
+
+float LookaheadPlanner::pieceLength() const {
+    return _in_blend ? block(0).blend_length : lineLength(0);
+}
+
+float LookaheadPlanner::pieceCap() const {
+    const Block& b = block(0);
+    return _in_blend ? b.v_junction : b.v_nominal;
+}
+
+void LookaheadPlanner::chainLimits(float* accel, float* jerk) const {
+    float A = block(0).accel, J = block(0).jerk;
+    for (uint32_t i = 1; i < _count; ++i) {
+        const Block& prev = block(i - 1);
+        if (prev.trim_out == 0.0f && prev.v_junction == 0.0f) break;  // 停在角點：之後的線段不影響目前的輪廓
+        if (block(i).accel < A) A = block(i).accel;
+        if (block(i).jerk < J) J = block(i).jerk;
+    }
+    *accel = A;
+    *jerk = J;
+}
+
+float LookaheadPlanner::peakSpeed() const {
+    float v = 0.0f;
+    for (uint32_t i = 0; i < _count; ++i)
+        if (block(i).v_nominal > v) v = block(i).v_nominal;
+    return v;
+}
+
+void LookaheadPlanner::joinBlocks(uint32_t i) {
+    shapeJunction(i);
+    Block& p = block(i);
+    if (p.v_junction == 0.0f) return;
+
+    // 不停下的轉角讓目前的輪廓延伸到新的線段 (圓化起點比原本的停止點近、加速度 / jerk 可能變小)：
+    // 目前狀態已來不及 (或加速度已超過新的上限) 時改為停在角點 (原本就保證停得下)
+    float A, J;
+    chainLimits(&A, &J);
+    if (std::fabs(_a) > A || overshoot(0.0f, _v, _a, pieceCap(), peakSpeed(), A, J) > 0.0f) {
+        p.trim_out = 0.0f;
+        p.blend_length = 0.0f;
+        p.v_junction = 0.0f;
+        block(i + 1).trim_in = 0.0f;
+    }
+}
+
+void LookaheadPlanner::shapeJunction(uint32_t i) {
+    Block& p = block(i);
+    Block& n = block(i + 1);
+    p.trim_out = 0.0f;
+    p.blend_length = 0.0f;
+    p.v_junction = 0.0f;
+    n.trim_in = 0.0f;
+
+    float c = p.dir.x * n.dir.x + p.dir.y * n.dir.y;  // cos φ
+    float v_limit = (p.v_nominal < n.v_nominal) ? p.v_nominal : n.v_nominal;
+    if (c > JUNCTION_COS_EPS) {
+        p.v_junction = v_limit;  // 直行
+        return;
+    }
+    if (!(_junction_deviation > 0.0f) || c < -JUNCTION_COS_EPS) return;  // 停在角點
+
+    // 中點距角點 d sin(φ/2) / 4 = δ；不超過兩段各一半，也不從目前已走過的地方開始
+    float sin_half = std::sqrt(0.5f * (1.0f - c));
+    float d = 4.0f * _junction_deviation / sin_half;
+    if (d > 0.5f * p.length) d = 0.5f * p.length;
+    if (d > 0.5f * n.length) d = 0.5f * n.length;
+    if (i == 0 && !_in_blend && d > p.length - p.trim_in - _s) d = p.length - p.trim_in - _s;
+    if (!(d >= MIN_BLEND_TRIM)) return;
+
+    // B'(t) = 3d (u² u1 + t² u2)，|B'|² = 9d² g；κ = (2/3) t u sinφ / (d g^1.5)
+    // dκ/ds = (2/9) sinφ / d² × ((u - t) / g² - 1.5 t u g' / g³)，g' = -4u³ + 4t³ + 4c t u (u - t)
+    // 等速通過時 jerk = v³ (N dκ/ds - T κ²)，大小 v³ sqrt((dκ/ds)² + κ⁴)
+    float sin_phi = 2.0f * sin_half * std::sqrt(0.5f * (1.0f + c));
+    float dkds_scale = (2.0f / 9.0f) * sin_phi / (d * d);
+    float kappa_max = 0.0f, jerk_max = 0.0f, len = 0.0f;
+    for (int k = 0; k <= BLEND_SAMPLES; ++k) {
+        float t = 0.5f * (float)k / (float)BLEND_SAMPLES;
+        float u = 1.0f - t;
+        float tu = t * u;
+        float g = u * u * u * u + t * t * t * t + 2.0f * c * tu * tu;
+        float gp = -4.0f * u * u * u + 4.0f * t * t * t + 4.0f * c * tu * (u - t);
+        float sg = std::sqrt(g);
+        float kappa = (2.0f / 3.0f) * tu * sin_phi / (d * g * sg);
+        float dkds = dkds_scale * ((u - t) / (g * g) - 1.5f * tu * gp / (g * g * g));
+        float k2 = kappa * kappa;
+        float jerk = dkds * dkds + k2 * k2;
+        if (kappa > kappa_max) kappa_max = kappa;
+        if (jerk > jerk_max) jerk_max = jerk;
+        float w = (k == 0 || k == BLEND_SAMPLES) ? 1.0f : ((k & 1) ? 4.0f : 2.0f);
+        len += w * 3.0f * d * sg;
+    }
+    len *= 2.0f * (0.5f / (float)BLEND_SAMPLES) / 3.0f;  // 兩半對稱
+
+    float A = (p.accel < n.accel) ? p.accel : n.accel;
+    float J = (p.jerk < n.jerk) ? p.jerk : n.jerk;
+    float v = v_limit;
+    float v_lateral = std::sqrt(A / kappa_max);
+    if (v_lateral < v) v = v_lateral;
+    float v_jerk = std::cbrt(J / std::sqrt(jerk_max));
+    if (v_jerk < v) v = v_jerk;
+
+    // 銳角的圓化速度很低：以 v 走完圓化比停在角點 (兩段各 d 減速到 0 再加速) 還慢時改為停下
+    if (len / v > 2.0f * timeFromRest(d, A, J)) return;
+
+    p.trim_out = d;
+    p.blend_length = len;
+    p.v_junction = v;
+    n.trim_in = d;
+}
+
+// ==========================================================
+// 加入線段
+// ==========================================================
+
+bool LookaheadPlanner::append(Point2D end, float v_max, float a_max) {
+    if (full() || !(v_max > 0.0f) || !(a_max > 0.0f)) return false;
+    float dx = end.x - _tail.x, dy = end.y - _tail.y;
+    float len = std::sqrt(dx * dx + dy * dy);
+    if (!(len > 0.0f)) return true;
+
+    Block& b = block(_count);
+    b.start = _tail;
+    b.dir = {dx / len, dy / len};
+    b.length = len;
+    b.v_nominal = v_max;
+    b.accel = a_max;
+    b.jerk = a_max / _jerk_time;
+    b.trim_in = 0.0f;
+    b.trim_out = 0.0f;
+    b.v_junction = 0.0f;
+    b.blend_length = 0.0f;
+    _tail = end;
+    _count++;
+    if (_count == 1) {
+        _in_blend = false;
+        _s = 0.0f;
+        _pos = b.start;
+        _tangent = b.dir;
+        _curvature = {0.0f, 0.0f};
+    } else {
+        joinBlocks(_count - 2);
+    }
+    return true;
+}
+
+// ==========================================================
+// 執行
+// ==========================================================
+
+float LookaheadPlanner::overshoot(float dp, float v, float a, float v_cap, float v_peak, float A, float J) const {
+    float t0;
+    float d0 = brakeDistance(v, a, 0.0f, A, J, &t0);
+    float horizon = d0 + v_peak * t0;
+    float worst = -d0 - 1.0f;  // 沒有上限點在範圍內
+    float dist = pieceLength() - _s - dp;
+    uint32_t i = 0;
+    bool blend = _in_blend;
+    while (dist <= horizon) {
+        if (blend) {
+            // 圓化結束接下一段直線：直線上限 >= 圓化上限，不是新的上限點
+            blend = false;
+            ++i;
+            dist += lineLength(i);
+            continue;
+        }
+        const Block& b = block(i);
+        // 不低於目前這一塊上限的點由加速候選本身保證 (一起檢查會在上限附近互相拉扯)
+        float cap = (i + 1 < _count) ? b.v_junction : 0.0f;
+        if (cap < v_cap && dist <= d0 + cap * t0) {
+            // 不必煞車 (本來就不會超過 cap) 的點沒有限制，即使這一步剛好越過它 (dist < 0)
+            float need = brakeDistance(v, a, cap, A, J, nullptr);
+            if (need > 0.0f && need - dist > worst) worst = need - dist;
+        }
+        if (cap == 0.0f) break;  // 停止點之後的上限點不會比它更嚴
+        if (b.trim_out > 0.0f) {
+            blend = true;
+            dist += b.blend_length;
+        } else {
+            ++i;
+            dist += lineLength(i);
+        }
+    }
+    return worst;
+}
+
+void LookaheadPlanner::pop() {
+    _head = (_head + 1) % CAPACITY;
+    _count--;
+}
+
+void LookaheadPlanner::beginBlend() {
+    Block& b = block(0);
+    const Block& n = block(1);
+    Point2D v = n.start;
+    float d = b.trim_out;
+    _blend.beginBezier({v.x - b.dir.x * d, v.y - b.dir.y * d}, v, v, {v.x + n.dir.x * d, v.y + n.dir.y * d});
+    b.blend_length = _blend.length();
+}
+
+bool LookaheadPlanner::step(float dt, CartesianState* out) {
+    if (_count > 0 && dt > 0.0f) {
+        const Block& b = block(0);
+        float A, J;
+        chainLimits(&A, &J);
+        const float V = pieceCap();
+        const float v_peak = peakSpeed();
+
+        // 停止點 (最後一段終點 / 不圓化的停止角點) 前：誤差小於一個 tick 的加加速度位移時直接對齊
+        bool stop_ahead = !_in_blend && (_count == 1 || (b.trim_out == 0.0f && b.v_junction == 0.0f));
+        float remaining = pieceLength() - _s;
+        if (stop_ahead && remaining <= J * dt * dt * dt + 1e-6f && std::fabs(_v) <= J * dt * dt &&
+            std::fabs(_a) <= J * dt) {
+            _s = pieceLength();
+            _v = _a = 0.0f;
+        } else {
+            // 本 tick 可用的 jerk 範圍 (保證 |a| <= A；換到加速度較小的線段時 |a| 以 J 降回 A，不跳變)
+            float j_min = clampf((-A - _a) / dt, -J, J);
+            float j_max = clampf((A - _a) / dt, -J, J);
+
+            // 1. 加速候選：a 沿 sqrt(2J |V - v|) 曲線，v 到達這一塊的上限 V 時 a 剛好回到 0
+            //    (與 V 差不到一個 tick 的 jerk 速度時直接收回 a，避免 sqrt 曲線在 V 附近來回切換)
+            float v_next = _v + _a * dt;
+            float a_goal = 0.0f;
+            if (std::fabs(V - v_next) > J * dt * dt)
+                a_goal = (v_next < V) ? std::sqrt(2.0f * J * (V - v_next)) : -std::sqrt(2.0f * J * (v_next - V));
+            a_goal = clampf(a_goal, -A, A);
+            float j = clampf((a_goal - _a) / dt, j_min, j_max);
+
+            // 2. 候選走一步後立刻最大煞車，前方的上限點是否來不及
+            auto over = [&](float jerk) {
+                Step st = integrate(_v, _a, jerk, dt);
+                return overshoot(st.dp, st.v, st.a, V, v_peak, A, J);
+            };
+
+            // 3. 來不及：在 [最大煞車, 候選] 之間找剛好來得及的 jerk (保留來得及的一側)
+            if (over(j) > 0.0f) {
+                float lo = j_min;
+                if (over(lo) < 0.0f) {
+                    float hi = j;
+                    for (int i = 0; i < BISECT_ITERATIONS; ++i) {
+                        float mid = 0.5f * (lo + hi);
+                        if (over(mid) > 0.0f) hi = mid;
+                        else lo = mid;
+                    }
+                }
+                j = lo;
+            }
+
+            Step st = integrate(_v, _a, j, dt);
+            _s += st.dp;
+            _v = st.v;
+            _a = st.a;
+            // 路徑不倒退：停止前最後一個 tick 煞過頭時停在原地；停止點不帶著速度 / 加速度越過 (下一段方向不同)
+            if (_v < 0.0f) {
+                _v = 0.0f;
+                _a = 0.0f;
+            }
+            if (stop_ahead && _s >= pieceLength()) {
+                _s = pieceLength();
+                _v = _a = 0.0f;
+            }
+        }
+
+        // 越過這一塊的終點：多走的距離帶進下一塊 (直線 -> 圓化 -> 下一段直線)
+        while (_count > 0) {
+            float len = pieceLength();
+            if (_s < len) break;
+            if (_in_blend) {
+                _s -= len;
+                _in_blend = false;
+                pop();
+            } else if (_count == 1) {
+                pop();
+                _s = 0.0f;
+                _v = _a = 0.0f;
+            } else if (block(0).trim_out > 0.0f) {
+                _s -= len;
+                _in_blend = true;
+                beginBlend();
+            } else {
+                _s -= len;
+                pop();
+            }
+        }
+
+        if (_count == 0) {
+            _pos = _tail;
+            _curvature = {0.0f, 0.0f};
+        } else if (_in_blend) {
+            PathPoint p = _blend.sample(_s);
+            _pos = p.pos;
+            _tangent = p.tangent;
+            _curvature = p.curvature;
+        } else {
+            const Block& c = block(0);
+            float s = c.trim_in + _s;
+            _pos = {c.start.x + c.dir.x * s, c.start.y + c.dir.y * s};
+            _tangent = c.dir;
+            _curvature = {0.0f, 0.0f};
+        }
+    }
+
+    float v2 = _v * _v;
+    out->pos = _pos;
+    out->vel = {_tangent.x * _v, _tangent.y * _v};
+    out->acc = {_tangent.x * _a + _curvature.x * v2, _tangent.y * _a + _curvature.y * v2};
+    return _count > 0;
+}
@@ -5,6 +5,7 @@
  */
 
 #include "nidec_motor_driver.h"
+#include "motor_params.h"
 #include <math.h>
 
 // ==========================================================
@@ -192,7 +193,7 @@ void Motor_Update(Motor_t *motor) {
         int64_t pulse_delta = motor->total_pulse_count - motor->prev_pulse_count;
         
         // STM32 Encoder Mode x4: 馬達轉一圈 = PPR * 4 脈衝
-        float pulses_per_motor_rev = motor->config.encoder_ppr * 4.0f;
+        float pulses_per_motor_rev = motor->config.encoder_ppr * ENCODER_COUNTS_PER_PULSE;
         
         // 馬達軸轉數 (未經過減速比)
         float motor_revs = (float)pulse_delta / (pulses_per_motor_rev * motor->config.gear_ratio);
@@ -214,7 +215,7 @@ float Motor_GetAngle(Motor_t *motor) {
 
     // STM32 Encoder Mode x4 模式 (上下數都計數)
     // 馬達轉一圈的 Pulse 數 = PPR * 4
-    float pulses_per_motor_rev = motor->config.encoder_ppr * 4.0f;
+    float pulses_per_motor_rev = motor->config.encoder_ppr * ENCODER_COUNTS_PER_PULSE;
 
     // 總輸出軸轉數 = 總 Pulse / (馬達每圈Pulse * 減速比)
     float output_revs = (float)motor->total_pulse_count / (pulses_per_motor_rev * motor->config.gear_ratio);
@@ -284,9 +285,9 @@ void Motor_System_Config(void) {
     motor_joint_13pin.config.dir_pin = GPIO_PIN_2;    // DIR
 
     // 參數
-    motor_joint_13pin.config.max_rpm = 6000;
-    motor_joint_13pin.config.encoder_ppr = 100.0f;  // Nidec 規格書值
-    motor_joint_13pin.config.gear_ratio = 50.0f;    // [請依實際減速比修改] 假設 50:1
+    motor_joint_13pin.config.max_rpm = JOINT1_MAX_RPM;
+    motor_joint_13pin.config.encoder_ppr = JOINT1_ENCODER_PPR;  // 數值見 motor_params.h
+    motor_joint_13pin.config.gear_ratio = JOINT1_GEAR_RATIO;
 
     Motor_Init(&motor_joint_13pin);
 
@@ -308,9 +309,9 @@ void Motor_System_Config(void) {
     motor_joint_8pin.config.dir_pin = GPIO_PIN_5;    // DIR
 
     // 參數
-    motor_joint_8pin.config.max_rpm = 6300;
-    motor_joint_8pin.config.encoder_ppr = 100.0f; // Nidec 規格書值
-    motor_joint_8pin.config.gear_ratio = 30.0f;   // [請依實際減速比修改] 假設 30:1
+    motor_joint_8pin.config.max_rpm = JOINT2_MAX_RPM;
+    motor_joint_8pin.config.encoder_ppr = JOINT2_ENCODER_PPR; // 數值見 motor_params.h
+    motor_joint_8pin.config.gear_ratio = JOINT2_GEAR_RATIO;
 
     Motor_Init(&motor_joint_8pin);
 }
@@ -0,0 +1,179 @@
+/**
+ * @file path_interpolator.cpp
+ * @brief 直線 / 圓弧 / 三次 Bézier 路徑的弧長取樣實作
+ */
+
+#include "path_interpolator.hpp"
+#include "kinematics_math.hpp"
+
+static inline float clampf(float x, float lo, float hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+// ==========================================================
+// 建立路徑
+// ==========================================================
+
+void PathInterpolator::beginLine(Point2D from, Point2D to) {
+    _type = PATH_LINE;
+    _p0 = from;
+    _end = to;
+    float dx = to.x - from.x, dy = to.y - from.y;
+    _length = std::sqrt(dx * dx + dy * dy);
+    if (_length > 0.0f) {
+        _dir.x = dx / _length;
+        _dir.y = dy / _length;
+    } else {
+        _dir.x = 1.0f;
+        _dir.y = 0.0f;
+    }
+}
+
+bool PathInterpolator::beginArc(Point2D from, Point2D center, float sweep_rad) {
+    float rx = from.x - center.x, ry = from.y - center.y;
+    float r = std::sqrt(rx * rx + ry * ry);
+    if (!(r > 0.0f)) return false;
+
+    _type = PATH_ARC;
+    _p0 = from;
+    _center = center;
+    _radius = r;
+    _phi0 = FastMath::atan2(ry, rx);
+    _turn = (sweep_rad >= 0.0f) ? 1.0f : -1.0f;
+    _length = r * std::fabs(sweep_rad);
+    float se, ce;
+    FastMath::sincos(_phi0 + sweep_rad, &se, &ce);
+    _end.x = center.x + r * ce;
+    _end.y = center.y + r * se;
+
+    _arc_s = 0.0f;
+    _arc_sin = ry / r;
+    _arc_cos = rx / r;
+    _arc_age = 0;
+    return true;
+}
+
+void PathInterpolator::beginBezier(Point2D p0, Point2D p1, Point2D p2, Point2D p3) {
+    _type = PATH_BEZIER;
+    _p0 = p0;
+    _end = p3;
+    // 轉成冪次基底
+    _c.x = 3.0f * (p1.x - p0.x);
+    _c.y = 3.0f * (p1.y - p0.y);
+    _b.x = 3.0f * (p2.x - 2.0f * p1.x + p0.x);
+    _b.y = 3.0f * (p2.y - 2.0f * p1.y + p0.y);
+    _a.x = p3.x - p0.x + 3.0f * (p1.x - p2.x);
+    _a.y = p3.y - p0.y + 3.0f * (p1.y - p2.y);
+
+    // 前向差分：d1 = f(t+h) - f(t) 為這一段的弦，d1 += d2，d2 += d3 (三次多項式的三階差分為常數)
+    const float h = 1.0f / (float)BEZIER_STEPS;
+    const float h2 = h * h, h3 = h2 * h;
+    float d1x = _a.x * h3 + _b.x * h2 + _c.x * h, d1y = _a.y * h3 + _b.y * h2 + _c.y * h;
+    float d2x = 6.0f * _a.x * h3 + 2.0f * _b.x * h2, d2y = 6.0f * _a.y * h3 + 2.0f * _b.y * h2;
+    const float d3x = 6.0f * _a.x * h3, d3y = 6.0f * _a.y * h3;
+
+    float s = 0.0f;
+    _s_table[0] = 0.0f;
+    for (uint32_t i = 1; i <= BEZIER_STEPS; ++i) {
+        s += std::sqrt(d1x * d1x + d1y * d1y);  // 這一段的弦長 = |f(t+h) - f(t)|
+        _s_table[i] = s;
+        d1x += d2x;
+        d1y += d2y;
+        d2x += d3x;
+        d2y += d3y;
+    }
+    _length = s;
+    _cursor = 0;
+
+    for (uint32_t i = 0; i <= BEZIER_STEPS; ++i) {
+        float t = (float)i * h;
+        float dx = _c.x + t * (2.0f * _b.x + 3.0f * t * _a.x);
+        float dy = _c.y + t * (2.0f * _b.y + 3.0f * t * _a.y);
+        float speed = std::sqrt(dx * dx + dy * dy);
+        _dtds_table[i] = (speed > 1e-6f) ? 1.0f / speed : 0.0f;
+    }
+}
+
+// ==========================================================
+// 取樣
+// ==========================================================
+
+PathPoint PathInterpolator::sample(float s) {
+    s = clampf(s, 0.0f, _length);
+    if (_type == PATH_ARC) return sampleArc(s);
+    if (_type == PATH_BEZIER) return sampleBezier(s);
+
+    PathPoint p;
+    p.pos.x = _p0.x + _dir.x * s;
+    p.pos.y = _p0.y + _dir.y * s;
+    p.tangent = _dir;
+    p.curvature = {0.0f, 0.0f};
+    return p;
+}
+
+PathPoint PathInterpolator::sampleArc(float s) {
+    // (sin φ, cos φ) 由上一次的值旋轉 Δφ；跳動過大或累積太多次時重新精確計算
+    float d = _turn * (s - _arc_s) / _radius;
+    if (++_arc_age >= TRIG_RESYNC_PERIOD || std::fabs(d) > SMALL_ANGLE) {
+        FastMath::sincos(_phi0 + _turn * s / _radius, &_arc_sin, &_arc_cos);
+        _arc_age = 0;
+    } else {
+        float d2 = d * d;
+        float sd = d * (1.0f - d2 * (1.0f / 6.0f));
+        float cd = 1.0f - 0.5f * d2;
+        float s0 = _arc_sin;
+        _arc_sin = s0 * cd + _arc_cos * sd;
+        _arc_cos = _arc_cos * cd - s0 * sd;
+    }
+    _arc_s = s;
+
+    PathPoint p;
+    p.pos.x = _center.x + _radius * _arc_cos;
+    p.pos.y = _center.y + _radius * _arc_sin;
+    p.tangent.x = -_turn * _arc_sin;
+    p.tangent.y = _turn * _arc_cos;
+    float k = 1.0f / _radius;
+    p.curvature.x = -k * _arc_cos;
+    p.curvature.y = -k * _arc_sin;
+    return p;
+}
+
+PathPoint PathInterpolator::sampleBezier(float s) {
+    // 單調游標：s 遞增時通常不動或只前進一格
+    while (_cursor + 1 < BEZIER_STEPS && _s_table[_cursor + 1] < s) ++_cursor;
+    while (_cursor > 0 && _s_table[_cursor] > s) --_cursor;
+    float seg = _s_table[_cursor + 1] - _s_table[_cursor];
+    float u = (seg > 0.0f) ? clampf((s - _s_table[_cursor]) / seg, 0.0f, 1.0f) : 0.0f;
+    // 區間內 t 的位置 f(u)：f(0) = 0、f(1) = 1，端點斜率 = dt/ds × 區間弦長 × BEZIER_STEPS
+    // 斜率夾在 [0, 3] 內保證 f 單調 (B' = 0 的節點斜率為 0 也仍然單調)
+    float k = seg * (float)BEZIER_STEPS;
+    float m0 = clampf(_dtds_table[_cursor] * k, 0.0f, 3.0f);
+    float m1 = clampf(_dtds_table[_cursor + 1] * k, 0.0f, 3.0f);
+    float u2 = u * u, u3 = u2 * u;
+    float f = (3.0f * u2 - 2.0f * u3) + m0 * (u3 - 2.0f * u2 + u) + m1 * (u3 - u2);
+    float t = ((float)_cursor + f) * (1.0f / (float)BEZIER_STEPS);
+
+    PathPoint p;
+    p.pos.x = _p0.x + t * (_c.x + t * (_b.x + t * _a.x));
+    p.pos.y = _p0.y + t * (_c.y + t * (_b.y + t * _a.y));
+    float dx = _c.x + t * (2.0f * _b.x + 3.0f * t * _a.x);  // B'(t)
+    float dy = _c.y + t * (2.0f * _b.y + 3.0f * t * _a.y);
+    float ddx = 2.0f * _b.x + 6.0f * t * _a.x;              // B''(t)
+    float ddy = 2.0f * _b.y + 6.0f * t * _a.y;
+
+    float speed2 = dx * dx + dy * dy;
+    if (speed2 < 1e-12f) {
+        // 控制點與端點重合 (B' = 0)：切線方向取 B''，曲率視為 0
+        float n = std::sqrt(ddx * ddx + ddy * ddy);
+        p.tangent = (n > 0.0f) ? Point2D{ddx / n, ddy / n} : Point2D{1.0f, 0.0f};
+        p.curvature = {0.0f, 0.0f};
+        return p;
+    }
+    // T = B' / |B'|，K = (B'' - T (T·B'')) / |B'|²
+    float inv_speed = 1.0f / std::sqrt(speed2);
+    p.tangent.x = dx * inv_speed;
+    p.tangent.y = dy * inv_speed;
+    float along = p.tangent.x * ddx + p.tangent.y * ddy;
+    float inv_speed2 = inv_speed * inv_speed;
+    p.curvature.x = (ddx - p.tangent.x * along) * inv_speed2;
+    p.curvature.y = (ddy - p.tangent.y * along) * inv_speed2;
+    return p;
+}
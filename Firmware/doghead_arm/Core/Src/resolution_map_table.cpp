@@ -0,0 +1,70 @@
+/**
+ * @file resolution_map_table.cpp
+ * @brief [自動產生] 書寫區編碼器量化解析度地圖，請勿手動修改
+ * @details 產生器: Tools/resolution_map_gen --cell 5.000 --samples 4
+ *   幾何 L1=100.000 L2=150.000 D=60.000 mm，書寫區 X[-60.0, 120.0] Y[100.0, 200.0] mm
+ *   編碼器 關節1 100 PPR x4 x 50.0:1 (3.142e-04 rad/count)，關節2 100 PPR x4 x 30.0:1 (5.236e-04 rad/count)
+ *   36 x 20 格 (2880 bytes)，不確定度 0.0396 ~ 0.0743 mm
+ */
+
+#include "resolution_map.hpp"
+#include "arm_geometry.hpp"
+
+// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)
+static_assert(dogArmGeometryMatches(100.0f, 150.0f, 60.0f),
+              "resolution_map_table.cpp was generated for another geometry: rerun Tools/resolution_map_gen");
+
+static const uint16_t RESOLUTION_MAP_RESOLUTION[720] = {
+    515, 511, 508, 504, 499, 495, 490, 485, 480, 474, 469, 463, 457, 452, 446, 440, 434, 428, 423, 417, 412, 408, 404, 400, 398, 396, 395, 395, 396, 399, 401, 405, 409, 414, 419, 425,
+    518, 515, 512, 509, 505, 501, 497, 492, 488, 483, 478, 473, 468, 462, 457, 452, 447, 441, 436, 432, 427, 423, 420, 416, 414, 412, 411, 411, 412, 414, 416, 420, 423, 428, 432, 438,
+    520, 518, 516, 513, 510, 506, 503, 499, 495, 490, 486, 482, 477, 472, 467, 463, 458, 453, 449, 445, 441, 437, 434, 431, 429, 427, 426, 426, 427, 428, 430, 433, 436, 440, 445, 450,
+    522, 520, 519, 516, 514, 511, 508, 504, 501, 497, 493, 489, 485, 481, 477, 472, 468, 464, 460, 456, 453, 449, 447, 444, 442, 440, 439, 439, 440, 441, 443, 446, 449, 452, 456, 461,
+    523, 522, 521, 519, 517, 515, 512, 509, 506, 503, 500, 496, 492, 489, 485, 481, 477, 474, 470, 467, 464, 461, 458, 456, 454, 453, 452, 451, 452, 453, 455, 457, 460, 463, 467, 471,
+    524, 524, 523, 521, 520, 518, 516, 513, 511, 508, 505, 502, 499, 496, 492, 489, 486, 482, 479, 476, 473, 471, 469, 467, 465, 464, 463, 463, 463, 464, 466, 468, 470, 473, 477, 481,
+    524, 524, 524, 523, 522, 520, 519, 517, 515, 512, 510, 507, 505, 502, 499, 496, 493, 490, 487, 485, 482, 480, 478, 476, 475, 474, 473, 473, 473, 475, 476, 478, 480, 483, 486, 490,
+    524, 524, 524, 524, 523, 522, 521, 520, 518, 516, 514, 512, 509, 507, 505, 502, 500, 497, 495, 492, 490, 488, 486, 485, 484, 483, 482, 482, 483, 484, 485, 487, 489, 492, 495, 498,
+    524, 524, 524, 524, 524, 524, 523, 522, 520, 519, 517, 515, 514, 512, 509, 507, 505, 503, 501, 499, 497, 496, 494, 493, 492, 491, 491, 491, 491, 492, 494, 495, 498, 500, 503, 506,
+    523, 524, 524, 524, 524, 524, 524, 523, 522, 521, 520, 519, 517, 515, 514, 512, 510, 508, 507, 505, 503, 502, 501, 500, 499, 498, 498, 498, 499, 500, 501, 503, 505, 508, 511, 514,
+    522, 523, 524, 524, 524, 524, 524, 524, 524, 523, 522, 521, 520, 519, 517, 516, 514, 513, 512, 510, 509, 508, 507, 506, 505, 505, 505, 505, 506, 507, 509, 510, 512, 515, 518, 521,
+    520, 522, 523, 524, 524, 524, 524, 524, 524, 524, 523, 523, 522, 521, 520, 519, 518, 517, 516, 515, 514, 513, 512, 511, 511, 511, 511, 512, 513, 514, 515, 517, 519, 521, 524, 528,
+    517, 519, 521, 522, 523, 524, 524, 524, 524, 524, 524, 524, 523, 523, 522, 522, 521, 520, 519, 518, 518, 517, 517, 516, 516, 516, 517, 517, 518, 520, 521, 523, 525, 528, 531, 534,
+    513, 516, 518, 520, 522, 523, 524, 524, 524, 524, 524, 524, 524, 524, 524, 523, 523, 522, 522, 522, 521, 521, 521, 520, 521, 521, 522, 522, 523, 525, 526, 528, 531, 533, 536, 540,
+    508, 512, 515, 517, 519, 521, 522, 523, 524, 524, 524, 524, 525, 525, 525, 525, 524, 524, 524, 524, 524, 524, 524, 524, 525, 525, 526, 527, 528, 530, 531, 533, 536, 539, 542, 546,
+    502, 507, 510, 514, 516, 518, 520, 521, 523, 523, 524, 524, 525, 525, 525, 525, 525, 526, 526, 526, 526, 526, 527, 527, 528, 529, 530, 531, 532, 534, 536, 538, 541, 544, 547, 551,
+    494, 500, 505, 509, 512, 515, 517, 519, 521, 522, 523, 524, 524, 525, 525, 525, 526, 526, 527, 527, 528, 528, 529, 530, 531, 532, 533, 534, 536, 538, 540, 542, 545, 549, 552, 557,
+    485, 492, 497, 502, 506, 510, 513, 515, 518, 519, 521, 522, 523, 524, 525, 525, 526, 527, 527, 528, 529, 530, 531, 532, 533, 534, 535, 537, 539, 541, 543, 546, 550, 553, 557, 562,
+    473, 482, 489, 494, 500, 504, 508, 511, 514, 516, 518, 520, 521, 523, 524, 525, 526, 526, 527, 528, 529, 530, 531, 533, 534, 536, 537, 539, 542, 544, 547, 550, 554, 558, 563, 569,
+    458, 469, 477, 485, 491, 496, 501, 505, 508, 511, 514, 516, 518, 520, 522, 523, 525, 526, 527, 528, 529, 530, 532, 533, 535, 537, 539, 541, 544, 547, 550, 554, 558, 563, 569, 576,
+};
+
+static const uint16_t RESOLUTION_MAP_UNCERTAINTY[720] = {
+    541, 530, 520, 509, 499, 495, 490, 485, 480, 474, 469, 463, 457, 452, 446, 440, 434, 428, 423, 417, 412, 408, 404, 400, 398, 396, 399, 405, 413, 421, 431, 441, 452, 464, 476, 489,
+    550, 540, 530, 520, 510, 501, 497, 492, 488, 483, 478, 473, 468, 462, 457, 452, 447, 441, 436, 432, 427, 423, 420, 416, 414, 412, 418, 424, 431, 440, 448, 458, 469, 480, 491, 504,
+    560, 550, 540, 531, 522, 512, 504, 499, 495, 490, 486, 482, 477, 472, 467, 463, 458, 453, 449, 445, 441, 437, 434, 431, 429, 432, 437, 443, 450, 457, 466, 475, 485, 496, 507, 519,
+    569, 560, 551, 542, 533, 524, 516, 508, 501, 497, 493, 489, 485, 481, 477, 472, 468, 464, 460, 456, 453, 449, 447, 444, 446, 450, 455, 461, 468, 475, 483, 492, 502, 512, 523, 534,
+    579, 570, 561, 553, 544, 536, 528, 521, 513, 506, 500, 496, 492, 489, 485, 481, 477, 474, 470, 467, 464, 461, 460, 462, 465, 469, 474, 479, 486, 493, 501, 509, 518, 528, 538, 549,
+    589, 580, 572, 564, 556, 548, 541, 533, 526, 520, 513, 507, 502, 496, 492, 489, 486, 482, 479, 477, 476, 477, 478, 480, 483, 487, 492, 497, 503, 510, 518, 526, 535, 544, 554, 565,
+    598, 591, 583, 575, 568, 560, 553, 546, 540, 533, 527, 522, 517, 512, 507, 504, 500, 498, 496, 494, 494, 494, 496, 498, 501, 505, 509, 515, 521, 527, 534, 542, 551, 560, 569, 580,
+    608, 601, 593, 586, 579, 572, 565, 559, 553, 547, 541, 536, 531, 527, 523, 520, 517, 514, 513, 511, 511, 512, 514, 516, 519, 522, 527, 532, 538, 544, 551, 559, 567, 575, 585, 594,
+    618, 611, 604, 597, 591, 584, 578, 572, 566, 560, 555, 550, 546, 542, 538, 535, 533, 531, 529, 528, 528, 529, 531, 533, 536, 540, 544, 549, 554, 560, 567, 575, 582, 591, 600, 609,
+    627, 621, 614, 608, 602, 596, 590, 584, 579, 574, 569, 564, 560, 557, 553, 551, 548, 546, 545, 544, 545, 546, 548, 550, 553, 556, 560, 565, 571, 577, 583, 590, 598, 606, 615, 624,
+    636, 630, 625, 619, 613, 607, 602, 597, 592, 587, 582, 578, 575, 571, 568, 566, 564, 562, 561, 561, 561, 562, 564, 566, 569, 573, 577, 581, 587, 593, 599, 606, 613, 621, 629, 638,
+    645, 640, 634, 629, 624, 619, 614, 609, 604, 600, 596, 592, 589, 585, 583, 581, 579, 577, 577, 576, 577, 578, 580, 582, 585, 589, 593, 597, 602, 608, 614, 621, 628, 636, 644, 652,
+    653, 649, 644, 639, 634, 630, 625, 621, 616, 612, 609, 605, 602, 599, 597, 595, 593, 592, 592, 592, 593, 594, 596, 598, 601, 604, 608, 613, 618, 623, 629, 636, 642, 650, 658, 666,
+    661, 657, 653, 648, 644, 640, 636, 632, 628, 625, 621, 618, 615, 613, 611, 609, 608, 607, 606, 607, 608, 609, 611, 613, 616, 620, 623, 628, 633, 638, 644, 650, 657, 664, 671, 679,
+    668, 664, 661, 657, 654, 650, 646, 643, 640, 636, 633, 631, 628, 626, 624, 623, 622, 621, 621, 621, 622, 624, 626, 628, 631, 634, 638, 642, 647, 652, 658, 664, 670, 677, 684, 692,
+    673, 671, 668, 665, 662, 659, 656, 653, 650, 648, 645, 643, 640, 639, 637, 636, 635, 635, 635, 635, 636, 638, 640, 642, 645, 648, 652, 656, 661, 666, 671, 677, 683, 690, 697, 704,
+    677, 676, 674, 672, 670, 668, 665, 663, 660, 658, 656, 654, 652, 651, 649, 648, 648, 648, 648, 649, 650, 652, 654, 656, 659, 662, 666, 670, 674, 679, 684, 690, 696, 702, 708, 715,
+    680, 680, 679, 678, 677, 675, 673, 671, 670, 668, 666, 664, 663, 662, 661, 660, 660, 660, 661, 662, 663, 665, 667, 669, 672, 675, 679, 682, 687, 691, 696, 702, 707, 713, 719, 726,
+    681, 682, 682, 682, 682, 681, 680, 679, 678, 676, 675, 674, 673, 672, 672, 671, 671, 672, 672, 674, 675, 677, 679, 681, 684, 687, 691, 694, 698, 703, 708, 713, 718, 724, 729, 735,
+    681, 682, 683, 684, 685, 685, 685, 685, 684, 684, 683, 682, 682, 681, 681, 681, 682, 682, 683, 685, 686, 688, 690, 692, 695, 698, 701, 705, 709, 713, 718, 723, 727, 733, 738, 743,
+};
+
+const ResolutionMapTable RESOLUTION_MAP_DOGARM = {
+    -60.0f, 100.0f,   // x_min, y_min
+    5.0f, 0.200000003f,   // cell, inv_cell
+    36, 20,   // nx, ny
+    9.99999975e-05f,   // unit_mm
+    RESOLUTION_MAP_RESOLUTION,
+    RESOLUTION_MAP_UNCERTAINTY,
+};
@@ -6,80 +6,79 @@
 #include "mainpp.h"
 #include "pid_controller.hpp"
 #include "nidec_motor_driver.h"
-#include "kinematics.hpp"
-#include <queue>
+#include "motor_params.h"
+#include "arm_geometry.hpp"
+#include "ik_lookup_grid.hpp"
+#include "workspace_map.hpp"
+#include "resolution_map.hpp"
+#include "incremental_ik.hpp"
+#include "ik_cache.hpp"
+#include "branch_tracker.hpp"
+#include "collision_checker.hpp"
+#include "spsc_ring_buffer.hpp"
+#include "scurve_generator.hpp"
+#include "kinematic_feedforward.hpp"
+#include "cartesian_motion.hpp"
+#include "lookahead_planner.hpp"
+#include "pvt_interpolator.hpp"
+#include "stroke_table.hpp"
+#include "trajectory_codec.hpp"
+#include "feedrate_override.hpp"
 #include <cmath>
+#include <atomic>
 
 // ==========================================================
-// 機構參數設定 (請依照實際硬體測量修改！)
-// 單位: mm
+// 機構參數設定：見 arm_geometry.hpp (DogArmSpec)
 // ==========================================================
-// 假設五連桿參數
-#define LINK_L1  100.0f  // 主動臂 (連接馬達)
-#define LINK_L2  150.0f  // 從動臂 (連接末端)
-#define MOTOR_DIST_D 60.0f // 兩馬達間距
 
 // 建立運動學解算器實體
-FiveBarKinematics kinematics(LINK_L1, LINK_L2, MOTOR_DIST_D);
+// 控制迴圈使用多項式近似版 (FastMath)，誤差小於編碼器 1 count，見 kinematics_math.hpp
+// 幾何常數 (L1^2、1/(2*L1)、可達範圍...) 皆在編譯期折疊
+DogArmKinematics kinematics;
+
+// 書寫區 IK 查表 (可選)：網格內以雙線性內插取代解析解，網格外自動退回解析解
+IkLookupGrid ik_grid(IK_GRID_DOGARM);
+
+// 工作空間地圖：目標點在設定時就以 O(1) 查表檢查可達性，不必等 IK 解不出來
+WorkspaceMap workspace_map(WORKSPACE_MAP_DOGARM);
+
+// 編碼器量化解析度地圖：書寫區各處的最壞位置不確定度，供作業規劃挑選書寫位置
+ResolutionMap resolution_map(RESOLUTION_MAP_DOGARM);
+
+// 熱啟動增量 IK：以上一個 tick 的解做牛頓修正 (收斂到 FK 精度，約 5e-6 rad)，
+// 目標跳動 > 1mm 或殘差過大時自動退回封閉解
+IncrementalIk<DogArmKinematics> ik_incremental(kinematics);
+
+// IK 記憶快取 (可選)：重複描寫的筆畫目標直接查表，0.05mm 量化鍵，命中誤差 <= 1e-4 rad (256 格，8KB RAM)
+IkCache<DogArmKinematics, 256> ik_cache(kinematics);
+
+// 分支追蹤：由實測關節角決定組裝模式 (FK 交點) 與各臂手肘方向 (IK mode)，
+// 取代 solveFK 的 Y < 0 猜測與固定的 mode 1，並把 IK 解平移到多圈馬達角附近
+BranchTracker<DogArmKinematics> branch_tracker(kinematics);
+std::atomic<uint32_t> branch_events(0);  // ControlTask 每個 tick 併入 branch_tracker 的事件，Robot_TakeBranchEvents 以 exchange 取走
+
+// 碰撞檢查：連桿 / 馬達 / 壓紙條的膠囊體模型 (arm_geometry.hpp 的 DogArmCollisionSpec)
+CollisionChecker collision_checker(CollisionChecker::fromSpec<DogArmCollisionSpec>(DogArmGeometry::value));
+
+// 運動學前饋：路徑產生器給出末端速度 / 加速度時，以 J^-1 直接換算關節前饋
+KinematicFeedforward<DogArmKinematics> kinematic_ff(kinematics, ik_incremental);
 
 // ==========================================================
-// 軌跡規劃器 (Trajectory Planner) - 產生速度與加速度前饋
+// 軌跡規劃器 (Trajectory Planner) - 加加速度限制的 S 曲線 (scurve_generator.hpp)
 // ==========================================================
-class TrajectoryPlanner {
-public:
-    TrajectoryPlanner() : _prev_target(0.0f), _prev_velocity(0.0f), _velocity(0.0f), _acceleration(0.0f) {}
-
-    /**
-     * @brief 計算平滑的速度和加速度 (使用一階濾波)
-     * @param current_target 當前目標位置 (Degree)
-     * @param dt 時間間隔 (s)
-     * @param max_velocity 最大速度限制 (Deg/s)
-     * @param max_acceleration 最大加速度限制 (Deg/s²)
-     */
-    void update(float current_target, float dt, float max_velocity = 360.0f, float max_acceleration = 1800.0f) {
-        // 計算原始速度 (位置差分)
-        float raw_velocity = (current_target - _prev_target) / dt;
-        
-        // 速度限幅
-        if (raw_velocity > max_velocity) raw_velocity = max_velocity;
-        else if (raw_velocity < -max_velocity) raw_velocity = -max_velocity;
-        
-        // 一階低通濾波 (平滑速度，避免抖動)
-        const float alpha = 0.7f; // 濾波系數 (0~1, 越小越平滑)
-        _velocity = alpha * raw_velocity + (1.0f - alpha) * _prev_velocity;
-        
-        // 計算加速度 (速度差分)
-        _acceleration = (_velocity - _prev_velocity) / dt;
-        
-        // 加速度限幅
-        if (_acceleration > max_acceleration) _acceleration = max_acceleration;
-        else if (_acceleration < -max_acceleration) _acceleration = -max_acceleration;
-        
-        // 更新記錄
-        _prev_target = current_target;
-        _prev_velocity = _velocity;
-    }
+const float JOINT_MAX_JERK_TIME = 0.05f;       // s (由 0 加到最大加速度的時間，決定 J = A / 0.05)
 
-    float getVelocity() const { return _velocity; }
-    float getAcceleration() const { return _acceleration; }
-    
-    void reset() {
-        _prev_target = 0.0f;
-        _prev_velocity = 0.0f;
-        _velocity = 0.0f;
-        _acceleration = 0.0f;
-    }
-
-private:
-    float _prev_target;
-    float _prev_velocity;
-    float _velocity;
-    float _acceleration;
-};
+// 為每個關節建立軌跡產生器：輸出彼此一致的位置 / 速度 / 加速度給 PositionController
+// (速度 / 加速度上限見 motor_params.h，Host 時間最佳化使用同一組數值)
+static_assert(JOINT1_MAX_VELOCITY <= JOINT1_MAX_RPM / JOINT1_GEAR_RATIO * 6.0f, "JOINT1_MAX_VELOCITY exceeds the motor");
+static_assert(JOINT2_MAX_VELOCITY <= JOINT2_MAX_RPM / JOINT2_GEAR_RATIO * 6.0f, "JOINT2_MAX_VELOCITY exceeds the motor");
+SCurveGenerator traj_joint1(JOINT1_MAX_VELOCITY, JOINT1_MAX_ACCEL, JOINT1_MAX_ACCEL / JOINT_MAX_JERK_TIME);
+SCurveGenerator traj_joint2(JOINT2_MAX_VELOCITY, JOINT2_MAX_ACCEL, JOINT2_MAX_ACCEL / JOINT_MAX_JERK_TIME);
+bool traj_synced = false;  // false：下一個 tick 先把產生器對齊到實測角度 (開機、測試模式、停機之後)
 
-// 為每個關節建立軌跡規劃器
-TrajectoryPlanner traj_joint1;
-TrajectoryPlanner traj_joint2;
+// 進給率覆寫：路徑移動 / 線段佇列 / PVT / 筆畫表的時間軸以 s 倍速前進 (點對點移動不受影響)
+FeedrateOverride feedrate;
+volatile float feedrate_request = 1.0f;  // CommTask 設定的目標縮放，ControlTask 以 jerk 限制的斜坡過渡
 
 // ==========================================================
 // PID 控制器與變數 (含前饋參數)
@@ -87,28 +86,123 @@ TrajectoryPlanner traj_joint2;
 // 參數說明: (Kp, Ki, Kd, Kv_速度前饋, Ka_加速度前饋, max_rpm)
 // Kv: 對於速度控制馬達，通常設為 1.0 (直接對應速度指令)
 // Ka: 加速度補償係數，用於補償慣量，建議從 0.05~0.2 開始調整
+// (數值在 motor_params.h，Host 的控制模擬使用同一組)
 
 // 關節 1 (13-Pin 馬達 - 24H702U030)
-PositionController joint1_pid(5.0f, 0.1f, 0.0f, 1.0f, 0.1f, 3000.0f);
+PositionController joint1_pid(JOINT1_PID_KP, JOINT1_PID_KI, JOINT1_PID_KD, JOINT1_PID_KV, JOINT1_PID_KA, JOINT1_PID_MAX_RPM);
 
 // 關節 2 (8-Pin 馬達 - 24H220Q231)
-PositionController joint2_pid(8.0f, 0.2f, 0.0f, 1.0f, 0.15f, 4000.0f);
+PositionController joint2_pid(JOINT2_PID_KP, JOINT2_PID_KI, JOINT2_PID_KD, JOINT2_PID_KV, JOINT2_PID_KA, JOINT2_PID_MAX_RPM);
 
 // 測試目標 (座標模式)
 float target_x = 0.0f;
 float target_y = 150.0f; // 預設停在前方
 bool ik_mode_enabled = false;
+bool ik_grid_enabled = false;  // true: 優先使用查表 IK
+bool ik_cache_enabled = false; // true: 增量 IK 前先查 IK 記憶快取
+bool collision_check_enabled = true; // true: 每個 tick 檢查實測構型，並拒絕會碰撞的目標
+uint32_t collision_flags = 0;        // 最近一次實測構型的 CollisionFlag
+
+// 笛卡兒狀態模式 (Robot_SetTargetState)：前饋來自運動學，不經 S 曲線產生器
+CartesianState target_state = {{0.0f, 150.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}};
+bool cartesian_ff_enabled = false;
+
+// 笛卡兒路徑插補 (Robot_MoveLinear / MoveArc / MoveBezier)：逐 tick 產生 target_state，並以實測 FK 量測路徑偏差
+CartesianMotion path_motion;
+PathInterpolator pending_path;                  // intakeSegments 檢查線段可達性用 (只在 ControlTask)
+StraightnessMeter straightness;
+bool straightness_measuring = false;
+float straightness_settle_left = 0.0f;          // 插補結束後繼續量測的剩餘時間 (s)
+const float STRAIGHTNESS_SETTLE_TIME = 0.1f;    // 包含停止後的殘餘振動
+Point2D measured_pos = {0.0f, 150.0f};          // 最近一次實測末端位置 (FK)
+
+// 目標要求：目標 API 在呼叫端 (CommTask) 檢查可達性 / 碰撞，通過後放進 move_requests，
+// ControlTask 在下一個 tick 開頭依序套用；path_motion、target_state、straightness 與模式旗標只由 ControlTask 寫入
+enum MoveRequestType : uint8_t {
+    MOVE_POSITION = 0,  // Robot_SetTargetPosition：state.pos
+    MOVE_STATE = 1,     // Robot_SetTargetState：state
+    MOVE_PATH = 2,      // Robot_MoveLinear / MoveArc / MoveBezier：path, v, a
+};
+struct MoveRequest {
+    MoveRequestType type;
+    CartesianState state;
+    PathInterpolator path;
+    float v, a;
+};
+SpscRingBuffer<MoveRequest, 2> move_requests;   // 在緩衝區內就地填寫 (reserve / commit)，不在 CommTask 的 stack 上複製
+
+// 目標 API 在呼叫端需要的 ControlTask 狀態 (路徑起點、實測的手肘方向)：ControlTask 每個 tick 發佈一份快照。
+// seqlock：寫入期間序號為奇數，讀取端讀到奇數或前後序號不同就重讀；ControlTask 優先權較高，
+// 寫入不會被讀取端擋住，讀取端只在被 tick 打斷時重讀
+struct ControlSnapshot {
+    Point2D start;      // pathStartPoint()
+    int solution_mode;  // branch_tracker.solutionMode()
+};
+std::atomic<uint32_t> snapshot_seq(0);
+std::atomic<float> snapshot_start_x(0.0f);
+std::atomic<float> snapshot_start_y(150.0f);
+std::atomic<int> snapshot_solution_mode(1);
+
+// 發佈快照 (ControlTask)
+static void publishSnapshot(Point2D start, int solution_mode) {
+    uint32_t seq = snapshot_seq.load(std::memory_order_relaxed);
+    snapshot_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    snapshot_start_x.store(start.x, std::memory_order_relaxed);
+    snapshot_start_y.store(start.y, std::memory_order_relaxed);
+    snapshot_solution_mode.store(solution_mode, std::memory_order_relaxed);
+    snapshot_seq.store(seq + 2, std::memory_order_release);
+}
+
+// 讀取最近一個 tick 的快照 (目標 API 的呼叫端)
+static ControlSnapshot readSnapshot() {
+    ControlSnapshot snap;
+    for (;;) {
+        uint32_t seq = snapshot_seq.load(std::memory_order_acquire);
+        snap.start.x = snapshot_start_x.load(std::memory_order_relaxed);
+        snap.start.y = snapshot_start_y.load(std::memory_order_relaxed);
+        snap.solution_mode = snapshot_solution_mode.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (!(seq & 1u) && snapshot_seq.load(std::memory_order_relaxed) == seq) return snap;
+    }
+}
+
+// 奇異構型減速：singularityDistance 低於此值時，依比例降低關節速度上限
+// (書寫區內最小約 0.66，正常書寫不受影響)
+const float SINGULARITY_SLOWDOWN_BAND = 0.3f;
+const float SINGULARITY_MIN_SPEED_SCALE = 0.1f;
 
 // 測試模式變數
 bool test_mode = false;
 int32_t test_rpm_motor1 = 0;  // 測試模式下馬達1的目標轉速
 int32_t test_rpm_motor2 = 0;  // 測試模式下馬達2的目標轉速
 
-// PVT 緩衝區 (未來使用，目前先留著結構)
-struct TrajectoryPoint {
-    float theta1, theta2, z, duration;
-};
-std::queue<TrajectoryPoint> traj_buffer;
+// PVT 緩衝區：CommTask 寫入、ControlTask 取出 (SPSC 無鎖，128 點 = 3KB 靜態 RAM)
+SpscRingBuffer<TrajectoryPoint, 128> traj_buffer;
+TrajectoryDecoder traj_decoder;                 // 壓縮串流解碼 (在 CommTask 執行，直接寫進 traj_buffer)
+
+// PVT 執行 (關節空間)：軌跡點間以三次 Hermite 插補，結束或斷流後以 S 曲線停在 joint_hold
+PvtInterpolator pvt;
+bool pvt_mode_enabled = false;
+
+// 筆畫表播放 (關節空間)：先以 S 曲線移到表格起點 (joint_hold)，到達後逐 tick 播放 Flash 中的關節角 (不做 IK)
+StrokeTablePlayer table_player;
+std::atomic<const StrokeTable*> playback_request(nullptr);  // CommTask 要求播放的表格，ControlTask 以 exchange 接手
+uint32_t playback_index = 0;
+bool playback_mode_enabled = false;
+bool playback_approaching = false;              // true：正在移向表格起點
+
+float joint_hold1 = 0.0f;                       // 關節空間模式的停止目標 (Deg)
+float joint_hold2 = 0.0f;
+volatile bool joint_stream_abort = false;       // 要求 ControlTask 中止 PVT 軌跡與筆畫表播放 (清空軌跡點)
+
+// 筆畫線段：CommTask 寫入 segment_buffer，ControlTask 檢查可達性後併入前瞻規劃器 (CAPACITY 段)
+SpscRingBuffer<StrokeSegment, 64> segment_buffer;
+LookaheadPlanner lookahead(0.05f);              // 轉角容許偏差 0.05mm
+volatile float junction_deviation_request = 0.05f;  // CommTask 設定的轉角容許偏差，ControlTask 在併入線段前套用
+const uint32_t SEGMENT_INTAKE_PER_TICK = 4;     // 每個 tick 最多併入的線段數 (限制檢查成本)
+volatile bool segment_queue_abort = false;      // 其他 API 改變目標時要求 ControlTask 清空線段
+std::atomic<uint32_t> rejected_segments(0);     // 不可書寫 / 碰撞而被丟棄的線段數 (ControlTask 累加，CommTask exchange 取走)
 
 
 // ==========================================================
@@ -122,34 +216,330 @@ extern "C" void Robot_Init(void) {
     joint1_pid.reset();
     joint2_pid.reset();
     
-    // 重置軌跡規劃器
-    traj_joint1.reset();
-    traj_joint2.reset();
+    // 軌跡產生器在第一個控制 tick 對齊實測角度
+    traj_synced = false;
+    feedrate.reset();
+    feedrate_request = 1.0f;
+    ik_incremental.reset();
+    ik_cache.clear();
+    branch_tracker.reset();
+    branch_events.store(0, std::memory_order_relaxed);
+    traj_buffer.discard();
+    traj_buffer.resetStats();
+    pvt.stop();
+    pvt_mode_enabled = false;
+    table_player.stop();
+    playback_request.store(nullptr, std::memory_order_relaxed);
+    playback_mode_enabled = false;
+    playback_approaching = false;
+    segment_buffer.discard();
+    segment_buffer.resetStats();
+    lookahead.clear();
+    rejected_segments.store(0, std::memory_order_relaxed);
+    move_requests.discard();
+    move_requests.resetStats();
 
     // 預設目標設為當前位置 (防止開機暴衝)
     // 注意：這裡假設開機時已經在某個合理位置，且已手動歸零
     // 如果沒有歸零，Encoder 值會是 0，IK 可能解不出來
     target_x = 0.0f;
     target_y = 150.0f;
+    publishSnapshot(measured_pos, branch_tracker.solutionMode());  // ik_mode_enabled 尚未開啟
 }
 
 // ==========================================================
 // 2. 設定目標 API (給 main.c 測試用)
 // ==========================================================
-extern "C" void Robot_SetTargetPosition(float x, float y) {
-    target_x = x;
-    target_y = y;
+
+// 沿路徑每 1mm 取樣檢查可書寫 (工作空間地圖 O(1) 查表)：
+// 路徑的關節前饋 J^-1 * v 直接交給產生器 sync()，不經過奇異構型減速，
+// 所以整條路徑都必須在 writable 區 (singularityDistance >= SINGULARITY_SLOWDOWN_BAND)
+static bool pathWritable(PathInterpolator& path) {
+    int n = (int)path.length() + 1;
+    for (int i = 0; i <= n; ++i) {
+        Point2D p = path.sample(path.length() * (float)i / (float)n).pos;
+        if (!workspace_map.isWritable(p.x, p.y)) return false;
+    }
+    return true;
+}
+
+// 目標點以目前的手肘方向 (快照) 解 IK 後的構型是否碰撞 (手肘方向不一致時以 mode 1 估計)
+static bool targetCollides(float x, float y) {
+    if (!collision_check_enabled) return false;
+    int mode = readSnapshot().solution_mode;
+    MotorAngles sol = kinematics.solveIK({x, y}, mode != 0 ? mode : 1);
+    LinkagePose pose;
+    if (!sol.is_reachable || !kinematics.solveFKLinkage(sol.theta1, sol.theta2, &pose)) return true;
+    return collision_checker.check(pose) != 0;
+}
+
+// 發佈 reserve 填好的目標要求，並要求 ControlTask 中止線段佇列、PVT 與筆畫表 (呼叫端)
+static void postMove() {
+    move_requests.commit(1);
+    segment_queue_abort = true;
+    joint_stream_abort = true;
+    playback_request.store(nullptr, std::memory_order_relaxed);
+}
+
+extern "C" bool Robot_SetTargetPosition(float x, float y) {
+    // 不可達 (或在圍籬之下) 的目標直接拒絕，保持上一個目標
+    if (!workspace_map.isReachable(x, y) || targetCollides(x, y)) return false;
+    MoveRequest* req = move_requests.reserve(0);
+    if (!req) return false;
+    req->type = MOVE_POSITION;
+    req->state = {{x, y}, {0.0f, 0.0f}, {0.0f, 0.0f}};
+    postMove();
+    return true;
+}
+
+extern "C" bool Robot_SetTargetState(float x, float y, float vx, float vy, float ax, float ay) {
+    // 前饋不經奇異構型減速：與路徑移動相同，只接受 writable 區的目標
+    if (!workspace_map.isWritable(x, y) || targetCollides(x, y)) return false;
+    MoveRequest* req = move_requests.reserve(0);
+    if (!req) return false;
+    req->type = MOVE_STATE;
+    req->state = {{x, y}, {vx, vy}, {ax, ay}};
+    postMove();
+    return true;
+}
+
+// 路徑插補的起點 (ControlTask)：運動學模式下為目前的命令點 (移動中途呼叫時從當下的插補點開始)，
+// 否則為實測位置；目標 API 在呼叫端使用快照裡最近一個 tick 的值
+static Point2D pathStartPoint() {
+    return ik_mode_enabled ? Point2D{target_x, target_y} : measured_pos;
+}
+
+// 在 move_requests 預留的位置上建立路徑 (呼叫端)：檢查通過才 commit，否則這個位置留給下一次使用
+static bool startPath(MoveRequest* req, float v, float a) {
+    if (!(v > 0.0f) || !(a > 0.0f)) return false;
+    Point2D end = req->path.end();
+    if (!pathWritable(req->path) || targetCollides(end.x, end.y)) return false;
+
+    req->type = MOVE_PATH;
+    req->v = v;
+    req->a = a;
+    postMove();
+    return true;
+}
+
+// 套用一個目標要求 (ControlTask)：同一個 tick 內 segment_queue_abort / joint_stream_abort 接著清掉其他來源
+static void applyMove(const MoveRequest& req) {
+    path_motion.cancel();
+    pvt_mode_enabled = false;
+    playback_mode_enabled = false;
     ik_mode_enabled = true;
+    cartesian_ff_enabled = req.type != MOVE_POSITION;
+    if (req.type == MOVE_PATH) {
+        target_state.pos = req.path.start();
+        target_state.vel = {0.0f, 0.0f};
+        target_state.acc = {0.0f, 0.0f};
+        path_motion.start(req.path, req.v, req.a);
+        straightness.begin();
+        straightness_measuring = true;
+        straightness_settle_left = STRAIGHTNESS_SETTLE_TIME;
+    } else {
+        target_state = req.state;
+    }
+    target_x = target_state.pos.x;
+    target_y = target_state.pos.y;
+}
+
+// 把 segment_buffer 的線段併入前瞻規劃器 (ControlTask)：
+// 閒置時從目前的命令點開始；經過不可書寫區域或終點碰撞的線段連同其後整個佇列丟棄，已規劃的部分照常停在終點
+static void intakeSegments() {
+    for (uint32_t n = 0; n < SEGMENT_INTAKE_PER_TICK && !lookahead.full(); ++n) {
+        StrokeSegment seg;
+        if (!segment_buffer.pop(&seg)) return;
+
+        bool starting = !lookahead.active();
+        if (starting) lookahead.setStart(pathStartPoint());
+        pending_path.beginLine(lookahead.tail(), {seg.x, seg.y});
+        if (!pathWritable(pending_path) || targetCollides(seg.x, seg.y) ||
+            !lookahead.append({seg.x, seg.y}, seg.v, seg.a)) {
+            rejected_segments.fetch_add(1 + segment_buffer.size(), std::memory_order_relaxed);
+            segment_buffer.discard();
+            return;
+        }
+        if (starting && lookahead.active()) {
+            target_state.pos = pending_path.start();
+            target_state.vel = {0.0f, 0.0f};
+            target_state.acc = {0.0f, 0.0f};
+            straightness.begin();
+            straightness_measuring = true;
+            straightness_settle_left = STRAIGHTNESS_SETTLE_TIME;
+            pvt_mode_enabled = false;
+            playback_mode_enabled = false;
+            ik_mode_enabled = true;
+            cartesian_ff_enabled = true;
+        }
+    }
+}
+
+extern "C" bool Robot_MoveLinear(float x, float y, float v, float a) {
+    MoveRequest* req = move_requests.reserve(0);
+    if (!req) return false;
+    req->path.beginLine(readSnapshot().start, {x, y});
+    return startPath(req, v, a);
+}
+
+extern "C" bool Robot_MoveArc(float cx, float cy, float sweep_deg, float v, float a) {
+    MoveRequest* req = move_requests.reserve(0);
+    if (!req) return false;
+    if (!req->path.beginArc(readSnapshot().start, {cx, cy}, DogArmKinematics::deg2rad(sweep_deg))) return false;
+    return startPath(req, v, a);
+}
+
+extern "C" bool Robot_MoveBezier(float x1, float y1, float x2, float y2, float x3, float y3, float v, float a) {
+    MoveRequest* req = move_requests.reserve(0);
+    if (!req) return false;
+    req->path.beginBezier(readSnapshot().start, {x1, y1}, {x2, y2}, {x3, y3});
+    return startPath(req, v, a);
+}
+
+// 筆畫表正在移向起點或播放中
+static bool playbackBusy() {
+    return playback_approaching || table_player.active();
+}
+
+extern "C" bool Robot_IsMoving(void) {
+    return !move_requests.empty() || path_motion.active() || lookahead.active() || !segment_buffer.empty() ||
+           pvt.active() || !traj_buffer.empty() || playbackBusy() ||
+           playback_request.load(std::memory_order_relaxed) != nullptr;
+}
+
+extern "C" void Robot_GetStraightnessReport(StraightnessReport* report) {
+    const StraightnessStats& st = straightness.stats();
+    report->max_deviation_mm = st.max_deviation;
+    report->rms_deviation_mm = st.rms_deviation;
+    report->max_tracking_error_mm = st.max_tracking;
+    report->duration_s = st.duration;
+    report->samples = st.samples;
+    report->complete = !straightness_measuring;
+}
+
+extern "C" uint32_t Robot_PushTrajectory(const TrajectoryPoint* points, uint32_t count) {
+    return traj_buffer.pushBulk(points, count);
+}
+
+extern "C" uint32_t Robot_FeedTrajectoryStream(const uint8_t* data, uint32_t length) {
+    return traj_decoder.feed(data, length, traj_buffer);
+}
+
+extern "C" void Robot_GetTrajectoryStreamStats(TrajectoryStreamStats* stats) {
+    *stats = traj_decoder.stats();
+}
+
+extern "C" void Robot_SetFeedrateOverride(float percent) {
+    float s = percent * 0.01f;
+    if (!(s >= 0.0f)) s = 0.0f;  // 含 NaN
+    if (s > FeedrateOverride::MAX_SCALE) s = FeedrateOverride::MAX_SCALE;
+    feedrate_request = s;
+}
+
+extern "C" float Robot_GetFeedrateOverride(void) {
+    return feedrate.scale() * 100.0f;
+}
+
+extern "C" void Robot_StopTrajectory(void) {
+    playback_request.store(nullptr, std::memory_order_relaxed);
+    joint_stream_abort = true;
+}
+
+extern "C" uint32_t Robot_GetStrokeTableCount(void) {
+    return STROKE_TABLE_COUNT;
+}
+
+extern "C" const char* Robot_GetStrokeTableName(uint32_t index) {
+    return (index < STROKE_TABLE_COUNT) ? STROKE_TABLES[index].name : nullptr;
+}
+
+extern "C" bool Robot_PlayStrokeTable(uint32_t index) {
+    // 表格以固定的手肘方向編譯，實測構型不同時整條軌跡都會跨過奇異構型
+    if (index >= STROKE_TABLE_COUNT || test_mode) return false;
+    if (readSnapshot().solution_mode != STROKE_TABLES[index].solution_mode) return false;
+    segment_queue_abort = true;
+    joint_stream_abort = true;
+    playback_index = index;
+    playback_request.store(&STROKE_TABLES[index], std::memory_order_release);
+    return true;
+}
+
+extern "C" void Robot_GetPlaybackStatus(PlaybackStatus* status) {
+    const StrokeTable* t = table_player.table();
+    status->active = playbackBusy();
+    status->approaching = playback_approaching;
+    status->pen_down = table_player.active() && !playback_approaching && table_player.penDown();
+    status->table = playback_index;
+    status->tick = table_player.tick();
+    status->total_ticks = t ? t->samples - 1 : 0;
+}
+
+extern "C" uint32_t Robot_QueueSegments(const StrokeSegment* segments, uint32_t count) {
+    return segment_buffer.pushBulk(segments, count);
+}
+
+extern "C" void Robot_SetJunctionDeviation(float mm) {
+    junction_deviation_request = (mm > 0.0f) ? mm : 0.0f;  // NaN 也視為 0
+}
+
+extern "C" uint32_t Robot_TakeRejectedSegments(void) {
+    return rejected_segments.exchange(0, std::memory_order_relaxed);
+}
+
+extern "C" void Robot_GetTrajectoryBufferStats(TrajectoryBufferStats* stats) {
+    stats->level = traj_buffer.size();
+    stats->capacity = traj_buffer.capacity();
+    stats->high_watermark = traj_buffer.highWatermark();
+    stats->overruns = traj_buffer.overruns();
+    stats->underruns = traj_buffer.underruns();
+}
+
+extern "C" bool Robot_IsWritable(float x, float y) {
+    return workspace_map.isWritable(x, y);
+}
+
+extern "C" float Robot_GetPositionUncertainty(float x, float y) {
+    return resolution_map.uncertaintyAt(x, y);
+}
+
+extern "C" uint32_t Robot_GetCollisionFlags(void) {
+    return collision_flags;
+}
+
+extern "C" void Robot_SetCollisionCheck(bool enable) {
+    collision_check_enabled = enable;
+    if (!enable) collision_flags = 0;
+}
+
+extern "C" uint32_t Robot_TakeBranchEvents(void) {
+    return branch_events.exchange(0, std::memory_order_relaxed);
+}
+
+extern "C" void Robot_SetIkGridMode(bool enable) {
+    ik_grid_enabled = enable;
+}
+
+extern "C" void Robot_SetIkCacheMode(bool enable) {
+    ik_cache_enabled = enable;
+}
+
+extern "C" void Robot_GetIkCacheStats(uint32_t* hits, uint32_t* misses, uint32_t* evictions) {
+    *hits = ik_cache.hits();
+    *misses = ik_cache.misses();
+    *evictions = ik_cache.evictions();
 }
 
 // ==========================================================
 // 測試模式 API
 // ==========================================================
 extern "C" void Robot_SetTestMode(bool enable) {
-    test_mode = enable;
     if (enable) {
-        ik_mode_enabled = false;  // 測試模式下關閉運動學控制
+        // 模式旗標與路徑插補由 ControlTask 在測試模式的 tick 中關閉
+        segment_queue_abort = true;
+        joint_stream_abort = true;
+        playback_request.store(nullptr, std::memory_order_relaxed);
     }
+    test_mode = enable;
 }
 
 extern "C" void Robot_SetTestSpeed(int32_t rpm_motor1, int32_t rpm_motor2) {
@@ -162,6 +552,13 @@ extern "C" void Robot_SetTestSpeed(int32_t rpm_motor1, int32_t rpm_motor2) {
 extern "C" void Robot_Loop(float dt_seconds) {
     // --- 測試模式：直接控制馬達速度 ---
     if (test_mode == true) {
+        // 關閉運動學控制 (離開測試模式後從實測位置重新開始)
+        ik_mode_enabled = false;
+        traj_synced = false;
+        path_motion.cancel();
+        pvt_mode_enabled = false;
+        playback_mode_enabled = false;
+
         // 更新編碼器數據（仍需讀取位置回饋）
         Motor_Update(&motor_joint_13pin);
         Motor_Update(&motor_joint_8pin);
@@ -182,23 +579,198 @@ extern "C" void Robot_Loop(float dt_seconds) {
     Motor_Update(&motor_joint_8pin);
 
     // 取得真實角度 (Degree)
-    // 注意：這裡可能需要加上歸零後的 Offset
-    // 例如: float real_theta1 = Motor_GetAngle(&motor_joint_13pin) + JOINT1_OFFSET;
-    float real_theta1 = Motor_GetAngle(&motor_joint_13pin);
-    float real_theta2 = Motor_GetAngle(&motor_joint_8pin);
+    // 加上校正得到的零點修正 (arm_calibration.hpp，Tools/arm_calibrate 產生)
+    float real_theta1 = Motor_GetAngle(&motor_joint_13pin) + DogArmCalibration::JOINT1_OFFSET_DEG;
+    float real_theta2 = Motor_GetAngle(&motor_joint_8pin) + DogArmCalibration::JOINT2_OFFSET_DEG;
+
+    // 實測構型的 FK (步驟 C 的圍籬與碰撞檢查使用)，同時更新分支狀態
+    LinkagePose current_pose;
+    Point2D current_pos = branch_tracker.observe(
+        FiveBarKinematics::deg2rad(real_theta1),
+        FiveBarKinematics::deg2rad(real_theta2),
+        &current_pose
+    );
+    if (collision_check_enabled) {
+        bool assembled = current_pose.end.x != 0.0f || current_pose.end.y != 0.0f;
+        collision_flags = assembled ? collision_checker.check(current_pose) : (uint32_t)COLLISION_INVALID;
+    }
+    int solution_mode = branch_tracker.solutionMode();  // 0：兩臂手肘方向不一致
+    measured_pos = current_pos;
+
+    // 目標要求 (CommTask 的目標 API)：依序套用，後到的覆蓋先到的
+    while (const MoveRequest* req = move_requests.peek()) {
+        applyMove(*req);
+        move_requests.drop();
+    }
+
+    // 筆畫線段：其他目標 API 要求中止時清空；單段路徑插補結束後才開始消化佇列
+    if (segment_queue_abort) {
+        segment_queue_abort = false;
+        segment_buffer.discard();
+        lookahead.clear();
+    }
+    float junction_deviation = junction_deviation_request;
+    if (junction_deviation != lookahead.junctionDeviation()) lookahead.setJunctionDeviation(junction_deviation);
+    if (!path_motion.active() && !pvt.active() && !playbackBusy()) intakeSegments();
+
+    // PVT 軌跡：中止時從目前的設定點以最大煞車停下；有新的點且沒有路徑移動時，從目前的設定點開始執行
+    if (joint_stream_abort) {
+        joint_stream_abort = false;
+        traj_buffer.discard();
+        if (pvt.active() || playbackBusy()) {
+            pvt.stop();
+            table_player.stop();
+            playback_approaching = false;
+            joint_hold1 = traj_joint1.getPosition() +
+                        traj_joint1.stoppingDistance(traj_joint1.getVelocity(), traj_joint1.getAcceleration());
+            joint_hold2 = traj_joint2.getPosition() +
+                        traj_joint2.stoppingDistance(traj_joint2.getVelocity(), traj_joint2.getAcceleration());
+        }
+    }
+    if (!pvt.active() && !traj_buffer.empty() && !path_motion.active() && !lookahead.active() && !playbackBusy()) {
+        bool tracking = traj_synced && (ik_mode_enabled || pvt_mode_enabled);
+        JointSetpoint s1 = {real_theta1, 0.0f, 0.0f}, s2 = {real_theta2, 0.0f, 0.0f};
+        if (tracking) {
+            s1 = {traj_joint1.getPosition(), traj_joint1.getVelocity(), traj_joint1.getAcceleration()};
+            s2 = {traj_joint2.getPosition(), traj_joint2.getVelocity(), traj_joint2.getAcceleration()};
+        }
+        pvt.start(s1, s2);
+        pvt_mode_enabled = true;
+        playback_mode_enabled = false;
+        ik_mode_enabled = false;
+        cartesian_ff_enabled = false;
+    }
+
+    // 筆畫表播放要求：表格角度平移整圈數到實測的多圈馬達角附近，先移向起點
+    const StrokeTable* table = playback_request.exchange(nullptr, std::memory_order_acquire);
+    if (table) {
+        path_motion.cancel();
+        pvt_mode_enabled = false;
+        float off1 = 360.0f * roundf((real_theta1 - (float)table->theta1_start * table->angle_lsb) / 360.0f);
+        float off2 = 360.0f * roundf((real_theta2 - (float)table->theta2_start * table->angle_lsb) / 360.0f);
+        table_player.start(*table, off1, off2);
+        joint_hold1 = table_player.theta1();
+        joint_hold2 = table_player.theta2();
+        playback_approaching = true;
+        playback_mode_enabled = true;
+        ik_mode_enabled = false;
+        cartesian_ff_enabled = false;
+    }
+
+    // 進給率覆寫：本 tick 的軌跡時間 (覆寫為 0 時軌跡停在原處，前饋依鏈鎖律換算)
+    feedrate.update(feedrate_request, dt_seconds);
+    const float traj_dt = feedrate.trajectoryDt(dt_seconds);
+
+    // 路徑插補：先量測上一個命令點的結果，再產生本 tick 的末端狀態
+    bool queue_running = lookahead.active();
+    if (straightness_measuring) {
+        Point2D tangent = queue_running ? lookahead.tangent() : path_motion.tangent();
+        straightness.add(current_pos, target_state.pos, tangent, dt_seconds);
+        if (!path_motion.active() && !queue_running) {
+            straightness_settle_left -= dt_seconds;
+            if (straightness_settle_left <= 0.0f) straightness_measuring = false;
+        }
+    }
+    bool path_driven = path_motion.active() || queue_running;  // target_state 的導數是對軌跡時間
+    if (path_driven && traj_dt > 0.0f) {
+        if (queue_running) lookahead.step(traj_dt, &target_state);
+        else path_motion.step(traj_dt, &target_state);
+        target_x = target_state.pos.x;
+        target_y = target_state.pos.y;
+    }
+    publishSnapshot(pathStartPoint(), solution_mode);
 
     // --- 步驟 B: 計算目標角度 (Setpoint) ---
     float target_angle1_deg = real_theta1; // 預設保持現狀
     float target_angle2_deg = real_theta2;
+    float speed_scale = 1.0f;  // 接近奇異構型時 < 1
+    JointSetpoint ff1 = {real_theta1, 0.0f, 0.0f};
+    JointSetpoint ff2 = {real_theta2, 0.0f, 0.0f};
+    bool use_setpoint_ff = false;  // true：ff1 / ff2 是完整的設定點 (位置 + 解析前饋)，產生器直接跟隨
 
-    if (ik_mode_enabled) {
-        // 使用運動學解算 (IK)
-        MotorAngles solution = kinematics.solveIK({target_x, target_y});
+    if (pvt_mode_enabled) {
+        // PVT 軌跡 (關節空間，與實測角同一個多圈座標)：Hermite 插補的設定點直接當前饋；
+        // 結束或斷流後由 S 曲線從當下的速度 / 加速度停到最後一點
+        if (pvt.active()) {
+            use_setpoint_ff = pvt.step(traj_dt, traj_buffer, &ff1, &ff2);
+            feedrate.apply(&ff1);  // 對軌跡時間的導數 -> 實際時間
+            feedrate.apply(&ff2);
+            if (!pvt.active()) {
+                joint_hold1 = pvt.endTheta1();
+                joint_hold2 = pvt.endTheta2();
+            }
+        }
+        target_angle1_deg = joint_hold1;
+        target_angle2_deg = joint_hold2;
+    } else if (playback_mode_enabled) {
+        // 筆畫表：S 曲線停在起點後 (產生器到達目標時精確對齊)，每個 tick 前進 s 個樣本 (無 IK，成本固定)
+        if (playback_approaching && traj_synced && traj_joint1.getPosition() == joint_hold1 &&
+            traj_joint2.getPosition() == joint_hold2 && traj_joint1.getVelocity() == 0.0f &&
+            traj_joint2.getVelocity() == 0.0f) {
+            playback_approaching = false;
+        }
+        if (!playback_approaching && table_player.active()) {
+            use_setpoint_ff = table_player.step(&ff1, &ff2, traj_dt / table_player.table()->tick_s);
+            feedrate.apply(&ff1);
+            feedrate.apply(&ff2);
+            if (!table_player.active()) {
+                joint_hold1 = table_player.theta1();
+                joint_hold2 = table_player.theta2();
+            }
+        }
+        target_angle1_deg = joint_hold1;
+        target_angle2_deg = joint_hold2;
+    } else if (ik_mode_enabled && cartesian_ff_enabled) {
+        // 笛卡兒狀態模式：位置、速度、加速度一起換算
+        // (不可達，或兩臂手肘方向不一致而無法以 solveIK 的 mode 表示時，保持不動)
+        CartesianState state = target_state;
+        if (path_driven) feedrate.apply(&state);  // 路徑插補的導數是對軌跡時間
+        if (solution_mode != 0 && kinematic_ff.update(state, &ff1, &ff2, solution_mode)) {
+            float t1 = FiveBarKinematics::deg2rad(ff1.pos);
+            float t2 = FiveBarKinematics::deg2rad(ff2.pos);
+            branch_tracker.unwrap(&t1, &t2);
+            ff1.pos = FiveBarKinematics::rad2deg(t1);
+            ff2.pos = FiveBarKinematics::rad2deg(t2);
+            // 進給率設得過高時 J^-1 * v 可能超過關節速度上限：前饋夾在上限內，其餘由 PID 追
+            ff1.vel = fmaxf(-JOINT1_MAX_VELOCITY, fminf(ff1.vel, JOINT1_MAX_VELOCITY));
+            ff2.vel = fmaxf(-JOINT2_MAX_VELOCITY, fminf(ff2.vel, JOINT2_MAX_VELOCITY));
+            use_setpoint_ff = true;
+        }
+        target_angle1_deg = ff1.pos;
+        target_angle2_deg = ff2.pos;
+    } else if (ik_mode_enabled) {
+        // 使用運動學解算 (IK)，手肘模式跟隨實測構型：
+        // 查表模式 (mode 1) 且在網格內時只需 4 次讀取 + 內插，否則走增量 IK (內含封閉解 fallback)，
+        // 快取模式下先查記憶快取，miss 才求解並存入；
+        // 兩臂手肘方向不一致時由 branch_tracker 逐臂選最接近實測角的解
+        Point2D target = {target_x, target_y};
+        MotorAngles solution;
+        if (solution_mode == 0) {
+            solution = branch_tracker.solveIK(target);
+        } else {
+            if (ik_grid_enabled && solution_mode == 1 && ik_grid.contains(target)) {
+                solution = ik_grid.lookup(target);
+            } else if (ik_cache_enabled) {
+                solution = ik_cache.solve(target, solution_mode,
+                                          [](Point2D p, int mode) { return ik_incremental.solve(p, mode); });
+            } else {
+                solution = ik_incremental.solve(target, solution_mode);
+            }
+            branch_tracker.unwrap(&solution.theta1, &solution.theta2);
+        }
 
         if (solution.is_reachable) {
             // IK 算出來是 Radian，轉成 Degree 給 PID 用
             target_angle1_deg = FiveBarKinematics::rad2deg(solution.theta1);
             target_angle2_deg = FiveBarKinematics::rad2deg(solution.theta2);
+
+            // 接近奇異構型時 J^-1 放大，同樣的末端速度需要極大的關節速度，
+            // 先行降速，避免 PositionController 飽和在 max_rpm
+            float sd = kinematics.singularityDistance(solution.theta1, solution.theta2);
+            if (sd < SINGULARITY_SLOWDOWN_BAND) {
+                speed_scale = sd / SINGULARITY_SLOWDOWN_BAND;
+                if (speed_scale < SINGULARITY_MIN_SPEED_SCALE) speed_scale = SINGULARITY_MIN_SPEED_SCALE;
+            }
         } else {
             // 目標點超出工作範圍 (Unreachable)
             // 策略：保持在最後一個有效位置，或報錯
@@ -206,27 +778,54 @@ extern "C" void Robot_Loop(float dt_seconds) {
         }
     }
 
-    // --- 步驟 C: 安全檢查 (FK) ---
-    // 利用正向運動學檢查當前位置是否撞機
-    Point2D current_pos = kinematics.solveFK(
-        FiveBarKinematics::deg2rad(real_theta1),
-        FiveBarKinematics::deg2rad(real_theta2)
-    );
+    // 分支事件 (observe / solveIK 產生) 併入跨 Task 的旗標：BranchTracker 只在 ControlTask 存取
+    uint32_t events = branch_tracker.takeEvents();
+    if (events) branch_events.fetch_or(events, std::memory_order_relaxed);
 
-    // 虛擬圍籬範例：如果 Y < 10mm (太靠近底座)，強制停止
-    if (current_pos.y < 10.0f && ik_mode_enabled) {
+    // --- 步驟 C: 安全檢查 (FK) ---
+    // 利用正向運動學 (步驟 A 的 current_pos) 檢查當前位置是否撞機
+    // 虛擬圍籬：如果 Y < Y_FENCE (太靠近底座)，強制停止
+    // (目標點已由工作空間地圖擋在圍籬之上，這裡只防實際位置偏離，例如 PID 過衝或外力)
+    // 實測構型的連桿互撞 / 撞馬達 / 撞壓紙條同樣強制停止
+    // PVT 軌跡與筆畫表沒有經過目標檢查，同樣受圍籬保護；停機時丟棄剩下的軌跡點 / 中止播放，恢復後停在停機位置
+    bool position_control = ik_mode_enabled || pvt_mode_enabled || playback_mode_enabled;
+    bool collided = collision_check_enabled && collision_flags != 0;
+    if ((current_pos.y < DogArmSafety::Y_FENCE || collided) && position_control) {
         Motor_Stop(&motor_joint_13pin);
         Motor_Stop(&motor_joint_8pin);
+        traj_synced = false;  // 恢復後從實測位置重新規劃，不追趕停機期間的軌跡
+        if (pvt_mode_enabled || playback_mode_enabled) {
+            pvt.stop();
+            table_player.stop();
+            playback_approaching = false;
+            traj_buffer.discard();
+            joint_hold1 = real_theta1;
+            joint_hold2 = real_theta2;
+        }
         return; // 跳過 PID 計算
     }
 
     // --- 步驟 D: 軌跡規劃 (Trajectory Planning) ---
-    // 根據目標位置變化，計算速度與加速度前饋
-    traj_joint1.update(target_angle1_deg, dt_seconds);
-    traj_joint2.update(target_angle2_deg, dt_seconds);
-    
+    // 由 S 曲線產生器把目標角度變成 jerk 限制的位置 / 速度 / 加速度 (目標中途改變時即時重新規劃)
+    if (!traj_synced || !position_control) {
+        traj_joint1.reset(real_theta1);
+        traj_joint2.reset(real_theta2);
+        traj_synced = true;
+    }
+    if (use_setpoint_ff) {
+        // 精確前饋：J^-1 * v 與 J^-1 * (a - J' * θ') 或 Hermite 多項式的導數，無差分延遲與濾波衰減；
+        // 產生器跟隨這個狀態，切回位置模式時從目前的速度 / 加速度平滑接續
+        traj_joint1.sync(ff1.pos, ff1.vel, ff1.acc);
+        traj_joint2.sync(ff2.pos, ff2.vel, ff2.acc);
+    } else {
+        traj_joint1.update(target_angle1_deg, dt_seconds, JOINT1_MAX_VELOCITY * speed_scale);
+        traj_joint2.update(target_angle2_deg, dt_seconds, JOINT2_MAX_VELOCITY * speed_scale);
+    }
+
+    target_angle1_deg = traj_joint1.getPosition();      // Deg
     float target_vel1 = traj_joint1.getVelocity();      // Deg/s
     float target_acc1 = traj_joint1.getAcceleration(); // Deg/s²
+    target_angle2_deg = traj_joint2.getPosition();
     float target_vel2 = traj_joint2.getVelocity();
     float target_acc2 = traj_joint2.getAcceleration();
 
@@ -0,0 +1,104 @@
+/**
+ * @file scurve_generator.cpp
+ * @brief 線上 S 曲線產生器實作
+ */
+
+#include "scurve_generator.hpp"
+
+static inline float clampf(float x, float lo, float hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+float SCurveGenerator::stoppingDistance(float vel, float acc) const {
+    const float J = _j_max;
+    const float A = _a_max;
+
+    // 換到「停下前最後的運動方向為正」的座標：方向由立刻收回 a 之後的速度 v + a|a|/2J 決定
+    // (以速度正負判斷時，反向移動中朝目標加速的狀態會被當成在速度過零處停下，忽略折返的那一段)
+    float s = 1.0f;
+    float v_release = vel + acc * std::fabs(acc) / (2.0f * J);
+    if (v_release < 0.0f || (v_release == 0.0f && vel < 0.0f)) {
+        s = -1.0f;
+        vel = -vel;
+        acc = -acc;
+    }
+
+    // 煞車輪廓：a 以 -J 推到 -Ap，維持 t2，再以 +J 收回 0 時 v 剛好為 0
+    //   v + a²/2J - Ap²/J - Ap t2 = 0  =>  Ap² = J v + a²/2 (未飽和，>= 0 由上面的方向保證)，飽和時 Ap = A
+    float q = J * vel + 0.5f * acc * acc;
+    float ap, t2 = 0.0f;
+    if (q >= A * A) {
+        ap = A;
+        t2 = (q - A * A) / (J * A);
+    } else {
+        ap = std::sqrt(q > 0.0f ? q : 0.0f);
+    }
+    float t1 = (acc + ap) / J;
+    if (t1 < 0.0f) t1 = 0.0f;
+    float t3 = ap / J;
+
+    float d = t1 * (vel + t1 * (0.5f * acc - t1 * (J * (1.0f / 6.0f))));
+    float v1 = vel + t1 * (acc - 0.5f * J * t1);
+    d += t2 * (v1 - 0.5f * ap * t2);
+    float v2 = v1 - ap * t2;
+    d += t3 * (v2 + t3 * (-0.5f * ap + t3 * (J * (1.0f / 6.0f))));
+    return s * d;
+}
+
+void SCurveGenerator::update(float target, float dt, float max_velocity) {
+    const float V = (max_velocity > 0.0f) ? max_velocity : _v_max;
+    const float A = _a_max;
+    const float J = _j_max;
+
+    // 已到達：誤差小於一個 tick 的加加速度位移時直接對齊，避免在目標附近來回微調
+    float d = target - _pos;
+    float pos_tol = J * dt * dt * dt + std::fabs(target) * 1e-6f;
+    if (std::fabs(d) <= pos_tol && std::fabs(_vel) <= J * dt * dt && std::fabs(_acc) <= J * dt) {
+        _pos = target;
+        _vel = _acc = _jerk = 0.0f;
+        return;
+    }
+
+    // 換到「目標在正方向」的座標
+    const float s = (d >= 0.0f) ? 1.0f : -1.0f;
+    const float dist = s * d;
+    const float v = s * _vel;
+    const float a = s * _acc;
+
+    // 本 tick 可用的 jerk 範圍 (同時保證 |a| <= A)
+    float j_min = (-A - a) / dt;
+    float j_max = (A - a) / dt;
+    if (j_min < -J) j_min = -J;
+    if (j_max > J) j_max = J;
+    if (j_max < j_min) j_max = j_min;
+
+    // 1. 加速候選：a 沿 sqrt(2J |V - v|) 曲線，v 到達 V 時 a 剛好回到 0 (超過 V 時減速回來)
+    float v_next = v + a * dt;  // 以下一個 tick 的速度判斷，消掉一個 tick 的延遲
+    float a_goal = (v_next <= V) ? std::sqrt(2.0f * J * (V - v_next)) : -std::sqrt(2.0f * J * (v_next - V));
+    a_goal = clampf(a_goal, -A, A);
+    float j = clampf((a_goal - a) / dt, j_min, j_max);
+
+    // 2. 候選走一步後立刻最大煞車，停止點是否超過目標
+    auto overshoot = [&](float jerk) {
+        Step st = integrate(v, a, jerk, dt);
+        return st.dp + stoppingDistance(st.v, st.a) - dist;
+    };
+
+    // 3. 會超過：在 [最大煞車, 候選] 之間找剛好停在目標上的 jerk (保留不超過的一側)
+    if (overshoot(j) > 0.0f) {
+        float lo = j_min;
+        if (overshoot(lo) < 0.0f) {
+            float hi = j;
+            for (int i = 0; i < BISECT_ITERATIONS; ++i) {
+                float mid = 0.5f * (lo + hi);
+                if (overshoot(mid) > 0.0f) hi = mid;
+                else lo = mid;
+            }
+        }
+        j = lo;
+    }
+
+    Step st = integrate(v, a, j, dt);
+    _pos += s * st.dp;
+    _vel = s * st.v;
+    _acc = s * st.a;
+    _jerk = s * j;
+}
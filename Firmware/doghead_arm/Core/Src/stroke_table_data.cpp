@@ -0,0 +1,2280 @@
+/**
+ * @file stroke_table_data.cpp
+ * @brief [自動產生] 離線編譯的關節空間筆畫表，請勿手動修改
+ * @details 產生器: Tools/stroke_table_gen --speed 80 --accel 800 --travel-speed 150
+ *   幾何 L1=100.000 L2=150.000 D=60.000 mm，tick 1 ms，LSB 2^-16 Deg，共 70868 bytes Flash
+ *   yong          5 筆  5.436 s  21864 bytes，最大誤差 0.00006 mm
+ *   shi           2 筆  2.249 s   9076 bytes，最大誤差 0.00006 mm
+ *   kou           3 筆  3.815 s  15356 bytes，最大誤差 0.00006 mm
+ *   calib_square  1 筆  3.604 s  14480 bytes，最大誤差 0.00006 mm
+ *   calib_circle  1 筆  2.507 s  10092 bytes，最大誤差 0.00005 mm
+ */
+
+#include "stroke_table.hpp"
+#include "arm_geometry.hpp"
+
+// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)
+static_assert(dogArmGeometryMatches(100.0f, 150.0f, 60.0f),
+              "stroke_table_data.cpp was generated for another geometry: rerun Tools/stroke_table_gen");
+
+static const int16_t STROKE_YONG_DELTAS[10872] = {
+    0, 0, -1, 0, 0, -2, -1, -4, -2, -5, -5, -8, -3, -11, -6, -14,
+    -7, -20, -10, -24, -12, -28, -14, -36, -16, -41, -19, -47, -22, -57, -25, -64,
+    -29, -71, -32, -80, -36, -91, -39, -100, -45, -111, -47, -122, -54, -134, -57, -145,
+    -62, -159, -68, -172, -73, -185, -79, -200, -84, -215, -91, -229, -96, -246, -103, -262,
+    -109, -279, -115, -297, -124, -315, -130, -333, -137, -353, -145, -372, -152, -393, -159, -413,
+    -168, -434, -176, -457, -185, -479, -193, -501, -200, -526, -210, -550, -218, -574, -228, -600,
+    -237, -625, -246, -652, -256, -678, -263, -706, -274, -732, -283, -761, -292, -786, -301, -814,
+    -309, -842, -319, -869, -326, -895, -336, -924, -344, -950, -351, -977, -360, -1007, -369, -1034,
+    -376, -1060, -384, -1089, -392, -1117, -399, -1144, -407, -1173, -413, -1200, -421, -1228, -428, -1257,
+    -434, -1284, -442, -1313, -448, -1342, -454, -1370, -460, -1397, -468, -1427, -472, -1455, -478, -1483,
+    -483, -1514, -489, -1541, -494, -1571, -500, -1600, -504, -1628, -507, -1657, -514, -1687, -517, -1716,
+    -520, -1746, -526, -1775, -528, -1805, -532, -1834, -535, -1864, -539, -1893, -539, -1923, -544, -1955,
+    -545, -1984, -547, -2013, -550, -2044, -550, -2075, -553, -2104, -551, -2135, -552, -2164, -555, -2193,
+    -552, -2221, -553, -2249, -551, -2278, -549, -2304, -547, -2330, -546, -2358, -542, -2382, -539, -2406,
+    -536, -2432, -533, -2456, -528, -2479, -525, -2503, -517, -2525, -514, -2547, -509, -2568, -502, -2590,
+    -496, -2610, -489, -2630, -483, -2648, -475, -2668, -467, -2686, -460, -2703, -451, -2721, -443, -2738,
+    -435, -2754, -424, -2769, -415, -2783, -407, -2798, -396, -2812, -384, -2825, -375, -2838, -364, -2849,
+    -355, -2862, -342, -2872, -328, -2882, -319, -2892, -307, -2901, -294, -2909, -282, -2918, -268, -2924,
+    -256, -2930, -244, -2938, -229, -2942, -216, -2948, -203, -2950, -190, -2953, -174, -2958, -160, -2960,
+    -147, -2962, -133, -2965, -118, -2968, -103, -2971, -89, -2972, -74, -2975, -60, -2978, -44, -2980,
+    -29, -2982, -13, -2983, 1, -2986, 18, -2987, 31, -2987, 50, -2987, 65, -2987, 80, -2984,
+    96, -2982, 113, -2979, 128, -2976, 146, -2971, 161, -2966, 178, -2960, 194, -2954, 208, -2947,
+    227, -2938, 242, -2931, 258, -2920, 274, -2911, 290, -2900, 306, -2888, 322, -2877, 336, -2864,
+    353, -2848, 367, -2836, 383, -2820, 398, -2805, 412, -2787, 426, -2771, 440, -2753, 455, -2734,
+    467, -2714, 482, -2695, 494, -2673, 507, -2652, 519, -2631, 530, -2607, 543, -2583, 553, -2560,
+    564, -2535, 574, -2508, 584, -2483, 592, -2456, 602, -2428, 609, -2400, 618, -2371, 625, -2342,
+    630, -2311, 638, -2281, 643, -2251, 648, -2216, 651, -2186, 655, -2152, 659, -2121, 661, -2089,
+    665, -2057, 666, -2024, 668, -1991, 667, -1960, 670, -1926, 670, -1896, 668, -1864, 669, -1831,
+    668, -1800, 667, -1767, 663, -1736, 663, -1705, 658, -1672, 658, -1641, 652, -1609, 648, -1579,
+    644, -1547, 640, -1515, 634, -1486, 629, -1453, 624, -1423, 616, -1391, 609, -1361, 605, -1332,
+    594, -1300, 588, -1270, 581, -1239, 571, -1209, 564, -1180, 555, -1149, 544, -1120, 535, -1091,
+    526, -1060, 515, -1031, 504, -1002, 495, -973, 482, -943, 473, -915, 460, -884, 448, -857,
+    436, -829, 425, -799, 412, -771, 398, -743, 386, -715, 373, -686, 359, -659, 348, -630,
+    333, -605, 322, -579, 310, -553, 294, -528, 284, -504, 270, -481, 260, -458, 248, -435,
+    236, -414, 225, -392, 213, -372, 202, -352, 193, -332, 182, -314, 171, -296, 162, -276,
+    151, -261, 143, -244, 134, -228, 124, -212, 115, -198, 109, -183, 99, -169, 92, -156,
+    85, -143, 77, -132, 70, -120, 66, -108, 58, -98, 53, -88, 45, -78, 42, -70,
+    36, -61, 31, -54, 28, -46, 24, -39, 19, -33, 17, -27, 14, -22, 9, -18,
+    9, -14, 6, -10, 3, -6, 4, -5, 0, -2, 2, -1, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 1, 4, 1, 5, 1, 8, 2, 13, 3, 16, 5,
+    21, 5, 26, 6, 30, 9, 39, 9, 45, 10, 51, 14, 60, 15, 69, 17,
+    78, 20, 87, 22, 98, 25, 109, 27, 119, 30, 131, 33, 145, 37, 158, 40,
+    172, 43, 185, 47, 200, 51, 216, 53, 232, 59, 248, 63, 266, 67, 283, 71,
+    302, 76, 319, 82, 340, 86, 360, 91, 380, 95, 401, 102, 424, 108, 444, 112,
+    468, 119, 491, 124, 516, 131, 539, 137, 566, 143, 591, 150, 616, 156, 643, 164,
+    672, 171, 699, 177, 727, 185, 756, 193, 785, 200, 812, 207, 842, 215, 870, 221,
+    898, 230, 928, 237, 954, 244, 985, 252, 1012, 259, 1040, 267, 1070, 275, 1098, 282,
+    1126, 289, 1154, 297, 1184, 304, 1213, 312, 1240, 321, 1268, 327, 1296, 335, 1327, 343,
+    1354, 350, 1382, 359, 1411, 366, 1439, 373, 1469, 383, 1497, 389, 1523, 397, 1553, 405,
+    1582, 413, 1611, 421, 1638, 429, 1666, 437, 1696, 445, 1723, 453, 1753, 461, 1781, 469,
+    1808, 477, 1837, 485, 1867, 493, 1894, 502, 1922, 510, 1952, 518, 1978, 527, 2008, 534,
+    2035, 543, 2066, 552, 2092, 560, 2121, 568, 2149, 577, 2178, 585, 2206, 594, 2235, 603,
+    2264, 610, 2290, 620, 2320, 629, 2348, 637, 2376, 646, 2404, 655, 2433, 663, 2461, 673,
+    2489, 681, 2518, 690, 2546, 699, 2574, 710, 2603, 716, 2630, 727, 2659, 736, 2687, 745,
+    2716, 754, 2743, 764, 2773, 772, 2800, 782, 2829, 793, 2856, 801, 2885, 810, 2913, 820,
+    2942, 830, 2970, 840, 2997, 848, 3026, 859, 3054, 869, 3083, 878, 3110, 889, 3139, 899,
+    3166, 908, 3196, 918, 3223, 928, 3252, 939, 3279, 949, 3308, 959, 3335, 969, 3364, 979,
+    3392, 991, 3421, 1000, 3447, 1011, 3477, 1022, 3503, 1031, 3529, 1042, 3555, 1052, 3580, 1062,
+    3605, 1071, 3628, 1082, 3655, 1091, 3675, 1100, 3698, 1110, 3721, 1119, 3740, 1128, 3763, 1137,
+    3781, 1146, 3802, 1154, 3820, 1164, 3840, 1171, 3857, 1180, 3874, 1189, 3891, 1196, 3907, 1204,
+    3923, 1211, 3937, 1220, 3954, 1226, 3966, 1235, 3978, 1241, 3992, 1248, 4004, 1256, 4017, 1261,
+    4026, 1269, 4038, 1275, 4046, 1281, 4057, 1288, 4065, 1293, 4074, 1299, 4081, 1305, 4089, 1310,
+    4094, 1316, 4101, 1320, 4105, 1326, 4111, 1331, 4115, 1334, 4118, 1341, 4122, 1343, 4125, 1348,
+    4125, 1352, 4129, 1355, 4128, 1359, 4128, 1362, 4129, 1366, 4127, 1369, 4127, 1371, 4124, 1374,
+    4121, 1376, 4118, 1379, 4115, 1380, 4111, 1383, 4106, 1384, 4100, 1385, 4095, 1387, 4087, 1388,
+    4081, 1388, 4074, 1389, 4065, 1390, 4056, 1389, 4048, 1390, 4037, 1389, 4027, 1390, 4016, 1387,
+    4004, 1388, 3991, 1386, 3981, 1385, 3965, 1383, 3952, 1382, 3939, 1379, 3923, 1377, 3908, 1374,
+    3892, 1372, 3874, 1369, 3859, 1366, 3839, 1362, 3822, 1358, 3804, 1355, 3784, 1350, 3764, 1346,
+    3742, 1341, 3722, 1337, 3701, 1331, 3678, 1327, 3656, 1320, 3633, 1315, 3608, 1307, 3584, 1302,
+    3558, 1295, 3535, 1289, 3507, 1281, 3481, 1274, 3452, 1266, 3427, 1258, 3397, 1250, 3369, 1242,
+    3341, 1233, 3313, 1226, 3284, 1216, 3256, 1208, 3227, 1200, 3199, 1191, 3170, 1182, 3142, 1174,
+    3115, 1166, 3086, 1156, 3058, 1147, 3027, 1139, 3002, 1129, 2972, 1121, 2945, 1112, 2916, 1103,
+    2888, 1093, 2859, 1084, 2831, 1076, 2803, 1066, 2775, 1057, 2745, 1047, 2719, 1038, 2690, 1028,
+    2661, 1020, 2634, 1010, 2605, 1000, 2576, 991, 2550, 981, 2520, 971, 2492, 962, 2463, 951,
+    2436, 943, 2408, 932, 2379, 923, 2351, 912, 2322, 903, 2296, 893, 2266, 883, 2239, 873,
+    2209, 862, 2183, 853, 2153, 843, 2126, 831, 2097, 823, 2069, 812, 2042, 801, 2012, 791,
+    1984, 781, 1957, 771, 1927, 761, 1901, 750, 1872, 739, 1843, 729, 1816, 719, 1788, 707,
+    1760, 698, 1730, 687, 1704, 676, 1675, 665, 1645, 656, 1619, 643, 1591, 634, 1562, 623,
+    1535, 612, 1506, 601, 1478, 591, 1449, 579, 1422, 569, 1394, 558, 1366, 547, 1337, 535,
+    1310, 526, 1280, 514, 1253, 503, 1225, 492, 1198, 481, 1167, 470, 1141, 460, 1113, 447,
+    1084, 437, 1056, 426, 1029, 415, 1000, 402, 972, 393, 944, 381, 915, 370, 888, 359,
+    860, 348, 832, 336, 803, 325, 775, 314, 747, 303, 719, 291, 691, 280, 664, 269,
+    637, 258, 610, 249, 584, 236, 559, 227, 535, 216, 509, 207, 486, 198, 463, 188,
+    440, 179, 419, 170, 398, 162, 376, 153, 356, 145, 337, 137, 317, 128, 299, 122,
+    280, 114, 263, 107, 246, 100, 231, 94, 213, 87, 199, 81, 185, 75, 170, 69,
+    156, 64, 144, 58, 131, 54, 119, 49, 109, 43, 96, 40, 87, 36, 78, 31,
+    68, 28, 61, 24, 52, 21, 43, 18, 39, 15, 31, 14, 26, 10, 20, 9,
+    16, 6, 13, 5, 9, 4, 6, 3, 3, 0, 2, 2, 1, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, -1, -3, -3, -5, -4, -6, -6, -10, -8,
+    -13, -11, -17, -14, -21, -18, -25, -22, -30, -26, -36, -31, -42, -36, -49, -41,
+    -56, -48, -62, -53, -70, -61, -79, -67, -88, -76, -97, -83, -105, -91, -118, -100,
+    -127, -110, -138, -117, -150, -130, -162, -139, -174, -148, -188, -161, -199, -172, -214, -184,
+    -229, -196, -244, -208, -258, -222, -274, -234, -291, -249, -307, -264, -323, -277, -342, -293,
+    -360, -307, -377, -324, -397, -341, -415, -355, -437, -374, -457, -391, -476, -408, -500, -426,
+    -519, -446, -543, -463, -564, -484, -589, -503, -610, -522, -634, -542, -657, -562, -681, -581,
+    -703, -601, -727, -620, -749, -640, -773, -660, -797, -679, -818, -699, -843, -719, -866, -737,
+    -889, -758, -911, -777, -935, -796, -960, -816, -981, -836, -1004, -855, -1028, -874, -1051, -895,
+    -1075, -913, -1097, -932, -1122, -953, -1144, -971, -1168, -991, -1191, -1010, -1214, -1030, -1237, -1049,
+    -1261, -1068, -1285, -1088, -1307, -1107, -1331, -1126, -1355, -1145, -1377, -1164, -1401, -1185, -1425, -1203,
+    -1448, -1222, -1472, -1241, -1495, -1261, -1518, -1280, -1542, -1299, -1564, -1318, -1589, -1336, -1613, -1357,
+    -1636, -1374, -1659, -1395, -1682, -1412, -1709, -1432, -1729, -1451, -1753, -1470, -1778, -1488, -1799, -1507,
+    -1822, -1523, -1844, -1542, -1865, -1558, -1886, -1574, -1906, -1591, -1926, -1606, -1946, -1623, -1966, -1635,
+    -1983, -1650, -2002, -1665, -2020, -1678, -2037, -1692, -2053, -1704, -2070, -1716, -2087, -1730, -2101, -1740,
+    -2116, -1751, -2132, -1762, -2145, -1772, -2158, -1783, -2173, -1791, -2185, -1801, -2197, -1811, -2209, -1817,
+    -2219, -1826, -2232, -1834, -2241, -1841, -2251, -1847, -2262, -1854, -2268, -1860, -2280, -1865, -2286, -1871,
+    -2295, -1875, -2301, -1880, -2308, -1884, -2315, -1887, -2321, -1890, -2325, -1894, -2331, -1895, -2335, -1898,
+    -2339, -1900, -2342, -1901, -2345, -1901, -2348, -1902, -2350, -1903, -2352, -1901, -2353, -1901, -2352, -1901,
+    -2355, -1899, -2354, -1899, -2355, -1897, -2356, -1896, -2356, -1896, -2358, -1893, -2359, -1893, -2358, -1893,
+    -2359, -1891, -2360, -1890, -2360, -1889, -2362, -1889, -2362, -1887, -2362, -1886, -2363, -1885, -2363, -1884,
+    -2364, -1883, -2366, -1881, -2366, -1881, -2365, -1880, -2367, -1878, -2367, -1878, -2368, -1876, -2368, -1875,
+    -2370, -1875, -2369, -1873, -2371, -1872, -2371, -1871, -2370, -1870, -2373, -1869, -2374, -1868, -2372, -1868,
+    -2374, -1866, -2376, -1865, -2375, -1864, -2377, -1863, -2376, -1861, -2378, -1862, -2378, -1859, -2378, -1858,
+    -2379, -1858, -2381, -1857, -2380, -1856, -2382, -1854, -2381, -1853, -2382, -1853, -2382, -1851, -2384, -1850,
+    -2384, -1849, -2385, -1848, -2385, -1847, -2385, -1846, -2388, -1844, -2387, -1844, -2387, -1842, -2389, -1842,
+    -2388, -1841, -2391, -1838, -2389, -1839, -2391, -1837, -2391, -1836, -2392, -1836, -2393, -1834, -2393, -1833,
+    -2393, -1832, -2394, -1830, -2395, -1829, -2395, -1829, -2396, -1828, -2397, -1826, -2396, -1825, -2398, -1824,
+    -2399, -1823, -2399, -1822, -2399, -1821, -2400, -1819, -2400, -1820, -2401, -1817, -2403, -1816, -2402, -1816,
+    -2404, -1815, -2403, -1813, -2404, -1812, -2405, -1811, -2406, -1810, -2405, -1809, -2407, -1808, -2408, -1807,
+    -2406, -1805, -2410, -1805, -2408, -1804, -2410, -1802, -2409, -1801, -2411, -1799, -2412, -1800, -2412, -1798,
+    -2412, -1797, -2413, -1796, -2414, -1795, -2414, -1793, -2415, -1792, -2415, -1792, -2416, -1790, -2417, -1790,
+    -2417, -1787, -2417, -1788, -2418, -1785, -2419, -1784, -2420, -1784, -2421, -1783, -2419, -1781, -2421, -1780,
+    -2422, -1780, -2423, -1778, -2422, -1777, -2424, -1776, -2425, -1774, -2423, -1774, -2425, -1772, -2427, -1772,
+    -2426, -1770, -2426, -1769, -2428, -1768, -2428, -1766, -2427, -1767, -2430, -1764, -2430, -1764, -2430, -1762,
+    -2431, -1762, -2432, -1760, -2431, -1758, -2433, -1759, -2432, -1756, -2431, -1753, -2430, -1752, -2430, -1749,
+    -2426, -1747, -2424, -1742, -2421, -1739, -2417, -1736, -2414, -1730, -2409, -1726, -2403, -1720, -2400, -1715,
+    -2392, -1710, -2385, -1703, -2379, -1697, -2372, -1690, -2364, -1683, -2353, -1676, -2347, -1667, -2337, -1660,
+    -2326, -1651, -2317, -1643, -2304, -1632, -2294, -1624, -2282, -1614, -2269, -1604, -2256, -1593, -2243, -1583,
+    -2229, -1571, -2215, -1560, -2199, -1549, -2184, -1535, -2168, -1524, -2151, -1511, -2135, -1498, -2118, -1485,
+    -2099, -1470, -2082, -1457, -2060, -1443, -2043, -1427, -2023, -1413, -2002, -1397, -1982, -1382, -1959, -1366,
+    -1938, -1349, -1915, -1334, -1893, -1315, -1868, -1300, -1845, -1281, -1821, -1263, -1796, -1247, -1773, -1228,
+    -1747, -1211, -1725, -1193, -1699, -1175, -1674, -1158, -1651, -1141, -1625, -1123, -1603, -1105, -1576, -1088,
+    -1554, -1071, -1529, -1053, -1504, -1036, -1479, -1018, -1455, -1002, -1431, -983, -1407, -966, -1381, -949,
+    -1359, -932, -1332, -915, -1309, -896, -1285, -881, -1258, -863, -1235, -845, -1210, -829, -1187, -811,
+    -1160, -795, -1137, -777, -1113, -760, -1088, -743, -1063, -726, -1039, -708, -1013, -692, -991, -675,
+    -964, -657, -941, -642, -915, -623, -891, -607, -866, -590, -842, -572, -817, -556, -793, -540,
+    -768, -522, -743, -506, -718, -488, -694, -471, -671, -455, -643, -437, -621, -422, -594, -404,
+    -573, -387, -548, -372, -525, -357, -503, -341, -480, -326, -459, -311, -438, -297, -417, -282,
+    -398, -270, -377, -256, -360, -243, -340, -231, -322, -218, -305, -206, -286, -194, -272, -184,
+    -255, -172, -238, -162, -224, -152, -209, -142, -195, -132, -181, -122, -169, -114, -156, -106,
+    -144, -97, -131, -89, -120, -82, -111, -74, -100, -67, -90, -61, -80, -55, -74, -49,
+    -63, -43, -57, -39, -48, -33, -43, -28, -36, -24, -30, -21, -25, -17, -20, -14,
+    -17, -10, -12, -9, -9, -6, -6, -4, -4, -3, -2, -1, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, -2, 1, -2, 4, -5, 7, -7, 8, -10,
+    12, -12, 14, -16, 20, -21, 21, -25, 27, -30, 33, -36, 35, -40, 43, -48,
+    49, -54, 55, -61, 63, -70, 70, -77, 76, -86, 86, -95, 94, -105, 102, -114,
+    113, -125, 121, -135, 133, -148, 141, -158, 154, -171, 165, -184, 175, -196, 190, -210,
+    201, -225, 215, -238, 227, -254, 242, -269, 255, -284, 270, -301, 286, -318, 301, -335,
+    317, -353, 331, -370, 349, -389, 367, -408, 383, -427, 401, -447, 420, -469, 438, -487,
+    457, -511, 477, -530, 496, -554, 517, -575, 537, -599, 556, -621, 578, -642, 597, -667,
+    617, -689, 639, -711, 658, -733, 677, -756, 699, -779, 719, -801, 737, -823, 759, -847,
+    778, -868, 800, -891, 818, -914, 840, -936, 858, -958, 879, -981, 898, -1004, 921, -1026,
+    939, -1048, 959, -1071, 979, -1094, 1000, -1116, 1019, -1138, 1039, -1160, 1058, -1183, 1080, -1205,
+    1099, -1228, 1120, -1251, 1138, -1273, 1159, -1295, 1179, -1317, 1199, -1340, 1217, -1362, 1239, -1385,
+    1259, -1407, 1277, -1429, 1298, -1451, 1317, -1475, 1338, -1496, 1357, -1519, 1377, -1540, 1396, -1564,
+    1417, -1585, 1437, -1607, 1454, -1631, 1476, -1652, 1495, -1675, 1515, -1697, 1534, -1718, 1552, -1741,
+    1572, -1760, 1589, -1782, 1606, -1801, 1624, -1820, 1641, -1841, 1657, -1858, 1672, -1877, 1689, -1894,
+    1702, -1911, 1719, -1929, 1732, -1944, 1745, -1961, 1760, -1976, 1771, -1991, 1785, -2005, 1799, -2020,
+    1808, -2033, 1820, -2046, 1832, -2059, 1841, -2071, 1853, -2084, 1862, -2094, 1871, -2106, 1880, -2115,
+    1887, -2125, 1897, -2136, 1904, -2144, 1913, -2153, 1917, -2161, 1925, -2170, 1931, -2176, 1936, -2182,
+    1942, -2190, 1947, -2196, 1952, -2201, 1955, -2205, 1959, -2211, 1962, -2215, 1965, -2218, 1969, -2223,
+    1970, -2224, 1971, -2227, 1973, -2229, 1973, -2230, 1975, -2231, 1973, -2232, 1975, -2233, 1973, -2231,
+    1973, -2232, 1972, -2231, 1971, -2231, 1971, -2230, 1970, -2231, 1970, -2230, 1968, -2230, 1969, -2230,
+    1967, -2229, 1967, -2230, 1965, -2228, 1966, -2228, 1965, -2229, 1964, -2228, 1964, -2228, 1962, -2227,
+    1963, -2227, 1961, -2227, 1961, -2226, 1959, -2226, 1961, -2227, 1957, -2226, 1959, -2225, 1958, -2225,
+    1956, -2225, 1957, -2225, 1955, -2224, 1955, -2224, 1954, -2223, 1953, -2224, 1954, -2224, 1952, -2223,
+    1953, -2223, 1950, -2223, 1950, -2223, 1951, -2222, 1949, -2223, 1949, -2222, 1948, -2222, 1948, -2220,
+    1946, -2222, 1947, -2221, 1946, -2221, 1944, -2220, 1945, -2221, 1944, -2220, 1943, -2219, 1943, -2221,
+    1941, -2218, 1941, -2220, 1941, -2220, 1940, -2218, 1940, -2219, 1938, -2218, 1940, -2218, 1937, -2218,
+    1937, -2218, 1936, -2218, 1937, -2217, 1934, -2218, 1935, -2216, 1934, -2217, 1934, -2217, 1932, -2216,
+    1932, -2216, 1932, -2216, 1931, -2216, 1931, -2216, 1930, -2216, 1929, -2215, 1929, -2215, 1929, -2214,
+    1927, -2216, 1927, -2215, 1926, -2214, 1926, -2214, 1926, -2215, 1924, -2213, 1924, -2214, 1923, -2214,
+    1924, -2213, 1922, -2214, 1923, -2213, 1920, -2214, 1923, -2213, 1919, -2212, 1919, -2213, 1920, -2212,
+    1918, -2213, 1918, -2212, 1919, -2212, 1915, -2213, 1918, -2211, 1916, -2212, 1915, -2212, 1915, -2212,
+    1914, -2211, 1914, -2212, 1913, -2210, 1912, -2211, 1913, -2211, 1911, -2211, 1910, -2211, 1912, -2211,
+    1910, -2210, 1909, -2210, 1909, -2211, 1909, -2210, 1908, -2211, 1907, -2210, 1907, -2210, 1907, -2209,
+    1905, -2211, 1905, -2209, 1905, -2210, 1905, -2209, 1903, -2210, 1903, -2209, 1903, -2209, 1903, -2209,
+    1901, -2210, 1902, -2208, 1900, -2210, 1900, -2208, 1900, -2210, 1899, -2208, 1899, -2209, 1898, -2209,
+    1897, -2208, 1898, -2209, 1896, -2208, 1897, -2209, 1897, -2209, 1894, -2207, 1894, -2208, 1895, -2208,
+    1894, -2209, 1893, -2207, 1892, -2209, 1891, -2207, 1892, -2208, 1891, -2208, 1891, -2208, 1891, -2207,
+    1889, -2207, 1889, -2208, 1889, -2207, 1887, -2207, 1888, -2207, 1886, -2208, 1888, -2207, 1886, -2208,
+    1886, -2207, 1885, -2207, 1885, -2207, 1884, -2207, 1884, -2208, 1883, -2206, 1884, -2207, 1882, -2208,
+    1882, -2207, 1881, -2207, 1881, -2208, 1881, -2206, 1880, -2208, 1880, -2207, 1879, -2208, 1880, -2206,
+    1878, -2208, 1878, -2207, 1876, -2207, 1879, -2208, 1876, -2207, 1876, -2207, 1876, -2207, 1876, -2208,
+    1874, -2207, 1875, -2208, 1873, -2207, 1874, -2207, 1872, -2209, 1874, -2207, 1871, -2207, 1872, -2208,
+    1872, -2206, 1870, -2209, 1870, -2207, 1870, -2208, 1869, -2206, 1869, -2208, 1870, -2208, 1867, -2208,
+    1868, -2207, 1867, -2208, 1867, -2207, 1866, -2209, 1866, -2207, 1866, -2208, 1865, -2208, 1864, -2209,
+    1865, -2208, 1863, -2207, 1864, -2209, 1862, -2208, 1864, -2209, 1862, -2208, 1861, -2208, 1861, -2209,
+    1862, -2209, 1861, -2208, 1859, -2209, 1861, -2209, 1859, -2210, 1859, -2209, 1858, -2209, 1859, -2209,
+    1856, -2210, 1858, -2209, 1857, -2209, 1857, -2210, 1855, -2210, 1855, -2209, 1856, -2210, 1855, -2210,
+    1854, -2210, 1855, -2210, 1853, -2211, 1854, -2210, 1853, -2211, 1853, -2210, 1852, -2212, 1851, -2210,
+    1852, -2211, 1850, -2211, 1852, -2212, 1849, -2211, 1850, -2212, 1849, -2211, 1850, -2212, 1849, -2212,
+    1848, -2212, 1848, -2213, 1848, -2212, 1847, -2212, 1847, -2212, 1846, -2214, 1846, -2212, 1846, -2213,
+    1846, -2214, 1844, -2213, 1846, -2213, 1844, -2215, 1843, -2213, 1844, -2214, 1842, -2214, 1844, -2214,
+    1843, -2215, 1841, -2215, 1842, -2214, 1842, -2215, 1841, -2216, 1840, -2214, 1841, -2216, 1840, -2216,
+    1839, -2215, 1839, -2217, 1840, -2216, 1838, -2216, 1839, -2217, 1837, -2217, 1839, -2217, 1836, -2217,
+    1837, -2217, 1837, -2218, 1835, -2217, 1836, -2219, 1836, -2218, 1835, -2218, 1834, -2218, 1836, -2219,
+    1834, -2220, 1833, -2218, 1834, -2220, 1833, -2220, 1834, -2219, 1831, -2221, 1833, -2220, 1833, -2220,
+    1829, -2221, 1833, -2221, 1831, -2221, 1830, -2222, 1830, -2221, 1829, -2223, 1830, -2221, 1830, -2222,
+    1829, -2224, 1828, -2223, 1829, -2223, 1828, -2223, 1829, -2224, 1827, -2223, 1826, -2224, 1827, -2225,
+    1827, -2225, 1826, -2224, 1826, -2226, 1825, -2225, 1825, -2225, 1825, -2226, 1825, -2227, 1824, -2227,
+    1824, -2226, 1824, -2227, 1823, -2228, 1824, -2226, 1823, -2229, 1822, -2228, 1821, -2228, 1823, -2229,
+    1821, -2229, 1823, -2230, 1821, -2230, 1820, -2229, 1820, -2231, 1821, -2230, 1820, -2231, 1819, -2231,
+    1820, -2231, 1819, -2232, 1818, -2232, 1818, -2232, 1820, -2232, 1817, -2234, 1817, -2232, 1818, -2235,
+    1817, -2234, 1817, -2234, 1816, -2234, 1816, -2235, 1817, -2235, 1815, -2236, 1816, -2236, 1816, -2236,
+    1813, -2237, 1816, -2236, 1814, -2238, 1813, -2237, 1814, -2238, 1814, -2238, 1814, -2239, 1813, -2239,
+    1812, -2239, 1812, -2239, 1813, -2241, 1812, -2241, 1813, -2241, 1810, -2241, 1812, -2241, 1811, -2242,
+    1811, -2243, 1810, -2242, 1811, -2243, 1810, -2243, 1808, -2245, 1811, -2243, 1809, -2245, 1808, -2244,
+    1810, -2246, 1808, -2245, 1808, -2247, 1809, -2247, 1806, -2247, 1809, -2247, 1806, -2247, 1808, -2249,
+    1807, -2248, 1807, -2249, 1806, -2249, 1805, -2250, 1807, -2250, 1806, -2251, 1804, -2251, 1806, -2252,
+    1805, -2251, 1805, -2252, 1804, -2253, 1805, -2253, 1804, -2254, 1804, -2254, 1803, -2254, 1803, -2256,
+    1804, -2255, 1803, -2256, 1803, -2256, 1803, -2257, 1802, -2257, 1802, -2258, 1801, -2258, 1802, -2258,
+    1801, -2259, 1801, -2260, 1803, -2259, 1799, -2261, 1802, -2260, 1800, -2262, 1800, -2261, 1800, -2263,
+    1801, -2262, 1798, -2263, 1801, -2265, 1797, -2264, 1800, -2265, 1798, -2265, 1800, -2266, 1798, -2265,
+    1798, -2267, 1798, -2268, 1797, -2267, 1798, -2268, 1798, -2269, 1797, -2270, 1797, -2269, 1797, -2270,
+    1798, -2271, 1795, -2271, 1796, -2272, 1796, -2273, 1796, -2272, 1796, -2273, 1796, -2274, 1796, -2275,
+    1794, -2274, 1795, -2276, 1795, -2276, 1794, -2276, 1795, -2278, 1794, -2277, 1794, -2278, 1795, -2280,
+    1794, -2279, 1793, -2280, 1793, -2279, 1793, -2282, 1794, -2281, 1793, -2283, 1792, -2282, 1792, -2284,
+    1793, -2283, 1793, -2285, 1792, -2285, 1791, -2285, 1792, -2287, 1792, -2287, 1791, -2287, 1792, -2288,
+    1790, -2288, 1792, -2290, 1791, -2289, 1791, -2290, 1790, -2292, 1791, -2291, 1789, -2293, 1791, -2292,
+    1789, -2293, 1791, -2295, 1789, -2294, 1790, -2295, 1789, -2297, 1788, -2296, 1789, -2298, 1789, -2297,
+    1789, -2299, 1789, -2298, 1789, -2300, 1788, -2300, 1788, -2301, 1787, -2302, 1789, -2303, 1789, -2303,
+    1787, -2303, 1786, -2304, 1789, -2305, 1787, -2305, 1787, -2308, 1787, -2306, 1787, -2308, 1787, -2308,
+    1787, -2309, 1787, -2310, 1786, -2310, 1786, -2311, 1786, -2312, 1786, -2312, 1787, -2313, 1785, -2314,
+    1785, -2315, 1786, -2315, 1786, -2316, 1785, -2316, 1785, -2317, 1785, -2319, 1785, -2318, 1785, -2320,
+    1786, -2320, 1785, -2321, 1783, -2322, 1785, -2322, 1784, -2324, 1785, -2323, 1783, -2325, 1785, -2325,
+    1783, -2326, 1784, -2327, 1785, -2328, 1783, -2328, 1783, -2329, 1784, -2329, 1783, -2331, 1783, -2332,
+    1784, -2331, 1781, -2332, 1782, -2331, 1780, -2330, 1778, -2329, 1774, -2327, 1774, -2324, 1771, -2322,
+    1767, -2319, 1764, -2315, 1760, -2310, 1755, -2306, 1751, -2300, 1747, -2295, 1741, -2289, 1735, -2283,
+    1729, -2275, 1723, -2268, 1715, -2259, 1710, -2251, 1701, -2243, 1694, -2233, 1686, -2223, 1676, -2213,
+    1669, -2202, 1658, -2190, 1651, -2178, 1638, -2167, 1630, -2153, 1618, -2141, 1608, -2126, 1597, -2113,
+    1585, -2097, 1572, -2082, 1560, -2066, 1548, -2051, 1534, -2034, 1522, -2017, 1506, -1999, 1493, -1981,
+    1479, -1962, 1463, -1943, 1449, -1924, 1432, -1903, 1417, -1883, 1401, -1862, 1383, -1841, 1367, -1818,
+    1349, -1796, 1332, -1772, 1314, -1750, 1297, -1727, 1278, -1702, 1260, -1681, 1243, -1656, 1225, -1634,
+    1207, -1609, 1189, -1588, 1171, -1563, 1154, -1540, 1136, -1517, 1118, -1493, 1100, -1470, 1083, -1446,
+    1065, -1423, 1046, -1400, 1030, -1375, 1009, -1353, 994, -1329, 976, -1306, 958, -1282, 940, -1258,
+    922, -1235, 904, -1211, 887, -1188, 868, -1164, 850, -1140, 835, -1117, 814, -1094, 797, -1069,
+    781, -1046, 761, -1022, 745, -999, 726, -974, 709, -951, 690, -927, 673, -904, 656, -880,
+    637, -856, 619, -832, 602, -808, 584, -784, 566, -761, 547, -738, 532, -713, 512, -689,
+    495, -666, 478, -642, 459, -617, 442, -594, 424, -571, 406, -546, 390, -525, 374, -503,
+    357, -481, 342, -459, 326, -440, 311, -418, 297, -400, 282, -379, 268, -361, 254, -342,
+    241, -325, 228, -307, 217, -291, 202, -274, 192, -258, 181, -243, 168, -227, 159, -213,
+    147, -199, 138, -185, 127, -173, 119, -159, 110, -148, 101, -136, 92, -124, 85, -114,
+    77, -104, 70, -94, 63, -84, 56, -76, 51, -69, 43, -59, 39, -52, 34, -47,
+    30, -39, 24, -33, 22, -27, 16, -24, 14, -18, 11, -15, 7, -11, 7, -7,
+    4, -6, 1, -3, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    2, 2, 2, 5, 2, 8, 5, 11, 6, 16, 8, 22, 11, 26, 13, 35,
+    17, 42, 19, 50, 24, 58, 26, 70, 32, 79, 35, 91, 40, 103, 45, 115,
+    50, 130, 55, 143, 63, 159, 68, 175, 73, 192, 83, 208, 88, 227, 94, 246,
+    104, 266, 111, 285, 120, 307, 127, 328, 138, 352, 145, 375, 155, 399, 166, 424,
+    173, 449, 186, 476, 196, 504, 206, 531, 217, 559, 229, 590, 240, 619, 254, 650,
+    264, 682, 277, 714, 290, 748, 304, 781, 315, 816, 330, 852, 345, 887, 358, 925,
+    373, 962, 387, 1000, 402, 1037, 416, 1074, 430, 1112, 445, 1151, 459, 1188, 473, 1225,
+    488, 1262, 502, 1300, 517, 1338, 530, 1375, 545, 1412, 559, 1450, 573, 1487, 588, 1525,
+    600, 1563, 617, 1599, 629, 1637, 643, 1674, 658, 1711, 671, 1750, 686, 1785, 699, 1823,
+    714, 1861, 727, 1898, 741, 1935, 753, 1972, 769, 2009, 783, 2046, 795, 2083, 809, 2121,
+    823, 2157, 837, 2195, 849, 2231, 864, 2267, 876, 2305, 888, 2338, 903, 2373, 912, 2408,
+    925, 2439, 937, 2472, 948, 2504, 958, 2533, 969, 2563, 979, 2592, 988, 2620, 998, 2648,
+    1008, 2675, 1016, 2700, 1025, 2725, 1032, 2750, 1041, 2773, 1049, 2795, 1055, 2819, 1064, 2839,
+    1068, 2860, 1077, 2879, 1081, 2899, 1087, 2916, 1094, 2934, 1097, 2951, 1103, 2966, 1107, 2982,
+    1112, 2995, 1115, 3011, 1119, 3022, 1124, 3035, 1125, 3046, 1128, 3056, 1132, 3067, 1131, 3076,
+    1136, 3083, 1137, 3092, 1136, 3099, 1140, 3104, 1140, 3110, 1139, 3114, 1141, 3119, 1140, 3121,
+    1139, 3124, 1140, 3126, 1137, 3126, 1138, 3126, 1136, 3126, 1132, 3125, 1133, 3123, 1130, 3119,
+    1126, 3117, 1124, 3112, 1121, 3107, 1118, 3101, 1115, 3095, 1110, 3088, 1106, 3079, 1103, 3071,
+    1098, 3062, 1093, 3052, 1088, 3041, 1082, 3029, 1077, 3017, 1071, 3004, 1065, 2990, 1058, 2976,
+    1053, 2961, 1046, 2945, 1037, 2927, 1032, 2912, 1023, 2893, 1017, 2874, 1007, 2855, 1000, 2834,
+    992, 2813, 983, 2793, 974, 2769, 965, 2748, 955, 2722, 947, 2699, 936, 2673, 926, 2648,
+    917, 2621, 905, 2594, 894, 2565, 884, 2538, 874, 2508, 861, 2477, 851, 2447, 840, 2416,
+    825, 2383, 815, 2350, 802, 2317, 790, 2283, 777, 2247, 762, 2212, 752, 2175, 738, 2139,
+    723, 2101, 711, 2066, 699, 2028, 683, 1991, 672, 1955, 657, 1918, 646, 1881, 632, 1845,
+    619, 1807, 606, 1771, 593, 1736, 580, 1698, 568, 1661, 555, 1626, 540, 1588, 530, 1552,
+    516, 1515, 503, 1479, 492, 1443, 478, 1406, 465, 1369, 453, 1334, 440, 1297, 428, 1260,
+    415, 1225, 403, 1188, 390, 1151, 378, 1115, 365, 1079, 353, 1043, 340, 1006, 328, 970,
+    316, 935, 303, 897, 291, 862, 279, 827, 268, 793, 256, 759, 246, 726, 233, 694,
+    223, 663, 213, 633, 204, 602, 193, 573, 183, 544, 174, 517, 165, 491, 156, 463,
+    148, 439, 139, 412, 131, 390, 122, 366, 117, 344, 107, 320, 101, 300, 94, 280,
+    87, 260, 82, 241, 75, 223, 69, 205, 63, 188, 58, 171, 52, 157, 47, 142,
+    44, 128, 38, 115, 34, 102, 31, 90, 27, 79, 22, 69, 21, 59, 17, 51,
+    14, 42, 12, 35, 9, 28, 7, 22, 6, 16, 4, 13, 3, 8, 2, 6,
+    0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 4,
+    0, 7, 0, 10, 0, 15, 0, 19, 0, 24, 0, 31, 1, 37, -1, 46,
+    0, 53, 0, 62, 0, 71, 0, 82, 0, 92, 0, 105, 0, 116, 0, 129,
+    0, 143, 0, 158, 0, 171, 0, 188, 0, 204, -1, 221, 0, 239, 0, 257,
+    -1, 276, 0, 295, 0, 317, 0, 337, 0, 359, -1, 381, 0, 404, -1, 428,
+    0, 453, -1, 478, 0, 503, -1, 530, -1, 557, -2, 585, -1, 613, -1, 643,
+    -1, 671, -1, 703, -1, 734, -2, 765, -4, 799, -1, 831, -2, 865, -2, 898,
+    -4, 933, -2, 966, -4, 1000, -4, 1034, -4, 1067, -4, 1101, -5, 1135, -4, 1168,
+    -5, 1203, -6, 1235, -6, 1269, -7, 1303, -7, 1336, -7, 1371, -8, 1403, -9, 1436,
+    -9, 1471, -9, 1504, -11, 1537, -10, 1571, -11, 1604, -13, 1637, -13, 1671, -14, 1704,
+    -14, 1737, -15, 1770, -15, 1803, -17, 1838, -18, 1870, -19, 1903, -20, 1936, -19, 1969,
+    -22, 2003, -23, 2035, -24, 2068, -24, 2101, -26, 2134, -27, 2167, -28, 2200, -29, 2232,
+    -31, 2265, -31, 2299, -34, 2330, -35, 2364, -35, 2396, -38, 2428, -39, 2462, -41, 2492,
+    -43, 2527, -43, 2559, -45, 2591, -49, 2623, -48, 2655, -51, 2689, -53, 2719, -53, 2753,
+    -58, 2784, -57, 2817, -61, 2849, -62, 2881, -64, 2912, -67, 2945, -68, 2976, -72, 3008,
+    -73, 3041, -76, 3072, -78, 3103, -81, 3136, -82, 3167, -86, 3199, -88, 3230, -91, 3261,
+    -93, 3294, -96, 3324, -100, 3356, -102, 3387, -103, 3418, -108, 3450, -111, 3481, -114, 3512,
+    -117, 3543, -119, 3574, -123, 3605, -127, 3636, -129, 3666, -134, 3699, -136, 3728, -141, 3759,
+    -144, 3790, -146, 3821, -152, 3851, -155, 3881, -157, 3912, -163, 3943, -167, 3972, -170, 4003,
+    -174, 4034, -179, 4064, -182, 4094, -187, 4124, -192, 4154, -194, 4184, -201, 4214, -204, 4243,
+    -209, 4275, -214, 4303, -218, 4333, -224, 4364, -227, 4392, -233, 4423, -237, 4451, -243, 4482,
+    -248, 4510, -251, 4540, -258, 4569, -263, 4599, -270, 4628, -274, 4657, -280, 4686, -284, 4715,
+    -291, 4744, -297, 4773, -301, 4803, -309, 4830, -314, 4860, -320, 4889, -326, 4917, -332, 4945,
+    -339, 4974, -343, 5003, -352, 5032, -356, 5059, -364, 5088, -371, 5116, -377, 5144, -384, 5173,
+    -390, 5201, -396, 5227, -404, 5254, -412, 5280, -417, 5305, -425, 5330, -431, 5353, -439, 5375,
+    -446, 5398, -451, 5421, -459, 5441, -466, 5461, -473, 5482, -479, 5499, -488, 5520, -493, 5536,
+    -501, 5553, -506, 5569, -516, 5586, -521, 5601, -528, 5615, -535, 5628, -542, 5642, -549, 5655,
+    -555, 5666, -562, 5677, -570, 5688, -574, 5698, -584, 5707, -589, 5716, -596, 5725, -602, 5731,
+    -609, 5738, -616, 5744, -621, 5751, -629, 5754, -633, 5759, -641, 5763, -647, 5765, -653, 5769,
+    -659, 5770, -665, 5771, -673, 5772, -676, 5772, -683, 5771, -689, 5771, -695, 5769, -700, 5765,
+    -705, 5764, -711, 5759, -716, 5755, -722, 5752, -728, 5748, -732, 5744, -739, 5740, -743, 5737,
+    -749, 5732, -754, 5729, -759, 5725, -765, 5722, -770, 5718, -776, 5714, -781, 5711, -786, 5707,
+    -791, 5703, -796, 5698, -803, 5693, -807, 5689, -811, 5681, -817, 5675, -821, 5668, -824, 5660,
+    -831, 5651, -834, 5642, -839, 5632, -843, 5622, -846, 5612, -851, 5599, -855, 5588, -858, 5575,
+    -862, 5562, -864, 5550, -869, 5533, -871, 5520, -874, 5504, -876, 5488, -881, 5472, -883, 5454,
+    -885, 5437, -887, 5419, -889, 5400, -891, 5381, -894, 5361, -895, 5340, -897, 5319, -897, 5298,
+    -899, 5277, -900, 5253, -901, 5231, -902, 5206, -903, 5182, -902, 5157, -904, 5132, -904, 5106,
+    -903, 5079, -902, 5053, -903, 5025, -902, 4997, -902, 4969, -899, 4938, -901, 4909, -897, 4879,
+    -897, 4849, -895, 4817, -893, 4785, -892, 4753, -889, 4723, -887, 4690, -885, 4659, -883, 4627,
+    -881, 4597, -879, 4564, -875, 4534, -875, 4502, -871, 4471, -869, 4440, -866, 4409, -863, 4377,
+    -861, 4348, -858, 4315, -856, 4285, -851, 4253, -850, 4224, -846, 4192, -842, 4160, -840, 4130,
+    -838, 4100, -833, 4070, -829, 4038, -827, 4008, -823, 3976, -819, 3947, -815, 3916, -813, 3886,
+    -809, 3855, -803, 3824, -801, 3795, -797, 3763, -794, 3733, -788, 3704, -785, 3673, -780, 3642,
+    -777, 3613, -773, 3582, -768, 3552, -764, 3522, -759, 3491, -755, 3463, -751, 3431, -746, 3402,
+    -742, 3372, -737, 3341, -733, 3312, -727, 3283, -722, 3250, -719, 3223, -713, 3192, -707, 3162,
+    -704, 3132, -699, 3103, -693, 3073, -688, 3043, -683, 3014, -678, 2984, -673, 2953, -668, 2924,
+    -662, 2896, -656, 2865, -652, 2835, -647, 2806, -640, 2777, -635, 2746, -631, 2717, -623, 2688,
+    -618, 2658, -614, 2629, -607, 2600, -601, 2570, -596, 2540, -591, 2511, -584, 2482, -578, 2451,
+    -572, 2423, -567, 2394, -560, 2364, -555, 2334, -548, 2306, -543, 2277, -536, 2247, -531, 2217,
+    -523, 2188, -518, 2160, -512, 2130, -506, 2100, -499, 2072, -493, 2043, -487, 2013, -480, 1983,
+    -474, 1955, -468, 1925, -460, 1897, -455, 1867, -447, 1839, -443, 1809, -435, 1780, -428, 1751,
+    -420, 1721, -416, 1693, -409, 1664, -402, 1635, -395, 1605, -389, 1577, -381, 1547, -375, 1519,
+    -368, 1489, -362, 1461, -355, 1432, -347, 1402, -341, 1373, -335, 1346, -327, 1315, -320, 1286,
+    -314, 1258, -306, 1229, -299, 1199, -293, 1172, -285, 1141, -278, 1113, -272, 1084, -265, 1055,
+    -257, 1026, -249, 998, -244, 969, -236, 940, -229, 910, -222, 882, -215, 852, -206, 825,
+    -201, 795, -194, 766, -185, 738, -179, 709, -172, 679, -166, 653, -157, 626, -152, 598,
+    -145, 573, -138, 548, -132, 522, -127, 499, -120, 474, -115, 451, -107, 429, -104, 407,
+    -98, 385, -92, 366, -88, 344, -82, 326, -78, 305, -72, 287, -68, 269, -66, 252,
+    -58, 235, -57, 220, -51, 202, -48, 189, -45, 174, -40, 160, -37, 146, -34, 134,
+    -32, 123, -28, 110, -26, 99, -21, 89, -21, 79, -17, 69, -16, 61, -12, 52,
+    -12, 46, -11, 39, -8, 31, -6, 27, -4, 21, -5, 15, -3, 12, -3, 9,
+    -1, 6, -1, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    -2, -2, -3, -2, -6, -5, -7, -7, -10, -9, -13, -13, -17, -16, -22, -20,
+    -26, -25, -32, -29, -37, -35, -43, -41, -51, -47, -57, -54, -64, -61, -74, -69,
+    -82, -76, -91, -85, -101, -94, -109, -104, -122, -112, -131, -125, -143, -134, -156, -145,
+    -168, -157, -180, -169, -194, -182, -208, -194, -222, -208, -236, -222, -253, -236, -268, -251,
+    -285, -266, -300, -282, -319, -297, -336, -315, -354, -331, -373, -349, -392, -366, -411, -386,
+    -431, -403, -452, -423, -474, -442, -495, -463, -517, -483, -539, -504, -562, -525, -585, -547,
+    -610, -570, -633, -592, -658, -614, -681, -636, -706, -658, -729, -681, -753, -702, -779, -726,
+    -801, -747, -826, -769, -849, -792, -874, -815, -897, -835, -922, -859, -946, -880, -968, -902,
+    -996, -925, -1017, -947, -1042, -969, -1067, -990, -1089, -1013, -1114, -1036, -1140, -1057, -1162, -1080,
+    -1187, -1101, -1210, -1123, -1236, -1145, -1259, -1167, -1283, -1190, -1308, -1212, -1331, -1234, -1358, -1254,
+    -1380, -1278, -1404, -1299, -1430, -1321, -1453, -1342, -1477, -1365, -1502, -1387, -1527, -1407, -1551, -1431,
+    -1575, -1452, -1599, -1473, -1624, -1495, -1648, -1518, -1673, -1539, -1696, -1560, -1723, -1582, -1745, -1604,
+    -1770, -1626, -1795, -1647, -1819, -1669, -1845, -1689, -1867, -1711, -1890, -1730, -1912, -1751, -1936, -1770,
+    -1957, -1788, -1977, -1807, -1999, -1825, -2019, -1842, -2040, -1859, -2057, -1876, -2078, -1891, -2096, -1908,
+    -2112, -1922, -2133, -1938, -2147, -1951, -2164, -1966, -2181, -1978, -2197, -1992, -2211, -2003, -2226, -2016,
+    -2242, -2027, -2253, -2038, -2268, -2049, -2279, -2059, -2293, -2069, -2305, -2077, -2315, -2087, -2327, -2095,
+    -2336, -2103, -2347, -2110, -2356, -2118, -2365, -2123, -2374, -2131, -2382, -2135, -2388, -2141, -2396, -2145,
+    -2403, -2150, -2408, -2154, -2415, -2157, -2419, -2160, -2424, -2162, -2427, -2165, -2432, -2167, -2434, -2167,
+    -2439, -2169, -2439, -2168, -2441, -2169, -2443, -2167, -2442, -2168, -2444, -2167, -2445, -2164, -2445, -2165,
+    -2447, -2163, -2447, -2163, -2447, -2162, -2448, -2160, -2449, -2160, -2450, -2158, -2449, -2158, -2451, -2157,
+    -2453, -2155, -2451, -2156, -2453, -2153, -2454, -2152, -2455, -2153, -2454, -2150, -2456, -2150, -2457, -2149,
+    -2456, -2148, -2458, -2146, -2458, -2146, -2459, -2145, -2459, -2144, -2460, -2143, -2461, -2142, -2461, -2140,
+    -2463, -2140, -2462, -2139, -2464, -2137, -2464, -2137, -2465, -2136, -2465, -2136, -2467, -2133, -2467, -2134,
+    -2468, -2131, -2468, -2131, -2470, -2130, -2469, -2130, -2471, -2127, -2470, -2127, -2471, -2127, -2472, -2124,
+    -2474, -2124, -2474, -2123, -2473, -2122, -2475, -2121, -2476, -2120, -2476, -2119, -2476, -2118, -2476, -2117,
+    -2478, -2115, -2478, -2113, -2475, -2111, -2474, -2108, -2473, -2106, -2471, -2101, -2467, -2099, -2465, -2092,
+    -2461, -2089, -2455, -2083, -2453, -2078, -2444, -2071, -2441, -2065, -2433, -2059, -2427, -2051, -2419, -2043,
+    -2412, -2035, -2404, -2027, -2394, -2018, -2384, -2007, -2376, -1999, -2365, -1989, -2353, -1978, -2342, -1967,
+    -2331, -1955, -2318, -1944, -2305, -1931, -2292, -1920, -2277, -1905, -2263, -1893, -2249, -1879, -2231, -1865,
+    -2218, -1850, -2199, -1835, -2185, -1819, -2164, -1804, -2148, -1788, -2130, -1771, -2109, -1754, -2091, -1737,
+    -2070, -1719, -2050, -1701, -2028, -1682, -2008, -1663, -1984, -1645, -1962, -1624, -1939, -1604, -1916, -1583,
+    -1891, -1563, -1866, -1542, -1842, -1520, -1817, -1500, -1791, -1477, -1768, -1456, -1743, -1436, -1717, -1414,
+    -1694, -1393, -1668, -1372, -1644, -1351, -1618, -1329, -1594, -1310, -1567, -1287, -1545, -1267, -1520, -1245,
+    -1494, -1226, -1469, -1203, -1444, -1183, -1420, -1162, -1394, -1141, -1369, -1120, -1344, -1099, -1321, -1079,
+    -1295, -1057, -1269, -1037, -1244, -1016, -1219, -996, -1195, -974, -1170, -954, -1144, -933, -1120, -912,
+    -1094, -891, -1070, -871, -1043, -850, -1020, -830, -994, -808, -969, -789, -944, -767, -919, -747,
+    -894, -726, -869, -706, -842, -686, -820, -664, -792, -643, -769, -624, -743, -604, -718, -581,
+    -692, -562, -668, -542, -642, -520, -617, -502, -593, -479, -569, -461, -545, -441, -521, -423,
+    -500, -405, -477, -386, -455, -368, -434, -351, -413, -335, -394, -318, -373, -303, -354, -287,
+    -337, -272, -318, -257, -299, -243, -283, -229, -266, -215, -251, -202, -234, -190, -220, -177,
+    -204, -167, -192, -153, -176, -143, -164, -133, -152, -122, -139, -113, -128, -103, -116, -94,
+    -106, -86, -96, -78, -86, -69, -77, -62, -69, -56, -60, -49, -54, -43, -46, -37,
+    -39, -32, -33, -27, -29, -23, -21, -17, -19, -16, -13, -11, -12, -8, -8, -7,
+    -6, -4, -1, -2, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 2, -1,
+    3, -1, 6, -3, 9, -2, 10, -4, 16, -5, 21, -7, 25, -9, 31, -10,
+    38, -14, 44, -14, 51, -17, 59, -20, 66, -24, 77, -25, 86, -30, 96, -32,
+    107, -36, 118, -41, 129, -43, 143, -48, 156, -53, 167, -57, 182, -61, 198, -68,
+    212, -72, 228, -77, 244, -82, 262, -89, 277, -94, 298, -101, 315, -106, 334, -113,
+    353, -118, 375, -127, 395, -132, 416, -141, 438, -148, 460, -154, 485, -163, 507, -170,
+    532, -178, 557, -187, 580, -195, 609, -202, 634, -212, 662, -221, 689, -230, 717, -238,
+    745, -248, 773, -257, 802, -265, 831, -275, 858, -284, 886, -292, 916, -302, 943, -310,
+    972, -319, 1000, -327, 1028, -337, 1058, -345, 1086, -354, 1113, -362, 1142, -371, 1171, -379,
+    1198, -388, 1229, -396, 1257, -404, 1284, -413, 1314, -419, 1342, -429, 1370, -438, 1400, -445,
+    1428, -452, 1457, -460, 1485, -469, 1515, -476, 1542, -484, 1573, -492, 1600, -498, 1630, -506,
+    1659, -514, 1687, -521, 1717, -529, 1746, -535, 1774, -543, 1803, -550, 1834, -556, 1862, -563,
+    1890, -570, 1920, -577, 1950, -583, 1978, -590, 2009, -596, 2038, -602, 2066, -609, 2096, -614,
+    2126, -621, 2155, -627, 2183, -632, 2213, -638, 2240, -643, 2268, -647, 2294, -652, 2322, -657,
+    2346, -660, 2373, -665, 2395, -667, 2421, -671, 2444, -675, 2468, -677, 2491, -680, 2511, -682,
+    2534, -684, 2555, -686, 2574, -687, 2595, -689, 2614, -690, 2632, -691, 2652, -692, 2667, -692,
+    2686, -691, 2702, -693, 2718, -691, 2734, -692, 2748, -691, 2763, -690, 2776, -689, 2791, -688,
+    2802, -685, 2815, -686, 2826, -682, 2837, -681, 2848, -678, 2856, -676, 2868, -673, 2875, -671,
+    2884, -667, 2891, -665, 2898, -661, 2905, -657, 2910, -655, 2917, -650, 2920, -646, 2924, -642,
+    2929, -638, 2931, -633, 2933, -630, 2937, -625, 2937, -619, 2939, -616, 2940, -609, 2944, -607,
+    2943, -600, 2947, -597, 2949, -591, 2951, -588, 2952, -582, 2953, -577, 2956, -573, 2958, -568,
+    2960, -563, 2959, -558, 2965, -554, 2964, -549, 2967, -544, 2968, -539, 2971, -535, 2972, -529,
+    2974, -525, 2976, -520, 2977, -515, 2979, -511, 2982, -505, 2982, -500, 2986, -496, 2986, -491,
+    2988, -486, 2991, -480, 2991, -476, 2995, -471, 2997, -467, 2997, -460, 3001, -457, 3002, -452,
+    3004, -446, 3005, -441, 3006, -437, 3010, -432, 3012, -427, 3013, -420, 3015, -417, 3017, -411,
+    3018, -406, 3021, -402, 3021, -397, 3025, -391, 3026, -386, 3028, -381, 3030, -376, 3032, -371,
+    3033, -366, 3035, -361, 3038, -356, 3039, -350, 3040, -346, 3044, -340, 3044, -335, 3046, -330,
+    3048, -325, 3051, -320, 3052, -315, 3054, -308, 3056, -305, 3058, -298, 3060, -294, 3061, -289,
+    3063, -283, 3065, -278, 3067, -273, 3069, -268, 3071, -262, 3072, -257, 3077, -252, 3076, -246,
+    3077, -242, 3080, -236, 3082, -229, 3085, -226, 3085, -220, 3088, -215, 3090, -209, 3091, -204,
+    3094, -198, 3094, -193, 3097, -188, 3100, -183, 3101, -177, 3103, -172, 3105, -166, 3106, -161,
+    3108, -155, 3110, -150, 3112, -145, 3114, -139, 3116, -134, 3119, -129, 3119, -122, 3121, -117,
+    3124, -112, 3125, -106, 3127, -102, 3129, -95, 3131, -90, 3133, -84, 3135, -79, 3135, -73,
+    3139, -68, 3141, -62, 3140, -57, 3145, -51, 3146, -46, 3147, -39, 3149, -34, 3153, -29,
+    3152, -23, 3155, -18, 3156, -11, 3160, -7, 3160, 0, 3162, 4, 3164, 11, 3166, 16,
+    3167, 22, 3171, 28, 3171, 33, 3173, 39, 3176, 45, 3176, 51, 3179, 56, 3181, 62,
+    3181, 67, 3185, 73, 3186, 79, 3188, 85, 3189, 91, 3191, 95, 3194, 103, 3194, 107,
+    3196, 115, 3198, 118, 3200, 126, 3203, 130, 3203, 137, 3205, 143, 3207, 149, 3208, 153,
+    3211, 160, 3212, 166, 3214, 171, 3215, 178, 3218, 183, 3219, 190, 3221, 195, 3223, 201,
+    3225, 206, 3226, 214, 3227, 218, 3231, 225, 3232, 230, 3232, 237, 3236, 242, 3235, 248,
+    3239, 254, 3241, 261, 3241, 266, 3244, 272, 3244, 277, 3248, 284, 3248, 290, 3251, 296,
+    3252, 302, 3254, 308, 3255, 314, 3258, 319, 3258, 327, 3261, 332, 3261, 338, 3264, 343,
+    3266, 351, 3267, 355, 3268, 363, 3270, 367, 3272, 375, 3274, 380, 3274, 386, 3276, 392,
+    3277, 399, 3280, 405, 3281, 410, 3283, 417, 3284, 423, 3286, 428, 3288, 435, 3289, 441,
+    3289, 447, 3293, 453, 3294, 460, 3295, 465, 3296, 472, 3300, 478, 3300, 484, 3300, 490,
+    3303, 496, 3305, 502, 3306, 509, 3307, 515, 3309, 521, 3310, 527, 3313, 533, 3312, 539,
+    3315, 546, 3315, 552, 3318, 558, 3320, 564, 3321, 570, 3321, 577, 3323, 583, 3325, 588,
+    3327, 596, 3327, 601, 3330, 608, 3330, 614, 3333, 621, 3333, 626, 3334, 632, 3336, 639,
+    3338, 645, 3339, 652, 3339, 658, 3341, 664, 3343, 670, 3345, 676, 3345, 683, 3347, 689,
+    3347, 695, 3350, 701, 3351, 708, 3353, 715, 3352, 720, 3355, 727, 3355, 733, 3357, 739,
+    3357, 745, 3360, 752, 3361, 758, 3362, 765, 3364, 771, 3364, 777, 3365, 783, 3367, 790,
+    3367, 797, 3369, 802, 3370, 809, 3372, 814, 3373, 821, 3373, 828, 3375, 834, 3375, 841,
+    3377, 846, 3379, 853, 3380, 859, 3379, 866, 3381, 872, 3382, 879, 3384, 883, 3385, 893,
+    3385, 896, 3387, 904, 3388, 910, 3387, 917, 3392, 922, 3389, 929, 3393, 936, 3391, 941,
+    3393, 949, 3396, 954, 3396, 962, 3394, 967, 3399, 973, 3398, 980, 3398, 986, 3401, 992,
+    3402, 1000, 3401, 1005, 3402, 1012, 3404, 1017, 3404, 1025, 3405, 1030, 3406, 1038, 3406, 1043,
+    3408, 1050, 3408, 1057, 3409, 1062, 3411, 1068, 3411, 1075, 3411, 1082, 3412, 1088, 3413, 1094,
+    3414, 1101, 3414, 1106, 3414, 1114, 3416, 1119, 3416, 1127, 3418, 1132, 3417, 1138, 3417, 1145,
+    3420, 1151, 3420, 1158, 3420, 1164, 3420, 1171, 3421, 1176, 3423, 1183, 3422, 1189, 3423, 1196,
+    3423, 1202, 3425, 1209, 3423, 1213, 3422, 1220, 3421, 1225, 3419, 1231, 3414, 1236, 3410, 1240,
+    3406, 1245, 3402, 1248, 3395, 1253, 3389, 1256, 3381, 1260, 3372, 1262, 3364, 1265, 3355, 1268,
+    3345, 1269, 3334, 1271, 3322, 1272, 3310, 1274, 3296, 1275, 3283, 1273, 3268, 1275, 3255, 1274,
+    3238, 1273, 3221, 1274, 3205, 1270, 3186, 1270, 3168, 1266, 3148, 1265, 3128, 1262, 3108, 1259,
+    3087, 1255, 3064, 1250, 3042, 1247, 3018, 1241, 2994, 1237, 2969, 1230, 2943, 1224, 2917, 1219,
+    2890, 1211, 2863, 1204, 2834, 1196, 2806, 1188, 2775, 1180, 2745, 1170, 2714, 1162, 2683, 1151,
+    2648, 1141, 2617, 1130, 2582, 1120, 2548, 1108, 2514, 1097, 2480, 1084, 2444, 1072, 2410, 1060,
+    2377, 1049, 2342, 1036, 2307, 1025, 2274, 1010, 2238, 998, 2204, 986, 2168, 973, 2136, 960,
+    2101, 948, 2067, 933, 2032, 919, 1997, 907, 1964, 893, 1929, 880, 1894, 866, 1860, 850,
+    1826, 838, 1791, 825, 1757, 808, 1722, 796, 1689, 781, 1653, 767, 1619, 751, 1585, 737,
+    1551, 722, 1516, 709, 1481, 693, 1448, 677, 1413, 663, 1379, 648, 1345, 633, 1308, 617,
+    1277, 602, 1241, 586, 1207, 571, 1172, 556, 1139, 541, 1103, 523, 1071, 510, 1035, 492,
+    1001, 478, 966, 461, 932, 446, 897, 429, 864, 412, 830, 398, 797, 383, 764, 366,
+    730, 352, 700, 336, 670, 322, 640, 308, 610, 294, 581, 281, 554, 267, 526, 254,
+    501, 241, 473, 229, 450, 217, 424, 205, 401, 194, 376, 183, 356, 172, 333, 162,
+    312, 151, 294, 142, 271, 132, 253, 123, 235, 114, 218, 105, 200, 96, 183, 91,
+    170, 81, 153, 75, 139, 68, 127, 61, 113, 55, 102, 49, 90, 44, 78, 38,
+    69, 34, 60, 29, 49, 24, 43, 21, 36, 17, 29, 14, 23, 11, 17, 9,
+    13, 6, 9, 4, 5, 3, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, -2, -1, -3, -2, -8, -3, -10, -5, -15, -7, -19, -10, -25, -12,
+    -31, -14, -37, -18, -47, -22, -54, -25, -62, -30, -72, -35, -82, -39, -94, -45,
+    -105, -51, -118, -55, -130, -63, -144, -69, -160, -75, -174, -83, -189, -91, -206, -98,
+    -224, -106, -241, -115, -259, -124, -280, -134, -298, -142, -320, -152, -340, -162, -363, -173,
+    -386, -184, -408, -195, -432, -207, -458, -216, -482, -231, -510, -243, -535, -254, -563, -269,
+    -592, -281, -620, -295, -648, -310, -680, -323, -711, -338, -741, -353, -775, -368, -808, -384,
+    -840, -400, -875, -416, -909, -432, -944, -448, -978, -464, -1012, -481, -1045, -496, -1082, -513,
+    -1113, -529, -1150, -545, -1182, -561, -1217, -577, -1253, -593, -1285, -609, -1320, -624, -1354, -641,
+    -1388, -657, -1422, -672, -1457, -689, -1492, -704, -1523, -721, -1560, -736, -1592, -752, -1627, -768,
+    -1662, -783, -1695, -799, -1730, -814, -1764, -831, -1797, -846, -1832, -861, -1865, -877, -1899, -892,
+    -1934, -908, -1968, -923, -2001, -940, -2036, -955, -2069, -969, -2104, -986, -2138, -1000, -2170, -1015,
+    -2206, -1032, -2240, -1045, -2272, -1062, -2308, -1075, -2340, -1091, -2374, -1107, -2409, -1122, -2442, -1136,
+    -2476, -1151, -2510, -1167, -2545, -1180, -2576, -1196, -2612, -1211, -2645, -1225, -2679, -1240, -2711, -1255,
+    -2746, -1269, -2779, -1284, -2815, -1298, -2845, -1312, -2881, -1327, -2914, -1342, -2948, -1355, -2980, -1370,
+    -3015, -1384, -3048, -1398, -3082, -1412, -3114, -1427, -3149, -1440, -3182, -1455, -3215, -1468, -3249, -1482,
+    -3282, -1496, -3316, -1509, -3349, -1524, -3382, -1536, -3415, -1551, -3449, -1564, -3482, -1577, -3515, -1591,
+    -3548, -1605, -3582, -1616, -3615, -1631, -3647, -1643, -3681, -1658, -3713, -1669, -3748, -1683, -3780, -1697,
+    -3813, -1708, -3846, -1720, -3879, -1735, -3912, -1747, -3945, -1759, -3978, -1771, -4011, -1785, -4042, -1796,
+    -4077, -1810, -4109, -1821, -4141, -1833, -4175, -1845, -4207, -1858, -4240, -1870, -4273, -1880, -4305, -1893,
+    -4338, -1906, -4370, -1916, -4403, -1929, -4435, -1940, -4469, -1950, -4501, -1963, -4532, -1974, -4565, -1985,
+    -4597, -1996, -4631, -2007, -4661, -2018, -4695, -2030, -4727, -2040, -4759, -2050, -4791, -2062, -4824, -2072,
+    -4855, -2082, -4887, -2093, -4920, -2103, -4953, -2114, -4983, -2124, -5015, -2133, -5047, -2145, -5080, -2153,
+    -5111, -2163, -5144, -2173, -5174, -2183, -5206, -2193, -5239, -2202, -5270, -2211, -5302, -2221, -5333, -2230,
+    -5366, -2239, -5397, -2247, -5428, -2257, -5459, -2266, -5491, -2274, -5518, -2281, -5549, -2289, -5577, -2297,
+    -5604, -2305, -5631, -2309, -5658, -2316, -5683, -2322, -5708, -2327, -5733, -2333, -5756, -2337, -5779, -2342,
+    -5799, -2346, -5823, -2349, -5844, -2353, -5862, -2356, -5882, -2358, -5901, -2361, -5919, -2364, -5936, -2364,
+    -5952, -2367, -5969, -2367, -5984, -2368, -5999, -2368, -6012, -2369, -6025, -2368, -6039, -2368, -6048, -2367,
+    -6062, -2366, -6071, -2364, -6082, -2364, -6091, -2360, -6098, -2360, -6106, -2356, -6114, -2353, -6121, -2350,
+    -6125, -2347, -6131, -2343, -6136, -2339, -6139, -2334, -6144, -2331, -6145, -2326, -6145, -2320, -6149, -2315,
+    -6149, -2310, -6147, -2304, -6147, -2298, -6147, -2291, -6143, -2285, -6141, -2278, -6140, -2272, -6136, -2265,
+    -6134, -2258, -6132, -2252, -6129, -2245, -6126, -2238, -6125, -2231, -6122, -2226, -6119, -2217, -6116, -2212,
+    -6115, -2205, -6112, -2198, -6109, -2192, -6108, -2184, -6105, -2179, -6102, -2171, -6100, -2165, -6097, -2158,
+    -6095, -2152, -6093, -2144, -6091, -2138, -6087, -2133, -6086, -2124, -6082, -2119, -6081, -2111, -6079, -2105,
+    -6076, -2098, -6073, -2092, -6072, -2085, -6068, -2078, -6067, -2072, -6064, -2065, -6062, -2058, -6060, -2052,
+    -6056, -2045, -6055, -2038, -6051, -2032, -6051, -2026, -6048, -2018, -6045, -2012, -6042, -2005, -6041, -1999,
+    -6040, -1992, -6035, -1985, -6033, -1978, -6032, -1973, -6029, -1965, -6026, -1958, -6024, -1954, -6023, -1946,
+    -6019, -1938, -6018, -1932, -6015, -1926, -6014, -1920, -6011, -1912, -6008, -1906, -6006, -1899, -6003, -1893,
+    -6002, -1886, -5999, -1879, -5997, -1873, -5995, -1867, -5993, -1860, -5991, -1852, -5987, -1847, -5986, -1840,
+    -5983, -1833, -5983, -1827, -5978, -1820, -5977, -1814, -5975, -1807, -5973, -1800, -5971, -1793, -5968, -1789,
+    -5966, -1779, -5963, -1775, -5961, -1768, -5959, -1761, -5959, -1754, -5954, -1748, -5953, -1741, -5951, -1735,
+    -5948, -1728, -5946, -1721, -5945, -1715, -5942, -1710, -5941, -1701, -5938, -1697, -5935, -1688, -5934, -1683,
+    -5932, -1676, -5930, -1668, -5926, -1664, -5925, -1656, -5924, -1649, -5921, -1644, -5919, -1636, -5917, -1630,
+    -5915, -1624, -5913, -1617, -5911, -1611, -5908, -1604, -5907, -1598, -5905, -1591, -5901, -1584, -5902, -1578,
+    -5898, -1572, -5896, -1566, -5895, -1558, -5892, -1552, -5890, -1546, -5889, -1539, -5887, -1533, -5884, -1526,
+    -5883, -1520, -5880, -1513, -5879, -1507, -5876, -1500, -5875, -1495, -5873, -1487, -5871, -1481, -5868, -1475,
+    -5867, -1468, -5865, -1461, -5863, -1455, -5861, -1450, -5860, -1442, -5857, -1436, -5855, -1429, -5854, -1423,
+    -5853, -1417, -5848, -1410, -5848, -1404, -5846, -1397, -5845, -1391, -5841, -1385, -5841, -1378, -5839, -1372,
+    -5836, -1366, -5835, -1358, -5834, -1352, -5830, -1347, -5830, -1339, -5827, -1334, -5827, -1326, -5824, -1322,
+    -5823, -1314, -5820, -1308, -5818, -1301, -5817, -1295, -5816, -1288, -5813, -1283, -5811, -1276, -5811, -1270,
+    -5807, -1263, -5807, -1257, -5805, -1251, -5803, -1244, -5802, -1238, -5800, -1231, -5798, -1226, -5795, -1219,
+    -5795, -1213, -5793, -1206, -5791, -1200, -5789, -1193, -5788, -1187, -5787, -1181, -5784, -1176, -5784, -1167,
+    -5781, -1163, -5780, -1156, -5779, -1150, -5776, -1143, -5775, -1137, -5773, -1130, -5772, -1124, -5770, -1119,
+    -5770, -1112, -5766, -1105, -5766, -1099, -5765, -1094, -5762, -1086, -5761, -1081, -5759, -1074, -5758, -1069,
+    -5756, -1061, -5756, -1056, -5754, -1049, -5751, -1044, -5751, -1036, -5749, -1031, -5748, -1024, -5747, -1019,
+    -5744, -1011, -5744, -1006, -5741, -1000, -5740, -993, -5740, -987, -5737, -981, -5736, -975, -5735, -968,
+    -5733, -962, -5732, -956, -5728, -950, -5726, -943, -5722, -937, -5717, -930, -5712, -923, -5706, -916,
+    -5700, -910, -5694, -902, -5685, -895, -5680, -889, -5669, -881, -5660, -873, -5650, -867, -5641, -859,
+    -5629, -852, -5618, -844, -5604, -836, -5593, -829, -5580, -822, -5565, -814, -5550, -805, -5536, -798,
+    -5521, -791, -5503, -782, -5486, -774, -5469, -766, -5452, -759, -5431, -750, -5414, -742, -5393, -735,
+    -5372, -727, -5352, -717, -5329, -711, -5309, -702, -5285, -693, -5261, -686, -5237, -678, -5214, -669,
+    -5187, -662, -5162, -653, -5136, -644, -5110, -637, -5081, -629, -5053, -620, -5024, -612, -4995, -604,
+    -4965, -596, -4935, -587, -4904, -580, -4874, -572, -4841, -563, -4812, -556, -4780, -548, -4749, -540,
+    -4719, -533, -4688, -525, -4655, -518, -4627, -510, -4594, -504, -4564, -495, -4533, -490, -4502, -480,
+    -4473, -475, -4441, -468, -4410, -461, -4379, -454, -4349, -448, -4318, -441, -4288, -434, -4257, -428,
+    -4225, -422, -4195, -415, -4166, -409, -4134, -403, -4105, -397, -4071, -391, -4043, -385, -4011, -380,
+    -3982, -373, -3951, -366, -3921, -362, -3890, -357, -3858, -350, -3830, -345, -3798, -340, -3768, -335,
+    -3738, -328, -3706, -325, -3677, -318, -3645, -314, -3616, -309, -3585, -304, -3555, -299, -3524, -293,
+    -3495, -290, -3463, -284, -3433, -280, -3403, -276, -3373, -270, -3342, -266, -3312, -261, -3282, -258,
+    -3251, -253, -3221, -249, -3191, -244, -3160, -241, -3130, -236, -3099, -232, -3071, -228, -3039, -224,
+    -3009, -221, -2978, -216, -2949, -212, -2918, -210, -2889, -205, -2857, -202, -2827, -197, -2798, -195,
+    -2767, -191, -2736, -187, -2707, -184, -2677, -181, -2646, -177, -2616, -173, -2586, -171, -2555, -169,
+    -2526, -164, -2496, -161, -2464, -159, -2436, -155, -2405, -152, -2374, -149, -2344, -147, -2315, -143,
+    -2285, -141, -2254, -137, -2224, -135, -2193, -133, -2165, -130, -2133, -127, -2103, -124, -2074, -123,
+    -2043, -118, -2012, -117, -1984, -115, -1953, -112, -1923, -110, -1892, -107, -1863, -104, -1833, -102,
+    -1802, -101, -1772, -98, -1743, -96, -1711, -93, -1683, -91, -1651, -89, -1622, -88, -1591, -85,
+    -1562, -83, -1531, -81, -1502, -78, -1472, -78, -1441, -75, -1412, -73, -1380, -72, -1352, -68,
+    -1321, -68, -1291, -66, -1261, -63, -1231, -62, -1200, -60, -1171, -58, -1141, -57, -1111, -55,
+    -1080, -53, -1050, -52, -1020, -50, -990, -49, -962, -46, -929, -44, -901, -44, -870, -41,
+    -840, -41, -811, -39, -779, -37, -750, -36, -719, -33, -692, -33, -663, -31, -635, -31,
+    -607, -28, -582, -26, -553, -27, -530, -24, -503, -24, -480, -22, -457, -21, -433, -20,
+    -410, -19, -388, -17, -368, -18, -347, -16, -326, -15, -307, -14, -288, -13, -269, -13,
+    -251, -11, -236, -10, -218, -10, -203, -10, -187, -8, -173, -7, -158, -8, -145, -6,
+    -132, -7, -120, -4, -107, -6, -97, -4, -88, -3, -75, -4, -68, -3, -58, -3,
+    -50, -3, -44, -2, -36, -1, -31, -1, -23, -1, -20, -1, -14, -1, -11, 0,
+    -5, -1, -5, 0, -4, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1,
+    2, 0, 3, -1, 6, -2, 9, -3, 12, -5, 16, -5, 20, -7, 27, -9,
+    30, -10, 38, -13, 45, -15, 52, -17, 59, -21, 68, -23, 78, -27, 87, -29,
+    97, -32, 108, -37, 120, -41, 130, -44, 144, -49, 157, -53, 171, -58, 184, -63,
+    200, -68, 214, -72, 231, -78, 248, -84, 264, -89, 282, -96, 300, -101, 319, -108,
+    338, -114, 358, -121, 378, -128, 400, -134, 422, -142, 443, -149, 466, -156, 490, -165,
+    513, -173, 537, -180, 564, -188, 588, -197, 615, -206, 641, -214, 670, -224, 697, -231,
+    725, -241, 754, -250, 782, -261, 810, -268, 839, -278, 868, -287, 897, -295, 924, -304,
+    955, -315, 981, -322, 1012, -331, 1038, -340, 1068, -349, 1097, -357, 1125, -366, 1154, -375,
+    1182, -382, 1212, -392, 1240, -400, 1268, -408, 1298, -417, 1325, -424, 1355, -433, 1383, -441,
+    1412, -449, 1442, -458, 1468, -464, 1500, -473, 1527, -480, 1556, -489, 1586, -495, 1613, -503,
+    1644, -511, 1672, -518, 1699, -526, 1731, -533, 1759, -540, 1787, -546, 1817, -555, 1845, -560,
+    1875, -568, 1904, -575, 1932, -581, 1962, -587, 1991, -595, 2020, -600, 2050, -607, 2078, -613,
+    2107, -618, 2137, -626, 2167, -631, 2193, -636, 2224, -642, 2251, -646, 2277, -652, 2304, -656,
+    2330, -661, 2355, -664, 2381, -669, 2404, -672, 2428, -675, 2451, -678, 2475, -681, 2496, -683,
+    2517, -685, 2539, -689, 2559, -689, 2578, -691, 2599, -692, 2617, -694, 2634, -694, 2653, -694,
+    2670, -696, 2684, -695, 2703, -695, 2717, -695, 2732, -695, 2746, -693, 2761, -693, 2772, -691,
+    2787, -691, 2796, -688, 2810, -687, 2819, -685, 2831, -683, 2839, -681, 2849, -678, 2858, -675,
+    2864, -672, 2873, -671, 2879, -665, 2887, -664, 2892, -658, 2896, -657, 2901, -651, 2905, -648,
+    2910, -643, 2911, -640, 2913, -635, 2915, -629, 2917, -625, 2917, -621, 2918, -617, 2919, -611,
+    2922, -606, 2922, -601, 2922, -598, 2924, -592, 2925, -586, 2926, -583, 2927, -577, 2928, -573,
+    2930, -567, 2930, -563, 2931, -558, 2933, -554, 2933, -548, 2934, -543, 2937, -538, 2936, -533,
+    2938, -529, 2939, -523, 2940, -519, 2940, -514, 2941, -508, 2944, -504, 2944, -498, 2946, -494,
+    2945, -488, 2947, -483, 2948, -478, 2950, -473, 2952, -469, 2951, -463, 2952, -458, 2955, -453,
+    2955, -447, 2957, -443, 2957, -438, 2958, -432, 2961, -427, 2961, -421, 2961, -417, 2963, -411,
+    2964, -407, 2965, -400, 2966, -396, 2967, -390, 2969, -385, 2969, -380, 2970, -374, 2972, -368,
+    2973, -364, 2974, -358, 2975, -352, 2976, -348, 2978, -342, 2977, -336, 2980, -331, 2981, -326,
+    2981, -320, 2983, -314, 2983, -309, 2985, -304, 2986, -298, 2987, -292, 2988, -288, 2989, -280,
+    2991, -275, 2992, -270, 2992, -265, 2994, -258, 2995, -253, 2995, -247, 2997, -242, 2998, -235,
+    2999, -230, 3001, -225, 3001, -218, 3003, -211, 3003, -208, 3005, -200, 3006, -195, 3007, -190,
+    3008, -182, 3009, -178, 3010, -171, 3012, -165, 3012, -159, 3014, -153, 3015, -148, 3016, -140,
+    3016, -136, 3019, -128, 3018, -123, 3021, -118, 3021, -110, 3023, -104, 3023, -98, 3024, -92,
+    3026, -86, 3028, -78, 3027, -74, 3028, -67, 3031, -60, 3030, -54, 3033, -48, 3033, -41,
+    3034, -35, 3036, -28, 3037, -22, 3037, -16, 3038, -8, 3040, -3, 3040, 5, 3042, 11,
+    3042, 17, 3045, 24, 3045, 31, 3046, 39, 3047, 44, 3047, 50, 3050, 59, 3050, 64,
+    3050, 72, 3053, 78, 3052, 85, 3055, 93, 3055, 99, 3055, 106, 3057, 113, 3058, 121,
+    3059, 126, 3060, 136, 3060, 141, 3061, 148, 3063, 157, 3064, 162, 3064, 171, 3065, 177,
+    3067, 185, 3067, 193, 3068, 198, 3068, 208, 3070, 214, 3070, 222, 3072, 230, 3071, 236,
+    3075, 244, 3072, 253, 3074, 260, 3076, 266, 3073, 275, 3072, 283, 3073, 289, 3068, 297,
+    3065, 304, 3062, 313, 3057, 319, 3053, 326, 3046, 334, 3041, 340, 3034, 348, 3026, 354,
+    3018, 361, 3009, 367, 3000, 374, 2990, 381, 2980, 387, 2968, 393, 2957, 399, 2943, 405,
+    2929, 410, 2918, 416, 2901, 421, 2888, 427, 2871, 432, 2854, 436, 2838, 440, 2821, 445,
+    2801, 450, 2782, 454, 2765, 457, 2742, 461, 2722, 464, 2700, 466, 2679, 472, 2655, 472,
+    2632, 475, 2608, 477, 2585, 479, 2557, 480, 2532, 482, 2506, 482, 2477, 483, 2451, 483,
+    2422, 484, 2392, 483, 2364, 482, 2333, 483, 2300, 481, 2272, 479, 2239, 478, 2209, 476,
+    2177, 474, 2147, 472, 2116, 470, 2085, 467, 2054, 465, 2023, 462, 1992, 458, 1961, 456,
+    1930, 452, 1898, 449, 1868, 445, 1837, 441, 1806, 437, 1775, 433, 1743, 429, 1712, 424,
+    1682, 419, 1650, 415, 1620, 410, 1589, 403, 1557, 400, 1526, 393, 1495, 388, 1464, 383,
+    1433, 376, 1402, 371, 1372, 364, 1339, 358, 1309, 352, 1278, 345, 1246, 338, 1216, 332,
+    1185, 325, 1154, 318, 1122, 310, 1092, 304, 1060, 296, 1030, 289, 998, 281, 968, 273,
+    936, 266, 906, 257, 874, 250, 844, 241, 812, 235, 782, 225, 751, 217, 721, 209,
+    691, 202, 661, 193, 634, 185, 606, 177, 579, 171, 553, 162, 525, 156, 502, 148,
+    477, 141, 453, 135, 429, 128, 406, 121, 385, 114, 363, 109, 342, 102, 321, 96,
+    303, 91, 282, 85, 265, 80, 248, 73, 229, 70, 213, 64, 197, 60, 182, 54,
+    167, 51, 153, 46, 140, 42, 126, 39, 114, 35, 104, 30, 92, 29, 82, 25,
+    72, 21, 62, 20, 54, 16, 47, 13, 39, 13, 32, 9, 27, 8, 21, 7,
+    15, 5, 12, 3, 9, 3, 6, 1, 2, 2, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, -4, 0, -6, 0, -10, 0, -13, 0, -18,
+    -1, -23, -1, -29, -1, -34, 0, -43, -2, -49, -2, -57, -2, -67, -1, -75,
+    -2, -87, -2, -97, -4, -108, -2, -121, -3, -133, -4, -146, -5, -160, -4, -175,
+    -5, -190, -5, -206, -6, -222, -5, -239, -7, -257, -7, -274, -7, -296, -9, -313,
+    -8, -335, -9, -355, -10, -376, -11, -399, -11, -422, -11, -445, -13, -468, -12, -495,
+    -16, -519, -14, -545, -14, -572, -16, -599, -18, -627, -18, -656, -19, -684, -21, -714,
+    -19, -746, -23, -775, -22, -808, -24, -840, -25, -871, -26, -903, -27, -934, -29, -967,
+    -30, -998, -31, -1030, -31, -1062, -33, -1093, -36, -1125, -35, -1158, -38, -1189, -38, -1221,
+    -40, -1253, -42, -1285, -42, -1316, -45, -1349, -46, -1380, -46, -1413, -51, -1445, -50, -1476,
+    -52, -1508, -53, -1540, -57, -1572, -58, -1605, -59, -1636, -61, -1669, -63, -1700, -65, -1732,
+    -67, -1765, -68, -1798, -73, -1828, -72, -1862, -75, -1893, -78, -1925, -80, -1958, -82, -1990,
+    -84, -2023, -88, -2054, -90, -2086, -91, -2120, -95, -2151, -97, -2184, -100, -2216, -102, -2249,
+    -106, -2280, -109, -2314, -111, -2346, -113, -2380, -118, -2410, -121, -2443, -123, -2474, -126, -2505,
+    -129, -2536, -135, -2563, -136, -2593, -139, -2622, -142, -2649, -147, -2676, -148, -2703, -153, -2728,
+    -157, -2753, -159, -2778, -163, -2802, -167, -2825, -168, -2847, -174, -2870, -176, -2891, -180, -2912,
+    -184, -2932, -188, -2953, -190, -2970, -194, -2989, -198, -3006, -201, -3025, -206, -3039, -207, -3056,
+    -213, -3071, -215, -3085, -219, -3100, -222, -3113, -226, -3126, -230, -3138, -232, -3147, -237, -3161,
+    -239, -3169, -243, -3180, -247, -3188, -251, -3196, -252, -3204, -257, -3211, -261, -3217, -263, -3222,
+    -265, -3228, -270, -3233, -273, -3235, -276, -3240, -279, -3241, -283, -3243, -284, -3245, -288, -3246,
+    -291, -3246, -294, -3248, -296, -3249, -300, -3251, -304, -3250, -305, -3253, -310, -3254, -312, -3255,
+    -315, -3257, -317, -3257, -322, -3259, -323, -3259, -328, -3261, -330, -3262, -334, -3263, -336, -3265,
+    -341, -3265, -342, -3267, -345, -3268, -349, -3269, -353, -3269, -355, -3272, -357, -3272, -362, -3274,
+    -364, -3275, -368, -3275, -370, -3277, -374, -3278, -378, -3280, -380, -3280, -384, -3283, -386, -3282,
+    -390, -3285, -393, -3286, -396, -3287, -400, -3288, -403, -3289, -406, -3290, -410, -3292, -412, -3293,
+    -416, -3294, -420, -3295, -421, -3297, -426, -3298, -429, -3298, -432, -3300, -437, -3301, -437, -3303,
+    -443, -3303, -445, -3305, -449, -3306, -452, -3307, -456, -3309, -458, -3310, -462, -3310, -466, -3312,
+    -469, -3314, -472, -3313, -477, -3316, -478, -3317, -483, -3318, -485, -3319, -490, -3320, -493, -3322,
+    -496, -3323, -500, -3324, -503, -3325, -506, -3326, -510, -3328, -513, -3329, -517, -3330, -522, -3331,
+    -522, -3332, -529, -3334, -530, -3335, -535, -3335, -537, -3338, -543, -3338, -544, -3340, -549, -3342,
+    -552, -3341, -557, -3343, -559, -3345, -562, -3346, -566, -3347, -571, -3348, -574, -3350, -577, -3350,
+    -580, -3352, -585, -3354, -588, -3354, -593, -3355, -594, -3357, -600, -3358, -602, -3360, -606, -3360,
+    -611, -3362, -614, -3363, -618, -3363, -620, -3366, -626, -3367, -628, -3367, -632, -3369, -636, -3370,
+    -641, -3372, -643, -3373, -648, -3373, -650, -3375, -655, -3377, -659, -3377, -663, -3379, -666, -3379,
+    -670, -3381, -674, -3382, -677, -3384, -682, -3385, -686, -3386, -689, -3387, -693, -3388, -697, -3389,
+    -701, -3391, -704, -3392, -709, -3393, -711, -3394, -718, -3395, -720, -3397, -723, -3397, -729, -3400,
+    -732, -3399, -736, -3402, -740, -3402, -744, -3404, -747, -3404, -752, -3406, -756, -3407, -760, -3408,
+    -764, -3409, -768, -3410, -771, -3411, -776, -3413, -779, -3413, -784, -3415, -788, -3416, -792, -3418,
+    -796, -3417, -800, -3420, -804, -3420, -808, -3422, -811, -3422, -817, -3423, -820, -3425, -825, -3426,
+    -829, -3427, -832, -3428, -837, -3430, -841, -3430, -845, -3431, -849, -3432, -854, -3435, -857, -3435,
+    -863, -3436, -865, -3437, -870, -3437, -875, -3439, -879, -3441, -882, -3442, -887, -3442, -892, -3444,
+    -896, -3444, -900, -3446, -904, -3447, -909, -3448, -911, -3449, -919, -3450, -920, -3451, -926, -3452,
+    -930, -3453, -934, -3455, -939, -3455, -942, -3455, -947, -3458, -953, -3458, -954, -3459, -961, -3460,
+    -964, -3461, -969, -3461, -974, -3463, -977, -3464, -982, -3464, -987, -3466, -991, -3467, -995, -3467,
+    -1000, -3469, -1004, -3470, -1008, -3469, -1014, -3473, -1017, -3471, -1022, -3474, -1027, -3474, -1030, -3475,
+    -1036, -3476, -1039, -3477, -1046, -3477, -1048, -3480, -1054, -3480, -1057, -3480, -1063, -3481, -1067, -3482,
+    -1072, -3484, -1077, -3483, -1079, -3486, -1087, -3485, -1089, -3486, -1095, -3488, -1099, -3488, -1104, -3490,
+    -1108, -3489, -1112, -3491, -1119, -3491, -1121, -3492, -1128, -3493, -1132, -3494, -1135, -3494, -1141, -3496,
+    -1145, -3496, -1151, -3496, -1155, -3498, -1159, -3498, -1164, -3499, -1169, -3500, -1174, -3501, -1178, -3501,
+    -1182, -3501, -1189, -3503, -1193, -3503, -1198, -3504, -1201, -3505, -1207, -3505, -1212, -3506, -1216, -3507,
+    -1221, -3507, -1225, -3507, -1231, -3508, -1236, -3510, -1241, -3510, -1244, -3510, -1251, -3510, -1254, -3511,
+    -1260, -3512, -1264, -3513, -1268, -3512, -1275, -3514, -1278, -3514, -1285, -3516, -1289, -3515, -1294, -3514,
+    -1298, -3517, -1303, -3517, -1309, -3517, -1313, -3517, -1318, -3518, -1323, -3518, -1328, -3519, -1333, -3519,
+    -1338, -3519, -1343, -3521, -1347, -3520, -1354, -3521, -1357, -3521, -1362, -3522, -1368, -3521, -1372, -3523,
+    -1379, -3523, -1382, -3522, -1387, -3523, -1392, -3523, -1398, -3524, -1402, -3524, -1408, -3524, -1412, -3525,
+    -1418, -3524, -1422, -3525, -1429, -3525, -1432, -3525, -1437, -3526, -1443, -3525, -1448, -3526, -1453, -3526,
+    -1458, -3526, -1463, -3526, -1468, -3527, -1473, -3526, -1478, -3526, -1484, -3527, -1488, -3527, -1493, -3526,
+    -1499, -3526, -1505, -3527, -1508, -3526, -1515, -3527, -1518, -3527, -1524, -3527, -1530, -3526, -1534, -3526,
+    -1540, -3526, -1545, -3527, -1550, -3526, -1554, -3526, -1562, -3526, -1564, -3525, -1572, -3525, -1575, -3526,
+    -1581, -3525, -1587, -3525, -1591, -3525, -1597, -3524, -1601, -3523, -1607, -3525, -1612, -3523, -1616, -3522,
+    -1622, -3520, -1625, -3517, -1629, -3514, -1631, -3509, -1637, -3504, -1636, -3499, -1640, -3492, -1643, -3484,
+    -1644, -3477, -1644, -3469, -1647, -3459, -1646, -3450, -1646, -3438, -1647, -3427, -1646, -3415, -1645, -3403,
+    -1642, -3388, -1642, -3374, -1639, -3359, -1637, -3344, -1634, -3327, -1630, -3310, -1626, -3293, -1622, -3273,
+    -1617, -3255, -1612, -3234, -1607, -3214, -1601, -3193, -1593, -3170, -1588, -3147, -1580, -3125, -1573, -3100,
+    -1564, -3075, -1556, -3050, -1546, -3023, -1537, -2997, -1526, -2969, -1516, -2941, -1506, -2910, -1493, -2882,
+    -1482, -2851, -1470, -2821, -1456, -2787, -1443, -2756, -1431, -2723, -1414, -2689, -1401, -2654, -1385, -2620,
+    -1370, -2583, -1354, -2548, -1338, -2513, -1322, -2477, -1307, -2442, -1290, -2406, -1274, -2371, -1257, -2335,
+    -1241, -2300, -1225, -2265, -1208, -2229, -1191, -2194, -1174, -2158, -1157, -2124, -1141, -2088, -1123, -2053,
+    -1105, -2017, -1090, -1982, -1069, -1947, -1054, -1912, -1036, -1877, -1018, -1842, -1000, -1806, -983, -1771,
+    -964, -1736, -947, -1701, -929, -1666, -910, -1631, -892, -1596, -873, -1561, -856, -1525, -836, -1492,
+    -819, -1455, -800, -1422, -781, -1386, -762, -1351, -744, -1316, -725, -1282, -705, -1246, -688, -1212,
+    -667, -1177, -649, -1143, -629, -1107, -611, -1073, -591, -1037, -572, -1003, -552, -968, -533, -933,
+    -513, -900, -496, -864, -475, -830, -456, -796, -437, -763, -421, -731, -401, -701, -384, -668,
+    -368, -639, -349, -609, -334, -581, -319, -552, -302, -525, -288, -498, -272, -473, -258, -447,
+    -244, -423, -230, -399, -217, -375, -204, -354, -192, -332, -180, -310, -167, -290, -156, -270,
+    -145, -251, -136, -233, -124, -216, -114, -199, -106, -182, -96, -166, -88, -152, -80, -137,
+    -72, -125, -65, -111, -57, -99, -52, -89, -45, -76, -39, -68, -32, -58, -29, -49,
+    -25, -42, -19, -34, -17, -27, -12, -22, -9, -17, -8, -12, -4, -8, -3, -5,
+    -2, -3, 0, -1, 0, 0, -1, 0,
+};
+
+static const StrokeTableSegment STROKE_YONG_SEGMENTS[8] = {
+    {0, 1},
+    {312, 0},
+    {705, 1},
+    {2228, 0},
+    {2718, 1},
+    {3687, 0},
+    {4366, 1},
+    {4816, 1},
+};
+
+static const int16_t STROKE_SHI_DELTAS[4498] = {
+    0, 0, 0, -1, -2, -2, -2, -3, -4, -5, -7, -7, -8, -10, -11, -14,
+    -16, -18, -18, -22, -23, -27, -28, -31, -32, -38, -37, -45, -43, -52, -50, -58,
+    -56, -67, -63, -74, -70, -84, -78, -92, -87, -103, -95, -112, -105, -124, -113, -134,
+    -123, -147, -134, -158, -145, -171, -156, -184, -168, -198, -178, -212, -192, -228, -204, -241,
+    -218, -258, -231, -273, -245, -290, -260, -307, -274, -325, -290, -342, -306, -361, -320, -381,
+    -339, -399, -355, -420, -372, -439, -390, -462, -408, -482, -427, -504, -445, -527, -466, -549,
+    -486, -573, -505, -597, -525, -621, -548, -644, -567, -670, -588, -694, -609, -717, -630, -743,
+    -650, -767, -672, -790, -692, -815, -713, -839, -732, -865, -755, -888, -776, -912, -795, -936,
+    -817, -961, -838, -985, -858, -1009, -880, -1033, -901, -1057, -920, -1083, -943, -1105, -962, -1130,
+    -985, -1154, -1005, -1178, -1025, -1203, -1048, -1227, -1068, -1250, -1089, -1275, -1110, -1299, -1130, -1323,
+    -1153, -1347, -1173, -1371, -1194, -1396, -1217, -1419, -1236, -1443, -1258, -1469, -1280, -1490, -1299, -1516,
+    -1322, -1540, -1344, -1563, -1363, -1588, -1386, -1611, -1407, -1636, -1428, -1658, -1450, -1684, -1470, -1707,
+    -1493, -1730, -1513, -1755, -1535, -1780, -1557, -1802, -1577, -1826, -1600, -1850, -1620, -1873, -1640, -1895,
+    -1660, -1917, -1681, -1938, -1697, -1959, -1718, -1979, -1736, -1999, -1753, -2019, -1772, -2038, -1788, -2055,
+    -1804, -2074, -1823, -2091, -1837, -2109, -1853, -2123, -1868, -2141, -1882, -2155, -1897, -2171, -1911, -2186,
+    -1925, -2198, -1938, -2212, -1949, -2225, -1964, -2238, -1974, -2250, -1987, -2261, -1996, -2272, -2008, -2283,
+    -2017, -2293, -2029, -2301, -2037, -2311, -2046, -2320, -2054, -2329, -2064, -2334, -2071, -2343, -2078, -2349,
+    -2085, -2355, -2091, -2361, -2098, -2364, -2102, -2372, -2110, -2373, -2112, -2379, -2119, -2381, -2122, -2384,
+    -2126, -2386, -2128, -2389, -2132, -2389, -2132, -2390, -2137, -2390, -2136, -2390, -2138, -2389, -2139, -2389,
+    -2141, -2388, -2140, -2387, -2142, -2387, -2144, -2387, -2144, -2385, -2146, -2385, -2146, -2384, -2147, -2383,
+    -2148, -2384, -2149, -2382, -2150, -2381, -2152, -2381, -2152, -2380, -2153, -2380, -2154, -2379, -2155, -2378,
+    -2158, -2377, -2156, -2376, -2158, -2376, -2158, -2376, -2162, -2374, -2161, -2374, -2161, -2373, -2163, -2373,
+    -2164, -2371, -2165, -2371, -2166, -2370, -2167, -2370, -2167, -2369, -2169, -2368, -2170, -2367, -2171, -2368,
+    -2172, -2366, -2173, -2366, -2174, -2365, -2175, -2364, -2176, -2363, -2177, -2363, -2177, -2362, -2179, -2361,
+    -2180, -2361, -2181, -2360, -2182, -2359, -2182, -2359, -2184, -2357, -2184, -2358, -2186, -2356, -2186, -2355,
+    -2188, -2355, -2188, -2355, -2190, -2353, -2189, -2354, -2192, -2351, -2192, -2351, -2193, -2351, -2193, -2350,
+    -2195, -2349, -2196, -2348, -2197, -2347, -2198, -2347, -2199, -2347, -2200, -2345, -2201, -2345, -2201, -2343,
+    -2202, -2343, -2204, -2343, -2204, -2342, -2206, -2341, -2206, -2340, -2207, -2339, -2208, -2339, -2210, -2338,
+    -2209, -2337, -2211, -2336, -2212, -2336, -2213, -2335, -2213, -2335, -2214, -2333, -2215, -2333, -2217, -2332,
+    -2218, -2332, -2218, -2330, -2220, -2329, -2219, -2329, -2222, -2329, -2222, -2328, -2222, -2326, -2224, -2327,
+    -2225, -2325, -2226, -2324, -2226, -2324, -2227, -2323, -2230, -2322, -2229, -2322, -2230, -2321, -2232, -2320,
+    -2231, -2319, -2233, -2319, -2234, -2317, -2234, -2318, -2237, -2316, -2236, -2315, -2238, -2315, -2238, -2314,
+    -2239, -2313, -2241, -2312, -2241, -2312, -2242, -2311, -2244, -2310, -2243, -2309, -2245, -2309, -2246, -2307,
+    -2245, -2307, -2249, -2306, -2248, -2306, -2249, -2305, -2250, -2303, -2250, -2304, -2253, -2302, -2252, -2301,
+    -2254, -2301, -2255, -2301, -2256, -2299, -2256, -2297, -2256, -2299, -2258, -2297, -2259, -2295, -2261, -2296,
+    -2260, -2295, -2262, -2292, -2263, -2293, -2262, -2293, -2264, -2291, -2265, -2289, -2265, -2291, -2268, -2288,
+    -2267, -2288, -2269, -2286, -2269, -2286, -2270, -2287, -2270, -2284, -2272, -2284, -2272, -2282, -2274, -2282,
+    -2274, -2282, -2275, -2281, -2277, -2279, -2275, -2279, -2278, -2277, -2279, -2278, -2280, -2276, -2279, -2275,
+    -2281, -2275, -2282, -2274, -2282, -2272, -2284, -2273, -2283, -2271, -2286, -2271, -2286, -2270, -2287, -2269,
+    -2288, -2268, -2288, -2267, -2290, -2267, -2290, -2265, -2291, -2265, -2292, -2264, -2293, -2263, -2294, -2263,
+    -2294, -2261, -2296, -2261, -2295, -2260, -2298, -2258, -2296, -2259, -2300, -2257, -2300, -2257, -2300, -2255,
+    -2302, -2255, -2301, -2254, -2302, -2253, -2304, -2253, -2305, -2251, -2304, -2250, -2306, -2250, -2306, -2248,
+    -2308, -2248, -2308, -2247, -2309, -2246, -2310, -2245, -2311, -2244, -2311, -2243, -2312, -2243, -2312, -2242,
+    -2314, -2241, -2315, -2240, -2315, -2239, -2316, -2238, -2317, -2237, -2318, -2237, -2319, -2235, -2319, -2235,
+    -2320, -2234, -2321, -2233, -2322, -2231, -2322, -2232, -2323, -2230, -2324, -2230, -2325, -2228, -2326, -2228,
+    -2326, -2226, -2328, -2226, -2327, -2225, -2329, -2225, -2330, -2223, -2330, -2222, -2331, -2221, -2331, -2221,
+    -2333, -2220, -2333, -2218, -2335, -2219, -2335, -2217, -2335, -2216, -2337, -2215, -2337, -2214, -2338, -2214,
+    -2339, -2212, -2339, -2212, -2341, -2210, -2341, -2210, -2340, -2209, -2344, -2208, -2343, -2207, -2344, -2206,
+    -2345, -2206, -2345, -2204, -2347, -2203, -2347, -2203, -2347, -2202, -2350, -2200, -2349, -2200, -2349, -2199,
+    -2351, -2197, -2352, -2197, -2352, -2197, -2354, -2195, -2353, -2194, -2354, -2194, -2356, -2192, -2356, -2192,
+    -2357, -2190, -2357, -2189, -2359, -2189, -2358, -2188, -2360, -2186, -2361, -2186, -2361, -2185, -2362, -2185,
+    -2363, -2182, -2363, -2182, -2364, -2182, -2365, -2180, -2366, -2179, -2366, -2179, -2367, -2177, -2367, -2176,
+    -2369, -2176, -2369, -2175, -2370, -2173, -2370, -2173, -2372, -2172, -2372, -2171, -2372, -2169, -2375, -2170,
+    -2374, -2168, -2374, -2166, -2376, -2166, -2376, -2165, -2377, -2165, -2379, -2163, -2377, -2162, -2380, -2161,
+    -2379, -2161, -2381, -2159, -2381, -2158, -2383, -2158, -2383, -2157, -2383, -2155, -2383, -2154, -2385, -2154,
+    -2386, -2153, -2386, -2151, -2387, -2151, -2387, -2150, -2389, -2148, -2389, -2147, -2390, -2148, -2390, -2145,
+    -2391, -2145, -2392, -2144, -2392, -2142, -2393, -2142, -2394, -2141, -2395, -2140, -2395, -2138, -2396, -2138,
+    -2396, -2138, -2397, -2136, -2398, -2134, -2399, -2134, -2399, -2133, -2399, -2132, -2401, -2131, -2401, -2130,
+    -2402, -2129, -2403, -2128, -2404, -2127, -2403, -2126, -2404, -2124, -2406, -2125, -2406, -2123, -2406, -2122,
+    -2408, -2121, -2407, -2119, -2410, -2119, -2409, -2119, -2409, -2116, -2412, -2116, -2411, -2114, -2412, -2115,
+    -2412, -2113, -2414, -2112, -2413, -2110, -2414, -2111, -2415, -2108, -2417, -2108, -2416, -2106, -2417, -2106,
+    -2418, -2104, -2420, -2104, -2418, -2103, -2420, -2101, -2420, -2100, -2421, -2101, -2421, -2098, -2422, -2098,
+    -2423, -2096, -2424, -2096, -2425, -2094, -2424, -2093, -2426, -2092, -2426, -2092, -2427, -2090, -2427, -2090,
+    -2428, -2088, -2429, -2087, -2429, -2086, -2429, -2085, -2432, -2084, -2431, -2083, -2431, -2081, -2432, -2082,
+    -2434, -2080, -2434, -2078, -2434, -2078, -2435, -2077, -2435, -2075, -2437, -2075, -2437, -2073, -2437, -2073,
+    -2437, -2072, -2440, -2069, -2439, -2070, -2440, -2068, -2441, -2067, -2441, -2066, -2441, -2065, -2442, -2064,
+    -2444, -2063, -2444, -2062, -2444, -2061, -2445, -2059, -2445, -2059, -2446, -2057, -2446, -2057, -2448, -2055,
+    -2447, -2055, -2450, -2053, -2449, -2052, -2449, -2052, -2450, -2049, -2451, -2049, -2451, -2048, -2453, -2048,
+    -2452, -2045, -2453, -2045, -2454, -2043, -2455, -2043, -2456, -2041, -2455, -2040, -2457, -2040, -2456, -2038,
+    -2457, -2037, -2458, -2036, -2459, -2035, -2459, -2034, -2459, -2032, -2461, -2032, -2461, -2031, -2462, -2029,
+    -2462, -2029, -2462, -2026, -2464, -2026, -2463, -2026, -2464, -2023, -2466, -2023, -2465, -2022, -2466, -2021,
+    -2467, -2018, -2467, -2019, -2467, -2017, -2470, -2017, -2469, -2014, -2469, -2014, -2471, -2013, -2470, -2012,
+    -2471, -2010, -2473, -2009, -2471, -2009, -2473, -2008, -2474, -2005, -2475, -2006, -2474, -2003, -2475, -2002,
+    -2476, -2003, -2476, -2000, -2478, -2000, -2476, -1997, -2478, -1998, -2479, -1996, -2479, -1994, -2480, -1994,
+    -2480, -1993, -2481, -1991, -2482, -1990, -2482, -1989, -2482, -1989, -2483, -1987, -2483, -1985, -2484, -1984,
+    -2485, -1984, -2486, -1982, -2485, -1982, -2486, -1979, -2487, -1980, -2489, -1977, -2487, -1977, -2489, -1975,
+    -2489, -1975, -2489, -1973, -2490, -1971, -2490, -1972, -2493, -1969, -2490, -1969, -2493, -1968, -2493, -1966,
+    -2493, -1965, -2494, -1964, -2495, -1963, -2495, -1961, -2495, -1960, -2496, -1960, -2496, -1958, -2497, -1957,
+    -2499, -1956, -2497, -1955, -2499, -1954, -2500, -1952, -2499, -1951, -2500, -1950, -2501, -1949, -2502, -1947,
+    -2501, -1947, -2502, -1945, -2503, -1944, -2504, -1944, -2503, -1941, -2505, -1941, -2505, -1939, -2505, -1938,
+    -2507, -1938, -2506, -1935, -2507, -1935, -2507, -1933, -2508, -1933, -2509, -1931, -2508, -1930, -2510, -1928,
+    -2511, -1928, -2510, -1927, -2510, -1924, -2512, -1925, -2512, -1922, -2513, -1922, -2513, -1921, -2514, -1919,
+    -2514, -1918, -2514, -1917, -2516, -1915, -2515, -1915, -2516, -1913, -2516, -1912, -2518, -1911, -2516, -1909,
+    -2520, -1909, -2518, -1907, -2518, -1906, -2520, -1905, -2520, -1904, -2521, -1902, -2521, -1901, -2521, -1900,
+    -2523, -1898, -2522, -1899, -2524, -1895, -2523, -1896, -2524, -1893, -2524, -1893, -2525, -1892, -2525, -1890,
+    -2526, -1889, -2527, -1888, -2526, -1887, -2528, -1885, -2528, -1884, -2528, -1882, -2529, -1883, -2530, -1880,
+    -2529, -1879, -2530, -1879, -2531, -1877, -2531, -1875, -2532, -1874, -2532, -1874, -2533, -1871, -2533, -1871,
+    -2533, -1869, -2534, -1869, -2535, -1867, -2535, -1865, -2536, -1864, -2535, -1863, -2535, -1861, -2534, -1858,
+    -2531, -1856, -2532, -1854, -2528, -1849, -2525, -1845, -2522, -1843, -2517, -1836, -2513, -1833, -2509, -1827,
+    -2503, -1822, -2496, -1816, -2490, -1809, -2484, -1803, -2474, -1796, -2468, -1788, -2458, -1781, -2450, -1773,
+    -2441, -1763, -2428, -1756, -2420, -1746, -2408, -1737, -2397, -1727, -2383, -1717, -2373, -1706, -2358, -1694,
+    -2343, -1685, -2330, -1673, -2315, -1659, -2301, -1649, -2285, -1636, -2266, -1622, -2252, -1609, -2233, -1597,
+    -2215, -1581, -2197, -1567, -2179, -1553, -2160, -1537, -2138, -1523, -2118, -1506, -2098, -1491, -2075, -1475,
+    -2054, -1456, -2031, -1441, -2008, -1424, -1984, -1405, -1961, -1387, -1935, -1369, -1911, -1350, -1885, -1332,
+    -1860, -1313, -1834, -1294, -1808, -1275, -1785, -1257, -1759, -1238, -1732, -1219, -1708, -1201, -1682, -1182,
+    -1656, -1165, -1633, -1144, -1605, -1128, -1581, -1108, -1555, -1090, -1529, -1071, -1505, -1054, -1479, -1035,
+    -1453, -1016, -1428, -998, -1402, -980, -1376, -962, -1352, -943, -1325, -925, -1301, -907, -1275, -889,
+    -1249, -870, -1224, -852, -1198, -834, -1172, -816, -1148, -798, -1121, -780, -1095, -762, -1070, -744,
+    -1046, -725, -1019, -708, -993, -690, -969, -672, -942, -653, -917, -636, -891, -617, -866, -600,
+    -840, -583, -815, -563, -788, -546, -763, -528, -738, -511, -712, -493, -686, -474, -661, -456,
+    -634, -440, -610, -421, -586, -405, -561, -387, -536, -371, -514, -355, -491, -340, -470, -323,
+    -446, -309, -427, -294, -405, -280, -386, -265, -365, -253, -347, -239, -328, -226, -310, -213,
+    -292, -202, -275, -190, -258, -178, -243, -168, -227, -156, -212, -146, -198, -136, -184, -127,
+    -170, -117, -156, -108, -146, -100, -131, -91, -122, -84, -110, -76, -100, -69, -91, -61,
+    -80, -57, -72, -49, -64, -43, -55, -38, -47, -34, -43, -29, -34, -24, -30, -20,
+    -25, -17, -19, -13, -16, -11, -11, -8, -9, -6, -5, -4, -4, -2, -1, -1,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 4, 2, 6,
+    2, 10, 4, 12, 4, 17, 6, 22, 7, 27, 9, 33, 11, 40, 13, 47,
+    15, 55, 18, 64, 19, 72, 23, 82, 24, 93, 28, 103, 31, 115, 35, 126,
+    38, 140, 41, 152, 45, 167, 48, 181, 54, 196, 57, 212, 62, 228, 66, 245,
+    71, 262, 76, 280, 81, 299, 86, 319, 91, 339, 97, 359, 102, 379, 109, 402,
+    115, 424, 121, 447, 126, 471, 134, 494, 140, 519, 147, 544, 154, 571, 161, 597,
+    167, 624, 176, 652, 183, 679, 191, 710, 198, 739, 208, 768, 213, 799, 223, 829,
+    231, 859, 239, 888, 245, 920, 255, 949, 262, 979, 271, 1010, 277, 1040, 287, 1069,
+    293, 1100, 301, 1130, 310, 1160, 317, 1190, 325, 1220, 334, 1250, 340, 1281, 347, 1310,
+    357, 1341, 363, 1371, 371, 1400, 379, 1431, 387, 1461, 394, 1490, 401, 1522, 410, 1550,
+    417, 1581, 424, 1611, 431, 1641, 439, 1672, 447, 1701, 454, 1732, 461, 1760, 469, 1792,
+    476, 1821, 482, 1852, 491, 1881, 497, 1911, 506, 1941, 511, 1972, 519, 2001, 527, 2031,
+    533, 2061, 541, 2092, 548, 2121, 554, 2151, 561, 2181, 569, 2212, 574, 2240, 582, 2271,
+    589, 2301, 596, 2332, 601, 2360, 609, 2391, 616, 2420, 622, 2451, 629, 2481, 636, 2510,
+    641, 2540, 648, 2570, 656, 2601, 660, 2630, 667, 2660, 675, 2689, 678, 2720, 687, 2749,
+    692, 2779, 700, 2810, 704, 2839, 710, 2869, 717, 2898, 722, 2928, 728, 2959, 734, 2988,
+    739, 3018, 747, 3047, 752, 3078, 757, 3108, 763, 3136, 768, 3168, 774, 3195, 779, 3227,
+    785, 3256, 790, 3286, 796, 3316, 800, 3345, 806, 3376, 811, 3404, 817, 3434, 821, 3464,
+    827, 3495, 831, 3523, 836, 3553, 840, 3584, 847, 3612, 850, 3642, 854, 3672, 860, 3702,
+    864, 3731, 869, 3761, 874, 3790, 877, 3820, 881, 3850, 887, 3879, 889, 3909, 895, 3939,
+    899, 3968, 902, 3998, 906, 4027, 910, 4056, 915, 4087, 918, 4116, 921, 4146, 925, 4175,
+    928, 4204, 933, 4235, 935, 4263, 939, 4292, 942, 4323, 946, 4352, 949, 4382, 950, 4411,
+    956, 4441, 957, 4469, 961, 4500, 962, 4529, 966, 4559, 969, 4588, 971, 4617, 974, 4646,
+    975, 4676, 980, 4706, 979, 4735, 984, 4764, 985, 4794, 987, 4824, 990, 4851, 991, 4882,
+    992, 4910, 995, 4938, 995, 4965, 996, 4991, 997, 5018, 998, 5044, 999, 5068, 999, 5092,
+    999, 5117, 999, 5139, 998, 5161, 998, 5183, 998, 5205, 997, 5226, 996, 5246, 995, 5265,
+    994, 5283, 992, 5302, 991, 5319, 989, 5338, 987, 5353, 984, 5369, 983, 5385, 980, 5399,
+    978, 5413, 975, 5427, 973, 5440, 970, 5452, 965, 5463, 963, 5475, 960, 5486, 956, 5495,
+    953, 5504, 949, 5515, 944, 5521, 941, 5529, 936, 5535, 932, 5544, 929, 5547, 922, 5554,
+    918, 5558, 915, 5563, 909, 5565, 904, 5568, 898, 5571, 894, 5573, 889, 5572, 883, 5574,
+    877, 5574, 872, 5574, 867, 5573, 861, 5572, 856, 5572, 850, 5572, 844, 5572, 840, 5570,
+    832, 5572, 828, 5570, 823, 5570, 817, 5570, 811, 5568, 805, 5567, 800, 5565, 794, 5562,
+    788, 5560, 782, 5554, 775, 5552, 770, 5545, 764, 5541, 756, 5534, 752, 5527, 744, 5520,
+    737, 5512, 733, 5503, 725, 5494, 717, 5485, 711, 5475, 705, 5463, 698, 5452, 691, 5440,
+    684, 5427, 678, 5414, 672, 5401, 662, 5386, 657, 5371, 649, 5356, 643, 5338, 635, 5323,
+    628, 5305, 621, 5287, 615, 5270, 607, 5249, 599, 5230, 593, 5211, 586, 5188, 578, 5168,
+    571, 5145, 563, 5123, 556, 5100, 550, 5076, 542, 5052, 535, 5027, 527, 5000, 520, 4976,
+    513, 4949, 507, 4920, 499, 4894, 491, 4865, 485, 4836, 477, 4806, 470, 4776, 464, 4747,
+    457, 4718, 449, 4686, 444, 4659, 436, 4628, 430, 4599, 423, 4568, 417, 4540, 410, 4509,
+    403, 4482, 398, 4449, 392, 4421, 386, 4392, 379, 4361, 374, 4333, 367, 4301, 362, 4274,
+    356, 4243, 349, 4213, 346, 4184, 338, 4155, 334, 4125, 328, 4095, 324, 4066, 317, 4036,
+    311, 4007, 307, 3976, 303, 3948, 297, 3918, 292, 3888, 286, 3859, 283, 3829, 277, 3799,
+    273, 3770, 268, 3740, 263, 3711, 259, 3681, 255, 3651, 249, 3622, 246, 3592, 241, 3564,
+    237, 3533, 233, 3503, 229, 3475, 224, 3444, 220, 3415, 216, 3386, 213, 3355, 208, 3326,
+    205, 3297, 202, 3267, 197, 3238, 193, 3208, 190, 3178, 187, 3148, 182, 3120, 180, 3089,
+    176, 3060, 173, 3030, 169, 3001, 166, 2971, 163, 2941, 160, 2913, 155, 2882, 154, 2852,
+    150, 2824, 148, 2793, 145, 2765, 141, 2734, 139, 2704, 135, 2675, 133, 2646, 130, 2615,
+    128, 2587, 125, 2556, 122, 2527, 121, 2498, 117, 2467, 114, 2439, 113, 2407, 109, 2379,
+    109, 2349, 104, 2320, 103, 2290, 101, 2260, 98, 2230, 97, 2202, 94, 2171, 91, 2142,
+    91, 2111, 87, 2082, 86, 2053, 83, 2023, 83, 1994, 79, 1963, 78, 1934, 76, 1904,
+    75, 1875, 73, 1844, 70, 1816, 70, 1785, 67, 1756, 65, 1727, 65, 1696, 61, 1667,
+    61, 1637, 59, 1608, 59, 1577, 57, 1548, 53, 1518, 53, 1489, 52, 1458, 51, 1430,
+    48, 1400, 47, 1369, 47, 1340, 45, 1310, 43, 1281, 43, 1251, 40, 1221, 39, 1191,
+    40, 1162, 36, 1132, 36, 1102, 35, 1073, 35, 1042, 31, 1013, 32, 983, 30, 954,
+    29, 924, 28, 894, 27, 864, 26, 835, 25, 805, 24, 774, 23, 746, 21, 715,
+    22, 687, 19, 660, 19, 630, 18, 605, 18, 577, 16, 552, 16, 525, 15, 502,
+    14, 477, 13, 454, 13, 430, 12, 409, 10, 387, 12, 365, 9, 345, 11, 325,
+    8, 306, 9, 286, 7, 269, 7, 251, 7, 234, 6, 218, 7, 202, 4, 187,
+    6, 171, 4, 158, 4, 146, 4, 130, 3, 121, 2, 108, 4, 96, 3, 87,
+    1, 76, 3, 67, 1, 59, 2, 51, 0, 43, 2, 36, 1, 30, 0, 24,
+    1, 19, 0, 15, 0, 10, 1, 8, 0, 5, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 2, -2, 4, -4, 3, -4, 7, -7, 9, -9,
+    13, -14, 16, -16, 21, -21, 24, -26, 28, -30, 35, -36, 41, -42, 46, -48,
+    54, -55, 61, -63, 66, -70, 77, -80, 83, -87, 93, -97, 103, -106, 111, -117,
+    124, -127, 132, -138, 144, -151, 155, -161, 168, -174, 180, -186, 193, -201, 206, -214,
+    218, -229, 233, -242, 249, -259, 263, -274, 280, -290, 294, -306, 312, -325, 327, -340,
+    345, -359, 363, -377, 382, -397, 397, -415, 419, -435, 438, -456, 458, -476, 478, -497,
+    498, -519, 520, -541, 542, -563, 562, -586, 587, -609, 607, -632, 630, -655, 650, -678,
+    674, -701, 696, -723, 717, -747, 738, -770, 761, -791, 784, -815, 805, -839, 827, -861,
+    849, -882, 871, -907, 893, -930, 915, -951, 937, -976, 957, -997, 980, -1020, 1002, -1043,
+    1023, -1066, 1046, -1089, 1068, -1111, 1090, -1133, 1111, -1158, 1133, -1179, 1153, -1202, 1176, -1225,
+    1199, -1247, 1219, -1270, 1241, -1292, 1263, -1315, 1284, -1338, 1306, -1361, 1327, -1383, 1349, -1404,
+    1371, -1429, 1393, -1450, 1414, -1473, 1435, -1496, 1457, -1518, 1478, -1540, 1500, -1563, 1522, -1586,
+    1541, -1607, 1565, -1630, 1586, -1652, 1606, -1675, 1628, -1698, 1649, -1719, 1671, -1741, 1690, -1763,
+    1710, -1783, 1731, -1804, 1750, -1824, 1767, -1843, 1785, -1862, 1804, -1882, 1822, -1899, 1836, -1916,
+    1853, -1934, 1871, -1951, 1884, -1966, 1901, -1982, 1914, -1998, 1929, -2012, 1942, -2027, 1954, -2041,
+    1969, -2054, 1981, -2068, 1992, -2079, 2003, -2091, 2015, -2104, 2025, -2113, 2035, -2125, 2045, -2136,
+    2053, -2144, 2063, -2155, 2071, -2163, 2079, -2170, 2086, -2179, 2093, -2187, 2099, -2194, 2105, -2199,
+    2112, -2206, 2116, -2211, 2121, -2217, 2126, -2222, 2130, -2226, 2131, -2229, 2136, -2233, 2139, -2235,
+    2141, -2239, 2142, -2240, 2144, -2242, 2145, -2242, 2144, -2244, 2145, -2243, 2145, -2243, 2144, -2243,
+    2143, -2242, 2142, -2241, 2141, -2241, 2140, -2240, 2141, -2239, 2138, -2239, 2138, -2237, 2138, -2238,
+    2136, -2236, 2136, -2236, 2134, -2235, 2135, -2235, 2133, -2233, 2133, -2234, 2132, -2232, 2130, -2232,
+    2131, -2231, 2128, -2230, 2128, -2230, 2128, -2229, 2127, -2228, 2125, -2228, 2126, -2227, 2124, -2226,
+    2123, -2226, 2123, -2225, 2123, -2225, 2119, -2223, 2121, -2223, 2119, -2222, 2119, -2222, 2119, -2221,
+    2117, -2222, 2116, -2219, 2117, -2220, 2115, -2219, 2114, -2218, 2114, -2218, 2113, -2217, 2112, -2216,
+    2111, -2216, 2111, -2215, 2109, -2215, 2109, -2213, 2109, -2214, 2107, -2212, 2107, -2212, 2106, -2212,
+    2106, -2210, 2103, -2211, 2104, -2209, 2104, -2210, 2102, -2208, 2102, -2208, 2100, -2207, 2101, -2206,
+    2099, -2206, 2099, -2205, 2098, -2206, 2097, -2204, 2096, -2204, 2096, -2203, 2095, -2203, 2095, -2201,
+    2093, -2202, 2093, -2200, 2092, -2200, 2092, -2200, 2090, -2199, 2091, -2199, 2090, -2198, 2087, -2197,
+    2088, -2198, 2088, -2196, 2087, -2196, 2086, -2194, 2085, -2195, 2084, -2194, 2084, -2194, 2082, -2193,
+    2083, -2192, 2082, -2192, 2081, -2192, 2082, -2191, 2079, -2190, 2078, -2191, 2079, -2188, 2079, -2189,
+    2076, -2189, 2078, -2188, 2075, -2187, 2075, -2186, 2074, -2187, 2075, -2186, 2073, -2185, 2072, -2184,
+    2072, -2184, 2071, -2185, 2071, -2183, 2069, -2183, 2070, -2182, 2069, -2182, 2068, -2182, 2067, -2180,
+    2067, -2180, 2067, -2180, 2066, -2180, 2064, -2178, 2065, -2178, 2063, -2179, 2064, -2177, 2063, -2177,
+    2060, -2176, 2061, -2177, 2061, -2175, 2061, -2176, 2059, -2174, 2059, -2174, 2057, -2174, 2059, -2173,
+    2056, -2173, 2057, -2173, 2056, -2172, 2054, -2170, 2055, -2172, 2054, -2171, 2053, -2170, 2053, -2169,
+    2053, -2170, 2050, -2168, 2052, -2168, 2050, -2168, 2050, -2167, 2049, -2168, 2049, -2166, 2047, -2166,
+    2048, -2166, 2047, -2165, 2046, -2165, 2045, -2163, 2045, -2165, 2045, -2163, 2044, -2163, 2042, -2162,
+    2043, -2162, 2043, -2162, 2041, -2161, 2040, -2160, 2041, -2162, 2039, -2159, 2039, -2159, 2039, -2160,
+    2038, -2159, 2037, -2157, 2038, -2159, 2036, -2157, 2036, -2157, 2035, -2157, 2034, -2156, 2035, -2157,
+    2033, -2155, 2034, -2156, 2033, -2154, 2032, -2154, 2030, -2155, 2032, -2153, 2031, -2154, 2030, -2152,
+    2029, -2154, 2029, -2152, 2029, -2151, 2028, -2152, 2027, -2151, 2027, -2152, 2026, -2150, 2026, -2150,
+    2025, -2150, 2025, -2149, 2025, -2149, 2024, -2149, 2023, -2148, 2022, -2148, 2023, -2148, 2022, -2147,
+    2020, -2147, 2021, -2146, 2020, -2146, 2020, -2145, 2018, -2145, 2019, -2146, 2018, -2144, 2016, -2145,
+    2018, -2143, 2016, -2144, 2016, -2143, 2016, -2143, 2015, -2143, 2015, -2142, 2013, -2142, 2014, -2142,
+    2013, -2141, 2012, -2141, 2013, -2141, 2011, -2139, 2010, -2140, 2011, -2140, 2011, -2140, 2009, -2138,
+    2010, -2140, 2009, -2138, 2008, -2138, 2007, -2138, 2007, -2137, 2007, -2137, 2006, -2137, 2007, -2137,
+    2005, -2137, 2005, -2135, 2005, -2136, 2004, -2136, 2004, -2135, 2002, -2135, 2003, -2134, 2002, -2135,
+    2002, -2134, 2000, -2133, 2002, -2134, 2001, -2133, 2000, -2132, 2000, -2134, 1998, -2132, 1999, -2132,
+    1999, -2132, 1997, -2131, 1998, -2132, 1996, -2131, 1997, -2130, 1996, -2131, 1996, -2130, 1995, -2130,
+    1995, -2130, 1994, -2129, 1993, -2130, 1995, -2128, 1993, -2129, 1993, -2129, 1991, -2128, 1992, -2128,
+    1991, -2128, 1991, -2126, 1991, -2128, 1990, -2127, 1990, -2127, 1990, -2126, 1987, -2126, 1990, -2126,
+    1988, -2127, 1988, -2125, 1987, -2125, 1986, -2126, 1988, -2124, 1986, -2125, 1985, -2125, 1985, -2124,
+    1985, -2123, 1985, -2125, 1984, -2124, 1984, -2122, 1983, -2124, 1983, -2123, 1982, -2122, 1982, -2123,
+    1983, -2122, 1981, -2122, 1981, -2123, 1981, -2121, 1980, -2122, 1980, -2121, 1980, -2121, 1979, -2122,
+    1978, -2120, 1979, -2121, 1978, -2120, 1978, -2121, 1977, -2119, 1977, -2120, 1976, -2119, 1977, -2120,
+    1975, -2119, 1977, -2120, 1975, -2119, 1974, -2118, 1975, -2119, 1974, -2118, 1973, -2118, 1974, -2119,
+    1972, -2117, 1973, -2119, 1972, -2117, 1973, -2118, 1971, -2116, 1971, -2118, 1971, -2116, 1971, -2117,
+    1970, -2117, 1970, -2116, 1969, -2117, 1970, -2116, 1968, -2116, 1969, -2116, 1968, -2115, 1968, -2116,
+    1968, -2115, 1967, -2116, 1967, -2115, 1966, -2115, 1967, -2115, 1966, -2115, 1965, -2115, 1965, -2115,
+    1966, -2114, 1964, -2114, 1964, -2114, 1965, -2114, 1964, -2114, 1962, -2114, 1964, -2113, 1963, -2114,
+    1962, -2113, 1962, -2114, 1962, -2112, 1961, -2114, 1961, -2112, 1961, -2113, 1960, -2113, 1961, -2112,
+    1960, -2114, 1959, -2111, 1961, -2113, 1959, -2113, 1957, -2112, 1960, -2111, 1957, -2113, 1959, -2111,
+    1957, -2112, 1957, -2112, 1958, -2112, 1957, -2111, 1956, -2111, 1957, -2112, 1955, -2111, 1955, -2111,
+    1956, -2112, 1955, -2110, 1955, -2111, 1955, -2111, 1954, -2111, 1955, -2111, 1953, -2111, 1954, -2110,
+    1952, -2111, 1953, -2110, 1953, -2110, 1952, -2110, 1952, -2111, 1952, -2110, 1951, -2111, 1952, -2109,
+    1952, -2110, 1950, -2110, 1951, -2111, 1950, -2109, 1949, -2111, 1950, -2109, 1950, -2110, 1950, -2110,
+    1949, -2110, 1949, -2109, 1948, -2110, 1948, -2109, 1949, -2110, 1948, -2110, 1947, -2109, 1947, -2110,
+    1947, -2109, 1948, -2110, 1947, -2109, 1946, -2109, 1946, -2111, 1946, -2108, 1946, -2110, 1945, -2110,
+    1946, -2108, 1945, -2110, 1944, -2110, 1945, -2109, 1944, -2110, 1945, -2109, 1944, -2109, 1944, -2109,
+    1944, -2109, 1942, -2110, 1943, -2109, 1943, -2109, 1943, -2110, 1942, -2110, 1943, -2109, 1942, -2109,
+    1941, -2109, 1941, -2110, 1943, -2110, 1941, -2108, 1941, -2110, 1940, -2110, 1941, -2109, 1941, -2110,
+    1939, -2109, 1940, -2109, 1940, -2110, 1940, -2109, 1939, -2111, 1940, -2109, 1940, -2110, 1938, -2110,
+    1939, -2110, 1938, -2109, 1938, -2111, 1938, -2109, 1939, -2111, 1937, -2109, 1938, -2111, 1938, -2110,
+    1937, -2110, 1936, -2110, 1937, -2111, 1937, -2109, 1936, -2111, 1937, -2111, 1936, -2111, 1937, -2110,
+    1935, -2111, 1935, -2110, 1936, -2111, 1935, -2111, 1935, -2111, 1935, -2111, 1936, -2111, 1934, -2111,
+    1935, -2111, 1934, -2112, 1934, -2111, 1934, -2111, 1934, -2113, 1934, -2111, 1934, -2112, 1934, -2111,
+    1933, -2112, 1932, -2113, 1934, -2112, 1932, -2112, 1934, -2112, 1932, -2114, 1933, -2112, 1932, -2112,
+    1932, -2113, 1932, -2113, 1932, -2113, 1932, -2113, 1932, -2113, 1932, -2114, 1931, -2113, 1931, -2115,
+    1931, -2112, 1931, -2114, 1931, -2114, 1931, -2115, 1931, -2114, 1931, -2114, 1931, -2115, 1930, -2114,
+    1930, -2115, 1930, -2115, 1930, -2115, 1930, -2115, 1929, -2116, 1930, -2115, 1929, -2115, 1930, -2116,
+    1930, -2115, 1928, -2117, 1930, -2117, 1928, -2116, 1931, -2116, 1928, -2116, 1928, -2117, 1929, -2117,
+    1929, -2118, 1927, -2116, 1929, -2118, 1928, -2117, 1928, -2118, 1929, -2118, 1928, -2119, 1929, -2118,
+    1926, -2118, 1928, -2119, 1927, -2119, 1928, -2119, 1928, -2119, 1927, -2119, 1927, -2120, 1928, -2119,
+    1927, -2121, 1926, -2120, 1928, -2121, 1927, -2120, 1927, -2121, 1926, -2120, 1927, -2121, 1927, -2122,
+    1926, -2121, 1927, -2122, 1926, -2122, 1927, -2123, 1926, -2122, 1927, -2123, 1926, -2122, 1925, -2123,
+    1927, -2124, 1926, -2122, 1926, -2124, 1926, -2124, 1926, -2124, 1925, -2125, 1927, -2124, 1925, -2125,
+    1926, -2126, 1926, -2124, 1926, -2126, 1924, -2126, 1926, -2126, 1926, -2126, 1926, -2127, 1925, -2126,
+    1926, -2127, 1924, -2127, 1926, -2128, 1925, -2128, 1926, -2128, 1925, -2128, 1925, -2129, 1926, -2128,
+    1924, -2129, 1925, -2130, 1926, -2129, 1925, -2130, 1925, -2130, 1926, -2130, 1924, -2132, 1926, -2130,
+    1924, -2132, 1925, -2130, 1925, -2133, 1925, -2132, 1926, -2132, 1925, -2133, 1925, -2133, 1925, -2133,
+    1924, -2133, 1925, -2134, 1925, -2135, 1925, -2133, 1925, -2136, 1925, -2134, 1926, -2136, 1924, -2135,
+    1925, -2136, 1925, -2136, 1925, -2137, 1926, -2137, 1924, -2137, 1925, -2138, 1926, -2138, 1925, -2138,
+    1925, -2138, 1924, -2139, 1926, -2139, 1926, -2139, 1924, -2140, 1925, -2141, 1926, -2141, 1925, -2140,
+    1925, -2141, 1925, -2142, 1927, -2141, 1924, -2143, 1927, -2143, 1925, -2142, 1925, -2144, 1926, -2143,
+    1925, -2144, 1927, -2144, 1924, -2145, 1927, -2145, 1926, -2145, 1925, -2146, 1927, -2146, 1925, -2147,
+    1926, -2147, 1927, -2147, 1925, -2147, 1926, -2148, 1925, -2147, 1925, -2147, 1923, -2146, 1921, -2142,
+    1918, -2143, 1916, -2138, 1915, -2137, 1909, -2132, 1907, -2129, 1903, -2125, 1898, -2120, 1892, -2115,
+    1889, -2110, 1882, -2103, 1877, -2097, 1869, -2090, 1864, -2083, 1856, -2076, 1847, -2067, 1841, -2058,
+    1833, -2050, 1823, -2040, 1815, -2031, 1805, -2020, 1795, -2010, 1786, -1998, 1774, -1986, 1763, -1975,
+    1752, -1962, 1740, -1949, 1728, -1936, 1716, -1922, 1702, -1908, 1689, -1893, 1675, -1878, 1662, -1862,
+    1647, -1847, 1633, -1830, 1617, -1813, 1601, -1796, 1585, -1778, 1570, -1760, 1550, -1742, 1536, -1722,
+    1516, -1702, 1500, -1683, 1480, -1663, 1463, -1641, 1443, -1621, 1424, -1598, 1404, -1578, 1385, -1556,
+    1366, -1535, 1348, -1512, 1327, -1492, 1308, -1471, 1290, -1448, 1270, -1427, 1250, -1406, 1231, -1385,
+    1213, -1363, 1192, -1341, 1175, -1320, 1154, -1298, 1135, -1276, 1114, -1255, 1098, -1234, 1077, -1212,
+    1058, -1191, 1040, -1168, 1018, -1147, 999, -1127, 983, -1103, 960, -1082, 943, -1061, 923, -1039,
+    904, -1018, 885, -995, 864, -975, 846, -952, 827, -931, 807, -909, 788, -887, 768, -867,
+    749, -843, 730, -823, 712, -801, 690, -778, 672, -758, 655, -736, 632, -713, 614, -692,
+    594, -670, 577, -649, 555, -627, 537, -605, 518, -583, 498, -562, 479, -540, 460, -519,
+    441, -497, 423, -476, 406, -457, 387, -437, 370, -418, 354, -399, 337, -380, 322, -363,
+    305, -345, 291, -327, 276, -312, 260, -294, 249, -279, 233, -263, 221, -249, 207, -235,
+    195, -220, 183, -206, 171, -193, 161, -181, 149, -168, 138, -156, 129, -145, 118, -134,
+    109, -123, 101, -113, 92, -104, 83, -93, 75, -85, 68, -77, 61, -69, 54, -62,
+    48, -53, 42, -48, 37, -41, 32, -35, 26, -31, 23, -25, 18, -20, 14, -17,
+    11, -13, 10, -10, 6, -7, 4, -5, 3, -3, 2, -1, 0, 0, 0, 0,
+    0, 0,
+};
+
+static const StrokeTableSegment STROKE_SHI_SEGMENTS[3] = {
+    {0, 1},
+    {851, 0},
+    {1337, 1},
+};
+
+static const int16_t STROKE_KOU_DELTAS[7630] = {
+    0, 0, 0, -1, 2, -1, 4, -2, 3, -5, 7, -6, 11, -9, 11, -12,
+    18, -15, 20, -18, 24, -23, 31, -27, 36, -33, 41, -38, 48, -44, 55, -50,
+    62, -56, 69, -64, 79, -72, 86, -78, 96, -87, 105, -97, 116, -105, 125, -115,
+    137, -124, 148, -135, 160, -146, 172, -158, 186, -168, 197, -181, 213, -194, 225, -206,
+    240, -220, 256, -233, 271, -247, 287, -263, 303, -276, 320, -292, 338, -307, 355, -324,
+    373, -341, 392, -358, 411, -374, 431, -394, 451, -411, 471, -430, 492, -448, 513, -469,
+    536, -488, 557, -508, 579, -529, 603, -550, 626, -570, 648, -592, 671, -612, 694, -632,
+    717, -653, 738, -673, 761, -695, 785, -715, 808, -736, 829, -756, 852, -777, 875, -797,
+    898, -818, 920, -839, 944, -859, 964, -879, 988, -901, 1011, -920, 1033, -941, 1056, -962,
+    1078, -982, 1101, -1003, 1125, -1023, 1146, -1044, 1169, -1064, 1191, -1084, 1213, -1105, 1237, -1125,
+    1259, -1146, 1281, -1166, 1305, -1186, 1327, -1208, 1348, -1226, 1371, -1247, 1393, -1268, 1418, -1288,
+    1438, -1308, 1462, -1329, 1484, -1349, 1505, -1368, 1529, -1390, 1551, -1409, 1574, -1430, 1595, -1449,
+    1619, -1470, 1640, -1490, 1663, -1510, 1685, -1530, 1708, -1550, 1730, -1570, 1750, -1589, 1772, -1608,
+    1792, -1625, 1813, -1644, 1832, -1662, 1851, -1679, 1869, -1695, 1887, -1711, 1906, -1727, 1923, -1743,
+    1940, -1758, 1957, -1771, 1971, -1787, 1987, -1800, 2002, -1813, 2018, -1826, 2030, -1838, 2045, -1850,
+    2057, -1864, 2070, -1871, 2083, -1885, 2094, -1894, 2106, -1904, 2116, -1914, 2128, -1922, 2136, -1931,
+    2146, -1940, 2155, -1947, 2165, -1956, 2172, -1961, 2180, -1968, 2188, -1975, 2192, -1980, 2202, -1985,
+    2205, -1991, 2212, -1995, 2216, -1999, 2221, -2003, 2225, -2006, 2229, -2009, 2231, -2012, 2235, -2013,
+    2237, -2015, 2239, -2017, 2239, -2017, 2242, -2018, 2241, -2018, 2241, -2018, 2242, -2017, 2241, -2016,
+    2241, -2015, 2239, -2015, 2239, -2014, 2240, -2013, 2239, -2012, 2238, -2012, 2239, -2011, 2238, -2011,
+    2238, -2010, 2236, -2008, 2237, -2008, 2236, -2008, 2236, -2006, 2236, -2006, 2235, -2005, 2235, -2005,
+    2233, -2003, 2234, -2003, 2234, -2003, 2233, -2001, 2234, -2001, 2232, -2000, 2231, -1999, 2232, -1999,
+    2231, -1998, 2231, -1997, 2231, -1996, 2230, -1996, 2230, -1995, 2229, -1995, 2230, -1993, 2230, -1994,
+    2228, -1992, 2229, -1991, 2228, -1991, 2228, -1991, 2227, -1990, 2228, -1989, 2226, -1988, 2226, -1988,
+    2227, -1987, 2226, -1986, 2225, -1985, 2225, -1985, 2224, -1985, 2225, -1983, 2225, -1983, 2224, -1982,
+    2223, -1982, 2223, -1981, 2223, -1979, 2222, -1981, 2223, -1978, 2222, -1978, 2221, -1977, 2222, -1977,
+    2220, -1977, 2222, -1975, 2221, -1974, 2220, -1975, 2219, -1973, 2220, -1974, 2220, -1971, 2218, -1972,
+    2219, -1970, 2219, -1971, 2219, -1970, 2217, -1969, 2217, -1968, 2218, -1968, 2217, -1966, 2216, -1966,
+    2217, -1967, 2216, -1964, 2216, -1965, 2216, -1964, 2216, -1964, 2215, -1961, 2214, -1963, 2216, -1961,
+    2215, -1961, 2213, -1960, 2215, -1959, 2213, -1960, 2213, -1958, 2215, -1957, 2213, -1957, 2213, -1957,
+    2211, -1956, 2213, -1955, 2213, -1955, 2211, -1954, 2212, -1953, 2211, -1953, 2211, -1952, 2211, -1952,
+    2212, -1951, 2211, -1951, 2209, -1950, 2210, -1949, 2211, -1949, 2210, -1947, 2209, -1948, 2210, -1948,
+    2209, -1946, 2209, -1946, 2209, -1945, 2209, -1945, 2207, -1944, 2208, -1943, 2209, -1943, 2208, -1942,
+    2208, -1942, 2208, -1941, 2206, -1941, 2207, -1941, 2208, -1939, 2206, -1938, 2206, -1939, 2207, -1938,
+    2206, -1937, 2206, -1936, 2206, -1937, 2206, -1934, 2206, -1936, 2205, -1935, 2205, -1933, 2205, -1934,
+    2205, -1933, 2204, -1932, 2205, -1932, 2205, -1931, 2204, -1930, 2204, -1931, 2203, -1929, 2203, -1929,
+    2204, -1928, 2204, -1927, 2203, -1928, 2203, -1927, 2203, -1926, 2203, -1925, 2202, -1925, 2202, -1925,
+    2202, -1924, 2203, -1923, 2202, -1923, 2201, -1922, 2202, -1922, 2201, -1921, 2202, -1920, 2202, -1921,
+    2201, -1919, 2200, -1919, 2201, -1919, 2200, -1919, 2202, -1917, 2201, -1917, 2200, -1916, 2201, -1916,
+    2200, -1916, 2201, -1916, 2199, -1914, 2200, -1914, 2201, -1914, 2199, -1913, 2200, -1913, 2200, -1911,
+    2199, -1912, 2201, -1911, 2198, -1911, 2199, -1910, 2201, -1910, 2198, -1909, 2200, -1908, 2200, -1908,
+    2198, -1908, 2199, -1907, 2199, -1907, 2199, -1907, 2198, -1905, 2199, -1905, 2199, -1905, 2197, -1903,
+    2198, -1904, 2199, -1903, 2198, -1903, 2198, -1901, 2198, -1902, 2197, -1901, 2199, -1901, 2197, -1900,
+    2198, -1900, 2198, -1899, 2197, -1900, 2198, -1897, 2197, -1898, 2197, -1898, 2197, -1896, 2198, -1897,
+    2198, -1897, 2197, -1895, 2197, -1895, 2198, -1894, 2197, -1894, 2197, -1894, 2197, -1893, 2197, -1893,
+    2197, -1892, 2197, -1892, 2197, -1891, 2197, -1891, 2197, -1891, 2198, -1890, 2196, -1889, 2198, -1890,
+    2197, -1888, 2196, -1889, 2197, -1887, 2197, -1888, 2197, -1886, 2197, -1888, 2197, -1885, 2197, -1886,
+    2197, -1886, 2198, -1884, 2197, -1884, 2197, -1884, 2196, -1883, 2198, -1884, 2197, -1882, 2196, -1882,
+    2197, -1882, 2197, -1881, 2197, -1881, 2197, -1881, 2197, -1879, 2197, -1880, 2199, -1880, 2197, -1878,
+    2197, -1879, 2197, -1877, 2197, -1878, 2196, -1878, 2198, -1876, 2198, -1876, 2198, -1876, 2198, -1876,
+    2197, -1875, 2198, -1875, 2197, -1874, 2197, -1873, 2199, -1874, 2198, -1873, 2198, -1873, 2198, -1872,
+    2197, -1872, 2198, -1872, 2198, -1870, 2199, -1871, 2198, -1870, 2199, -1871, 2198, -1869, 2199, -1869,
+    2198, -1869, 2199, -1867, 2198, -1869, 2199, -1867, 2199, -1868, 2200, -1866, 2199, -1866, 2198, -1867,
+    2200, -1865, 2200, -1866, 2198, -1865, 2200, -1864, 2200, -1864, 2200, -1864, 2200, -1863, 2199, -1863,
+    2201, -1863, 2200, -1862, 2200, -1862, 2200, -1861, 2201, -1862, 2202, -1860, 2200, -1861, 2201, -1860,
+    2200, -1860, 2201, -1858, 2200, -1860, 2202, -1858, 2203, -1859, 2202, -1857, 2201, -1858, 2202, -1857,
+    2201, -1857, 2203, -1856, 2202, -1857, 2203, -1856, 2202, -1855, 2203, -1855, 2202, -1854, 2203, -1855,
+    2203, -1854, 2204, -1854, 2203, -1853, 2204, -1853, 2203, -1852, 2204, -1853, 2203, -1852, 2205, -1852,
+    2205, -1850, 2204, -1851, 2205, -1851, 2205, -1850, 2205, -1851, 2205, -1849, 2206, -1849, 2206, -1849,
+    2204, -1849, 2207, -1849, 2207, -1848, 2206, -1847, 2206, -1847, 2206, -1847, 2207, -1847, 2208, -1846,
+    2208, -1846, 2206, -1846, 2208, -1845, 2208, -1846, 2208, -1844, 2208, -1845, 2209, -1844, 2208, -1844,
+    2210, -1844, 2209, -1842, 2210, -1843, 2208, -1843, 2210, -1842, 2210, -1842, 2209, -1842, 2212, -1841,
+    2210, -1841, 2211, -1841, 2211, -1840, 2211, -1841, 2211, -1839, 2213, -1840, 2211, -1839, 2213, -1839,
+    2212, -1839, 2213, -1838, 2213, -1837, 2213, -1838, 2213, -1838, 2215, -1837, 2213, -1837, 2215, -1837,
+    2215, -1837, 2213, -1834, 2216, -1837, 2215, -1835, 2216, -1835, 2216, -1836, 2216, -1835, 2216, -1834,
+    2216, -1833, 2217, -1834, 2217, -1833, 2217, -1834, 2218, -1833, 2219, -1832, 2217, -1833, 2219, -1833,
+    2219, -1831, 2219, -1832, 2220, -1831, 2218, -1831, 2222, -1831, 2219, -1831, 2222, -1830, 2220, -1830,
+    2221, -1830, 2221, -1829, 2222, -1830, 2222, -1828, 2224, -1829, 2222, -1829, 2223, -1828, 2224, -1828,
+    2224, -1828, 2224, -1827, 2224, -1827, 2225, -1827, 2224, -1827, 2226, -1826, 2226, -1827, 2226, -1825,
+    2227, -1826, 2227, -1825, 2226, -1826, 2229, -1825, 2227, -1825, 2227, -1824, 2230, -1825, 2229, -1824,
+    2228, -1823, 2230, -1824, 2229, -1823, 2231, -1824, 2231, -1822, 2230, -1823, 2232, -1823, 2231, -1822,
+    2233, -1822, 2232, -1822, 2231, -1820, 2232, -1820, 2232, -1819, 2228, -1817, 2227, -1815, 2226, -1813,
+    2222, -1810, 2220, -1807, 2215, -1803, 2213, -1799, 2206, -1796, 2204, -1791, 2196, -1785, 2190, -1781,
+    2185, -1775, 2179, -1769, 2170, -1762, 2163, -1756, 2155, -1748, 2145, -1742, 2138, -1733, 2127, -1726,
+    2119, -1717, 2107, -1708, 2098, -1698, 2085, -1689, 2073, -1679, 2063, -1669, 2048, -1658, 2036, -1646,
+    2021, -1636, 2009, -1624, 1994, -1612, 1979, -1598, 1964, -1587, 1947, -1574, 1932, -1559, 1915, -1546,
+    1897, -1531, 1881, -1517, 1861, -1502, 1844, -1486, 1824, -1470, 1804, -1456, 1785, -1439, 1765, -1421,
+    1744, -1404, 1722, -1387, 1701, -1369, 1678, -1352, 1656, -1332, 1633, -1314, 1612, -1296, 1590, -1278,
+    1566, -1260, 1545, -1242, 1522, -1223, 1501, -1206, 1477, -1186, 1456, -1169, 1432, -1151, 1411, -1132,
+    1389, -1114, 1365, -1096, 1344, -1079, 1322, -1059, 1298, -1042, 1275, -1024, 1255, -1005, 1231, -987,
+    1209, -968, 1187, -952, 1164, -933, 1142, -914, 1120, -897, 1095, -878, 1075, -859, 1051, -843,
+    1029, -824, 1007, -806, 984, -787, 963, -770, 939, -751, 917, -733, 893, -716, 872, -697,
+    849, -679, 827, -661, 804, -642, 780, -625, 760, -606, 735, -590, 715, -569, 690, -552,
+    669, -535, 646, -515, 623, -499, 601, -479, 577, -462, 556, -444, 534, -426, 513, -408,
+    489, -392, 470, -375, 448, -358, 430, -343, 410, -327, 390, -312, 373, -298, 354, -282,
+    337, -268, 319, -255, 302, -241, 286, -229, 270, -215, 255, -203, 240, -191, 225, -180,
+    211, -169, 198, -158, 185, -147, 171, -137, 160, -127, 147, -117, 137, -110, 126, -99,
+    114, -93, 105, -83, 96, -76, 87, -69, 78, -63, 69, -56, 61, -48, 56, -44,
+    47, -38, 42, -33, 35, -29, 31, -24, 25, -19, 20, -17, 16, -13, 14, -11,
+    9, -8, 7, -5, 5, -4, 2, -2, 2, -1, 1, -1, 0, 0, 0, 0,
+    0, 0, 0, 1, -3, 1, -2, 2, -5, 4, -7, 5, -9, 8, -13, 10,
+    -17, 14, -19, 16, -25, 20, -31, 24, -36, 28, -41, 33, -47, 39, -55, 42,
+    -61, 50, -70, 56, -77, 61, -87, 69, -95, 76, -104, 84, -115, 91, -126, 100,
+    -135, 108, -149, 118, -158, 127, -173, 137, -183, 146, -196, 157, -212, 169, -224, 180,
+    -240, 190, -254, 204, -269, 215, -287, 228, -301, 240, -318, 254, -337, 269, -353, 282,
+    -372, 296, -390, 311, -409, 327, -428, 342, -450, 358, -469, 375, -489, 391, -511, 407,
+    -533, 426, -555, 442, -576, 462, -600, 479, -623, 498, -646, 515, -666, 534, -692, 551,
+    -712, 570, -736, 588, -757, 605, -781, 624, -804, 643, -825, 660, -849, 679, -870, 696,
+    -894, 714, -917, 733, -938, 751, -961, 769, -983, 787, -1006, 805, -1028, 823, -1051, 842,
+    -1074, 859, -1096, 878, -1119, 896, -1141, 913, -1162, 933, -1187, 950, -1208, 969, -1231, 986,
+    -1253, 1005, -1275, 1023, -1298, 1041, -1320, 1059, -1343, 1077, -1365, 1096, -1388, 1114, -1409, 1131,
+    -1433, 1150, -1454, 1169, -1479, 1186, -1498, 1205, -1522, 1223, -1544, 1240, -1565, 1260, -1589, 1277,
+    -1611, 1296, -1633, 1314, -1655, 1331, -1678, 1351, -1699, 1368, -1723, 1387, -1745, 1405, -1766, 1423,
+    -1789, 1442, -1811, 1460, -1833, 1477, -1856, 1496, -1876, 1515, -1900, 1533, -1923, 1551, -1944, 1569,
+    -1965, 1588, -1989, 1606, -2011, 1623, -2031, 1643, -2054, 1661, -2077, 1679, -2100, 1698, -2121, 1716,
+    -2141, 1734, -2166, 1752, -2187, 1771, -2209, 1789, -2229, 1807, -2253, 1826, -2276, 1844, -2297, 1864,
+    -2318, 1880, -2341, 1900, -2363, 1918, -2384, 1936, -2406, 1954, -2429, 1974, -2451, 1991, -2471, 2011,
+    -2495, 2028, -2516, 2047, -2538, 2065, -2559, 2084, -2582, 2102, -2603, 2121, -2625, 2139, -2647, 2159,
+    -2669, 2176, -2691, 2195, -2713, 2213, -2734, 2233, -2755, 2251, -2777, 2269, -2801, 2288, -2820, 2305,
+    -2843, 2326, -2865, 2343, -2886, 2363, -2908, 2381, -2929, 2400, -2951, 2418, -2973, 2437, -2994, 2456,
+    -3017, 2474, -3038, 2493, -3060, 2512, -3080, 2531, -3103, 2549, -3125, 2568, -3146, 2587, -3167, 2606,
+    -3189, 2624, -3211, 2644, -3233, 2662, -3253, 2681, -3276, 2699, -3297, 2719, -3318, 2738, -3340, 2757,
+    -3362, 2775, -3384, 2794, -3404, 2815, -3426, 2832, -3447, 2851, -3469, 2870, -3491, 2890, -3512, 2908,
+    -3533, 2928, -3556, 2946, -3576, 2966, -3598, 2985, -3620, 3004, -3640, 3022, -3661, 3041, -3680, 3058,
+    -3700, 3077, -3718, 3093, -3736, 3110, -3757, 3127, -3773, 3142, -3790, 3159, -3808, 3175, -3824, 3188,
+    -3839, 3205, -3855, 3219, -3870, 3231, -3885, 3247, -3899, 3259, -3912, 3273, -3926, 3285, -3939, 3297,
+    -3951, 3309, -3964, 3322, -3974, 3331, -3985, 3344, -3998, 3353, -4006, 3364, -4016, 3373, -4027, 3383,
+    -4035, 3393, -4043, 3400, -4051, 3410, -4059, 3417, -4067, 3425, -4073, 3432, -4080, 3440, -4086, 3445,
+    -4089, 3453, -4097, 3457, -4100, 3464, -4106, 3469, -4108, 3473, -4112, 3478, -4114, 3482, -4118, 3485,
+    -4119, 3490, -4121, 3492, -4123, 3495, -4122, 3496, -4124, 3499, -4123, 3501, -4122, 3501, -4123, 3503,
+    -4122, 3505, -4123, 3505, -4121, 3508, -4122, 3508, -4121, 3511, -4122, 3510, -4121, 3513, -4121, 3515,
+    -4120, 3515, -4121, 3518, -4120, 3518, -4120, 3520, -4120, 3521, -4120, 3524, -4120, 3524, -4120, 3526,
+    -4120, 3527, -4119, 3529, -4119, 3531, -4120, 3531, -4119, 3534, -4120, 3535, -4119, 3536, -4120, 3539,
+    -4120, 3539, -4118, 3541, -4121, 3543, -4119, 3544, -4119, 3546, -4120, 3547, -4120, 3550, -4119, 3550,
+    -4121, 3553, -4120, 3553, -4120, 3556, -4121, 3557, -4120, 3559, -4121, 3561, -4120, 3561, -4122, 3564,
+    -4121, 3566, -4122, 3567, -4121, 3569, -4122, 3570, -4122, 3573, -4123, 3574, -4122, 3575, -4124, 3578,
+    -4123, 3579, -4124, 3581, -4123, 3583, -4124, 3584, -4125, 3586, -4125, 3589, -4125, 3590, -4126, 3591,
+    -4126, 3594, -4126, 3595, -4127, 3597, -4128, 3599, -4128, 3600, -4128, 3603, -4128, 3604, -4129, 3607,
+    -4130, 3608, -4128, 3610, -4130, 3610, -4128, 3610, -4125, 3611, -4123, 3612, -4123, 3609, -4119, 3609,
+    -4116, 3608, -4111, 3606, -4109, 3604, -4104, 3602, -4099, 3598, -4093, 3595, -4087, 3592, -4083, 3587,
+    -4074, 3583, -4067, 3578, -4061, 3573, -4052, 3567, -4043, 3561, -4036, 3555, -4025, 3548, -4016, 3540,
+    -4006, 3534, -3995, 3525, -3984, 3517, -3973, 3508, -3962, 3499, -3948, 3489, -3936, 3479, -3923, 3469,
+    -3908, 3458, -3896, 3447, -3879, 3435, -3866, 3423, -3850, 3410, -3835, 3398, -3817, 3384, -3801, 3371,
+    -3784, 3357, -3767, 3343, -3747, 3327, -3730, 3312, -3712, 3296, -3690, 3281, -3672, 3263, -3651, 3246,
+    -3629, 3230, -3610, 3211, -3588, 3193, -3567, 3176, -3544, 3157, -3524, 3139, -3501, 3121, -3481, 3103,
+    -3459, 3084, -3437, 3067, -3416, 3047, -3394, 3030, -3373, 3012, -3351, 2993, -3329, 2975, -3309, 2957,
+    -3288, 2937, -3265, 2920, -3243, 2901, -3222, 2883, -3201, 2864, -3179, 2846, -3157, 2827, -3135, 2809,
+    -3114, 2789, -3093, 2772, -3070, 2753, -3050, 2734, -3027, 2715, -3006, 2696, -2985, 2678, -2961, 2659,
+    -2941, 2640, -2919, 2622, -2898, 2602, -2875, 2584, -2853, 2564, -2832, 2546, -2811, 2528, -2788, 2507,
+    -2767, 2489, -2744, 2470, -2723, 2450, -2701, 2432, -2680, 2413, -2657, 2393, -2636, 2374, -2613, 2355,
+    -2592, 2336, -2570, 2317, -2548, 2297, -2527, 2279, -2505, 2258, -2481, 2240, -2460, 2221, -2439, 2201,
+    -2416, 2180, -2395, 2163, -2373, 2142, -2350, 2124, -2328, 2104, -2306, 2084, -2285, 2065, -2261, 2044,
+    -2241, 2026, -2219, 2006, -2195, 1987, -2174, 1966, -2152, 1947, -2129, 1928, -2108, 1908, -2086, 1887,
+    -2063, 1869, -2040, 1848, -2019, 1829, -1998, 1809, -1974, 1789, -1952, 1769, -1930, 1750, -1909, 1729,
+    -1883, 1710, -1864, 1690, -1841, 1670, -1819, 1649, -1798, 1630, -1772, 1610, -1753, 1590, -1730, 1570,
+    -1706, 1549, -1686, 1531, -1662, 1509, -1641, 1490, -1616, 1469, -1596, 1449, -1574, 1429, -1550, 1409,
+    -1528, 1389, -1506, 1368, -1484, 1349, -1461, 1328, -1437, 1308, -1417, 1288, -1394, 1266, -1370, 1248,
+    -1348, 1227, -1327, 1206, -1304, 1186, -1280, 1165, -1259, 1146, -1237, 1125, -1212, 1104, -1191, 1084,
+    -1169, 1064, -1146, 1042, -1122, 1024, -1101, 1002, -1078, 982, -1057, 961, -1032, 941, -1010, 920,
+    -989, 900, -963, 879, -944, 859, -919, 838, -897, 818, -875, 796, -852, 777, -829, 757,
+    -806, 734, -784, 715, -761, 695, -740, 672, -716, 653, -692, 632, -670, 612, -649, 591,
+    -625, 568, -602, 551, -579, 528, -558, 508, -534, 488, -514, 468, -491, 449, -471, 429,
+    -450, 411, -430, 393, -411, 374, -392, 357, -372, 341, -355, 323, -336, 308, -321, 292,
+    -303, 275, -286, 262, -270, 247, -256, 233, -240, 219, -225, 206, -212, 192, -197, 181,
+    -185, 168, -171, 157, -160, 146, -148, 135, -137, 124, -125, 115, -114, 105, -106, 95,
+    -95, 86, -86, 81, -78, 69, -69, 64, -62, 56, -54, 50, -48, 44, -41, 37,
+    -35, 32, -30, 27, -25, 22, -20, 19, -16, 15, -13, 11, -8, 9, -7, 7,
+    -4, 2, -3, 4, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1,
+    -1, -4, -6, -3, -5, -7, -9, -9, -11, -12, -14, -16, -18, -19, -22, -24,
+    -25, -29, -32, -33, -35, -40, -42, -45, -46, -52, -54, -59, -61, -67, -67, -74,
+    -75, -82, -84, -91, -91, -100, -98, -110, -110, -119, -118, -130, -129, -141, -138, -152,
+    -148, -163, -159, -176, -172, -189, -183, -201, -197, -214, -208, -229, -222, -243, -234, -257,
+    -247, -273, -264, -288, -276, -304, -293, -321, -308, -337, -323, -355, -339, -372, -357, -391,
+    -374, -410, -389, -427, -409, -447, -427, -468, -445, -488, -463, -509, -485, -528, -503, -552,
+    -523, -572, -542, -594, -562, -616, -584, -637, -602, -659, -622, -681, -642, -701, -661, -723,
+    -683, -745, -701, -766, -722, -788, -740, -809, -762, -831, -782, -852, -800, -873, -821, -896,
+    -841, -916, -862, -938, -881, -960, -901, -980, -920, -1002, -941, -1024, -961, -1045, -981, -1066,
+    -1001, -1088, -1021, -1108, -1042, -1131, -1061, -1150, -1082, -1173, -1101, -1195, -1122, -1215, -1143, -1236,
+    -1160, -1259, -1183, -1278, -1202, -1301, -1223, -1321, -1243, -1343, -1263, -1364, -1285, -1384, -1303, -1407,
+    -1323, -1428, -1345, -1448, -1364, -1470, -1386, -1489, -1405, -1512, -1426, -1533, -1447, -1554, -1466, -1574,
+    -1486, -1596, -1509, -1617, -1528, -1636, -1547, -1658, -1566, -1677, -1587, -1696, -1604, -1714, -1622, -1734,
+    -1640, -1751, -1658, -1768, -1675, -1785, -1692, -1803, -1708, -1817, -1723, -1834, -1739, -1848, -1755, -1864,
+    -1769, -1878, -1783, -1891, -1798, -1906, -1812, -1917, -1823, -1931, -1838, -1943, -1849, -1954, -1862, -1966,
+    -1873, -1976, -1885, -1988, -1895, -1997, -1906, -2006, -1916, -2015, -1926, -2024, -1934, -2032, -1945, -2040,
+    -1951, -2048, -1962, -2053, -1967, -2061, -1976, -2066, -1982, -2072, -1990, -2078, -1994, -2082, -2002, -2086,
+    -2006, -2090, -2011, -2094, -2016, -2097, -2020, -2099, -2024, -2101, -2026, -2103, -2030, -2104, -2032, -2106,
+    -2034, -2105, -2037, -2106, -2037, -2105, -2038, -2105, -2040, -2104, -2040, -2103, -2041, -2101, -2042, -2102,
+    -2043, -2100, -2043, -2100, -2045, -2099, -2045, -2098, -2047, -2098, -2047, -2096, -2049, -2096, -2048, -2095,
+    -2050, -2094, -2050, -2093, -2052, -2093, -2052, -2091, -2054, -2091, -2055, -2090, -2054, -2089, -2055, -2087,
+    -2058, -2088, -2057, -2087, -2059, -2085, -2059, -2084, -2061, -2085, -2061, -2083, -2062, -2082, -2061, -2082,
+    -2065, -2080, -2062, -2080, -2067, -2079, -2066, -2078, -2068, -2078, -2068, -2076, -2068, -2076, -2070, -2075,
+    -2071, -2074, -2072, -2073, -2072, -2073, -2073, -2071, -2073, -2071, -2076, -2070, -2075, -2069, -2077, -2068,
+    -2078, -2067, -2077, -2067, -2080, -2066, -2080, -2064, -2081, -2064, -2082, -2063, -2082, -2062, -2082, -2062,
+    -2084, -2061, -2086, -2059, -2086, -2059, -2087, -2057, -2087, -2058, -2089, -2056, -2088, -2055, -2091, -2055,
+    -2090, -2053, -2093, -2053, -2091, -2052, -2093, -2051, -2095, -2050, -2094, -2050, -2097, -2048, -2097, -2047,
+    -2097, -2047, -2098, -2046, -2099, -2045, -2100, -2044, -2101, -2043, -2102, -2042, -2102, -2042, -2104, -2041,
+    -2103, -2039, -2105, -2039, -2106, -2038, -2106, -2037, -2108, -2037, -2108, -2035, -2109, -2035, -2110, -2033,
+    -2111, -2033, -2111, -2032, -2113, -2031, -2113, -2031, -2114, -2029, -2114, -2028, -2116, -2028, -2117, -2026,
+    -2117, -2027, -2118, -2024, -2119, -2024, -2120, -2024, -2120, -2022, -2121, -2022, -2123, -2021, -2123, -2019,
+    -2124, -2019, -2124, -2018, -2125, -2017, -2127, -2016, -2127, -2015, -2128, -2014, -2129, -2015, -2129, -2012,
+    -2130, -2012, -2132, -2011, -2131, -2010, -2134, -2009, -2133, -2009, -2134, -2007, -2136, -2006, -2136, -2006,
+    -2137, -2004, -2137, -2004, -2138, -2003, -2139, -2002, -2140, -2001, -2142, -2000, -2141, -2000, -2143, -1998,
+    -2143, -1998, -2144, -1996, -2144, -1996, -2146, -1995, -2146, -1995, -2148, -1992, -2148, -1992, -2149, -1992,
+    -2149, -1989, -2150, -1990, -2150, -1989, -2152, -1987, -2153, -1987, -2153, -1985, -2154, -1985, -2156, -1984,
+    -2156, -1983, -2156, -1982, -2157, -1981, -2158, -1980, -2159, -1979, -2159, -1978, -2160, -1978, -2161, -1976,
+    -2162, -1975, -2163, -1974, -2163, -1975, -2164, -1972, -2164, -1972, -2167, -1971, -2166, -1969, -2167, -1970,
+    -2168, -1967, -2168, -1968, -2170, -1967, -2171, -1964, -2170, -1965, -2173, -1964, -2172, -1963, -2174, -1962,
+    -2173, -1960, -2176, -1960, -2175, -1958, -2178, -1958, -2177, -1957, -2177, -1957, -2179, -1955, -2180, -1954,
+    -2181, -1954, -2181, -1952, -2181, -1952, -2183, -1951, -2184, -1949, -2184, -1948, -2185, -1948, -2185, -1947,
+    -2188, -1946, -2188, -1945, -2186, -1944, -2190, -1943, -2189, -1941, -2189, -1942, -2191, -1940, -2192, -1939,
+    -2192, -1938, -2193, -1936, -2194, -1937, -2194, -1936, -2195, -1934, -2196, -1933, -2198, -1933, -2197, -1931,
+    -2198, -1931, -2199, -1929, -2200, -1928, -2199, -1929, -2203, -1926, -2201, -1925, -2203, -1925, -2204, -1924,
+    -2204, -1923, -2205, -1922, -2205, -1920, -2206, -1920, -2207, -1919, -2209, -1918, -2207, -1917, -2210, -1917,
+    -2209, -1915, -2213, -1914, -2210, -1913, -2213, -1912, -2213, -1912, -2213, -1910, -2215, -1909, -2215, -1909,
+    -2216, -1907, -2217, -1906, -2218, -1905, -2217, -1905, -2219, -1903, -2219, -1903, -2220, -1902, -2222, -1900,
+    -2221, -1900, -2222, -1898, -2224, -1898, -2224, -1896, -2224, -1897, -2226, -1893, -2226, -1894, -2226, -1893,
+    -2227, -1892, -2230, -1891, -2227, -1889, -2231, -1889, -2230, -1888, -2232, -1886, -2231, -1887, -2233, -1884,
+    -2233, -1884, -2233, -1883, -2235, -1882, -2235, -1880, -2235, -1881, -2238, -1878, -2238, -1878, -2238, -1877,
+    -2239, -1876, -2240, -1874, -2240, -1874, -2240, -1873, -2242, -1872, -2243, -1871, -2242, -1871, -2246, -1868,
+    -2243, -1868, -2245, -1866, -2246, -1866, -2247, -1866, -2248, -1863, -2248, -1863, -2248, -1862, -2249, -1861,
+    -2251, -1860, -2251, -1859, -2251, -1858, -2253, -1856, -2252, -1856, -2254, -1855, -2255, -1854, -2255, -1853,
+    -2256, -1852, -2256, -1851, -2257, -1849, -2258, -1849, -2259, -1848, -2259, -1846, -2259, -1846, -2261, -1844,
+    -2262, -1844, -2261, -1843, -2263, -1842, -2264, -1840, -2264, -1839, -2265, -1839, -2264, -1838, -2267, -1836,
+    -2267, -1836, -2267, -1834, -2269, -1833, -2268, -1833, -2270, -1832, -2270, -1829, -2270, -1830, -2273, -1829,
+    -2272, -1827, -2273, -1826, -2273, -1825, -2275, -1824, -2274, -1824, -2276, -1821, -2277, -1821, -2276, -1821,
+    -2278, -1818, -2278, -1818, -2280, -1817, -2280, -1816, -2280, -1815, -2280, -1814, -2283, -1812, -2282, -1812,
+    -2283, -1811, -2285, -1810, -2283, -1808, -2286, -1808, -2285, -1806, -2287, -1806, -2287, -1804, -2289, -1803,
+    -2287, -1803, -2290, -1801, -2290, -1800, -2290, -1800, -2291, -1797, -2293, -1797, -2291, -1797, -2293, -1795,
+    -2294, -1793, -2294, -1793, -2295, -1792, -2296, -1791, -2297, -1789, -2297, -1789, -2297, -1788, -2300, -1786,
+    -2299, -1785, -2299, -1785, -2301, -1783, -2300, -1782, -2303, -1782, -2302, -1780, -2303, -1779, -2304, -1778,
+    -2305, -1777, -2304, -1776, -2305, -1775, -2307, -1773, -2307, -1773, -2308, -1772, -2307, -1770, -2309, -1769,
+    -2310, -1769, -2311, -1767, -2310, -1767, -2312, -1765, -2312, -1763, -2313, -1764, -2314, -1762, -2313, -1761,
+    -2315, -1759, -2315, -1759, -2317, -1758, -2316, -1757, -2318, -1755, -2319, -1754, -2318, -1754, -2319, -1752,
+    -2320, -1751, -2320, -1751, -2322, -1748, -2322, -1748, -2320, -1746, -2321, -1744, -2319, -1742, -2320, -1738,
+    -2315, -1736, -2314, -1733, -2311, -1727, -2308, -1726, -2303, -1719, -2299, -1716, -2294, -1710, -2289, -1705,
+    -2283, -1699, -2278, -1693, -2270, -1686, -2263, -1679, -2256, -1673, -2247, -1665, -2238, -1656, -2230, -1649,
+    -2219, -1641, -2211, -1632, -2199, -1622, -2188, -1613, -2179, -1603, -2164, -1594, -2152, -1582, -2141, -1571,
+    -2125, -1561, -2114, -1550, -2097, -1537, -2085, -1525, -2068, -1513, -2052, -1500, -2036, -1487, -2020, -1473,
+    -2002, -1460, -1984, -1446, -1966, -1432, -1949, -1417, -1929, -1402, -1908, -1387, -1888, -1371, -1870, -1356,
+    -1848, -1337, -1825, -1323, -1803, -1305, -1781, -1288, -1760, -1271, -1733, -1254, -1712, -1234, -1690, -1219,
+    -1665, -1200, -1642, -1183, -1618, -1166, -1597, -1148, -1571, -1131, -1550, -1112, -1526, -1096, -1502, -1079,
+    -1480, -1061, -1456, -1044, -1433, -1026, -1409, -1009, -1386, -992, -1363, -975, -1340, -957, -1316, -941,
+    -1292, -922, -1268, -907, -1247, -888, -1222, -872, -1199, -854, -1175, -838, -1153, -820, -1128, -803,
+    -1105, -786, -1082, -769, -1057, -752, -1036, -735, -1010, -719, -988, -701, -963, -684, -942, -666,
+    -916, -651, -894, -633, -869, -617, -846, -600, -825, -582, -798, -565, -776, -550, -752, -532,
+    -729, -515, -703, -499, -682, -481, -658, -465, -633, -448, -611, -431, -587, -415, -564, -397,
+    -541, -382, -517, -366, -497, -351, -476, -335, -454, -320, -434, -306, -413, -291, -394, -278,
+    -375, -264, -358, -252, -337, -238, -321, -226, -303, -214, -286, -202, -272, -191, -254, -179,
+    -240, -168, -225, -159, -211, -148, -195, -138, -184, -129, -170, -119, -157, -111, -146, -103,
+    -134, -94, -123, -87, -112, -79, -102, -72, -93, -66, -84, -59, -75, -52, -67, -47,
+    -59, -42, -52, -36, -45, -33, -38, -27, -34, -22, -27, -19, -22, -17, -19, -13,
+    -14, -10, -11, -7, -8, -6, -6, -3, -2, -3, -2, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 1, -2, 1, -2, 5, -5, 5, -7, 9, -10,
+    12, -14, 13, -17, 19, -22, 23, -27, 26, -31, 31, -37, 37, -44, 43, -50,
+    48, -58, 54, -65, 61, -73, 68, -82, 76, -90, 86, -102, 92, -110, 102, -121,
+    110, -132, 122, -144, 130, -155, 140, -168, 152, -181, 163, -194, 174, -208, 186, -222,
+    200, -238, 212, -253, 225, -268, 239, -285, 251, -301, 268, -318, 281, -336, 297, -355,
+    314, -373, 327, -392, 346, -412, 361, -432, 379, -452, 397, -473, 415, -495, 432, -516,
+    453, -540, 470, -562, 491, -586, 510, -609, 530, -633, 550, -657, 570, -681, 590, -705,
+    610, -728, 629, -753, 650, -776, 670, -800, 689, -824, 709, -847, 730, -873, 748, -895,
+    769, -918, 788, -944, 809, -967, 828, -991, 848, -1014, 867, -1038, 888, -1062, 907, -1086,
+    927, -1109, 946, -1133, 967, -1157, 985, -1181, 1006, -1204, 1025, -1228, 1044, -1252, 1065, -1276,
+    1083, -1299, 1104, -1324, 1123, -1346, 1142, -1370, 1163, -1394, 1182, -1419, 1200, -1441, 1220, -1465,
+    1241, -1489, 1259, -1512, 1278, -1536, 1298, -1559, 1318, -1584, 1337, -1607, 1356, -1630, 1375, -1654,
+    1395, -1678, 1415, -1701, 1433, -1725, 1452, -1749, 1472, -1771, 1491, -1797, 1509, -1817, 1529, -1842,
+    1545, -1863, 1563, -1885, 1580, -1906, 1597, -1926, 1614, -1948, 1630, -1966, 1644, -1985, 1659, -2005,
+    1674, -2022, 1689, -2040, 1703, -2058, 1715, -2074, 1729, -2092, 1741, -2106, 1753, -2121, 1765, -2137,
+    1776, -2152, 1787, -2164, 1798, -2179, 1808, -2192, 1818, -2204, 1827, -2215, 1836, -2228, 1844, -2238,
+    1852, -2249, 1860, -2259, 1868, -2269, 1874, -2279, 1882, -2286, 1887, -2295, 1893, -2302, 1897, -2310,
+    1902, -2316, 1907, -2323, 1912, -2329, 1916, -2334, 1918, -2338, 1921, -2344, 1924, -2347, 1927, -2350,
+    1927, -2354, 1930, -2356, 1930, -2358, 1932, -2360, 1930, -2361, 1931, -2361, 1931, -2362, 1929, -2360,
+    1928, -2362, 1929, -2361, 1926, -2360, 1926, -2360, 1925, -2360, 1924, -2359, 1923, -2359, 1922, -2359,
+    1921, -2359, 1920, -2358, 1920, -2358, 1918, -2358, 1918, -2358, 1917, -2356, 1915, -2357, 1915, -2358,
+    1914, -2356, 1913, -2355, 1912, -2356, 1911, -2355, 1910, -2356, 1910, -2354, 1908, -2354, 1908, -2355,
+    1906, -2354, 1905, -2353, 1906, -2353, 1903, -2354, 1903, -2352, 1902, -2353, 1901, -2352, 1900, -2353,
+    1900, -2352, 1898, -2351, 1898, -2352, 1897, -2351, 1896, -2352, 1895, -2350, 1894, -2351, 1893, -2351,
+    1893, -2350, 1892, -2349, 1891, -2350, 1889, -2349, 1889, -2350, 1888, -2349, 1887, -2348, 1886, -2349,
+    1888, -2348, 1883, -2348, 1885, -2348, 1882, -2347, 1882, -2348, 1881, -2347, 1881, -2347, 1878, -2346,
+    1879, -2347, 1879, -2346, 1877, -2347, 1875, -2345, 1875, -2346, 1876, -2346, 1872, -2345, 1873, -2346,
+    1872, -2344, 1871, -2345, 1871, -2345, 1869, -2345, 1867, -2343, 1868, -2344, 1867, -2344, 1866, -2344,
+    1866, -2343, 1864, -2344, 1863, -2343, 1863, -2342, 1862, -2344, 1860, -2343, 1861, -2342, 1860, -2342,
+    1858, -2342, 1859, -2343, 1855, -2342, 1856, -2341, 1856, -2342, 1854, -2341, 1854, -2342, 1854, -2341,
+    1852, -2341, 1851, -2341, 1851, -2342, 1850, -2341, 1848, -2340, 1849, -2341, 1846, -2340, 1848, -2340,
+    1845, -2340, 1845, -2341, 1845, -2339, 1843, -2341, 1843, -2339, 1841, -2340, 1842, -2339, 1839, -2340,
+    1841, -2340, 1839, -2338, 1837, -2340, 1837, -2338, 1837, -2339, 1835, -2340, 1835, -2339, 1834, -2338,
+    1835, -2340, 1832, -2337, 1831, -2339, 1832, -2338, 1830, -2339, 1830, -2339, 1828, -2337, 1829, -2338,
+    1827, -2339, 1826, -2338, 1827, -2338, 1824, -2337, 1825, -2339, 1822, -2337, 1823, -2338, 1823, -2338,
+    1821, -2337, 1821, -2338, 1819, -2337, 1819, -2338, 1819, -2338, 1818, -2337, 1815, -2337, 1817, -2337,
+    1815, -2338, 1815, -2336, 1814, -2337, 1812, -2338, 1812, -2337, 1811, -2336, 1812, -2338, 1809, -2336,
+    1810, -2337, 1808, -2337, 1808, -2336, 1807, -2337, 1805, -2336, 1807, -2337, 1804, -2337, 1804, -2336,
+    1804, -2337, 1802, -2336, 1803, -2337, 1800, -2336, 1800, -2337, 1800, -2337, 1800, -2337, 1798, -2336,
+    1798, -2337, 1796, -2336, 1797, -2338, 1795, -2336, 1795, -2337, 1795, -2337, 1793, -2337, 1793, -2337,
+    1792, -2336, 1791, -2337, 1791, -2338, 1790, -2336, 1789, -2338, 1788, -2337, 1789, -2337, 1787, -2338,
+    1787, -2337, 1785, -2337, 1785, -2338, 1785, -2337, 1784, -2338, 1783, -2337, 1782, -2337, 1781, -2338,
+    1782, -2337, 1779, -2338, 1780, -2337, 1778, -2338, 1779, -2338, 1777, -2337, 1777, -2338, 1775, -2338,
+    1776, -2338, 1774, -2338, 1775, -2338, 1773, -2338, 1772, -2338, 1773, -2338, 1771, -2339, 1770, -2338,
+    1770, -2339, 1769, -2339, 1769, -2339, 1769, -2339, 1767, -2338, 1765, -2339, 1766, -2340, 1765, -2339,
+    1766, -2339, 1763, -2339, 1764, -2339, 1762, -2341, 1762, -2340, 1761, -2340, 1761, -2340, 1760, -2339,
+    1760, -2341, 1758, -2341, 1758, -2340, 1757, -2340, 1758, -2341, 1755, -2342, 1756, -2340, 1755, -2342,
+    1753, -2341, 1754, -2342, 1753, -2341, 1752, -2341, 1751, -2342, 1752, -2343, 1750, -2342, 1750, -2342,
+    1748, -2342, 1749, -2343, 1748, -2343, 1747, -2343, 1746, -2343, 1746, -2343, 1745, -2344, 1745, -2343,
+    1744, -2344, 1742, -2344, 1743, -2345, 1742, -2343, 1741, -2345, 1741, -2345, 1740, -2344, 1740, -2346,
+    1739, -2345, 1738, -2345, 1738, -2346, 1737, -2345, 1736, -2347, 1736, -2345, 1735, -2347, 1735, -2346,
+    1734, -2348, 1733, -2347, 1732, -2346, 1733, -2348, 1731, -2348, 1730, -2347, 1731, -2349, 1730, -2347,
+    1729, -2350, 1728, -2348, 1728, -2349, 1728, -2349, 1726, -2350, 1726, -2349, 1726, -2350, 1724, -2350,
+    1725, -2351, 1724, -2350, 1722, -2351, 1722, -2351, 1721, -2351, 1723, -2352, 1720, -2352, 1721, -2352,
+    1719, -2352, 1718, -2352, 1719, -2353, 1718, -2353, 1717, -2353, 1715, -2354, 1715, -2354, 1717, -2354,
+    1715, -2355, 1713, -2354, 1715, -2355, 1712, -2355, 1713, -2356, 1711, -2356, 1710, -2356, 1712, -2356,
+    1710, -2357, 1708, -2357, 1710, -2357, 1708, -2357, 1708, -2359, 1707, -2358, 1707, -2359, 1705, -2359,
+    1707, -2359, 1703, -2359, 1705, -2359, 1704, -2360, 1703, -2360, 1702, -2361, 1702, -2361, 1701, -2361,
+    1701, -2362, 1700, -2361, 1700, -2362, 1699, -2363, 1699, -2363, 1698, -2363, 1698, -2363, 1696, -2365,
+    1696, -2364, 1697, -2364, 1694, -2366, 1695, -2364, 1694, -2366, 1694, -2366, 1692, -2366, 1694, -2367,
+    1692, -2368, 1690, -2366, 1690, -2368, 1690, -2368, 1690, -2369, 1689, -2368, 1689, -2370, 1688, -2369,
+    1688, -2370, 1687, -2370, 1686, -2371, 1685, -2371, 1685, -2372, 1685, -2372, 1685, -2372, 1683, -2373,
+    1682, -2373, 1683, -2373, 1682, -2374, 1682, -2374, 1681, -2375, 1679, -2375, 1682, -2375, 1677, -2376,
+    1680, -2376, 1678, -2377, 1677, -2377, 1678, -2378, 1676, -2378, 1676, -2378, 1676, -2379, 1674, -2379,
+    1675, -2380, 1673, -2379, 1674, -2381, 1673, -2381, 1672, -2381, 1672, -2382, 1671, -2383, 1672, -2382,
+    1670, -2384, 1669, -2383, 1669, -2385, 1669, -2384, 1668, -2384, 1667, -2386, 1667, -2386, 1667, -2387,
+    1666, -2386, 1665, -2388, 1666, -2387, 1664, -2389, 1664, -2388, 1663, -2389, 1663, -2390, 1663, -2391,
+    1662, -2390, 1661, -2392, 1660, -2391, 1662, -2393, 1660, -2392, 1659, -2393, 1658, -2394, 1658, -2394,
+    1658, -2395, 1658, -2395, 1657, -2396, 1656, -2396, 1655, -2397, 1655, -2397, 1656, -2398, 1653, -2398,
+    1655, -2399, 1653, -2400, 1654, -2400, 1651, -2400, 1652, -2401, 1651, -2402, 1651, -2402, 1651, -2402,
+    1649, -2403, 1649, -2404, 1649, -2404, 1648, -2405, 1648, -2405, 1647, -2407, 1648, -2406, 1645, -2407,
+    1646, -2408, 1645, -2408, 1645, -2408, 1644, -2410, 1644, -2409, 1644, -2411, 1642, -2411, 1643, -2411,
+    1642, -2413, 1641, -2413, 1642, -2413, 1640, -2414, 1639, -2415, 1640, -2415, 1639, -2416, 1639, -2417,
+    1637, -2416, 1638, -2417, 1637, -2419, 1636, -2418, 1637, -2420, 1634, -2418, 1634, -2419, 1632, -2418,
+    1630, -2415, 1627, -2414, 1625, -2411, 1623, -2408, 1619, -2406, 1615, -2400, 1611, -2397, 1608, -2391,
+    1603, -2386, 1599, -2380, 1591, -2374, 1589, -2367, 1582, -2359, 1573, -2351, 1570, -2344, 1562, -2334,
+    1555, -2325, 1549, -2315, 1539, -2305, 1531, -2294, 1524, -2283, 1515, -2271, 1507, -2259, 1496, -2245,
+    1487, -2233, 1476, -2219, 1466, -2204, 1458, -2190, 1445, -2175, 1434, -2158, 1421, -2143, 1411, -2125,
+    1399, -2108, 1387, -2091, 1372, -2072, 1361, -2054, 1346, -2034, 1333, -2015, 1319, -1993, 1304, -1974,
+    1290, -1952, 1275, -1930, 1260, -1908, 1243, -1885, 1229, -1862, 1212, -1838, 1196, -1814, 1178, -1791,
+    1162, -1765, 1148, -1741, 1129, -1718, 1113, -1694, 1098, -1669, 1080, -1645, 1066, -1621, 1047, -1596,
+    1032, -1572, 1016, -1549, 1000, -1523, 983, -1500, 966, -1475, 951, -1451, 935, -1427, 917, -1402,
+    902, -1378, 886, -1353, 869, -1330, 854, -1304, 836, -1281, 821, -1256, 805, -1231, 787, -1208,
+    773, -1183, 756, -1158, 740, -1134, 723, -1109, 708, -1085, 691, -1060, 675, -1036, 660, -1012,
+    642, -986, 628, -963, 610, -937, 595, -914, 578, -888, 562, -865, 547, -839, 529, -814,
+    514, -791, 498, -766, 482, -742, 466, -716, 450, -692, 434, -667, 417, -643, 401, -618,
+    386, -594, 370, -569, 354, -547, 340, -523, 326, -502, 310, -478, 297, -458, 283, -436,
+    270, -416, 257, -395, 244, -377, 232, -357, 219, -339, 209, -321, 197, -303, 185, -287,
+    175, -269, 164, -254, 155, -238, 144, -222, 135, -209, 125, -193, 118, -181, 108, -168,
+    101, -155, 92, -142, 85, -131, 78, -120, 71, -110, 63, -99, 59, -90, 51, -79,
+    47, -72, 42, -63, 36, -56, 30, -48, 28, -42, 23, -36, 19, -30, 16, -25,
+    13, -19, 11, -16, 7, -13, 7, -8, 3, -6, 2, -4, 2, -2, 1, -1,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 3, 4, 6, 5, 8, 7,
+    13, 11, 15, 15, 22, 18, 26, 23, 31, 27, 38, 34, 44, 41, 52, 45,
+    60, 54, 69, 61, 77, 69, 88, 78, 97, 87, 109, 97, 119, 107, 131, 117,
+    145, 129, 158, 140, 171, 152, 185, 165, 200, 179, 217, 192, 231, 207, 248, 221,
+    265, 236, 282, 253, 301, 268, 321, 285, 338, 302, 360, 321, 380, 339, 401, 357,
+    422, 378, 444, 395, 468, 418, 490, 438, 516, 459, 539, 482, 564, 503, 589, 527,
+    617, 550, 643, 575, 670, 598, 697, 624, 726, 649, 757, 674, 782, 701, 812, 726,
+    840, 751, 869, 777, 897, 803, 925, 828, 955, 854, 983, 879, 1009, 905, 1041, 932,
+    1067, 955, 1096, 983, 1124, 1008, 1153, 1033, 1182, 1060, 1208, 1085, 1239, 1111, 1265, 1137,
+    1296, 1162, 1323, 1188, 1351, 1214, 1380, 1240, 1409, 1266, 1436, 1293, 1464, 1317, 1494, 1344,
+    1521, 1369, 1549, 1396, 1579, 1422, 1606, 1447, 1633, 1475, 1664, 1499, 1691, 1526, 1719, 1551,
+    1748, 1578, 1775, 1605, 1804, 1630, 1832, 1657, 1861, 1684, 1888, 1708, 1917, 1736, 1945, 1762,
+    1974, 1788, 2001, 1814, 2029, 1841, 2057, 1867, 2086, 1894, 2114, 1919, 2142, 1948, 2170, 1973,
+    2197, 1999, 2228, 2026, 2254, 2053, 2282, 2080, 2310, 2106, 2337, 2133, 2367, 2159, 2394, 2187,
+    2422, 2213, 2451, 2240, 2478, 2267, 2506, 2293, 2533, 2320, 2562, 2349, 2589, 2374, 2618, 2401,
+    2646, 2429, 2673, 2455, 2701, 2483, 2728, 2510, 2758, 2537, 2784, 2564, 2812, 2592, 2841, 2618,
+    2866, 2646, 2895, 2674, 2924, 2700, 2951, 2728, 2978, 2756, 3006, 2783, 3033, 2810, 3062, 2838,
+    3088, 2866, 3118, 2893, 3142, 2921, 3172, 2949, 3198, 2976, 3227, 3004, 3253, 3032, 3281, 3061,
+    3309, 3087, 3335, 3116, 3364, 3143, 3390, 3171, 3419, 3200, 3445, 3228, 3471, 3255, 3500, 3285,
+    3527, 3312, 3554, 3340, 3581, 3369, 3608, 3397, 3636, 3426, 3662, 3454, 3690, 3482, 3716, 3510,
+    3743, 3540, 3771, 3568, 3798, 3596, 3823, 3625, 3853, 3653, 3878, 3682, 3904, 3711, 3931, 3741,
+    3959, 3768, 3986, 3798, 4012, 3826, 4038, 3856, 4065, 3884, 4092, 3913, 4118, 3944, 4145, 3971,
+    4170, 4001, 4199, 4031, 4224, 4058, 4250, 4088, 4278, 4119, 4302, 4147, 4330, 4177, 4356, 4205,
+    4382, 4237, 4408, 4265, 4435, 4295, 4460, 4324, 4486, 4354, 4513, 4384, 4538, 4413, 4563, 4442,
+    4587, 4471, 4612, 4498, 4635, 4526, 4658, 4554, 4679, 4579, 4702, 4605, 4721, 4631, 4743, 4656,
+    4761, 4680, 4782, 4704, 4799, 4728, 4819, 4749, 4835, 4773, 4852, 4794, 4869, 4816, 4883, 4837,
+    4898, 4857, 4914, 4876, 4928, 4896, 4940, 4914, 4953, 4932, 4965, 4950, 4978, 4968, 4986, 4983,
+    4998, 5000, 5009, 5015, 5016, 5030, 5026, 5044, 5034, 5058, 5042, 5072, 5047, 5084, 5055, 5096,
+    5060, 5109, 5066, 5119, 5070, 5129, 5074, 5140, 5076, 5149, 5081, 5158, 5082, 5166, 5085, 5174,
+    5086, 5182, 5086, 5188, 5087, 5194, 5086, 5199, 5084, 5205, 5083, 5209, 5082, 5213, 5078, 5215,
+    5075, 5220, 5073, 5221, 5069, 5225, 5066, 5228, 5063, 5230, 5061, 5234, 5057, 5235, 5053, 5240,
+    5052, 5242, 5048, 5245, 5043, 5248, 5042, 5250, 5039, 5252, 5036, 5257, 5032, 5258, 5028, 5262,
+    5025, 5264, 5023, 5267, 5019, 5270, 5016, 5272, 5014, 5274, 5008, 5278, 5006, 5280, 5003, 5283,
+    4999, 5286, 4995, 5287, 4990, 5288, 4986, 5290, 4980, 5289, 4974, 5289, 4967, 5288, 4960, 5286,
+    4950, 5284, 4945, 5281, 4935, 5278, 4925, 5273, 4916, 5270, 4904, 5264, 4895, 5258, 4882, 5252,
+    4870, 5245, 4859, 5238, 4844, 5230, 4832, 5220, 4816, 5212, 4803, 5201, 4787, 5191, 4772, 5181,
+    4756, 5168, 4739, 5156, 4722, 5143, 4704, 5130, 4685, 5116, 4667, 5100, 4649, 5086, 4628, 5070,
+    4609, 5052, 4587, 5036, 4567, 5019, 4545, 4999, 4521, 4982, 4501, 4961, 4476, 4942, 4454, 4920,
+    4429, 4899, 4403, 4878, 4381, 4855, 4353, 4831, 4328, 4808, 4302, 4783, 4275, 4759, 4246, 4732,
+    4219, 4707, 4191, 4679, 4162, 4653, 4133, 4625, 4106, 4597, 4075, 4571, 4048, 4543, 4020, 4515,
+    3990, 4488, 3962, 4461, 3935, 4432, 3905, 4406, 3877, 4377, 3849, 4351, 3821, 4321, 3794, 4295,
+    3764, 4266, 3738, 4240, 3709, 4211, 3680, 4184, 3653, 4155, 3626, 4128, 3597, 4100, 3570, 4071,
+    3542, 4044, 3514, 4016, 3487, 3988, 3459, 3960, 3432, 3932, 3405, 3903, 3376, 3875, 3350, 3849,
+    3321, 3819, 3295, 3791, 3267, 3762, 3240, 3735, 3213, 3707, 3185, 3678, 3160, 3649, 3132, 3622,
+    3104, 3593, 3077, 3565, 3051, 3536, 3024, 3509, 2997, 3479, 2971, 3451, 2943, 3423, 2917, 3394,
+    2890, 3366, 2863, 3337, 2838, 3308, 2810, 3281, 2784, 3251, 2757, 3224, 2730, 3194, 2706, 3165,
+    2677, 3137, 2652, 3109, 2626, 3080, 2599, 3052, 2573, 3022, 2547, 2994, 2521, 2964, 2494, 2937,
+    2469, 2907, 2442, 2879, 2417, 2851, 2391, 2821, 2364, 2792, 2339, 2764, 2314, 2735, 2286, 2706,
+    2262, 2677, 2236, 2648, 2209, 2619, 2185, 2591, 2158, 2562, 2134, 2533, 2107, 2503, 2082, 2475,
+    2056, 2446, 2032, 2417, 2005, 2388, 1981, 2358, 1954, 2330, 1929, 2302, 1904, 2272, 1879, 2243,
+    1854, 2214, 1828, 2184, 1803, 2157, 1778, 2126, 1753, 2098, 1727, 2068, 1703, 2040, 1678, 2011,
+    1653, 1982, 1627, 1952, 1603, 1923, 1577, 1894, 1552, 1865, 1529, 1836, 1503, 1807, 1477, 1778,
+    1453, 1748, 1428, 1719, 1404, 1690, 1379, 1661, 1354, 1631, 1329, 1603, 1305, 1574, 1281, 1544,
+    1255, 1515, 1230, 1486, 1207, 1456, 1181, 1428, 1157, 1398, 1132, 1369, 1108, 1339, 1083, 1311,
+    1059, 1281, 1034, 1252, 1011, 1223, 985, 1193, 961, 1164, 938, 1135, 911, 1106, 888, 1076,
+    863, 1047, 841, 1018, 814, 988, 790, 960, 767, 930, 741, 900, 718, 871, 693, 843,
+    670, 812, 645, 784, 621, 754, 596, 725, 573, 696, 549, 668, 525, 640, 505, 613,
+    482, 587, 461, 559, 439, 536, 420, 511, 401, 486, 379, 463, 362, 439, 343, 417,
+    324, 396, 307, 374, 292, 353, 273, 333, 257, 315, 242, 295, 227, 276, 213, 259,
+    199, 241, 185, 226, 172, 210, 158, 193, 147, 179, 136, 166, 124, 151, 113, 138,
+    103, 125, 95, 114, 83, 103, 75, 92, 68, 81, 59, 73, 52, 63, 45, 54,
+    38, 48, 33, 39, 28, 34, 22, 28, 18, 22, 15, 17, 10, 13, 7, 9,
+    6, 6, 3, 4, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    -1, -2, -3, -3, -5, -6, -8, -8, -10, -13, -16, -16, -17, -21, -24, -25,
+    -27, -31, -34, -39, -39, -43, -47, -53, -53, -59, -61, -69, -69, -77, -78, -87,
+    -87, -98, -96, -108, -107, -120, -116, -132, -129, -144, -141, -157, -152, -170, -164, -186,
+    -179, -199, -192, -216, -205, -231, -222, -248, -236, -265, -251, -282, -269, -300, -284, -320,
+    -302, -338, -320, -358, -338, -380, -357, -400, -376, -422, -397, -444, -416, -466, -437, -490,
+    -460, -514, -480, -538, -503, -564, -526, -589, -549, -615, -574, -642, -597, -668, -622, -698,
+    -648, -724, -674, -755, -699, -782, -724, -810, -751, -840, -776, -866, -800, -896, -828, -924,
+    -852, -952, -877, -981, -904, -1008, -929, -1038, -955, -1066, -980, -1094, -1006, -1122, -1032, -1151,
+    -1057, -1180, -1083, -1207, -1109, -1236, -1135, -1264, -1160, -1292, -1186, -1321, -1212, -1349, -1237, -1377,
+    -1263, -1406, -1289, -1434, -1315, -1462, -1341, -1490, -1367, -1518, -1393, -1547, -1418, -1575, -1445, -1604,
+    -1470, -1631, -1496, -1659, -1522, -1688, -1549, -1716, -1575, -1744, -1601, -1772, -1626, -1801, -1652, -1828,
+    -1679, -1856, -1706, -1885, -1730, -1914, -1758, -1941, -1783, -1969, -1810, -1996, -1836, -2025, -1863, -2054,
+    -1889, -2080, -1914, -2111, -1941, -2136, -1966, -2165, -1993, -2191, -2018, -2217, -2042, -2243, -2065, -2269,
+    -2090, -2294, -2112, -2316, -2135, -2341, -2156, -2363, -2177, -2385, -2199, -2407, -2220, -2428, -2239, -2448,
+    -2259, -2469, -2277, -2488, -2296, -2506, -2315, -2525, -2332, -2542, -2348, -2560, -2365, -2575, -2381, -2592,
+    -2396, -2606, -2412, -2622, -2426, -2636, -2439, -2649, -2455, -2663, -2465, -2675, -2479, -2686, -2491, -2698,
+    -2502, -2709, -2513, -2718, -2524, -2729, -2533, -2737, -2543, -2746, -2551, -2754, -2560, -2761, -2567, -2768,
+    -2576, -2773, -2581, -2780, -2588, -2784, -2594, -2789, -2599, -2793, -2604, -2797, -2609, -2798, -2611, -2801,
+    -2616, -2802, -2617, -2805, -2620, -2804, -2621, -2803, -2622, -2804, -2624, -2804, -2624, -2801, -2626, -2802,
+    -2627, -2801, -2627, -2801, -2630, -2800, -2630, -2799, -2630, -2798, -2633, -2799, -2633, -2797, -2634, -2797,
+    -2635, -2795, -2637, -2797, -2636, -2794, -2639, -2794, -2640, -2793, -2641, -2793, -2641, -2791, -2641, -2792,
+    -2644, -2790, -2645, -2790, -2644, -2790, -2647, -2788, -2648, -2788, -2647, -2787, -2650, -2786, -2650, -2785,
+    -2651, -2786, -2652, -2784, -2653, -2783, -2655, -2783, -2656, -2783, -2657, -2781, -2657, -2782, -2659, -2780,
+    -2659, -2780, -2661, -2779, -2662, -2779, -2662, -2777, -2664, -2777, -2665, -2775, -2666, -2776, -2666, -2775,
+    -2667, -2773, -2668, -2774, -2670, -2772, -2670, -2773, -2671, -2771, -2672, -2770, -2673, -2769, -2675, -2769,
+    -2675, -2768, -2676, -2767, -2677, -2767, -2678, -2766, -2678, -2765, -2680, -2764, -2680, -2764, -2682, -2762,
+    -2684, -2762, -2683, -2762, -2684, -2760, -2685, -2760, -2688, -2759, -2686, -2759, -2689, -2757, -2688, -2756,
+    -2690, -2757, -2692, -2755, -2691, -2754, -2693, -2754, -2694, -2752, -2695, -2752, -2695, -2752, -2696, -2751,
+    -2698, -2749, -2698, -2749, -2699, -2748, -2700, -2747, -2700, -2746, -2702, -2747, -2704, -2744, -2703, -2745,
+    -2704, -2743, -2706, -2743, -2707, -2742, -2707, -2741, -2708, -2740, -2709, -2739, -2710, -2739, -2711, -2738,
+    -2711, -2737, -2712, -2736, -2714, -2735, -2715, -2735, -2714, -2734, -2716, -2733, -2718, -2732, -2717, -2731,
+    -2719, -2731, -2720, -2730, -2720, -2729, -2721, -2728, -2722, -2727, -2723, -2726, -2724, -2725, -2725, -2725,
+    -2725, -2724, -2727, -2723, -2727, -2722, -2728, -2721, -2729, -2722, -2729, -2719, -2732, -2718, -2732, -2719,
+    -2731, -2716, -2734, -2717, -2733, -2715, -2735, -2715, -2735, -2714, -2737, -2712, -2738, -2712, -2737, -2712,
+    -2740, -2709, -2739, -2709, -2740, -2709, -2742, -2708, -2742, -2706, -2743, -2706, -2743, -2704, -2746, -2705,
+    -2745, -2703, -2746, -2702, -2746, -2701, -2748, -2700, -2749, -2700, -2748, -2698, -2750, -2698, -2751, -2696,
+    -2751, -2696, -2752, -2695, -2754, -2694, -2753, -2692, -2755, -2692, -2755, -2691, -2756, -2690, -2757, -2689,
+    -2758, -2688, -2757, -2688, -2759, -2686, -2760, -2685, -2760, -2684, -2762, -2684, -2762, -2682, -2763, -2682,
+    -2762, -2681, -2765, -2679, -2765, -2679, -2766, -2678, -2767, -2677, -2767, -2676, -2767, -2675, -2769, -2674,
+    -2770, -2673, -2770, -2672, -2772, -2671, -2771, -2671, -2772, -2669, -2774, -2669, -2773, -2667, -2775, -2667,
+    -2776, -2665, -2777, -2665, -2777, -2663, -2776, -2663, -2779, -2661, -2779, -2662, -2779, -2659, -2781, -2658,
+    -2782, -2658, -2781, -2657, -2782, -2655, -2784, -2656, -2783, -2653, -2784, -2652, -2786, -2652, -2785, -2649,
+    -2786, -2650, -2787, -2649, -2788, -2646, -2788, -2647, -2790, -2645, -2789, -2644, -2791, -2643, -2791, -2642,
+    -2791, -2641, -2793, -2641, -2793, -2639, -2794, -2638, -2794, -2637, -2796, -2636, -2796, -2635, -2795, -2634,
+    -2797, -2633, -2798, -2632, -2798, -2630, -2799, -2630, -2800, -2629, -2801, -2627, -2800, -2626, -2802, -2626,
+    -2802, -2624, -2802, -2624, -2804, -2622, -2804, -2622, -2805, -2620, -2805, -2619, -2805, -2618, -2808, -2616,
+    -2807, -2617, -2808, -2615, -2808, -2613, -2809, -2613, -2811, -2611, -2809, -2611, -2811, -2609, -2811, -2609,
+    -2813, -2607, -2813, -2606, -2813, -2605, -2814, -2603, -2813, -2604, -2817, -2601, -2815, -2601, -2817, -2599,
+    -2817, -2598, -2817, -2597, -2818, -2597, -2818, -2595, -2820, -2594, -2820, -2593, -2820, -2591, -2821, -2591,
+    -2822, -2589, -2823, -2588, -2821, -2588, -2824, -2586, -2825, -2585, -2824, -2583, -2825, -2583, -2826, -2581,
+    -2825, -2581, -2827, -2579, -2828, -2578, -2827, -2576, -2829, -2577, -2829, -2574, -2829, -2573, -2830, -2572,
+    -2830, -2572, -2832, -2569, -2831, -2569, -2832, -2567, -2834, -2568, -2833, -2565, -2833, -2563, -2835, -2564,
+    -2835, -2562, -2836, -2560, -2836, -2559, -2836, -2559, -2837, -2557, -2838, -2556, -2838, -2554, -2838, -2554,
+    -2839, -2553, -2840, -2550, -2840, -2550, -2841, -2549, -2842, -2547, -2841, -2547, -2842, -2545, -2843, -2544,
+    -2843, -2543, -2845, -2541, -2844, -2540, -2843, -2539, -2847, -2538, -2845, -2537, -2846, -2535, -2848, -2534,
+    -2846, -2533, -2849, -2532, -2847, -2530, -2849, -2530, -2850, -2527, -2849, -2528, -2851, -2525, -2850, -2524,
+    -2851, -2523, -2852, -2522, -2852, -2521, -2852, -2519, -2854, -2518, -2853, -2517, -2854, -2516, -2854, -2515,
+    -2856, -2512, -2854, -2512, -2855, -2511, -2858, -2509, -2856, -2508, -2858, -2507, -2857, -2505, -2858, -2505,
+    -2858, -2502, -2859, -2502, -2860, -2501, -2860, -2498, -2860, -2498, -2861, -2497, -2861, -2495, -2862, -2494,
+    -2862, -2493, -2863, -2491, -2863, -2490, -2864, -2490, -2863, -2487, -2864, -2486, -2864, -2485, -2866, -2484,
+    -2865, -2482, -2865, -2481, -2868, -2479, -2866, -2479, -2867, -2477, -2868, -2475, -2868, -2475, -2869, -2474,
+    -2868, -2471, -2869, -2470, -2867, -2468, -2866, -2464, -2865, -2462, -2862, -2458, -2858, -2453, -2857, -2449,
+    -2852, -2443, -2846, -2437, -2840, -2432, -2836, -2425, -2828, -2417, -2822, -2410, -2814, -2402, -2806, -2392,
+    -2796, -2384, -2788, -2375, -2778, -2364, -2767, -2354, -2756, -2343, -2743, -2331, -2732, -2319, -2720, -2307,
+    -2705, -2294, -2691, -2280, -2677, -2267, -2661, -2252, -2646, -2237, -2629, -2222, -2612, -2207, -2595, -2190,
+    -2577, -2175, -2558, -2155, -2539, -2140, -2519, -2120, -2498, -2103, -2476, -2083, -2456, -2064, -2434, -2044,
+    -2411, -2024, -2387, -2002, -2362, -1982, -2339, -1960, -2314, -1938, -2289, -1915, -2260, -1892, -2235, -1869,
+    -2206, -1844, -2179, -1821, -2151, -1795, -2122, -1771, -2093, -1745, -2064, -1721, -2036, -1696, -2007, -1672,
+    -1978, -1647, -1949, -1621, -1921, -1597, -1892, -1573, -1863, -1548, -1835, -1523, -1806, -1499, -1777, -1474,
+    -1748, -1450, -1720, -1426, -1690, -1401, -1662, -1376, -1633, -1353, -1605, -1327, -1574, -1304, -1547, -1279,
+    -1519, -1255, -1488, -1231, -1461, -1206, -1432, -1182, -1402, -1158, -1374, -1133, -1345, -1109, -1316, -1086,
+    -1286, -1061, -1259, -1038, -1229, -1012, -1201, -989, -1172, -965, -1143, -940, -1114, -917, -1084, -893,
+    -1057, -869, -1028, -844, -997, -821, -970, -797, -941, -773, -912, -749, -882, -725, -854, -701,
+    -825, -677, -797, -654, -766, -629, -738, -606, -711, -582, -680, -559, -653, -536, -627, -513,
+    -599, -492, -574, -470, -548, -449, -523, -428, -498, -409, -476, -389, -452, -371, -429, -351,
+    -406, -334, -387, -315, -365, -300, -344, -281, -326, -267, -306, -251, -287, -235, -270, -221,
+    -252, -206, -235, -193, -220, -179, -202, -166, -189, -155, -174, -142, -160, -131, -147, -120,
+    -133, -109, -123, -100, -109, -90, -100, -81, -89, -73, -79, -65, -69, -56, -62, -50,
+    -52, -44, -45, -37, -39, -31, -32, -27, -26, -21, -21, -17, -16, -13, -13, -10,
+    -9, -7, -5, -5, -4, -3, -2, -2, -1, 0, 0, 0, 0, -1,
+};
+
+static const StrokeTableSegment STROKE_KOU_SEGMENTS[5] = {
+    {0, 1},
+    {720, 0},
+    {1261, 1},
+    {2674, 0},
+    {3174, 1},
+};
+
+static const int16_t STROKE_CALIB_SQUARE_DELTAS[7208] = {
+    0, 0, -1, 0, -1, -3, -3, -3, -6, -6, -7, -11, -10, -14, -15, -17,
+    -18, -23, -23, -28, -27, -35, -33, -41, -39, -51, -46, -57, -53, -68, -60, -74,
+    -68, -87, -77, -97, -86, -109, -95, -119, -105, -134, -116, -146, -126, -161, -139, -174,
+    -150, -191, -163, -205, -176, -223, -189, -239, -204, -257, -218, -276, -233, -295, -249, -314,
+    -265, -333, -281, -357, -297, -376, -317, -398, -333, -422, -353, -446, -372, -470, -390, -492,
+    -412, -520, -432, -545, -453, -571, -474, -599, -497, -628, -520, -655, -543, -684, -566, -715,
+    -590, -745, -616, -776, -640, -806, -666, -838, -691, -873, -716, -901, -741, -933, -767, -966,
+    -793, -998, -816, -1028, -844, -1061, -868, -1092, -893, -1124, -919, -1155, -943, -1187, -971, -1218,
+    -995, -1251, -1021, -1282, -1047, -1313, -1071, -1346, -1098, -1377, -1123, -1409, -1149, -1441, -1174, -1471,
+    -1200, -1504, -1226, -1535, -1251, -1568, -1278, -1597, -1301, -1630, -1330, -1663, -1354, -1692, -1381, -1726,
+    -1405, -1757, -1433, -1788, -1458, -1820, -1484, -1852, -1511, -1884, -1536, -1914, -1562, -1946, -1589, -1979,
+    -1613, -2010, -1641, -2042, -1668, -2073, -1692, -2105, -1720, -2136, -1746, -2168, -1772, -2201, -1799, -2230,
+    -1824, -2263, -1852, -2295, -1878, -2326, -1905, -2358, -1930, -2390, -1957, -2420, -1983, -2452, -2008, -2480,
+    -2033, -2509, -2057, -2538, -2080, -2566, -2104, -2594, -2127, -2619, -2149, -2646, -2170, -2670, -2193, -2696,
+    -2213, -2719, -2233, -2743, -2253, -2765, -2273, -2789, -2292, -2808, -2310, -2831, -2328, -2850, -2346, -2870,
+    -2363, -2888, -2378, -2906, -2395, -2925, -2412, -2942, -2424, -2958, -2441, -2974, -2454, -2988, -2468, -3004,
+    -2480, -3017, -2494, -3031, -2505, -3043, -2517, -3055, -2528, -3066, -2538, -3077, -2548, -3087, -2558, -3096,
+    -2567, -3105, -2575, -3113, -2584, -3121, -2590, -3127, -2598, -3134, -2604, -3140, -2609, -3144, -2616, -3148,
+    -2619, -3153, -2625, -3155, -2629, -3158, -2631, -3159, -2634, -3161, -2638, -3162, -2637, -3160, -2640, -3161,
+    -2642, -3161, -2643, -3161, -2645, -3161, -2648, -3161, -2648, -3160, -2650, -3161, -2651, -3160, -2654, -3160,
+    -2656, -3160, -2656, -3160, -2659, -3160, -2661, -3159, -2662, -3160, -2663, -3159, -2666, -3159, -2666, -3159,
+    -2669, -3158, -2669, -3159, -2673, -3159, -2673, -3158, -2675, -3157, -2677, -3158, -2677, -3158, -2680, -3157,
+    -2682, -3157, -2682, -3157, -2685, -3157, -2686, -3156, -2688, -3157, -2689, -3156, -2691, -3156, -2693, -3156,
+    -2695, -3157, -2697, -3155, -2698, -3156, -2699, -3155, -2701, -3155, -2703, -3156, -2704, -3154, -2706, -3155,
+    -2707, -3154, -2709, -3155, -2711, -3154, -2711, -3153, -2714, -3154, -2715, -3154, -2717, -3152, -2718, -3153,
+    -2721, -3152, -2721, -3153, -2723, -3151, -2725, -3152, -2725, -3152, -2728, -3151, -2730, -3152, -2730, -3151,
+    -2732, -3150, -2734, -3151, -2736, -3150, -2736, -3149, -2739, -3150, -2740, -3150, -2741, -3149, -2743, -3149,
+    -2744, -3148, -2746, -3148, -2748, -3148, -2749, -3148, -2750, -3147, -2752, -3148, -2754, -3146, -2755, -3147,
+    -2757, -3147, -2757, -3145, -2759, -3146, -2761, -3146, -2763, -3145, -2764, -3145, -2766, -3145, -2766, -3144,
+    -2768, -3144, -2770, -3144, -2772, -3144, -2773, -3143, -2774, -3143, -2777, -3142, -2777, -3142, -2779, -3143,
+    -2780, -3142, -2781, -3141, -2783, -3141, -2785, -3141, -2786, -3140, -2787, -3140, -2789, -3141, -2790, -3140,
+    -2793, -3139, -2793, -3139, -2795, -3138, -2795, -3139, -2799, -3138, -2798, -3137, -2800, -3138, -2803, -3136,
+    -2803, -3137, -2804, -3137, -2806, -3136, -2808, -3135, -2809, -3135, -2811, -3135, -2811, -3135, -2813, -3134,
+    -2814, -3134, -2817, -3133, -2816, -3133, -2819, -3134, -2821, -3132, -2820, -3132, -2824, -3132, -2824, -3131,
+    -2825, -3130, -2827, -3131, -2829, -3131, -2829, -3129, -2832, -3130, -2832, -3128, -2834, -3129, -2835, -3129,
+    -2835, -3128, -2840, -3126, -2838, -3128, -2841, -3126, -2841, -3126, -2843, -3126, -2845, -3125, -2846, -3126,
+    -2847, -3124, -2847, -3123, -2851, -3124, -2850, -3123, -2853, -3122, -2853, -3122, -2855, -3122, -2855, -3121,
+    -2858, -3121, -2858, -3120, -2860, -3120, -2861, -3119, -2862, -3119, -2864, -3118, -2864, -3118, -2867, -3117,
+    -2868, -3118, -2868, -3116, -2871, -3116, -2872, -3116, -2871, -3115, -2874, -3115, -2876, -3114, -2876, -3114,
+    -2878, -3113, -2879, -3113, -2880, -3113, -2881, -3112, -2883, -3111, -2884, -3111, -2885, -3111, -2887, -3110,
+    -2887, -3110, -2889, -3108, -2890, -3109, -2892, -3108, -2893, -3108, -2894, -3108, -2895, -3106, -2897, -3106,
+    -2897, -3105, -2899, -3106, -2900, -3104, -2901, -3104, -2902, -3104, -2904, -3102, -2904, -3102, -2905, -3102,
+    -2908, -3101, -2907, -3101, -2910, -3099, -2910, -3100, -2911, -3098, -2913, -3098, -2913, -3098, -2915, -3097,
+    -2917, -3097, -2917, -3096, -2918, -3095, -2920, -3095, -2921, -3094, -2922, -3094, -2923, -3093, -2924, -3092,
+    -2924, -3092, -2928, -3091, -2927, -3091, -2928, -3090, -2931, -3090, -2931, -3089, -2931, -3088, -2933, -3088,
+    -2934, -3088, -2935, -3086, -2937, -3086, -2937, -3085, -2940, -3085, -2939, -3084, -2941, -3083, -2942, -3084,
+    -2943, -3082, -2944, -3081, -2946, -3081, -2945, -3081, -2948, -3079, -2948, -3079, -2950, -3079, -2951, -3078,
+    -2951, -3076, -2953, -3077, -2953, -3076, -2956, -3075, -2956, -3074, -2957, -3074, -2957, -3073, -2959, -3073,
+    -2960, -3072, -2962, -3071, -2961, -3070, -2963, -3070, -2964, -3069, -2966, -3069, -2966, -3068, -2968, -3067,
+    -2968, -3067, -2969, -3065, -2971, -3065, -2970, -3064, -2973, -3064, -2973, -3063, -2974, -3062, -2976, -3062,
+    -2976, -3060, -2978, -3060, -2979, -3060, -2978, -3058, -2981, -3058, -2981, -3057, -2983, -3057, -2983, -3056,
+    -2984, -3055, -2985, -3054, -2986, -3053, -2987, -3053, -2989, -3052, -2988, -3052, -2990, -3050, -2990, -3049,
+    -2993, -3049, -2993, -3049, -2994, -3048, -2994, -3047, -2997, -3045, -2996, -3045, -2997, -3045, -2999, -3044,
+    -2999, -3043, -3000, -3042, -3001, -3041, -3003, -3040, -3003, -3040, -3004, -3039, -3005, -3038, -3006, -3038,
+    -3006, -3036, -3008, -3036, -3008, -3035, -3010, -3034, -3010, -3034, -3011, -3032, -3012, -3032, -3013, -3030,
+    -3014, -3030, -3015, -3030, -3015, -3028, -3017, -3028, -3017, -3026, -3019, -3027, -3019, -3025, -3019, -3023,
+    -3022, -3024, -3021, -3022, -3022, -3022, -3024, -3021, -3024, -3019, -3024, -3020, -3027, -3018, -3027, -3017,
+    -3027, -3017, -3028, -3016, -3030, -3014, -3030, -3014, -3031, -3013, -3032, -3012, -3032, -3011, -3033, -3011,
+    -3035, -3009, -3034, -3008, -3036, -3008, -3036, -3007, -3038, -3006, -3037, -3004, -3041, -3004, -3039, -3004,
+    -3040, -3002, -3042, -3001, -3042, -3001, -3043, -2999, -3043, -2999, -3045, -2997, -3045, -2997, -3046, -2995,
+    -3046, -2995, -3048, -2994, -3049, -2993, -3049, -2992, -3049, -2991, -3051, -2990, -3051, -2989, -3052, -2988,
+    -3054, -2987, -3052, -2987, -3055, -2985, -3055, -2984, -3055, -2983, -3057, -2983, -3058, -2981, -3057, -2980,
+    -3059, -2979, -3059, -2978, -3060, -2978, -3062, -2977, -3060, -2975, -3063, -2974, -3062, -2974, -3064, -2972,
+    -3065, -2972, -3065, -2970, -3065, -2969, -3067, -2969, -3067, -2967, -3068, -2966, -3069, -2965, -3069, -2965,
+    -3069, -2963, -3071, -2962, -3072, -2961, -3070, -2960, -3074, -2959, -3073, -2958, -3073, -2958, -3075, -2955,
+    -3075, -2955, -3076, -2954, -3077, -2953, -3077, -2951, -3078, -2951, -3079, -2950, -3078, -2948, -3080, -2948,
+    -3080, -2946, -3081, -2945, -3081, -2944, -3084, -2943, -3083, -2942, -3083, -2941, -3083, -2940, -3085, -2939,
+    -3086, -2937, -3086, -2938, -3087, -2935, -3087, -2934, -3088, -2933, -3089, -2933, -3089, -2930, -3090, -2930,
+    -3090, -2929, -3091, -2928, -3091, -2927, -3091, -2925, -3094, -2924, -3093, -2923, -3093, -2922, -3094, -2921,
+    -3096, -2919, -3095, -2919, -3097, -2917, -3096, -2916, -3097, -2915, -3098, -2915, -3098, -2912, -3099, -2912,
+    -3099, -2911, -3101, -2908, -3100, -2909, -3101, -2906, -3102, -2906, -3102, -2905, -3102, -2903, -3103, -2902,
+    -3104, -2901, -3104, -2900, -3105, -2898, -3105, -2897, -3106, -2896, -3106, -2896, -3108, -2893, -3107, -2893,
+    -3109, -2891, -3107, -2890, -3109, -2889, -3110, -2887, -3109, -2887, -3111, -2885, -3111, -2884, -3111, -2882,
+    -3112, -2882, -3112, -2881, -3114, -2878, -3113, -2878, -3114, -2876, -3114, -2876, -3115, -2874, -3115, -2872,
+    -3116, -2872, -3116, -2870, -3117, -2869, -3117, -2867, -3117, -2867, -3119, -2864, -3118, -2864, -3119, -2863,
+    -3119, -2861, -3121, -2859, -3120, -2859, -3120, -2858, -3122, -2856, -3121, -2854, -3123, -2854, -3122, -2852,
+    -3123, -2852, -3122, -2849, -3125, -2848, -3124, -2847, -3125, -2845, -3125, -2845, -3125, -2843, -3126, -2841,
+    -3127, -2840, -3127, -2839, -3127, -2838, -3127, -2837, -3129, -2834, -3128, -2834, -3129, -2832, -3129, -2831,
+    -3129, -2830, -3130, -2828, -3130, -2827, -3131, -2825, -3132, -2824, -3132, -2823, -3131, -2821, -3132, -2820,
+    -3133, -2819, -3133, -2817, -3133, -2816, -3133, -2814, -3135, -2813, -3134, -2812, -3136, -2811, -3135, -2808,
+    -3135, -2808, -3135, -2806, -3137, -2805, -3137, -2803, -3137, -2802, -3137, -2800, -3137, -2799, -3139, -2797,
+    -3139, -2797, -3138, -2794, -3139, -2794, -3139, -2791, -3140, -2791, -3139, -2789, -3141, -2788, -3141, -2786,
+    -3140, -2784, -3142, -2784, -3140, -2781, -3143, -2780, -3142, -2779, -3142, -2778, -3144, -2776, -3143, -2774,
+    -3143, -2773, -3144, -2772, -3143, -2769, -3144, -2769, -3145, -2768, -3145, -2765, -3145, -2765, -3145, -2762,
+    -3146, -2761, -3146, -2760, -3147, -2759, -3146, -2756, -3147, -2755, -3147, -2753, -3148, -2753, -3148, -2751,
+    -3147, -2748, -3148, -2748, -3149, -2747, -3148, -2744, -3150, -2743, -3149, -2741, -3149, -2741, -3149, -2738,
+    -3151, -2736, -3149, -2736, -3151, -2734, -3152, -2733, -3149, -2730, -3152, -2729, -3151, -2728, -3153, -2727,
+    -3151, -2724, -3151, -2723, -3153, -2721, -3153, -2721, -3153, -2718, -3152, -2716, -3155, -2716, -3153, -2713,
+    -3153, -2712, -3153, -2710, -3155, -2709, -3154, -2708, -3154, -2706, -3156, -2704, -3154, -2702, -3155, -2701,
+    -3156, -2699, -3155, -2698, -3155, -2696, -3156, -2695, -3157, -2693, -3155, -2691, -3156, -2689, -3158, -2689,
+    -3156, -2686, -3158, -2685, -3157, -2683, -3156, -2682, -3158, -2680, -3157, -2678, -3159, -2676, -3158, -2675,
+    -3158, -2674, -3158, -2672, -3159, -2670, -3158, -2668, -3159, -2667, -3159, -2665, -3160, -2663, -3158, -2662,
+    -3161, -2661, -3158, -2658, -3160, -2657, -3160, -2655, -3160, -2653, -3161, -2653, -3160, -2650, -3160, -2648,
+    -3161, -2646, -3160, -2646, -3162, -2643, -3160, -2642, -3160, -2640, -3162, -2638, -3160, -2636, -3162, -2635,
+    -3159, -2631, -3158, -2629, -3155, -2624, -3152, -2620, -3149, -2616, -3144, -2609, -3140, -2604, -3134, -2598,
+    -3127, -2590, -3121, -2584, -3113, -2575, -3105, -2567, -3097, -2558, -3087, -2548, -3077, -2538, -3066, -2528,
+    -3054, -2517, -3043, -2506, -3031, -2493, -3017, -2481, -3003, -2467, -2990, -2455, -2974, -2440, -2957, -2426,
+    -2942, -2411, -2926, -2395, -2907, -2379, -2889, -2363, -2870, -2346, -2850, -2328, -2830, -2310, -2809, -2292,
+    -2789, -2273, -2765, -2254, -2744, -2234, -2719, -2213, -2696, -2192, -2671, -2171, -2645, -2150, -2620, -2127,
+    -2594, -2104, -2567, -2080, -2538, -2058, -2510, -2033, -2481, -2008, -2452, -1983, -2420, -1958, -2390, -1931,
+    -2358, -1905, -2327, -1878, -2295, -1851, -2263, -1826, -2232, -1799, -2201, -1772, -2167, -1747, -2138, -1720,
+    -2105, -1693, -2074, -1667, -2042, -1641, -2011, -1616, -1978, -1588, -1947, -1563, -1916, -1536, -1884, -1511,
+    -1851, -1485, -1821, -1458, -1789, -1432, -1758, -1407, -1724, -1381, -1694, -1354, -1663, -1330, -1630, -1303,
+    -1600, -1277, -1567, -1252, -1535, -1226, -1504, -1200, -1473, -1175, -1440, -1149, -1409, -1123, -1378, -1098,
+    -1345, -1073, -1314, -1046, -1282, -1021, -1252, -996, -1219, -970, -1187, -945, -1156, -919, -1124, -894,
+    -1093, -868, -1061, -844, -1029, -817, -997, -793, -966, -766, -934, -743, -903, -716, -872, -691,
+    -838, -666, -809, -641, -775, -616, -745, -591, -714, -567, -686, -542, -655, -520, -628, -497,
+    -599, -475, -573, -453, -545, -432, -519, -412, -495, -391, -470, -372, -445, -353, -422, -334,
+    -399, -316, -377, -299, -356, -282, -335, -264, -314, -249, -295, -233, -276, -219, -258, -203,
+    -239, -190, -223, -176, -205, -163, -190, -150, -176, -139, -160, -126, -146, -116, -134, -106,
+    -120, -96, -109, -86, -97, -76, -86, -69, -76, -60, -67, -53, -58, -45, -50, -40,
+    -41, -33, -36, -27, -28, -23, -24, -18, -17, -14, -13, -11, -10, -7, -6, -6,
+    -5, -3, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+    -3, 3, -3, 6, -3, 8, -6, 13, -8, 16, -10, 20, -12, 25, -14, 31,
+    -17, 38, -21, 44, -24, 51, -28, 59, -32, 68, -36, 76, -41, 86, -45, 97,
+    -50, 107, -56, 118, -62, 130, -66, 143, -74, 155, -79, 169, -86, 183, -93, 198,
+    -100, 212, -107, 229, -117, 245, -122, 262, -132, 279, -141, 297, -147, 315, -159, 335,
+    -167, 354, -177, 375, -187, 396, -195, 416, -208, 440, -216, 461, -228, 484, -240, 507,
+    -252, 532, -262, 556, -275, 582, -287, 608, -299, 633, -312, 661, -325, 688, -339, 716,
+    -352, 744, -365, 772, -378, 800, -392, 828, -405, 856, -418, 883, -432, 912, -444, 939,
+    -459, 968, -473, 995, -485, 1023, -499, 1051, -512, 1078, -525, 1106, -539, 1134, -551, 1162,
+    -566, 1190, -580, 1217, -593, 1245, -605, 1273, -620, 1300, -634, 1328, -646, 1355, -659, 1383,
+    -673, 1411, -688, 1438, -700, 1466, -714, 1493, -728, 1521, -740, 1548, -755, 1575, -769, 1603,
+    -782, 1630, -795, 1658, -809, 1685, -823, 1712, -836, 1739, -850, 1767, -863, 1794, -878, 1821,
+    -891, 1849, -904, 1875, -919, 1902, -931, 1930, -946, 1957, -959, 1983, -974, 2011, -988, 2037,
+    -1000, 2065, -1015, 2092, -1027, 2117, -1043, 2143, -1054, 2169, -1067, 2193, -1080, 2217, -1092, 2240,
+    -1104, 2264, -1116, 2285, -1127, 2307, -1140, 2328, -1150, 2349, -1160, 2368, -1171, 2389, -1181, 2406,
+    -1191, 2426, -1202, 2442, -1208, 2460, -1220, 2476, -1229, 2492, -1236, 2507, -1246, 2523, -1254, 2536,
+    -1262, 2550, -1269, 2563, -1277, 2576, -1284, 2587, -1289, 2600, -1298, 2609, -1304, 2621, -1309, 2630,
+    -1315, 2638, -1321, 2648, -1326, 2655, -1330, 2664, -1336, 2670, -1341, 2676, -1345, 2682, -1348, 2688,
+    -1352, 2692, -1355, 2697, -1358, 2700, -1362, 2703, -1364, 2705, -1366, 2708, -1368, 2709, -1370, 2710,
+    -1371, 2710, -1372, 2711, -1375, 2710, -1374, 2708, -1374, 2707, -1377, 2705, -1375, 2705, -1377, 2704,
+    -1379, 2702, -1378, 2701, -1378, 2699, -1380, 2699, -1381, 2698, -1381, 2696, -1381, 2695, -1383, 2694,
+    -1382, 2692, -1384, 2692, -1384, 2690, -1385, 2689, -1387, 2688, -1385, 2686, -1387, 2686, -1388, 2684,
+    -1388, 2683, -1389, 2681, -1389, 2681, -1391, 2679, -1390, 2678, -1392, 2677, -1391, 2676, -1393, 2674,
+    -1393, 2675, -1395, 2671, -1395, 2672, -1395, 2670, -1395, 2670, -1398, 2668, -1398, 2667, -1399, 2666,
+    -1398, 2665, -1398, 2664, -1401, 2662, -1401, 2662, -1401, 2660, -1403, 2660, -1402, 2658, -1404, 2657,
+    -1404, 2656, -1405, 2655, -1406, 2654, -1405, 2653, -1408, 2651, -1407, 2651, -1407, 2650, -1409, 2648,
+    -1410, 2648, -1410, 2646, -1411, 2645, -1411, 2644, -1413, 2644, -1413, 2642, -1412, 2641, -1415, 2640,
+    -1414, 2639, -1417, 2638, -1415, 2637, -1416, 2636, -1418, 2635, -1418, 2634, -1419, 2633, -1419, 2632,
+    -1420, 2631, -1421, 2629, -1422, 2629, -1421, 2628, -1423, 2627, -1423, 2626, -1425, 2625, -1424, 2623,
+    -1425, 2624, -1426, 2621, -1427, 2622, -1427, 2619, -1429, 2620, -1429, 2618, -1429, 2617, -1430, 2616,
+    -1431, 2616, -1431, 2614, -1433, 2614, -1431, 2612, -1435, 2612, -1434, 2610, -1434, 2610, -1436, 2609,
+    -1436, 2608, -1438, 2607, -1436, 2606, -1439, 2605, -1438, 2604, -1440, 2604, -1441, 2602, -1439, 2601,
+    -1443, 2601, -1442, 2600, -1443, 2599, -1444, 2598, -1444, 2597, -1445, 2597, -1446, 2595, -1446, 2595,
+    -1447, 2593, -1448, 2594, -1448, 2591, -1449, 2591, -1450, 2591, -1451, 2589, -1452, 2589, -1451, 2587,
+    -1453, 2587, -1452, 2586, -1455, 2586, -1454, 2584, -1456, 2584, -1455, 2582, -1457, 2582, -1457, 2581,
+    -1457, 2580, -1460, 2580, -1459, 2578, -1461, 2579, -1459, 2577, -1462, 2576, -1462, 2575, -1463, 2575,
+    -1463, 2573, -1464, 2574, -1465, 2572, -1466, 2571, -1467, 2571, -1466, 2570, -1467, 2568, -1468, 2568,
+    -1469, 2568, -1469, 2566, -1472, 2566, -1470, 2564, -1472, 2565, -1471, 2563, -1474, 2563, -1474, 2562,
+    -1473, 2561, -1476, 2560, -1475, 2559, -1475, 2560, -1478, 2558, -1477, 2557, -1480, 2557, -1477, 2555,
+    -1481, 2556, -1481, 2554, -1481, 2554, -1481, 2553, -1484, 2552, -1482, 2552, -1485, 2551, -1484, 2550,
+    -1486, 2550, -1486, 2549, -1486, 2548, -1488, 2548, -1488, 2546, -1490, 2547, -1489, 2545, -1490, 2545,
+    -1492, 2543, -1491, 2545, -1493, 2542, -1494, 2542, -1493, 2541, -1495, 2541, -1495, 2541, -1495, 2539,
+    -1497, 2539, -1498, 2538, -1497, 2537, -1500, 2537, -1499, 2536, -1499, 2535, -1501, 2534, -1502, 2534,
+    -1502, 2534, -1502, 2532, -1504, 2532, -1504, 2531, -1506, 2531, -1505, 2530, -1507, 2529, -1507, 2529,
+    -1508, 2528, -1507, 2529, -1510, 2526, -1509, 2526, -1511, 2526, -1512, 2525, -1513, 2525, -1511, 2524,
+    -1514, 2523, -1513, 2523, -1516, 2522, -1516, 2522, -1516, 2521, -1517, 2520, -1517, 2519, -1520, 2520,
+    -1518, 2518, -1520, 2519, -1520, 2517, -1522, 2517, -1522, 2517, -1523, 2515, -1523, 2515, -1524, 2515,
+    -1526, 2515, -1524, 2512, -1528, 2514, -1525, 2512, -1529, 2512, -1528, 2511, -1529, 2511, -1530, 2511,
+    -1531, 2509, -1532, 2509, -1532, 2509, -1532, 2508, -1535, 2507, -1533, 2508, -1536, 2506, -1534, 2506,
+    -1537, 2506, -1538, 2505, -1538, 2504, -1538, 2504, -1539, 2503, -1540, 2504, -1542, 2502, -1541, 2502,
+    -1542, 2501, -1544, 2502, -1543, 2500, -1544, 2500, -1546, 2499, -1546, 2500, -1546, 2498, -1547, 2498,
+    -1549, 2498, -1549, 2496, -1549, 2497, -1550, 2496, -1552, 2496, -1551, 2494, -1553, 2496, -1554, 2494,
+    -1553, 2494, -1556, 2493, -1555, 2493, -1556, 2493, -1558, 2492, -1557, 2491, -1558, 2491, -1560, 2491,
+    -1559, 2490, -1562, 2490, -1561, 2490, -1562, 2488, -1562, 2489, -1565, 2488, -1565, 2488, -1565, 2487,
+    -1566, 2487, -1566, 2486, -1568, 2486, -1568, 2486, -1569, 2485, -1569, 2485, -1571, 2484, -1572, 2484,
+    -1572, 2484, -1572, 2483, -1574, 2483, -1574, 2482, -1574, 2482, -1578, 2481, -1575, 2482, -1578, 2481,
+    -1578, 2481, -1578, 2479, -1579, 2480, -1581, 2479, -1581, 2479, -1582, 2479, -1582, 2478, -1584, 2478,
+    -1585, 2477, -1585, 2477, -1585, 2477, -1587, 2477, -1587, 2475, -1587, 2476, -1589, 2476, -1590, 2474,
+    -1590, 2475, -1590, 2474, -1593, 2474, -1593, 2474, -1593, 2473, -1595, 2473, -1594, 2473, -1595, 2472,
+    -1598, 2473, -1598, 2471, -1597, 2471, -1599, 2472, -1599, 2470, -1600, 2470, -1602, 2470, -1602, 2470,
+    -1603, 2469, -1603, 2470, -1604, 2469, -1606, 2468, -1606, 2468, -1606, 2468, -1608, 2468, -1607, 2467,
+    -1610, 2467, -1609, 2467, -1610, 2466, -1612, 2467, -1612, 2466, -1613, 2465, -1615, 2466, -1614, 2465,
+    -1615, 2464, -1616, 2465, -1616, 2465, -1619, 2463, -1619, 2465, -1618, 2462, -1621, 2464, -1620, 2462,
+    -1621, 2463, -1623, 2463, -1623, 2462, -1625, 2462, -1624, 2462, -1626, 2461, -1627, 2462, -1627, 2461,
+    -1629, 2460, -1628, 2461, -1630, 2460, -1630, 2460, -1632, 2460, -1632, 2460, -1633, 2459, -1633, 2459,
+    -1635, 2459, -1636, 2459, -1636, 2459, -1637, 2458, -1638, 2458, -1639, 2458, -1640, 2458, -1639, 2457,
+    -1641, 2458, -1642, 2457, -1643, 2457, -1644, 2456, -1645, 2457, -1644, 2456, -1647, 2457, -1646, 2455,
+    -1647, 2456, -1649, 2456, -1650, 2455, -1650, 2456, -1651, 2455, -1653, 2455, -1652, 2454, -1653, 2455,
+    -1654, 2454, -1657, 2455, -1656, 2454, -1657, 2454, -1657, 2453, -1658, 2454, -1660, 2454, -1659, 2453,
+    -1662, 2453, -1662, 2453, -1663, 2453, -1663, 2453, -1666, 2453, -1665, 2452, -1666, 2453, -1666, 2452,
+    -1669, 2452, -1668, 2452, -1669, 2452, -1671, 2452, -1671, 2451, -1673, 2452, -1673, 2451, -1674, 2451,
+    -1674, 2451, -1676, 2452, -1676, 2451, -1677, 2450, -1678, 2451, -1679, 2450, -1681, 2451, -1680, 2450,
+    -1681, 2451, -1683, 2450, -1684, 2450, -1684, 2451, -1684, 2449, -1686, 2450, -1687, 2450, -1688, 2450,
+    -1689, 2449, -1689, 2450, -1689, 2450, -1692, 2449, -1691, 2449, -1693, 2449, -1695, 2450, -1695, 2449,
+    -1695, 2449, -1696, 2449, -1697, 2449, -1699, 2449, -1700, 2449, -1699, 2448, -1701, 2449, -1701, 2449,
+    -1703, 2449, -1704, 2448, -1705, 2449, -1704, 2449, -1707, 2448, -1707, 2449, -1707, 2448, -1709, 2448,
+    -1711, 2449, -1710, 2448, -1711, 2449, -1713, 2448, -1713, 2448, -1715, 2449, -1715, 2448, -1716, 2448,
+    -1717, 2449, -1719, 2448, -1718, 2449, -1719, 2448, -1722, 2449, -1721, 2448, -1723, 2448, -1724, 2449,
+    -1723, 2448, -1726, 2449, -1726, 2448, -1727, 2449, -1728, 2448, -1729, 2448, -1731, 2449, -1729, 2448,
+    -1732, 2448, -1733, 2449, -1734, 2449, -1734, 2448, -1736, 2449, -1736, 2448, -1738, 2449, -1737, 2449,
+    -1740, 2449, -1740, 2448, -1741, 2450, -1742, 2449, -1742, 2448, -1744, 2449, -1745, 2450, -1746, 2449,
+    -1747, 2449, -1747, 2449, -1749, 2450, -1750, 2449, -1751, 2450, -1751, 2449, -1752, 2450, -1754, 2449,
+    -1753, 2450, -1756, 2450, -1757, 2450, -1756, 2450, -1758, 2450, -1760, 2451, -1760, 2450, -1760, 2450,
+    -1763, 2451, -1763, 2451, -1764, 2450, -1765, 2451, -1766, 2451, -1766, 2451, -1768, 2451, -1769, 2451,
+    -1770, 2452, -1771, 2451, -1772, 2452, -1773, 2451, -1773, 2452, -1774, 2452, -1776, 2452, -1777, 2452,
+    -1778, 2452, -1778, 2453, -1781, 2453, -1780, 2452, -1781, 2453, -1783, 2453, -1784, 2453, -1784, 2454,
+    -1786, 2453, -1787, 2454, -1787, 2454, -1789, 2454, -1789, 2454, -1792, 2454, -1790, 2454, -1794, 2455,
+    -1794, 2455, -1795, 2455, -1795, 2455, -1796, 2455, -1799, 2456, -1798, 2455, -1800, 2456, -1801, 2456,
+    -1801, 2456, -1803, 2456, -1805, 2457, -1805, 2457, -1806, 2456, -1806, 2457, -1808, 2457, -1809, 2458,
+    -1810, 2458, -1811, 2458, -1812, 2458, -1814, 2458, -1814, 2459, -1815, 2459, -1816, 2458, -1818, 2460,
+    -1818, 2459, -1820, 2460, -1821, 2460, -1822, 2460, -1822, 2459, -1823, 2462, -1825, 2460, -1826, 2461,
+    -1827, 2462, -1828, 2461, -1830, 2462, -1829, 2462, -1831, 2462, -1832, 2462, -1833, 2463, -1835, 2463,
+    -1835, 2464, -1837, 2463, -1837, 2464, -1839, 2464, -1840, 2464, -1841, 2465, -1842, 2465, -1843, 2465,
+    -1844, 2465, -1845, 2466, -1846, 2466, -1847, 2466, -1850, 2466, -1849, 2467, -1850, 2467, -1852, 2467,
+    -1853, 2468, -1855, 2468, -1855, 2469, -1855, 2468, -1857, 2468, -1857, 2467, -1858, 2467, -1856, 2464,
+    -1856, 2463, -1854, 2460, -1855, 2457, -1852, 2453, -1849, 2449, -1846, 2445, -1844, 2439, -1840, 2433,
+    -1836, 2428, -1834, 2421, -1828, 2414, -1822, 2406, -1818, 2399, -1812, 2389, -1806, 2381, -1799, 2370,
+    -1793, 2362, -1785, 2350, -1778, 2339, -1769, 2328, -1762, 2316, -1753, 2304, -1743, 2289, -1735, 2277,
+    -1723, 2263, -1715, 2247, -1702, 2233, -1692, 2218, -1680, 2201, -1668, 2185, -1655, 2167, -1644, 2150,
+    -1629, 2132, -1616, 2114, -1604, 2094, -1587, 2075, -1574, 2055, -1557, 2034, -1543, 2013, -1526, 1992,
+    -1511, 1969, -1494, 1947, -1476, 1924, -1458, 1900, -1440, 1876, -1423, 1852, -1404, 1827, -1385, 1802,
+    -1368, 1778, -1348, 1753, -1331, 1728, -1311, 1704, -1293, 1679, -1274, 1654, -1256, 1630, -1236, 1605,
+    -1218, 1580, -1200, 1556, -1180, 1530, -1162, 1506, -1143, 1482, -1125, 1456, -1105, 1432, -1087, 1407,
+    -1069, 1383, -1049, 1357, -1030, 1333, -1012, 1308, -991, 1284, -974, 1258, -955, 1234, -934, 1208,
+    -916, 1184, -898, 1159, -879, 1135, -860, 1109, -840, 1085, -821, 1060, -803, 1035, -782, 1010,
+    -765, 985, -744, 961, -726, 936, -705, 910, -688, 886, -667, 861, -649, 836, -630, 811,
+    -610, 786, -591, 761, -572, 737, -553, 711, -533, 687, -514, 662, -495, 636, -475, 612,
+    -456, 588, -439, 563, -420, 540, -401, 517, -385, 495, -367, 473, -351, 451, -335, 430,
+    -318, 410, -303, 390, -288, 371, -272, 350, -261, 334, -244, 314, -231, 298, -220, 280,
+    -204, 264, -193, 248, -182, 233, -169, 217, -158, 203, -147, 190, -137, 175, -126, 163,
+    -117, 150, -107, 138, -99, 127, -89, 115, -83, 106, -74, 94, -66, 86, -59, 77,
+    -55, 68, -46, 60, -41, 53, -35, 45, -30, 39, -26, 34, -22, 27, -18, 23,
+    -14, 18, -11, 14, -8, 11, -6, 7, -4, 5, -2, 3, -1, 1, -1, 2,
+    0, 0, 0, 0, 0, -1, 0, 1, 2, 1, 3, 2, 5, 3, 6, 5,
+    11, 7, 13, 10, 17, 12, 20, 15, 25, 18, 32, 22, 35, 26, 42, 31,
+    49, 35, 57, 40, 62, 46, 71, 51, 79, 57, 89, 64, 97, 69, 107, 78,
+    117, 84, 128, 92, 140, 100, 150, 109, 163, 117, 176, 127, 188, 135, 201, 146,
+    216, 155, 229, 166, 245, 176, 260, 188, 276, 199, 292, 210, 308, 222, 325, 236,
+    344, 247, 361, 261, 380, 274, 399, 288, 418, 302, 438, 316, 459, 332, 479, 346,
+    500, 362, 523, 377, 545, 393, 565, 410, 591, 428, 613, 443, 637, 461, 659, 476,
+    683, 495, 705, 510, 728, 528, 752, 545, 775, 561, 798, 579, 820, 595, 844, 613,
+    868, 629, 889, 646, 913, 663, 936, 680, 958, 697, 982, 714, 1006, 731, 1028, 748,
+    1051, 765, 1073, 782, 1097, 799, 1119, 816, 1142, 834, 1166, 850, 1188, 868, 1211, 885,
+    1234, 902, 1257, 919, 1280, 936, 1303, 954, 1325, 971, 1348, 987, 1372, 1006, 1394, 1022,
+    1417, 1040, 1440, 1057, 1462, 1075, 1485, 1092, 1508, 1109, 1529, 1127, 1554, 1144, 1576, 1162,
+    1599, 1179, 1621, 1197, 1644, 1214, 1667, 1231, 1689, 1250, 1712, 1266, 1734, 1285, 1756, 1302,
+    1779, 1319, 1799, 1335, 1821, 1352, 1840, 1368, 1859, 1384, 1880, 1399, 1898, 1413, 1916, 1429,
+    1935, 1444, 1951, 1457, 1969, 1471, 1985, 1485, 2001, 1498, 2016, 1510, 2032, 1524, 2046, 1535,
+    2059, 1547, 2074, 1559, 2088, 1570, 2100, 1580, 2111, 1592, 2124, 1601, 2135, 1612, 2146, 1621,
+    2156, 1630, 2166, 1640, 2175, 1647, 2184, 1656, 2194, 1664, 2200, 1672, 2209, 1678, 2215, 1686,
+    2222, 1692, 2230, 1699, 2232, 1704, 2241, 1710, 2244, 1715, 2248, 1720, 2253, 1725, 2256, 1728,
+    2259, 1732, 2261, 1736, 2262, 1740, 2266, 1741, 2266, 1745, 2267, 1746, 2266, 1748, 2266, 1750,
+    2266, 1751, 2266, 1752, 2265, 1753, 2263, 1753, 2264, 1755, 2263, 1757, 2262, 1756, 2261, 1760,
+    2261, 1758, 2260, 1761, 2259, 1761, 2260, 1763, 2258, 1763, 2256, 1764, 2256, 1766, 2256, 1767,
+    2256, 1767, 2254, 1769, 2253, 1770, 2253, 1771, 2252, 1772, 2252, 1773, 2250, 1773, 2251, 1775,
+    2249, 1776, 2249, 1777, 2248, 1778, 2247, 1779, 2246, 1780, 2246, 1781, 2244, 1783, 2246, 1783,
+    2243, 1784, 2244, 1785, 2242, 1787, 2242, 1787, 2241, 1789, 2241, 1790, 2239, 1790, 2239, 1792,
+    2239, 1793, 2237, 1793, 2237, 1795, 2236, 1795, 2235, 1797, 2235, 1798, 2234, 1799, 2234, 1800,
+    2232, 1801, 2232, 1802, 2231, 1803, 2231, 1803, 2229, 1806, 2229, 1806, 2229, 1806, 2227, 1808,
+    2227, 1809, 2226, 1810, 2225, 1811, 2225, 1812, 2224, 1814, 2223, 1814, 2223, 1815, 2222, 1816,
+    2220, 1817, 2220, 1818, 2220, 1819, 2219, 1820, 2218, 1822, 2218, 1822, 2216, 1823, 2216, 1823,
+    2215, 1825, 2216, 1827, 2214, 1827, 2212, 1828, 2212, 1829, 2212, 1831, 2211, 1831, 2210, 1832,
+    2209, 1833, 2209, 1834, 2208, 1836, 2207, 1836, 2208, 1837, 2206, 1838, 2204, 1839, 2206, 1841,
+    2203, 1841, 2202, 1843, 2203, 1843, 2201, 1844, 2200, 1845, 2202, 1847, 2199, 1847, 2198, 1848,
+    2198, 1849, 2197, 1850, 2197, 1852, 2196, 1852, 2194, 1853, 2195, 1855, 2193, 1855, 2193, 1856,
+    2193, 1857, 2191, 1858, 2190, 1860, 2190, 1860, 2190, 1861, 2188, 1862, 2188, 1863, 2187, 1864,
+    2186, 1866, 2185, 1866, 2184, 1867, 2185, 1868, 2182, 1869, 2183, 1870, 2183, 1871, 2181, 1872,
+    2179, 1874, 2180, 1873, 2179, 1876, 2179, 1875, 2177, 1877, 2176, 1878, 2176, 1879, 2176, 1880,
+    2174, 1881, 2173, 1881, 2173, 1883, 2173, 1885, 2171, 1884, 2171, 1886, 2169, 1886, 2169, 1888,
+    2168, 1888, 2169, 1890, 2166, 1890, 2166, 1892, 2165, 1892, 2165, 1893, 2163, 1894, 2164, 1896,
+    2161, 1895, 2162, 1897, 2160, 1898, 2160, 1900, 2159, 1899, 2158, 1902, 2157, 1901, 2157, 1903,
+    2156, 1904, 2156, 1904, 2154, 1906, 2154, 1906, 2152, 1908, 2152, 1908, 2152, 1910, 2151, 1910,
+    2150, 1912, 2149, 1912, 2147, 1914, 2149, 1913, 2147, 1915, 2146, 1917, 2146, 1917, 2145, 1918,
+    2143, 1919, 2143, 1919, 2142, 1923, 2142, 1921, 2141, 1923, 2140, 1924, 2140, 1924, 2137, 1927,
+    2138, 1926, 2138, 1926, 2135, 1930, 2136, 1929, 2134, 1931, 2134, 1931, 2133, 1932, 2133, 1933,
+    2131, 1934, 2131, 1935, 2130, 1936, 2129, 1936, 2128, 1938, 2127, 1938, 2127, 1940, 2125, 1940,
+    2126, 1942, 2123, 1941, 2124, 1944, 2122, 1943, 2123, 1946, 2120, 1946, 2121, 1947, 2120, 1947,
+    2118, 1949, 2117, 1950, 2118, 1950, 2116, 1952, 2115, 1952, 2115, 1953, 2114, 1954, 2114, 1956,
+    2112, 1955, 2112, 1958, 2110, 1957, 2110, 1959, 2109, 1960, 2108, 1961, 2108, 1961, 2107, 1962,
+    2106, 1964, 2104, 1964, 2105, 1965, 2103, 1967, 2103, 1966, 2103, 1968, 2101, 1969, 2101, 1969,
+    2099, 1971, 2098, 1972, 2098, 1972, 2098, 1974, 2096, 1974, 2096, 1974, 2094, 1976, 2094, 1978,
+    2093, 1977, 2093, 1979, 2090, 1980, 2092, 1980, 2089, 1982, 2090, 1982, 2088, 1983, 2086, 1984,
+    2087, 1985, 2086, 1986, 2084, 1987, 2085, 1987, 2083, 1989, 2083, 1989, 2081, 1991, 2082, 1991,
+    2079, 1992, 2079, 1993, 2079, 1994, 2078, 1995, 2076, 1995, 2077, 1997, 2075, 1997, 2073, 1999,
+    2074, 1999, 2072, 2000, 2073, 2001, 2070, 2001, 2071, 2003, 2069, 2004, 2069, 2005, 2067, 2004,
+    2067, 2007, 2066, 2007, 2066, 2008, 2063, 2008, 2064, 2011, 2063, 2011, 2061, 2011, 2062, 2012,
+    2060, 2012, 2059, 2015, 2059, 2016, 2057, 2015, 2058, 2017, 2055, 2017, 2056, 2018, 2053, 2020,
+    2054, 2020, 2052, 2021, 2053, 2022, 2051, 2023, 2050, 2024, 2048, 2024, 2049, 2026, 2048, 2026,
+    2046, 2027, 2047, 2028, 2044, 2028, 2045, 2030, 2043, 2031, 2042, 2031, 2042, 2033, 2042, 2033,
+    2039, 2034, 2039, 2034, 2038, 2036, 2038, 2037, 2037, 2037, 2035, 2038, 2035, 2039, 2034, 2040,
+    2033, 2041, 2033, 2041, 2031, 2043, 2030, 2044, 2030, 2044, 2029, 2045, 2028, 2045, 2027, 2047,
+    2026, 2048, 2026, 2048, 2024, 2050, 2025, 2050, 2021, 2051, 2023, 2051, 2020, 2053, 2021, 2054,
+    2019, 2054, 2018, 2055, 2018, 2056, 2017, 2057, 2016, 2057, 2014, 2059, 2015, 2059, 2012, 2061,
+    2014, 2061, 2011, 2062, 2010, 2062, 2010, 2063, 2009, 2065, 2008, 2065, 2007, 2066, 2006, 2067,
+    2006, 2067, 2004, 2069, 2004, 2070, 2002, 2070, 2002, 2071, 2002, 2071, 2000, 2073, 1999, 2073,
+    1999, 2075, 1996, 2075, 1997, 2076, 1995, 2077, 1996, 2078, 1994, 2078, 1992, 2079, 1993, 2080,
+    1991, 2081, 1990, 2082, 1990, 2082, 1989, 2084, 1987, 2083, 1987, 2086, 1986, 2085, 1985, 2087,
+    1984, 2088, 1983, 2087, 1982, 2089, 1981, 2090, 1981, 2091, 1981, 2092, 1977, 2092, 1978, 2093,
+    1978, 2093, 1975, 2095, 1975, 2096, 1975, 2096, 1973, 2097, 1973, 2098, 1972, 2099, 1969, 2100,
+    1971, 2100, 1968, 2101, 1968, 2102, 1968, 2103, 1965, 2103, 1966, 2105, 1963, 2106, 1964, 2105,
+    1963, 2107, 1961, 2107, 1961, 2109, 1960, 2109, 1958, 2111, 1959, 2111, 1957, 2111, 1955, 2112,
+    1956, 2113, 1954, 2115, 1954, 2114, 1952, 2116, 1952, 2116, 1949, 2117, 1950, 2118, 1950, 2119,
+    1948, 2120, 1946, 2120, 1947, 2121, 1944, 2122, 1945, 2122, 1943, 2124, 1942, 2125, 1942, 2124,
+    1940, 2126, 1940, 2127, 1938, 2128, 1938, 2128, 1937, 2129, 1935, 2129, 1936, 2131, 1933, 2132,
+    1933, 2131, 1933, 2133, 1930, 2133, 1930, 2135, 1930, 2135, 1929, 2137, 1926, 2137, 1927, 2137,
+    1926, 2138, 1924, 2140, 1924, 2139, 1923, 2141, 1922, 2142, 1920, 2142, 1920, 2143, 1920, 2144,
+    1917, 2144, 1918, 2146, 1915, 2145, 1915, 2147, 1915, 2148, 1913, 2148, 1913, 2150, 1911, 2149,
+    1911, 2151, 1909, 2151, 1909, 2153, 1907, 2152, 1907, 2154, 1906, 2155, 1905, 2155, 1903, 2156,
+    1902, 2157, 1903, 2157, 1900, 2159, 1901, 2159, 1899, 2160, 1897, 2160, 1898, 2162, 1896, 2162,
+    1895, 2163, 1894, 2163, 1893, 2165, 1893, 2165, 1891, 2166, 1890, 2167, 1890, 2166, 1889, 2169,
+    1887, 2170, 1886, 2169, 1887, 2171, 1884, 2171, 1884, 2172, 1882, 2173, 1881, 2173, 1881, 2174,
+    1880, 2175, 1879, 2176, 1878, 2177, 1876, 2177, 1877, 2178, 1874, 2178, 1874, 2179, 1873, 2181,
+    1872, 2181, 1871, 2182, 1870, 2182, 1869, 2183, 1868, 2185, 1867, 2184, 1867, 2185, 1865, 2186,
+    1864, 2188, 1863, 2187, 1862, 2188, 1861, 2189, 1860, 2190, 1860, 2191, 1857, 2192, 1858, 2191,
+    1857, 2193, 1855, 2194, 1854, 2193, 1853, 2196, 1852, 2196, 1852, 2196, 1849, 2198, 1850, 2197,
+    1848, 2199, 1847, 2199, 1847, 2201, 1845, 2200, 1844, 2201, 1844, 2203, 1843, 2203, 1841, 2205,
+    1840, 2204, 1840, 2205, 1838, 2206, 1837, 2206, 1836, 2208, 1836, 2208, 1834, 2208, 1833, 2210,
+    1833, 2211, 1831, 2211, 1830, 2211, 1829, 2213, 1829, 2214, 1828, 2213, 1825, 2215, 1825, 2215,
+    1825, 2216, 1824, 2217, 1821, 2218, 1822, 2218, 1819, 2219, 1820, 2220, 1819, 2220, 1817, 2221,
+    1816, 2223, 1815, 2222, 1814, 2223, 1813, 2224, 1813, 2224, 1811, 2226, 1809, 2226, 1809, 2227,
+    1809, 2228, 1806, 2228, 1807, 2229, 1805, 2230, 1804, 2230, 1802, 2232, 1802, 2231, 1800, 2233,
+    1801, 2233, 1798, 2233, 1798, 2235, 1797, 2235, 1795, 2237, 1795, 2237, 1794, 2237, 1793, 2238,
+    1791, 2239, 1791, 2239, 1789, 2241, 1789, 2241, 1788, 2242, 1785, 2242, 1786, 2242, 1784, 2246,
+    1783, 2243, 1783, 2246, 1781, 2246, 1780, 2246, 1780, 2248, 1778, 2248, 1776, 2248, 1777, 2250,
+    1774, 2251, 1774, 2250, 1773, 2251, 1772, 2252, 1771, 2253, 1769, 2254, 1769, 2255, 1768, 2254,
+    1766, 2256, 1766, 2257, 1764, 2257, 1763, 2258, 1764, 2257, 1761, 2260, 1761, 2259, 1758, 2262,
+    1758, 2261, 1758, 2261, 1756, 2263, 1755, 2263, 1753, 2264, 1753, 2265, 1752, 2265, 1751, 2267,
+    1750, 2266, 1748, 2267, 1747, 2267, 1744, 2265, 1742, 2265, 1738, 2264, 1736, 2260, 1733, 2259,
+    1728, 2256, 1726, 2253, 1719, 2248, 1715, 2244, 1710, 2240, 1705, 2234, 1697, 2228, 1693, 2222,
+    1686, 2216, 1680, 2208, 1670, 2202, 1663, 2192, 1658, 2184, 1647, 2176, 1639, 2167, 1630, 2155,
+    1622, 2146, 1611, 2135, 1603, 2123, 1591, 2113, 1581, 2100, 1570, 2087, 1558, 2074, 1548, 2060,
+    1535, 2047, 1524, 2031, 1510, 2017, 1498, 2001, 1485, 1985, 1472, 1970, 1457, 1951, 1444, 1934,
+    1429, 1917, 1413, 1898, 1400, 1880, 1384, 1860, 1368, 1841, 1352, 1820, 1336, 1800, 1319, 1778,
+    1301, 1756, 1285, 1735, 1268, 1713, 1249, 1688, 1231, 1668, 1215, 1644, 1197, 1623, 1179, 1597,
+    1162, 1577, 1145, 1553, 1127, 1532, 1110, 1508, 1092, 1484, 1074, 1464, 1057, 1440, 1042, 1417,
+    1022, 1394, 1005, 1371, 989, 1349, 970, 1326, 954, 1303, 937, 1280, 919, 1258, 902, 1234,
+    886, 1211, 867, 1189, 851, 1165, 834, 1144, 816, 1120, 799, 1096, 783, 1075, 765, 1051,
+    749, 1028, 731, 1005, 714, 982, 697, 959, 680, 936, 664, 913, 646, 891, 630, 867,
+    612, 844, 595, 821, 579, 798, 562, 775, 545, 752, 528, 729, 510, 706, 496, 682,
+    476, 661, 461, 636, 444, 613, 427, 591, 410, 567, 395, 545, 377, 523, 362, 501,
+    346, 479, 332, 459, 316, 438, 303, 418, 287, 399, 275, 381, 260, 361, 249, 344,
+    235, 325, 222, 309, 211, 293, 199, 275, 187, 260, 177, 246, 166, 229, 156, 215,
+    145, 203, 136, 188, 127, 175, 116, 164, 109, 151, 101, 138, 92, 128, 85, 118,
+    77, 107, 70, 97, 64, 89, 57, 80, 51, 70, 46, 64, 40, 55, 35, 49,
+    31, 43, 25, 36, 23, 31, 18, 25, 15, 21, 12, 16, 10, 14, 7, 10,
+    4, 7, 4, 4, 2, 3, 2, 2, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, -1, 2, -1, 3, -3, 5, -4, 7, -6, 12, -7, 14, -12, 17, -13,
+    24, -18, 27, -23, 33, -24, 39, -32, 46, -35, 52, -41, 61, -46, 68, -53,
+    76, -60, 85, -66, 95, -74, 105, -81, 116, -91, 126, -98, 138, -107, 150, -117,
+    162, -127, 176, -136, 189, -147, 202, -158, 218, -169, 232, -180, 248, -193, 263, -205,
+    281, -218, 297, -232, 315, -244, 332, -260, 352, -272, 370, -288, 389, -304, 410, -318,
+    430, -334, 451, -351, 472, -367, 494, -384, 518, -402, 539, -419, 563, -438, 588, -456,
+    611, -476, 637, -494, 661, -514, 686, -532, 712, -554, 736, -571, 761, -591, 786, -609,
+    810, -630, 835, -649, 861, -667, 886, -686, 910, -706, 935, -726, 960, -745, 985, -764,
+    1010, -782, 1035, -803, 1059, -820, 1085, -840, 1108, -859, 1136, -878, 1158, -898, 1184, -915,
+    1208, -936, 1233, -954, 1259, -973, 1282, -991, 1308, -1012, 1333, -1030, 1357, -1049, 1382, -1067,
+    1406, -1088, 1433, -1105, 1456, -1124, 1480, -1143, 1506, -1162, 1531, -1180, 1554, -1200, 1581, -1217,
+    1604, -1238, 1630, -1254, 1654, -1274, 1678, -1292, 1703, -1311, 1729, -1331, 1752, -1347, 1777, -1367,
+    1803, -1386, 1827, -1403, 1851, -1422, 1876, -1441, 1898, -1458, 1925, -1476, 1946, -1493, 1970, -1511,
+    1991, -1525, 2012, -1543, 2034, -1558, 2055, -1574, 2074, -1587, 2094, -1603, 2114, -1615, 2132, -1630,
+    2149, -1643, 2168, -1656, 2185, -1667, 2200, -1680, 2217, -1692, 2234, -1703, 2248, -1714, 2262, -1723,
+    2276, -1734, 2290, -1743, 2303, -1753, 2315, -1761, 2328, -1770, 2340, -1778, 2349, -1784, 2362, -1794,
+    2370, -1799, 2381, -1806, 2389, -1812, 2399, -1818, 2407, -1823, 2413, -1827, 2421, -1833, 2428, -1837,
+    2433, -1840, 2439, -1844, 2445, -1846, 2448, -1850, 2453, -1852, 2459, -1853, 2458, -1855, 2464, -1856,
+    2465, -1857, 2466, -1857, 2467, -1857, 2469, -1857, 2468, -1856, 2469, -1856, 2468, -1854, 2467, -1852,
+    2467, -1852, 2467, -1851, 2467, -1849, 2467, -1849, 2466, -1848, 2466, -1845, 2467, -1846, 2465, -1845,
+    2466, -1843, 2464, -1841, 2464, -1841, 2465, -1840, 2464, -1839, 2465, -1838, 2463, -1836, 2463, -1835,
+    2462, -1835, 2463, -1833, 2463, -1833, 2463, -1830, 2462, -1830, 2460, -1829, 2462, -1829, 2462, -1826,
+    2460, -1826, 2460, -1825, 2461, -1824, 2459, -1822, 2461, -1821, 2460, -1821, 2460, -1819, 2460, -1819,
+    2458, -1818, 2460, -1816, 2459, -1815, 2458, -1815, 2458, -1813, 2459, -1812, 2458, -1812, 2458, -1809,
+    2457, -1809, 2458, -1809, 2457, -1807, 2457, -1806, 2456, -1805, 2457, -1804, 2456, -1802, 2457, -1803,
+    2456, -1800, 2456, -1801, 2456, -1798, 2454, -1798, 2455, -1797, 2456, -1795, 2455, -1795, 2455, -1793,
+    2455, -1794, 2453, -1791, 2455, -1790, 2454, -1790, 2454, -1789, 2452, -1787, 2455, -1787, 2453, -1786,
+    2453, -1784, 2453, -1784, 2453, -1782, 2453, -1782, 2453, -1781, 2452, -1779, 2452, -1779, 2452, -1777,
+    2452, -1777, 2452, -1775, 2453, -1775, 2451, -1773, 2452, -1773, 2450, -1772, 2452, -1770, 2451, -1770,
+    2451, -1769, 2452, -1768, 2450, -1767, 2451, -1766, 2451, -1765, 2450, -1763, 2451, -1763, 2451, -1762,
+    2450, -1762, 2450, -1759, 2450, -1759, 2450, -1759, 2451, -1757, 2449, -1756, 2450, -1755, 2450, -1754,
+    2450, -1754, 2450, -1752, 2449, -1751, 2449, -1751, 2450, -1749, 2449, -1750, 2449, -1747, 2450, -1747,
+    2449, -1746, 2450, -1744, 2449, -1745, 2448, -1742, 2449, -1743, 2449, -1741, 2449, -1740, 2448, -1740,
+    2450, -1738, 2448, -1737, 2449, -1736, 2449, -1736, 2450, -1735, 2447, -1733, 2450, -1733, 2447, -1731,
+    2450, -1731, 2447, -1730, 2450, -1729, 2449, -1729, 2448, -1727, 2448, -1726, 2449, -1726, 2449, -1724,
+    2448, -1724, 2449, -1722, 2448, -1722, 2449, -1721, 2448, -1720, 2449, -1719, 2448, -1718, 2449, -1717,
+    2448, -1716, 2447, -1715, 2450, -1715, 2447, -1713, 2450, -1713, 2447, -1711, 2450, -1711, 2447, -1709,
+    2448, -1709, 2449, -1708, 2448, -1707, 2449, -1707, 2448, -1705, 2448, -1705, 2449, -1703, 2449, -1702,
+    2449, -1702, 2448, -1701, 2450, -1700, 2448, -1699, 2449, -1698, 2449, -1697, 2449, -1697, 2449, -1696,
+    2448, -1694, 2450, -1693, 2449, -1693, 2450, -1693, 2449, -1691, 2451, -1690, 2450, -1690, 2449, -1688,
+    2449, -1688, 2450, -1687, 2451, -1685, 2449, -1687, 2452, -1684, 2449, -1683, 2451, -1683, 2450, -1681,
+    2451, -1681, 2451, -1680, 2451, -1679, 2451, -1679, 2451, -1677, 2450, -1676, 2451, -1676, 2451, -1674,
+    2451, -1675, 2452, -1672, 2451, -1673, 2451, -1671, 2453, -1670, 2451, -1669, 2452, -1669, 2452, -1667,
+    2452, -1667, 2452, -1667, 2453, -1665, 2452, -1665, 2453, -1664, 2453, -1662, 2452, -1662, 2454, -1661,
+    2453, -1660, 2454, -1659, 2453, -1659, 2453, -1657, 2455, -1658, 2454, -1655, 2454, -1656, 2454, -1654,
+    2455, -1653, 2455, -1653, 2455, -1652, 2454, -1652, 2455, -1649, 2457, -1650, 2455, -1649, 2456, -1647,
+    2456, -1647, 2455, -1646, 2457, -1645, 2457, -1644, 2456, -1645, 2457, -1642, 2457, -1642, 2458, -1641,
+    2456, -1640, 2458, -1640, 2459, -1638, 2457, -1638, 2459, -1637, 2459, -1637, 2458, -1635, 2459, -1635,
+    2460, -1633, 2458, -1633, 2460, -1632, 2460, -1632, 2460, -1630, 2461, -1630, 2460, -1628, 2461, -1629,
+    2461, -1627, 2461, -1627, 2461, -1625, 2462, -1626, 2462, -1623, 2462, -1624, 2463, -1622, 2462, -1622,
+    2463, -1621, 2463, -1620, 2464, -1619, 2463, -1618, 2464, -1618, 2464, -1617, 2465, -1617, 2464, -1615,
+    2466, -1614, 2465, -1614, 2466, -1613, 2466, -1612, 2466, -1611, 2466, -1611, 2467, -1609, 2468, -1610,
+    2467, -1608, 2467, -1607, 2468, -1607, 2468, -1605, 2469, -1605, 2469, -1605, 2468, -1603, 2470, -1603,
+    2470, -1603, 2470, -1601, 2470, -1600, 2471, -1600, 2471, -1599, 2471, -1597, 2472, -1598, 2472, -1596,
+    2472, -1596, 2472, -1595, 2473, -1594, 2475, -1593, 2472, -1593, 2475, -1592, 2474, -1590, 2475, -1591,
+    2474, -1590, 2476, -1588, 2476, -1588, 2475, -1587, 2476, -1587, 2478, -1586, 2477, -1584, 2478, -1585,
+    2478, -1583, 2478, -1583, 2478, -1582, 2479, -1581, 2479, -1580, 2479, -1580, 2480, -1578, 2482, -1579,
+    2480, -1577, 2481, -1576, 2482, -1576, 2482, -1575, 2482, -1575, 2483, -1573, 2483, -1573, 2484, -1573,
+    2485, -1570, 2483, -1571, 2485, -1569, 2486, -1570, 2485, -1568, 2485, -1567, 2487, -1567, 2487, -1565,
+    2487, -1566, 2488, -1565, 2488, -1563, 2489, -1563, 2488, -1562, 2489, -1562, 2491, -1561, 2490, -1560,
+    2491, -1559, 2490, -1559, 2493, -1557, 2492, -1558, 2492, -1556, 2493, -1555, 2494, -1556, 2492, -1553,
+    2495, -1554, 2495, -1552, 2496, -1552, 2495, -1551, 2497, -1550, 2496, -1550, 2497, -1549, 2497, -1548,
+    2499, -1548, 2498, -1547, 2500, -1545, 2499, -1545, 2500, -1545, 2500, -1544, 2501, -1543, 2501, -1542,
+    2503, -1542, 2502, -1541, 2503, -1540, 2504, -1540, 2504, -1538, 2504, -1538, 2505, -1537, 2505, -1536,
+    2507, -1536, 2507, -1535, 2506, -1535, 2508, -1533, 2507, -1533, 2509, -1532, 2510, -1531, 2509, -1531,
+    2511, -1530, 2511, -1530, 2511, -1527, 2512, -1529, 2513, -1526, 2512, -1527, 2514, -1525, 2514, -1525,
+    2515, -1525, 2514, -1522, 2516, -1524, 2518, -1522, 2517, -1522, 2517, -1520, 2518, -1520, 2519, -1519,
+    2519, -1519, 2520, -1517, 2521, -1518, 2521, -1516, 2521, -1515, 2522, -1516, 2523, -1513, 2523, -1514,
+    2525, -1512, 2524, -1513, 2525, -1512, 2526, -1510, 2527, -1510, 2527, -1510, 2527, -1508, 2528, -1508,
+    2530, -1507, 2528, -1506, 2531, -1505, 2531, -1506, 2532, -1504, 2532, -1504, 2531, -1503, 2534, -1502,
+    2535, -1502, 2534, -1500, 2535, -1500, 2536, -1499, 2537, -1499, 2537, -1499, 2538, -1496, 2538, -1496,
+    2540, -1497, 2539, -1495, 2541, -1495, 2541, -1493, 2542, -1493, 2543, -1493, 2542, -1491, 2545, -1491,
+    2544, -1491, 2546, -1489, 2546, -1489, 2546, -1488, 2548, -1488, 2548, -1487, 2549, -1486, 2549, -1485,
+    2551, -1484, 2550, -1484, 2552, -1484, 2552, -1483, 2554, -1481, 2553, -1482, 2555, -1480, 2555, -1480,
+    2557, -1479, 2556, -1479, 2557, -1478, 2559, -1476, 2559, -1477, 2560, -1476, 2559, -1474, 2562, -1475,
+    2562, -1473, 2562, -1473, 2564, -1473, 2564, -1471, 2565, -1471, 2565, -1470, 2567, -1470, 2567, -1469,
+    2569, -1467, 2568, -1468, 2570, -1467, 2571, -1466, 2571, -1466, 2572, -1464, 2573, -1465, 2573, -1463,
+    2574, -1462, 2575, -1462, 2577, -1462, 2576, -1460, 2578, -1461, 2579, -1459, 2578, -1458, 2581, -1458,
+    2581, -1458, 2582, -1456, 2582, -1456, 2584, -1455, 2584, -1455, 2585, -1453, 2586, -1454, 2586, -1452,
+    2588, -1452, 2589, -1451, 2589, -1450, 2591, -1450, 2590, -1449, 2593, -1449, 2592, -1447, 2593, -1447,
+    2595, -1446, 2596, -1446, 2596, -1445, 2596, -1444, 2598, -1444, 2600, -1443, 2600, -1443, 2600, -1441,
+    2601, -1441, 2604, -1440, 2603, -1440, 2604, -1439, 2606, -1438, 2606, -1437, 2607, -1437, 2607, -1437,
+    2609, -1435, 2610, -1435, 2610, -1434, 2613, -1434, 2612, -1433, 2614, -1432, 2614, -1431, 2616, -1432,
+    2616, -1429, 2618, -1429, 2618, -1430, 2619, -1428, 2620, -1427, 2621, -1427, 2623, -1426, 2623, -1426,
+    2623, -1425, 2626, -1424, 2626, -1423, 2626, -1423, 2629, -1422, 2628, -1421, 2631, -1421, 2631, -1421,
+    2632, -1418, 2632, -1419, 2634, -1418, 2636, -1419, 2635, -1416, 2638, -1416, 2637, -1415, 2639, -1415,
+    2641, -1414, 2641, -1414, 2643, -1412, 2643, -1413, 2644, -1412, 2645, -1410, 2647, -1411, 2647, -1408,
+    2649, -1409, 2650, -1408, 2649, -1408, 2652, -1406, 2654, -1407, 2653, -1405, 2655, -1405, 2656, -1404,
+    2657, -1403, 2658, -1403, 2660, -1403, 2659, -1401, 2662, -1401, 2662, -1400, 2665, -1399, 2664, -1399,
+    2666, -1398, 2666, -1398, 2669, -1397, 2669, -1396, 2671, -1396, 2671, -1394, 2672, -1394, 2673, -1393,
+    2675, -1393, 2677, -1393, 2677, -1392, 2678, -1390, 2681, -1390, 2680, -1390, 2681, -1389, 2683, -1387,
+    2684, -1388, 2686, -1387, 2686, -1386, 2687, -1386, 2689, -1385, 2690, -1384, 2692, -1384, 2692, -1382,
+    2694, -1382, 2695, -1382, 2696, -1381, 2697, -1379, 2698, -1381, 2700, -1379, 2701, -1379, 2701, -1377,
+    2704, -1376, 2705, -1376, 2706, -1377, 2707, -1375, 2708, -1373, 2710, -1374, 2710, -1373, 2710, -1372,
+    2711, -1370, 2708, -1368, 2708, -1365, 2705, -1365, 2703, -1360, 2700, -1359, 2697, -1355, 2692, -1354,
+    2687, -1347, 2682, -1345, 2677, -1339, 2670, -1337, 2663, -1330, 2656, -1327, 2649, -1321, 2637, -1315,
+    2630, -1310, 2622, -1302, 2608, -1297, 2600, -1291, 2587, -1285, 2577, -1277, 2563, -1269, 2550, -1261,
+    2536, -1254, 2523, -1245, 2508, -1238, 2492, -1228, 2476, -1220, 2460, -1210, 2443, -1202, 2425, -1190,
+    2407, -1182, 2387, -1170, 2370, -1161, 2348, -1150, 2330, -1139, 2307, -1128, 2285, -1116, 2264, -1104,
+    2241, -1093, 2217, -1079, 2193, -1068, 2169, -1055, 2145, -1041, 2118, -1029, 2091, -1014, 2064, -1001,
+    2038, -988, 2012, -973, 1983, -959, 1957, -947, 1931, -932, 1902, -919, 1876, -905, 1849, -891,
+    1822, -877, 1794, -864, 1767, -849, 1739, -837, 1713, -823, 1685, -810, 1658, -795, 1631, -782,
+    1603, -768, 1575, -756, 1549, -740, 1522, -728, 1493, -714, 1467, -700, 1438, -688, 1411, -673,
+    1384, -660, 1355, -648, 1329, -633, 1299, -619, 1273, -606, 1247, -593, 1217, -579, 1189, -566,
+    1163, -552, 1134, -540, 1107, -525, 1079, -513, 1051, -499, 1024, -485, 995, -472, 968, -459,
+    939, -445, 912, -432, 885, -419, 856, -405, 827, -391, 800, -379, 774, -365, 744, -353,
+    716, -339, 688, -325, 661, -312, 635, -299, 608, -288, 582, -274, 556, -263, 532, -251,
+    509, -240, 484, -228, 461, -219, 440, -206, 417, -197, 395, -186, 376, -178, 354, -165,
+    335, -159, 315, -149, 298, -140, 280, -132, 262, -123, 244, -116, 229, -108, 213, -99,
+    198, -94, 183, -86, 169, -79, 155, -73, 143, -68, 131, -61, 118, -55, 108, -51,
+    96, -46, 86, -40, 77, -37, 68, -31, 59, -28, 51, -25, 44, -20, 38, -18,
+    31, -14, 25, -12, 21, -10, 16, -7, 12, -6, 8, -4, 7, -3, 3, -2,
+    1, -1, 1, 0, 0, 0, 0, 0,
+};
+
+static const StrokeTableSegment STROKE_CALIB_SQUARE_SEGMENTS[1] = {
+    {0, 1},
+};
+
+static const int16_t STROKE_CALIB_CIRCLE_DELTAS[5014] = {
+    0, 0, -1, 1, -1, 2, -2, 3, -3, 5, -6, 7, -5, 11, -9, 13,
+    -12, 18, -13, 23, -19, 27, -20, 33, -25, 39, -29, 45, -34, 52, -38, 60,
+    -43, 67, -48, 76, -54, 84, -60, 95, -67, 104, -73, 115, -79, 125, -88, 137,
+    -96, 150, -102, 161, -111, 174, -119, 187, -129, 202, -137, 216, -145, 231, -158, 247,
+    -167, 261, -177, 280, -186, 295, -199, 314, -209, 331, -222, 350, -233, 368, -244, 389,
+    -258, 408, -270, 429, -283, 450, -297, 471, -310, 494, -322, 516, -338, 539, -353, 563,
+    -367, 588, -381, 612, -397, 638, -411, 662, -428, 688, -442, 714, -457, 738, -472, 765,
+    -487, 790, -502, 815, -515, 841, -532, 867, -545, 893, -560, 918, -575, 944, -589, 970,
+    -603, 996, -618, 1021, -632, 1049, -646, 1073, -660, 1101, -674, 1126, -688, 1152, -702, 1179,
+    -714, 1206, -730, 1232, -742, 1258, -755, 1285, -769, 1312, -783, 1338, -796, 1365, -807, 1392,
+    -822, 1419, -834, 1446, -847, 1473, -860, 1501, -871, 1527, -884, 1555, -897, 1583, -909, 1609,
+    -920, 1636, -932, 1665, -945, 1693, -956, 1720, -968, 1749, -978, 1776, -990, 1804, -1002, 1833,
+    -1013, 1860, -1022, 1888, -1034, 1918, -1045, 1946, -1054, 1974, -1066, 2002, -1074, 2029, -1083, 2058,
+    -1093, 2084, -1102, 2110, -1107, 2136, -1117, 2162, -1124, 2186, -1130, 2211, -1136, 2235, -1144, 2258,
+    -1147, 2282, -1154, 2306, -1157, 2325, -1163, 2349, -1167, 2370, -1169, 2390, -1173, 2411, -1177, 2431,
+    -1178, 2450, -1181, 2468, -1182, 2488, -1184, 2504, -1185, 2523, -1186, 2538, -1187, 2556, -1187, 2571,
+    -1185, 2587, -1185, 2600, -1186, 2616, -1182, 2630, -1183, 2641, -1180, 2656, -1177, 2667, -1175, 2679,
+    -1174, 2690, -1168, 2700, -1168, 2711, -1162, 2720, -1159, 2729, -1155, 2737, -1150, 2745, -1146, 2753,
+    -1140, 2759, -1135, 2764, -1131, 2771, -1124, 2775, -1118, 2781, -1112, 2784, -1107, 2787, -1098, 2790,
+    -1094, 2794, -1087, 2796, -1080, 2800, -1074, 2803, -1069, 2807, -1061, 2809, -1055, 2813, -1048, 2815,
+    -1043, 2819, -1036, 2821, -1029, 2824, -1023, 2828, -1017, 2829, -1011, 2834, -1005, 2836, -997, 2839,
+    -991, 2842, -986, 2845, -977, 2846, -973, 2851, -965, 2852, -959, 2856, -953, 2858, -947, 2861,
+    -940, 2863, -935, 2866, -927, 2869, -920, 2871, -915, 2874, -908, 2877, -903, 2879, -895, 2881,
+    -890, 2886, -882, 2886, -877, 2889, -869, 2892, -863, 2895, -858, 2896, -852, 2899, -843, 2901,
+    -838, 2903, -833, 2905, -825, 2909, -819, 2910, -812, 2913, -806, 2915, -800, 2916, -794, 2920,
+    -786, 2921, -780, 2923, -774, 2926, -768, 2927, -761, 2930, -755, 2931, -748, 2934, -742, 2936,
+    -735, 2937, -730, 2940, -722, 2942, -717, 2943, -710, 2945, -703, 2948, -698, 2949, -690, 2951,
+    -685, 2952, -678, 2954, -671, 2957, -665, 2959, -658, 2958, -654, 2962, -644, 2964, -640, 2964,
+    -633, 2966, -627, 2968, -620, 2971, -613, 2971, -608, 2972, -601, 2975, -594, 2975, -589, 2978,
+    -582, 2980, -575, 2979, -570, 2983, -562, 2983, -555, 2984, -550, 2986, -544, 2988, -536, 2989,
+    -530, 2990, -526, 2991, -517, 2993, -510, 2995, -505, 2995, -498, 2996, -492, 2998, -486, 2999,
+    -479, 3000, -472, 3001, -467, 3003, -460, 3004, -453, 3004, -447, 3005, -443, 3007, -433, 3008,
+    -428, 3008, -422, 3011, -414, 3010, -410, 3012, -401, 3013, -396, 3014, -389, 3014, -383, 3015,
+    -376, 3017, -370, 3017, -364, 3017, -357, 3019, -350, 3020, -346, 3019, -337, 3022, -332, 3021,
+    -324, 3022, -319, 3024, -312, 3023, -306, 3025, -299, 3025, -293, 3025, -287, 3026, -279, 3027,
+    -274, 3027, -268, 3028, -260, 3028, -255, 3028, -247, 3030, -242, 3029, -235, 3030, -229, 3031,
+    -222, 3030, -217, 3031, -208, 3031, -203, 3032, -196, 3031, -190, 3033, -185, 3032, -177, 3033,
+    -170, 3033, -165, 3033, -157, 3033, -153, 3033, -145, 3034, -137, 3034, -133, 3033, -127, 3034,
+    -118, 3034, -115, 3034, -105, 3035, -101, 3034, -94, 3034, -87, 3034, -81, 3034, -74, 3034,
+    -68, 3034, -63, 3034, -55, 3034, -49, 3034, -43, 3033, -35, 3034, -31, 3034, -23, 3033,
+    -17, 3033, -10, 3033, -6, 3032, 4, 3033, 9, 3031, 14, 3032, 24, 3031, 26, 3032,
+    34, 3031, 42, 3030, 47, 3030, 55, 3029, 60, 3029, 67, 3028, 72, 3028, 78, 3028,
+    87, 3027, 92, 3026, 99, 3026, 104, 3025, 112, 3024, 118, 3024, 124, 3023, 131, 3023,
+    136, 3022, 144, 3021, 149, 3021, 157, 3020, 163, 3019, 169, 3018, 176, 3018, 181, 3017,
+    188, 3017, 195, 3015, 200, 3014, 208, 3014, 214, 3013, 220, 3012, 227, 3011, 232, 3011,
+    240, 3009, 246, 3008, 252, 3007, 258, 3006, 265, 3006, 271, 3004, 278, 3003, 284, 3002,
+    291, 3002, 296, 3000, 303, 2999, 311, 2998, 315, 2996, 322, 2995, 328, 2995, 337, 2993,
+    340, 2992, 348, 2990, 355, 2989, 360, 2990, 367, 2986, 373, 2986, 378, 2984, 386, 2984,
+    393, 2981, 399, 2980, 404, 2980, 411, 2977, 418, 2976, 425, 2974, 430, 2974, 437, 2971,
+    443, 2971, 450, 2969, 456, 2967, 462, 2966, 469, 2963, 475, 2963, 481, 2962, 488, 2959,
+    494, 2957, 500, 2957, 506, 2955, 514, 2953, 518, 2951, 526, 2949, 532, 2948, 538, 2946,
+    545, 2944, 551, 2943, 557, 2941, 564, 2939, 570, 2937, 576, 2935, 582, 2933, 590, 2933,
+    594, 2929, 603, 2928, 608, 2926, 613, 2924, 620, 2922, 628, 2921, 633, 2918, 639, 2916,
+    646, 2914, 651, 2913, 659, 2910, 664, 2908, 671, 2906, 678, 2904, 682, 2902, 690, 2900,
+    697, 2898, 701, 2895, 709, 2893, 714, 2892, 722, 2889, 727, 2887, 734, 2884, 739, 2883,
+    747, 2880, 752, 2878, 759, 2875, 764, 2873, 771, 2871, 778, 2869, 782, 2866, 790, 2865,
+    795, 2861, 803, 2859, 809, 2857, 815, 2854, 821, 2852, 827, 2850, 835, 2846, 839, 2844,
+    846, 2842, 852, 2840, 859, 2837, 863, 2834, 871, 2832, 877, 2830, 884, 2826, 889, 2824,
+    897, 2822, 902, 2818, 907, 2816, 914, 2813, 920, 2812, 928, 2807, 932, 2806, 940, 2802,
+    945, 2800, 950, 2798, 958, 2794, 964, 2792, 970, 2788, 975, 2787, 982, 2782, 990, 2781,
+    993, 2777, 1000, 2775, 1008, 2772, 1011, 2769, 1020, 2766, 1025, 2763, 1031, 2760, 1038, 2757,
+    1044, 2754, 1050, 2751, 1054, 2748, 1063, 2746, 1068, 2742, 1074, 2739, 1079, 2736, 1087, 2733,
+    1091, 2729, 1099, 2727, 1105, 2724, 1111, 2721, 1116, 2717, 1123, 2714, 1128, 2711, 1136, 2708,
+    1140, 2705, 1148, 2701, 1153, 2698, 1158, 2696, 1166, 2691, 1171, 2688, 1176, 2687, 1183, 2681,
+    1189, 2679, 1196, 2676, 1200, 2671, 1209, 2669, 1213, 2665, 1218, 2663, 1226, 2658, 1232, 2655,
+    1237, 2651, 1244, 2649, 1249, 2645, 1256, 2641, 1261, 2638, 1267, 2634, 1273, 2631, 1280, 2628,
+    1285, 2623, 1291, 2621, 1297, 2616, 1302, 2614, 1309, 2610, 1315, 2606, 1321, 2602, 1327, 2599,
+    1333, 2595, 1338, 2592, 1345, 2589, 1351, 2583, 1355, 2581, 1363, 2578, 1368, 2573, 1375, 2569,
+    1379, 2566, 1385, 2562, 1392, 2559, 1398, 2554, 1403, 2551, 1409, 2547, 1415, 2543, 1422, 2539,
+    1425, 2536, 1432, 2532, 1440, 2528, 1443, 2524, 1451, 2520, 1455, 2517, 1463, 2512, 1467, 2508,
+    1473, 2505, 1479, 2500, 1485, 2497, 1491, 2492, 1496, 2489, 1502, 2485, 1508, 2480, 1513, 2476,
+    1520, 2474, 1526, 2468, 1529, 2465, 1538, 2460, 1542, 2457, 1547, 2452, 1554, 2449, 1559, 2444,
+    1565, 2440, 1571, 2436, 1577, 2431, 1582, 2428, 1588, 2424, 1594, 2419, 1598, 2415, 1606, 2411,
+    1610, 2406, 1616, 2403, 1622, 2398, 1628, 2394, 1633, 2390, 1639, 2386, 1644, 2380, 1649, 2376,
+    1657, 2373, 1661, 2368, 1666, 2365, 1673, 2359, 1678, 2354, 1683, 2351, 1689, 2347, 1694, 2342,
+    1701, 2338, 1705, 2333, 1711, 2328, 1717, 2326, 1723, 2319, 1727, 2316, 1732, 2311, 1740, 2307,
+    1744, 2302, 1750, 2297, 1756, 2293, 1760, 2289, 1765, 2284, 1773, 2280, 1777, 2274, 1781, 2271,
+    1788, 2266, 1794, 2261, 1800, 2256, 1804, 2253, 1809, 2248, 1814, 2243, 1821, 2238, 1826, 2234,
+    1831, 2228, 1837, 2225, 1841, 2220, 1848, 2214, 1852, 2209, 1858, 2207, 1863, 2201, 1868, 2196,
+    1875, 2190, 1879, 2188, 1883, 2180, 1890, 2178, 1895, 2173, 1900, 2167, 1905, 2164, 1910, 2158,
+    1916, 2154, 1921, 2149, 1927, 2143, 1933, 2137, 1936, 2134, 1942, 2130, 1947, 2124, 1952, 2118,
+    1958, 2115, 1963, 2110, 1967, 2105, 1974, 2099, 1978, 2095, 1983, 2090, 1988, 2084, 1995, 2080,
+    1998, 2075, 2005, 2069, 2008, 2065, 2014, 2061, 2018, 2055, 2025, 2050, 2029, 2044, 2034, 2040,
+    2040, 2035, 2045, 2029, 2049, 2026, 2053, 2019, 2060, 2014, 2064, 2011, 2070, 2004, 2074, 1999,
+    2080, 1994, 2084, 1989, 2089, 1984, 2093, 1979, 2100, 1973, 2105, 1969, 2108, 1964, 2114, 1957,
+    2119, 1954, 2122, 1948, 2129, 1942, 2133, 1938, 2138, 1932, 2144, 1927, 2147, 1922, 2153, 1917,
+    2157, 1911, 2162, 1906, 2167, 1900, 2172, 1896, 2177, 1890, 2181, 1886, 2186, 1879, 2191, 1875,
+    2194, 1869, 2203, 1863, 2204, 1859, 2210, 1853, 2214, 1848, 2219, 1842, 2222, 1838, 2229, 1832,
+    2233, 1827, 2238, 1821, 2242, 1815, 2247, 1810, 2252, 1805, 2256, 1799, 2261, 1794, 2265, 1788,
+    2271, 1783, 2273, 1779, 2280, 1772, 2283, 1766, 2289, 1762, 2292, 1756, 2298, 1750, 2300, 1745,
+    2307, 1739, 2310, 1734, 2316, 1729, 2319, 1723, 2324, 1717, 2328, 1712, 2334, 1706, 2336, 1702,
+    2341, 1694, 2347, 1690, 2350, 1684, 2354, 1679, 2359, 1673, 2364, 1667, 2368, 1661, 2372, 1657,
+    2377, 1650, 2380, 1646, 2385, 1638, 2389, 1635, 2394, 1627, 2397, 1624, 2403, 1616, 2405, 1612,
+    2410, 1605, 2416, 1599, 2418, 1596, 2422, 1588, 2428, 1583, 2431, 1577, 2436, 1571, 2439, 1566,
+    2444, 1560, 2448, 1555, 2452, 1549, 2456, 1543, 2460, 1537, 2465, 1532, 2467, 1526, 2473, 1520,
+    2476, 1514, 2480, 1509, 2484, 1503, 2489, 1497, 2492, 1491, 2496, 1485, 2500, 1481, 2504, 1474,
+    2508, 1469, 2512, 1462, 2516, 1457, 2519, 1451, 2524, 1444, 2527, 1439, 2532, 1433, 2535, 1427,
+    2539, 1423, 2542, 1415, 2548, 1411, 2550, 1403, 2554, 1398, 2558, 1393, 2562, 1386, 2566, 1381,
+    2568, 1374, 2574, 1370, 2576, 1363, 2581, 1356, 2583, 1351, 2589, 1346, 2591, 1339, 2595, 1333,
+    2599, 1328, 2602, 1322, 2606, 1316, 2610, 1309, 2612, 1304, 2617, 1298, 2620, 1292, 2623, 1285,
+    2629, 1280, 2629, 1275, 2635, 1268, 2637, 1261, 2642, 1256, 2644, 1251, 2648, 1244, 2653, 1238,
+    2654, 1232, 2659, 1226, 2661, 1221, 2665, 1213, 2668, 1208, 2672, 1202, 2675, 1196, 2678, 1191,
+    2683, 1184, 2684, 1177, 2689, 1172, 2691, 1166, 2696, 1160, 2697, 1154, 2702, 1148, 2703, 1141,
+    2709, 1136, 2710, 1129, 2716, 1124, 2716, 1118, 2720, 1110, 2724, 1105, 2726, 1102, 2729, 1092,
+    2734, 1088, 2736, 1080, 2739, 1075, 2741, 1069, 2745, 1063, 2748, 1056, 2751, 1050, 2754, 1044,
+    2757, 1038, 2761, 1032, 2762, 1027, 2766, 1019, 2769, 1014, 2771, 1007, 2774, 1001, 2778, 995,
+    2780, 990, 2783, 982, 2786, 977, 2789, 970, 2791, 965, 2795, 958, 2797, 952, 2800, 946,
+    2802, 939, 2805, 934, 2808, 927, 2812, 922, 2812, 914, 2817, 909, 2819, 903, 2821, 897,
+    2824, 889, 2827, 885, 2829, 877, 2832, 872, 2835, 865, 2836, 860, 2839, 852, 2842, 847,
+    2844, 841, 2847, 834, 2850, 828, 2851, 822, 2855, 816, 2857, 808, 2858, 804, 2862, 797,
+    2863, 790, 2868, 784, 2868, 779, 2870, 772, 2874, 765, 2876, 759, 2877, 754, 2881, 746,
+    2882, 741, 2884, 735, 2887, 728, 2888, 721, 2892, 715, 2893, 710, 2896, 705, 2898, 696,
+    2899, 690, 2902, 684, 2904, 678, 2906, 672, 2909, 665, 2909, 659, 2913, 652, 2913, 647,
+    2917, 640, 2919, 634, 2919, 627, 2923, 621, 2924, 615, 2926, 609, 2929, 602, 2929, 596,
+    2931, 589, 2935, 584, 2934, 576, 2938, 571, 2939, 565, 2941, 558, 2942, 551, 2946, 546,
+    2945, 539, 2947, 532, 2951, 527, 2951, 520, 2952, 513, 2955, 508, 2957, 501, 2958, 495,
+    2959, 488, 2961, 482, 2963, 475, 2964, 470, 2966, 462, 2967, 458, 2969, 450, 2971, 444,
+    2971, 437, 2974, 431, 2974, 425, 2977, 418, 2976, 412, 2980, 406, 2980, 400, 2983, 393,
+    2982, 387, 2985, 380, 2985, 374, 2987, 367, 2989, 361, 2989, 355, 2992, 348, 2992, 343,
+    2993, 335, 2994, 330, 2995, 323, 2998, 316, 2997, 311, 2999, 303, 3000, 299, 3002, 291,
+    3002, 285, 3004, 278, 3004, 272, 3005, 266, 3007, 259, 3007, 253, 3009, 246, 3008, 240,
+    3012, 234, 3010, 227, 3013, 221, 3012, 214, 3015, 208, 3015, 202, 3015, 195, 3015, 189,
+    3019, 182, 3017, 176, 3019, 170, 3019, 163, 3020, 157, 3021, 151, 3023, 143, 3021, 138,
+    3025, 132, 3022, 125, 3026, 118, 3024, 112, 3024, 106, 3027, 98, 3027, 93, 3028, 87,
+    3025, 80, 3030, 73, 3028, 68, 3029, 61, 3030, 54, 3029, 48, 3031, 41, 3030, 35,
+    3031, 29, 3032, 22, 3032, 16, 3031, 9, 3032, 4, 3033, -4, 3034, -9, 3033, -17,
+    3032, -21, 3034, -30, 3034, -36, 3034, -41, 3033, -48, 3035, -56, 3034, -61, 3034, -67,
+    3035, -74, 3035, -80, 3034, -87, 3034, -93, 3034, -99, 3035, -107, 3035, -110, 3033, -120,
+    3035, -126, 3034, -131, 3034, -138, 3034, -144, 3034, -151, 3033, -158, 3033, -163, 3035, -171,
+    3032, -176, 3033, -184, 3033, -189, 3032, -196, 3032, -203, 3031, -208, 3032, -215, 3031, -222,
+    3030, -229, 3030, -234, 3029, -240, 3030, -249, 3029, -253, 3027, -259, 3029, -267, 3028, -274,
+    3026, -279, 3026, -286, 3025, -292, 3026, -299, 3024, -305, 3024, -312, 3024, -318, 3021, -324,
+    3022, -331, 3021, -337, 3020, -344, 3021, -350, 3018, -356, 3018, -363, 3017, -370, 3017, -376,
+    3015, -382, 3016, -388, 3013, -395, 3012, -402, 3012, -408, 3012, -415, 3009, -420, 3010, -427,
+    3007, -434, 3008, -440, 3006, -446, 3005, -453, 3004, -459, 3002, -466, 3001, -472, 3002, -479,
+    2998, -485, 2999, -491, 2998, -498, 2994, -504, 2995, -511, 2993, -518, 2992, -521, 2991, -530,
+    2990, -536, 2988, -543, 2986, -549, 2985, -556, 2984, -562, 2982, -568, 2981, -575, 2980, -581,
+    2977, -588, 2977, -594, 2975, -600, 2974, -608, 2971, -613, 2970, -619, 2968, -626, 2968, -633,
+    2966, -639, 2963, -646, 2962, -651, 2960, -658, 2959, -665, 2956, -671, 2955, -677, 2954, -684,
+    2951, -690, 2949, -697, 2949, -703, 2945, -710, 2943, -715, 2943, -722, 2939, -730, 2939, -735,
+    2936, -741, 2934, -748, 2932, -755, 2931, -760, 2927, -767, 2926, -774, 2924, -780, 2922, -786,
+    2918, -793, 2919, -799, 2914, -805, 2913, -812, 2910, -818, 2910, -825, 2905, -831, 2904, -838,
+    2902, -843, 2898, -851, 2897, -856, 2895, -863, 2892, -870, 2890, -876, 2886, -882, 2885, -889,
+    2883, -895, 2879, -901, 2877, -908, 2875, -914, 2871, -921, 2870, -927, 2866, -931, 2865, -940,
+    2861, -946, 2858, -953, 2857, -958, 2852, -966, 2851, -971, 2847, -978, 2845, -985, 2842, -990,
+    2840, -998, 2836, -1003, 2833, -1010, 2830, -1016, 2829, -1023, 2824, -1029, 2821, -1036, 2819, -1041,
+    2816, -1048, 2813, -1054, 2809, -1061, 2807, -1067, 2803, -1074, 2800, -1080, 2797, -1086, 2793, -1093,
+    2792, -1099, 2787, -1106, 2785, -1111, 2780, -1119, 2778, -1124, 2775, -1131, 2770, -1138, 2768, -1143,
+    2764, -1150, 2762, -1156, 2756, -1163, 2754, -1168, 2752, -1176, 2747, -1182, 2743, -1188, 2740, -1194,
+    2737, -1201, 2733, -1208, 2730, -1213, 2725, -1219, 2722, -1227, 2718, -1232, 2715, -1239, 2711, -1246,
+    2708, -1251, 2703, -1257, 2700, -1265, 2696, -1270, 2692, -1277, 2687, -1283, 2685, -1290, 2681, -1296,
+    2676, -1302, 2673, -1308, 2668, -1316, 2666, -1321, 2660, -1327, 2657, -1334, 2654, -1339, 2648, -1347,
+    2645, -1352, 2639, -1359, 2637, -1366, 2630, -1372, 2629, -1378, 2623, -1384, 2619, -1391, 2616, -1398,
+    2610, -1402, 2607, -1410, 2601, -1416, 2598, -1422, 2594, -1429, 2589, -1435, 2585, -1442, 2580, -1447,
+    2575, -1453, 2571, -1460, 2566, -1467, 2562, -1473, 2558, -1479, 2553, -1485, 2548, -1492, 2544, -1497,
+    2539, -1504, 2534, -1511, 2529, -1516, 2525, -1523, 2520, -1529, 2515, -1536, 2511, -1542, 2506, -1548,
+    2500, -1554, 2496, -1561, 2491, -1567, 2486, -1573, 2481, -1580, 2476, -1585, 2471, -1592, 2466, -1599,
+    2462, -1604, 2455, -1610, 2452, -1617, 2445, -1624, 2441, -1629, 2436, -1636, 2430, -1642, 2425, -1649,
+    2420, -1654, 2414, -1661, 2409, -1667, 2405, -1673, 2397, -1679, 2394, -1686, 2388, -1692, 2383, -1698,
+    2377, -1705, 2372, -1710, 2365, -1717, 2362, -1723, 2355, -1730, 2349, -1735, 2345, -1740, 2339, -1748,
+    2333, -1754, 2326, -1760, 2322, -1767, 2317, -1773, 2309, -1780, 2305, -1784, 2297, -1791, 2294, -1798,
+    2287, -1804, 2281, -1810, 2275, -1816, 2269, -1822, 2264, -1828, 2258, -1835, 2251, -1841, 2245, -1847,
+    2240, -1853, 2234, -1860, 2227, -1865, 2221, -1872, 2215, -1878, 2210, -1884, 2202, -1890, 2198, -1896,
+    2190, -1902, 2185, -1909, 2179, -1915, 2171, -1921, 2165, -1927, 2159, -1933, 2154, -1939, 2146, -1946,
+    2139, -1951, 2135, -1958, 2127, -1963, 2120, -1970, 2114, -1976, 2108, -1982, 2101, -1988, 2095, -1995,
+    2087, -2000, 2082, -2006, 2074, -2012, 2067, -2019, 2061, -2025, 2056, -2031, 2046, -2037, 2041, -2042,
+    2034, -2049, 2029, -2056, 2020, -2061, 2014, -2067, 2006, -2074, 2000, -2079, 1993, -2085, 1986, -2092,
+    1979, -2097, 1971, -2103, 1965, -2109, 1959, -2117, 1950, -2121, 1944, -2128, 1939, -2132, 1928, -2139,
+    1923, -2145, 1916, -2153, 1907, -2157, 1899, -2164, 1895, -2169, 1885, -2176, 1878, -2182, 1871, -2188,
+    1864, -2193, 1857, -2199, 1848, -2206, 1842, -2211, 1834, -2218, 1826, -2223, 1819, -2229, 1812, -2236,
+    1804, -2241, 1795, -2247, 1790, -2253, 1780, -2259, 1774, -2265, 1765, -2271, 1758, -2277, 1751, -2282,
+    1742, -2289, 1734, -2295, 1727, -2300, 1719, -2306, 1711, -2312, 1703, -2318, 1695, -2324, 1687, -2330,
+    1680, -2335, 1670, -2342, 1664, -2347, 1654, -2353, 1648, -2359, 1640, -2365, 1631, -2370, 1623, -2377,
+    1614, -2383, 1607, -2387, 1598, -2394, 1590, -2400, 1581, -2405, 1574, -2411, 1566, -2418, 1556, -2422,
+    1549, -2429, 1540, -2434, 1532, -2440, 1523, -2446, 1514, -2451, 1507, -2458, 1498, -2463, 1489, -2469,
+    1481, -2475, 1472, -2479, 1464, -2486, 1455, -2491, 1446, -2497, 1439, -2503, 1430, -2508, 1421, -2514,
+    1411, -2520, 1403, -2525, 1394, -2531, 1385, -2537, 1377, -2543, 1368, -2547, 1359, -2554, 1349, -2559,
+    1341, -2564, 1332, -2571, 1323, -2576, 1314, -2581, 1306, -2587, 1296, -2593, 1287, -2598, 1278, -2604,
+    1268, -2609, 1261, -2615, 1250, -2621, 1240, -2626, 1234, -2631, 1222, -2637, 1214, -2642, 1204, -2648,
+    1196, -2654, 1186, -2658, 1178, -2663, 1167, -2670, 1157, -2675, 1149, -2681, 1139, -2686, 1130, -2692,
+    1121, -2696, 1110, -2702, 1101, -2708, 1092, -2712, 1083, -2719, 1073, -2723, 1063, -2729, 1053, -2734,
+    1044, -2740, 1035, -2744, 1024, -2750, 1014, -2756, 1006, -2760, 995, -2766, 986, -2772, 976, -2777,
+    966, -2781, 956, -2787, 947, -2793, 937, -2796, 927, -2803, 917, -2809, 907, -2813, 896, -2818,
+    888, -2823, 876, -2828, 868, -2834, 857, -2838, 847, -2845, 837, -2848, 829, -2853, 816, -2859,
+    807, -2865, 796, -2869, 787, -2874, 776, -2879, 766, -2885, 755, -2888, 747, -2895, 734, -2899,
+    725, -2905, 715, -2909, 705, -2914, 693, -2919, 685, -2923, 673, -2930, 664, -2933, 651, -2939,
+    642, -2944, 633, -2948, 621, -2953, 611, -2958, 600, -2963, 589, -2967, 580, -2972, 569, -2977,
+    558, -2983, 547, -2987, 537, -2991, 527, -2996, 515, -3001, 505, -3005, 494, -3010, 485, -3015,
+    473, -3020, 462, -3023, 452, -3029, 440, -3033, 430, -3038, 420, -3043, 409, -3047, 396, -3051,
+    388, -3057, 376, -3059, 364, -3066, 355, -3070, 343, -3073, 333, -3079, 321, -3083, 311, -3087,
+    299, -3091, 288, -3097, 278, -3099, 266, -3106, 256, -3108, 246, -3114, 232, -3118, 223, -3122,
+    211, -3126, 200, -3130, 190, -3136, 178, -3138, 167, -3143, 156, -3148, 145, -3150, 135, -3156,
+    122, -3159, 111, -3164, 100, -3168, 89, -3172, 76, -3176, 68, -3179, 55, -3185, 43, -3187,
+    32, -3193, 22, -3196, 10, -3199, -1, -3204, -14, -3209, -24, -3210, -36, -3216, -46, -3219,
+    -58, -3223, -69, -3227, -83, -3231, -91, -3235, -104, -3238, -114, -3241, -128, -3246, -137, -3250,
+    -151, -3252, -160, -3256, -172, -3261, -184, -3264, -196, -3267, -206, -3270, -219, -3275, -230, -3277,
+    -241, -3282, -252, -3285, -265, -3288, -276, -3292, -287, -3295, -299, -3298, -311, -3303, -322, -3305,
+    -334, -3308, -345, -3312, -358, -3315, -368, -3318, -380, -3322, -393, -3325, -402, -3327, -415, -3331,
+    -427, -3334, -438, -3337, -449, -3340, -462, -3344, -474, -3347, -485, -3348, -496, -3353, -508, -3355,
+    -520, -3359, -530, -3360, -544, -3365, -554, -3367, -567, -3369, -578, -3372, -587, -3375, -602, -3379,
+    -614, -3380, -623, -3384, -638, -3386, -648, -3389, -660, -3391, -672, -3395, -682, -3396, -695, -3399,
+    -707, -3402, -718, -3404, -730, -3406, -743, -3410, -753, -3411, -765, -3413, -777, -3416, -789, -3419,
+    -800, -3421, -811, -3423, -824, -3425, -836, -3428, -847, -3430, -858, -3431, -872, -3435, -882, -3435,
+    -894, -3439, -905, -3440, -917, -3443, -929, -3443, -941, -3446, -951, -3449, -965, -3450, -975, -3451,
+    -987, -3455, -999, -3455, -1011, -3457, -1021, -3459, -1035, -3461, -1045, -3463, -1057, -3463, -1069, -3466,
+    -1080, -3467, -1092, -3469, -1104, -3471, -1115, -3472, -1127, -3474, -1138, -3474, -1151, -3477, -1161, -3478,
+    -1173, -3478, -1185, -3480, -1196, -3483, -1208, -3482, -1219, -3485, -1232, -3485, -1241, -3486, -1255, -3488,
+    -1266, -3488, -1276, -3490, -1288, -3491, -1300, -3491, -1312, -3492, -1322, -3494, -1333, -3496, -1346, -3495,
+    -1357, -3496, -1369, -3497, -1380, -3498, -1391, -3498, -1402, -3499, -1415, -3500, -1425, -3500, -1438, -3501,
+    -1448, -3501, -1460, -3502, -1470, -3503, -1482, -3503, -1493, -3503, -1505, -3505, -1516, -3503, -1527, -3505,
+    -1538, -3504, -1551, -3505, -1559, -3505, -1574, -3506, -1583, -3505, -1594, -3505, -1606, -3506, -1617, -3505,
+    -1627, -3506, -1638, -3505, -1651, -3505, -1660, -3506, -1672, -3505, -1683, -3505, -1694, -3504, -1705, -3505,
+    -1716, -3504, -1727, -3504, -1738, -3502, -1749, -3504, -1759, -3502, -1771, -3502, -1781, -3501, -1793, -3501,
+    -1803, -3500, -1814, -3499, -1824, -3499, -1836, -3499, -1845, -3496, -1859, -3496, -1867, -3496, -1878, -3495,
+    -1888, -3494, -1901, -3493, -1910, -3491, -1920, -3492, -1932, -3489, -1941, -3489, -1953, -3487, -1963, -3487,
+    -1973, -3485, -1984, -3483, -1994, -3482, -2006, -3481, -2014, -3480, -2027, -3479, -2034, -3476, -2045, -3475,
+    -2057, -3474, -2067, -3472, -2076, -3470, -2088, -3470, -2096, -3466, -2109, -3466, -2117, -3463, -2128, -3461,
+    -2139, -3460, -2147, -3458, -2158, -3455, -2169, -3454, -2177, -3452, -2188, -3450, -2198, -3447, -2209, -3446,
+    -2216, -3442, -2229, -3442, -2237, -3438, -2247, -3436, -2256, -3434, -2268, -3431, -2275, -3429, -2287, -3427,
+    -2295, -3424, -2305, -3421, -2315, -3419, -2325, -3416, -2333, -3413, -2344, -3410, -2353, -3408, -2362, -3405,
+    -2372, -3402, -2381, -3399, -2392, -3396, -2399, -3394, -2409, -3389, -2418, -3388, -2428, -3383, -2437, -3381,
+    -2446, -3377, -2454, -3374, -2465, -3370, -2474, -3369, -2481, -3363, -2492, -3361, -2500, -3357, -2509, -3354,
+    -2518, -3350, -2527, -3347, -2535, -3342, -2545, -3339, -2553, -3335, -2562, -3333, -2570, -3327, -2580, -3324,
+    -2588, -3319, -2597, -3317, -2604, -3312, -2613, -3308, -2623, -3304, -2631, -3300, -2637, -3296, -2648, -3291,
+    -2656, -3287, -2663, -3283, -2672, -3279, -2681, -3274, -2688, -3270, -2697, -3265, -2705, -3260, -2713, -3257,
+    -2720, -3251, -2731, -3247, -2736, -3242, -2746, -3238, -2752, -3232, -2761, -3228, -2768, -3223, -2777, -3218,
+    -2784, -3214, -2792, -3208, -2799, -3203, -2807, -3198, -2815, -3193, -2822, -3188, -2830, -3183, -2837, -3177,
+    -2844, -3172, -2853, -3167, -2859, -3162, -2867, -3156, -2874, -3150, -2882, -3145, -2888, -3139, -2895, -3135,
+    -2903, -3128, -2910, -3123, -2917, -3117, -2925, -3111, -2929, -3104, -2939, -3101, -2944, -3094, -2952, -3087,
+    -2958, -3082, -2966, -3076, -2970, -3070, -2980, -3064, -2985, -3056, -2991, -3052, -2998, -3045, -3006, -3039,
+    -3010, -3033, -3019, -3026, -3024, -3020, -3029, -3014, -3037, -3006, -3044, -3001, -3049, -2994, -3055, -2987,
+    -3061, -2980, -3069, -2975, -3074, -2967, -3079, -2961, -3086, -2953, -3092, -2948, -3096, -2941, -3103, -2934,
+    -3109, -2926, -3116, -2919, -3120, -2912, -3127, -2906, -3131, -2898, -3138, -2891, -3143, -2883, -3149, -2877,
+    -3155, -2869, -3160, -2862, -3164, -2854, -3171, -2848, -3175, -2839, -3181, -2833, -3186, -2824, -3192, -2818,
+    -3196, -2809, -3202, -2803, -3206, -2794, -3212, -2787, -3216, -2778, -3222, -2772, -3225, -2763, -3232, -2756,
+    -3236, -2747, -3240, -2740, -3247, -2732, -3249, -2723, -3254, -2716, -3260, -2707, -3263, -2700, -3269, -2692,
+    -3272, -2683, -3277, -2675, -3282, -2666, -3286, -2659, -3289, -2650, -3295, -2642, -3298, -2633, -3303, -2625,
+    -3305, -2617, -3312, -2608, -3314, -2599, -3319, -2591, -3323, -2582, -3327, -2574, -3329, -2564, -3335, -2557,
+    -3337, -2547, -3341, -2540, -3345, -2529, -3350, -2521, -3352, -2512, -3356, -2503, -3360, -2494, -3363, -2486,
+    -3366, -2476, -3369, -2468, -3374, -2457, -3376, -2450, -3379, -2439, -3383, -2431, -3385, -2423, -3389, -2413,
+    -3392, -2402, -3396, -2394, -3397, -2384, -3402, -2376, -3403, -2364, -3407, -2357, -3410, -2346, -3413, -2338,
+    -3414, -2327, -3418, -2319, -3420, -2308, -3424, -2299, -3425, -2289, -3429, -2280, -3429, -2270, -3434, -2260,
+    -3435, -2251, -3438, -2240, -3440, -2231, -3442, -2221, -3444, -2211, -3448, -2202, -3448, -2191, -3451, -2181,
+    -3452, -2171, -3456, -2162, -3457, -2151, -3460, -2142, -3461, -2131, -3463, -2121, -3464, -2111, -3467, -2101,
+    -3468, -2091, -3470, -2080, -3471, -2070, -3473, -2060, -3475, -2050, -3476, -2039, -3478, -2029, -3479, -2019,
+    -3480, -2008, -3482, -1999, -3483, -1986, -3485, -1978, -3486, -1966, -3487, -1956, -3488, -1946, -3490, -1935,
+    -3489, -1924, -3492, -1914, -3492, -1902, -3495, -1894, -3493, -1882, -3495, -1871, -3497, -1860, -3497, -1850,
+    -3498, -1839, -3498, -1828, -3500, -1818, -3499, -1806, -3502, -1797, -3501, -1785, -3500, -1776, -3503, -1763,
+    -3503, -1753, -3502, -1741, -3504, -1731, -3504, -1720, -3504, -1708, -3505, -1698, -3505, -1687, -3505, -1676,
+    -3504, -1664, -3506, -1654, -3505, -1642, -3507, -1632, -3504, -1620, -3506, -1609, -3505, -1598, -3506, -1588,
+    -3506, -1575, -3505, -1565, -3505, -1553, -3504, -1543, -3505, -1530, -3504, -1520, -3504, -1508, -3504, -1498,
+    -3503, -1486, -3502, -1475, -3502, -1463, -3502, -1452, -3501, -1441, -3501, -1429, -3499, -1418, -3501, -1407,
+    -3498, -1395, -3498, -1384, -3496, -1372, -3498, -1361, -3494, -1350, -3496, -1338, -3493, -1327, -3494, -1316,
+    -3491, -1303, -3492, -1292, -3490, -1281, -3489, -1269, -3488, -1258, -3487, -1247, -3485, -1234, -3485, -1224,
+    -3483, -1212, -3482, -1200, -3481, -1189, -3480, -1176, -3478, -1166, -3476, -1154, -3475, -1143, -3475, -1130,
+    -3471, -1119, -3472, -1107, -3469, -1097, -3468, -1084, -3466, -1072, -3465, -1062, -3462, -1051, -3462, -1038,
+    -3460, -1026, -3458, -1014, -3456, -1003, -3454, -992, -3453, -979, -3451, -968, -3448, -956, -3447, -945,
+    -3445, -933, -3444, -921, -3440, -909, -3439, -898, -3437, -886, -3434, -875, -3433, -862, -3431, -851,
+    -3427, -840, -3427, -828, -3424, -815, -3422, -804, -3418, -793, -3418, -781, -3414, -769, -3413, -757,
+    -3409, -746, -3407, -734, -3405, -723, -3403, -710, -3400, -699, -3398, -687, -3393, -675, -3393, -665,
+    -3390, -652, -3387, -640, -3384, -629, -3382, -618, -3379, -605, -3377, -594, -3373, -581, -3370, -571,
+    -3368, -558, -3366, -548, -3361, -535, -3360, -524, -3356, -511, -3353, -501, -3350, -489, -3349, -477,
+    -3343, -465, -3342, -454, -3338, -442, -3335, -431, -3332, -418, -3329, -408, -3325, -395, -3323, -385,
+    -3320, -372, -3316, -360, -3312, -350, -3311, -338, -3305, -325, -3304, -315, -3300, -305, -3296, -291,
+    -3293, -280, -3289, -269, -3286, -257, -3283, -244, -3278, -234, -3275, -222, -3273, -212, -3270, -199,
+    -3264, -187, -3261, -177, -3258, -164, -3254, -154, -3251, -142, -3247, -130, -3242, -119, -3240, -108,
+    -3236, -96, -3232, -85, -3228, -73, -3224, -63, -3221, -50, -3216, -40, -3213, -27, -3208, -17,
+    -3206, -5, -3201, 6, -3197, 17, -3194, 29, -3189, 40, -3186, 51, -3181, 62, -3178, 74,
+    -3173, 86, -3169, 95, -3166, 108, -3160, 118, -3157, 130, -3153, 141, -3148, 152, -3145, 164,
+    -3140, 173, -3137, 186, -3131, 197, -3128, 207, -3124, 219, -3119, 229, -3114, 241, -3112, 252,
+    -3105, 263, -3102, 274, -3097, 285, -3095, 295, -3088, 307, -3084, 318, -3079, 328, -3076, 341,
+    -3071, 350, -3067, 361, -3062, 373, -3058, 382, -3053, 394, -3048, 406, -3045, 414, -3039, 425,
+    -3034, 438, -3032, 448, -3025, 458, -3021, 470, -3016, 480, -3013, 490, -3006, 502, -3003, 512,
+    -2997, 523, -2994, 533, -2988, 544, -2983, 555, -2978, 565, -2975, 575, -2968, 587, -2965, 596,
+    -2959, 608, -2956, 617, -2950, 628, -2944, 640, -2940, 649, -2937, 659, -2929, 670, -2927, 680,
+    -2920, 691, -2916, 700, -2911, 712, -2906, 721, -2901, 732, -2896, 742, -2890, 753, -2887, 763,
+    -2881, 772, -2875, 783, -2871, 793, -2866, 804, -2861, 812, -2856, 825, -2850, 833, -2845, 843,
+    -2841, 854, -2835, 863, -2830, 874, -2826, 884, -2819, 894, -2814, 903, -2811, 914, -2804, 923,
+    -2799, 934, -2795, 943, -2788, 953, -2784, 963, -2778, 972, -2772, 983, -2769, 992, -2762, 1002,
+    -2758, 1011, -2752, 1021, -2746, 1031, -2741, 1041, -2736, 1050, -2731, 1061, -2726, 1067, -2721, 1079,
+    -2714, 1089, -2709, 1099, -2704, 1107, -2699, 1117, -2693, 1126, -2688, 1136, -2681, 1146, -2678, 1155,
+    -2671, 1164, -2666, 1174, -2661, 1182, -2655, 1193, -2649, 1201, -2646, 1210, -2637, 1221, -2634, 1228,
+    -2627, 1239, -2623, 1248, -2616, 1256, -2612, 1266, -2605, 1274, -2600, 1285, -2594, 1293, -2590, 1302,
+    -2583, 1311, -2579, 1320, -2571, 1329, -2567, 1338, -2562, 1346, -2555, 1357, -2548, 1364, -2546, 1374,
+    -2538, 1382, -2533, 1391, -2528, 1400, -2521, 1409, -2516, 1418, -2510, 1425, -2505, 1435, -2500, 1444,
+    -2492, 1452, -2489, 1461, -2481, 1469, -2477, 1477, -2471, 1487, -2464, 1495, -2459, 1504, -2453, 1512,
+    -2448, 1520, -2442, 1529, -2436, 1537, -2431, 1546, -2424, 1554, -2419, 1562, -2413, 1571, -2407, 1579,
+    -2401, 1587, -2397, 1595, -2389, 1603, -2385, 1612, -2378, 1620, -2373, 1629, -2367, 1634, -2361, 1645,
+    -2355, 1652, -2349, 1661, -2343, 1669, -2338, 1676, -2331, 1684, -2326, 1692, -2319, 1701, -2316, 1709,
+    -2307, 1716, -2302, 1723, -2297, 1732, -2290, 1739, -2284, 1748, -2279, 1755, -2273, 1762, -2268, 1772,
+    -2260, 1778, -2255, 1786, -2249, 1793, -2243, 1801, -2237, 1809, -2232, 1817, -2225, 1823, -2219, 1832,
+    -2214, 1839, -2208, 1846, -2200, 1854, -2197, 1861, -2188, 1869, -2185, 1876, -2177, 1882, -2171, 1891,
+    -2166, 1898, -2160, 1905, -2153, 1912, -2148, 1920, -2142, 1927, -2135, 1934, -2129, 1940, -2124, 1950,
+    -2117, 1954, -2113, 1963, -2105, 1969, -2100, 1977, -2092, 1983, -2088, 1991, -2081, 1997, -2075, 2005,
+    -2069, 2011, -2063, 2017, -2058, 2026, -2051, 2032, -2044, 2037, -2038, 2045, -2032, 2051, -2024, 2057,
+    -2017, 2062, -2009, 2066, -2001, 2071, -1992, 2075, -1982, 2077, -1973, 2081, -1965, 2081, -1953, 2084,
+    -1943, 2087, -1932, 2086, -1920, 2088, -1908, 2087, -1898, 2087, -1884, 2085, -1872, 2084, -1859, 2081,
+    -1846, 2080, -1831, 2075, -1819, 2071, -1803, 2068, -1790, 2062, -1774, 2058, -1760, 2051, -1744, 2045,
+    -1729, 2038, -1712, 2030, -1696, 2023, -1680, 2013, -1663, 2004, -1646, 1994, -1628, 1984, -1612, 1973,
+    -1593, 1962, -1576, 1949, -1556, 1935, -1539, 1923, -1519, 1909, -1500, 1895, -1481, 1880, -1462, 1864,
+    -1442, 1848, -1422, 1830, -1402, 1814, -1380, 1794, -1361, 1777, -1340, 1757, -1319, 1738, -1298, 1717,
+    -1277, 1696, -1256, 1677, -1235, 1657, -1215, 1635, -1194, 1615, -1175, 1593, -1155, 1573, -1133, 1552,
+    -1114, 1530, -1095, 1508, -1075, 1488, -1054, 1465, -1037, 1445, -1016, 1422, -998, 1400, -978, 1379,
+    -960, 1355, -941, 1335, -921, 1311, -903, 1290, -886, 1267, -864, 1244, -849, 1221, -830, 1199,
+    -811, 1177, -794, 1152, -775, 1131, -758, 1107, -739, 1084, -722, 1061, -703, 1037, -688, 1015,
+    -668, 990, -653, 967, -634, 944, -617, 920, -600, 897, -583, 873, -565, 848, -550, 826,
+    -531, 802, -515, 777, -498, 753, -481, 729, -465, 706, -448, 681, -432, 657, -414, 633,
+    -399, 608, -383, 585, -365, 561, -351, 538, -337, 516, -320, 494, -306, 472, -294, 450,
+    -278, 431, -265, 410, -252, 390, -241, 371, -227, 352, -216, 334, -204, 316, -192, 299,
+    -181, 282, -171, 265, -160, 250, -150, 234, -142, 219, -131, 205, -123, 190, -113, 178,
+    -105, 164, -97, 151, -90, 140, -82, 128, -75, 117, -68, 107, -63, 97, -55, 87,
+    -50, 78, -43, 69, -41, 62, -34, 54, -29, 46, -26, 41, -22, 34, -19, 28,
+    -14, 24, -12, 19, -9, 15, -7, 10, -6, 9, -3, 5, -2, 3, -2, 2,
+    0, 1, 0, 0, 0, 0,
+};
+
+static const StrokeTableSegment STROKE_CALIB_CIRCLE_SEGMENTS[1] = {
+    {0, 1},
+};
+
+const StrokeTable STROKE_TABLES[] = {
+    {"yong", 0.00100000005f, 1.52587891e-05f, 1, 8524131, 2977621, 5437, STROKE_YONG_DELTAS, STROKE_YONG_SEGMENTS, 8, 6.11542491e-05f},
+    {"shi", 0.00100000005f, 1.52587891e-05f, 1, 10088260, 3013587, 2250, STROKE_SHI_DELTAS, STROKE_SHI_SEGMENTS, 3, 6.15101453e-05f},
+    {"kou", 0.00100000005f, 1.52587891e-05f, 1, 9406291, 3219016, 3816, STROKE_KOU_DELTAS, STROKE_KOU_SEGMENTS, 5, 5.98615843e-05f},
+    {"calib_square", 0.00100000005f, 1.52587891e-05f, 1, 11498903, 2516121, 3605, STROKE_CALIB_SQUARE_DELTAS, STROKE_CALIB_SQUARE_SEGMENTS, 1, 6.26891269e-05f},
+    {"calib_circle", 0.00100000005f, 1.52587891e-05f, 1, 8736380, 1276066, 2508, STROKE_CALIB_CIRCLE_DELTAS, STROKE_CALIB_CIRCLE_SEGMENTS, 1, 5.3981672e-05f},
+};
+
+const uint32_t STROKE_TABLE_COUNT = sizeof(STROKE_TABLES) / sizeof(STROKE_TABLES[0]);
@@ -0,0 +1,293 @@
+/**
+ * @file workspace_map_table.cpp
+ * @brief [自動產生] 工作空間地圖 (可達 / 可寫 bitmap)，請勿手動修改
+ * @details 產生器: Tools/workspace_map_gen --cell 2.000 --samples 4 --min-sd 0.300
+ *   幾何 L1=100.000 L2=150.000 D=60.000 mm，範圍 X[-250.0, 310.0] Y[10.0, 250.0] mm (手肘模式 1)
+ *   280 x 120 格 (8400 bytes)，可達 18142 格、可寫 16946 格
+ */
+
+#include "workspace_map.hpp"
+#include "arm_geometry.hpp"
+
+// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)
+static_assert(dogArmGeometryMatches(100.0f, 150.0f, 60.0f),
+              "workspace_map_table.cpp was generated for another geometry: rerun Tools/workspace_map_gen");
+
+static const uint32_t WORKSPACE_REACHABLE[1050] = {
+    0x80000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F, 0x00000000, 0xFFF00000, 0xFFFFFFFF, 0x01FFFFFF,
+    0x00000000, 0xFF800000, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000, 0xFFFFF000, 0xFFFFFFFF,
+    0x0001FFFF, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000, 0xFFFFFFF8,
+    0xFFFFFFFF, 0x000001FF, 0x00000000, 0xFFFFFF80, 0xFFFFFFFF, 0x00001FFF, 0x00000000, 0xF8000000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000001, 0x80000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000,
+    0xFFF80000, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000,
+    0x00000000, 0xFFFFFC00, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0x003FFFFF,
+    0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0x000001FF, 0x00000000, 0xFFFFFF80, 0xFFFFFFFF,
+    0x00007FFF, 0x00000000, 0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000001, 0x80000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000007F, 0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0xFF800000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0x0001FFFF, 0x00000000,
+    0xFFFF0000, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0x80000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF,
+    0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000003FF, 0x00000000, 0xFFFFC000, 0xFFFFFFFF,
+    0x00FFFFFF, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007, 0x00000000, 0xFFFFFFE0,
+    0xFFFFFFFF, 0x0000FFFF, 0x00000000, 0xFFFF0000, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0xF0000000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0x003FFFFF, 0x00000000,
+    0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00007FFF,
+    0x00001800, 0xFFFFFE00, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000, 0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000001FF, 0x8000007E, 0xFFFFFFFF, 0xFFFFFFFF, 0x00007FFF, 0x00000000, 0xFFFE0000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFF800007, 0xFFE00001, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000007F, 0x00000000, 0xFFFFFE00,
+    0xFFFFFFFF, 0x3FFFFFFF, 0x0FFFF000, 0xFFFFFC00, 0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x00000000,
+    0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0x00000000,
+    0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00007FFF,
+    0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000003F, 0x00000000, 0xFFFFFC00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3FFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x003FFFFF, 0x00000000, 0xFC000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0xFFF80000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000, 0xFFFFF800, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1FFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFF8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0xF8000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001FFF, 0x00000000, 0xFFF00000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F, 0x00000000,
+    0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000,
+    0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF,
+    0x00000000, 0xE0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000007FF, 0x00000000, 0xFFE00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00000007, 0x00000000, 0xFFFFE000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x07FFFFFF, 0x00000000, 0x00000000, 0xFFFFFFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x0003FFFF, 0x00000000, 0xC0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000003FF, 0x00000000, 0xFFC00000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000003, 0x00000000, 0xFFFF8000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0x00000000, 0xFFFFFF80,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0x00000000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x00000000,
+    0xFF000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+    0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF,
+    0x00000000, 0x00000000, 0xFFFFFE00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007FFF, 0x00000000, 0x00000000, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000007F, 0x00000000, 0xFC000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x003FFFFF, 0x00000000, 0x00000000, 0xFFFFF800, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001FFF, 0x00000000, 0x00000000, 0xFFFFFFF8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000, 0xF0000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000, 0xFFF00000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x00000000,
+    0xFFFFE000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x00000000,
+    0x00000000, 0xFFFFFFE0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007,
+    0x00000000, 0xC0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x03FFFFFF,
+    0x00000000, 0x00000000, 0xFFC00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0003FFFF, 0x00000000, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000001FF, 0x00000000, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000, 0x00000000, 0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00007FFF, 0x00000000, 0x00000000, 0xFFFE0000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000007F, 0x00000000, 0x00000000, 0xFFFFFC00,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFFF8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000,
+    0xF8000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001FFF, 0x00000000,
+    0x00000000, 0xFFF00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F,
+    0x00000000, 0x00000000, 0xFFFFE000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x07FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFFFFE0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0007FFFF, 0x00000000, 0x00000000, 0xC0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000003FF, 0x00000000, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000FFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFE,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000007F, 0x00000000, 0x00000000, 0xFC000000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0xFFF80000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFF800, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001FFF, 0x00000000,
+    0x00000000, 0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F,
+    0x00000000, 0x00000000, 0xE0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x07FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0xFFC00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0003FFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFE, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0x00000000, 0x00000000, 0x00000000, 0xFC000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0x00000000, 0x00000000, 0xFFF80000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFFE0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0007FFFF, 0x00000000, 0x00000000,
+    0x00000000, 0xC0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000003FF, 0x00000000,
+    0x00000000, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000001,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFF0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFE00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007FFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0xF8000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFE00000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x0007FFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFC000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000003FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFF80, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFC000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xFFF80000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFFE000, 0xFFFFFFFF, 0xFFFFFFFF, 0x07FFFFFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0x0003FFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x7FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFF80000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFE000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFC000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xFFF00000, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFFC000, 0xFFFFFFFF, 0x03FFFFFF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0x0000FFFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFF8, 0xFFFFFFFF, 0x0000001F,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xE0000000, 0xFFFFFFFF, 0x07FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFF800000, 0xFFFFFFFF,
+    0x0001FFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFC0000,
+    0xFFFFFFFF, 0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFE000, 0x07FFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFF00, 0x0000FFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xFFFFFFF0, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00FFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xE0000000, 0x000007FF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000,
+};
+
+static const uint32_t WORKSPACE_WRITABLE[1050] = {
+    0x00000000, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000, 0xFC000000, 0xFFFFFFFF, 0x00FFFFFF,
+    0x00000000, 0xFF000000, 0xFFFFFFFF, 0x003FFFFF, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFFFFFFF,
+    0x0000FFFF, 0x00000000, 0xFFFF0000, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0x00000000, 0xFFFFFC00,
+    0xFFFFFFFF, 0x000000FF, 0x00000000, 0xFFFFFF00, 0xFFFFFFFF, 0x0000003F, 0x00000000, 0x00000000,
+    0xFFFFFFFC, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x00000000,
+    0xFE000000, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0x007FFFFF, 0x00000000,
+    0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0x0000FFFF, 0x00000000, 0xFFFF0000, 0xFFFFFFFF, 0x00007FFF,
+    0x00000000, 0x00000000, 0xFFFFFE00, 0xFFFFFFFF, 0x000000FF, 0x00000000, 0xFFFFFE00, 0xFFFFFFFF,
+    0x000000FF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFE,
+    0xFFFFFFFF, 0x00000000, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0x007FFFFF, 0x00000000, 0xFE000000,
+    0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0x00007FFF, 0x00000000,
+    0xFFFE0000, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0x00000000, 0xFFFFFF80, 0xFFFFFFFF, 0x0000007F,
+    0x00000000, 0xFFFFFE00, 0xFFFFFFFF, 0x000003FF, 0x00000000, 0xC0000000, 0xFFFFFFFF, 0x7FFFFFFF,
+    0x00000000, 0x00000000, 0xFFFFFFFE, 0xFFFFFFFF, 0x00000003, 0x00000000, 0xFFC00000, 0xFFFFFFFF,
+    0x007FFFFF, 0x00000000, 0xFE000000, 0xFFFFFFFF, 0x07FFFFFF, 0x00000000, 0x00000000, 0xFFFFE000,
+    0xFFFFFFFF, 0x00007FFF, 0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x00000000,
+    0xFFFFFFF0, 0xFFFFFFFF, 0x0000003F, 0x00000000, 0xFFFFFC00, 0xFFFFFFFF, 0x00001FFF, 0x00000000,
+    0xF8000000, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0x0000001F,
+    0x00000000, 0xFFF80000, 0xFFFFFFFF, 0x003FFFFF, 0x00000000, 0xFC000000, 0xFFFFFFFF, 0x3FFFFFFF,
+    0x00000000, 0x00000000, 0xFFFFFC00, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0xFFFC0000, 0xFFFFFFFF,
+    0x007FFFFF, 0x00000000, 0x00000000, 0xFFFFFFFE, 0xFFFFFFFF, 0x0000003F, 0x00000000, 0xFFFFFC00,
+    0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000,
+    0xFFFFFFF8, 0xFFFFFFFF, 0x000003FF, 0x00000000, 0xFFFFC000, 0xFFFFFFFF, 0x001FFFFF, 0x00000000,
+    0xF8000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007, 0x00000000, 0xFFFFFFE0, 0xFFFFFFFF, 0x00001FFF,
+    0x00000000, 0xFFF80000, 0xFFFFFFFF, 0x1FFFFFFF, 0x00000000, 0xF8000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000001F, 0x00000000, 0xFFFFF800, 0xFFFFFFFF, 0x007FFFFF, 0x00180000, 0xFFFE0000, 0xFFFFFFFF,
+    0x1FFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0x0001FFFF, 0x00007E00, 0xFFFFFF80,
+    0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0xF0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0000FFF, 0xF00003FF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0x00000000, 0xFFF00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFE01FF,
+    0xFFFF807F, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000000F, 0x00000000, 0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFE0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0007FFFF, 0x00000000, 0xE0000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x00000000, 0xFFE00000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007, 0x00000000,
+    0xFFFFC000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x03FFFFFF, 0x00000000,
+    0x00000000, 0xFFFFFFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0003FFFF,
+    0x00000000, 0xC0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000003FF, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00000001, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x01FFFFFF, 0x00000000, 0x00000000, 0xFFFFFF80, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFF0000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00FFFFFF, 0x00000000, 0x00000000, 0xFFFFFE00,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00007FFF, 0x00000000, 0x00000000,
+    0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000007F, 0x00000000,
+    0xFC000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3FFFFFFF, 0x00000000,
+    0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x003FFFFF,
+    0x00000000, 0x00000000, 0xFFFFFC00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00003FFF, 0x00000000, 0x00000000, 0xFFFFFFF8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000001F, 0x00000000, 0xF8000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1FFFFFFF, 0x00000000, 0x00000000, 0xFFF00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x00000000, 0xFFFFF000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0x00000000, 0x00000000, 0xFFFFFFE0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007, 0x00000000, 0xE0000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x07FFFFFF, 0x00000000, 0x00000000, 0xFFC00000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0003FFFF, 0x00000000, 0x00000000,
+    0xFFFFC000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000003FF, 0x00000000,
+    0x00000000, 0xFFFFFF80, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000001,
+    0x00000000, 0x80000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF,
+    0x00000000, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000FFFF, 0x00000000, 0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000007F, 0x00000000, 0x00000000, 0xFFFFFE00, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x003FFFFF, 0x00000000, 0x00000000, 0xFC000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0x00000000, 0xFFF80000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000, 0x00000000, 0xFFFFF000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x00000000,
+    0xE0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x00000000,
+    0x00000000, 0xFFC00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000003,
+    0x00000000, 0x00000000, 0xFFFFC000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x03FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFFFF80, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0001FFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000000FF, 0x00000000, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x007FFFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFC00, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00003FFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFF8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000001F, 0x00000000, 0x00000000, 0xF0000000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0FFFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0xFFF00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000FFFFF, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFE000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x00000000,
+    0x00000000, 0x00000000, 0xFFFFFFC0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000003,
+    0x00000000, 0x00000000, 0x80000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0xFF000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000FFFF, 0x00000000, 0x00000000, 0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000007F, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFC00, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFF8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000, 0x00000000, 0xF0000000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0x00000000, 0x00000000, 0x00000000, 0xFFE00000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000007, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFC000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x03FFFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFF80, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x00000000,
+    0x00000000, 0x00000000, 0xFE000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFC0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x003FFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFF800, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00001FFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFF0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000000F, 0x00000000, 0x00000000, 0x00000000, 0xC0000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x03FFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFF800000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x0001FFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFF0000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFE00, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFFF8, 0xFFFFFFFF, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xF0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000FFF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xFFC00000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000003, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFF8000, 0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFE00, 0xFFFFFFFF, 0xFFFFFFFF, 0x00007FFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000003F, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xF0000000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFC00000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0003FFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFF8000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x000001FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFFFE00, 0xFFFFFFFF, 0x7FFFFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFFFF8, 0xFFFFFFFF, 0x001FFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xE0000000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000007FF, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0xFF800000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000001, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0xFFFE0000, 0xFFFFFFFF, 0x007FFFFF, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFF000, 0xFFFFFFFF, 0x00000FFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFC0, 0xFFFFFFFF, 0x00000003,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFE, 0x007FFFFF,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xF0000000, 0xFFFFFFFF,
+    0x00000FFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xFF800000,
+    0xFFFFFFFF, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFC0000, 0x003FFFFF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xFFFFC000, 0x000003FF, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x3FFFFC00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000FF00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000,
+};
+
+const WorkspaceMapTable WORKSPACE_MAP_DOGARM = {
+    -250.0f, 10.0f,   // x_min, y_min
+    2.0f, 0.5f,   // cell, inv_cell
+    280, 120,   // nx, ny
+    0.300000012f,   // min_singularity
+    WORKSPACE_REACHABLE,
+    WORKSPACE_WRITABLE,
+};
@@ -0,0 +1,161 @@
+/**
+ * @file collision_check_bench.cpp
+ * @brief [Host 工具] 碰撞檢查 (CollisionChecker) 的書寫區驗證、速度與碰撞地圖
+ * @details
+ *  以韌體相同的 DogArmKinematics 與 DogArmCollisionSpec：
+ *    1. 書寫區 (DogArmWritingArea) 以 --step 取樣，IK (mode 1) -> solveFKLinkage -> check，
+ *       任何一點碰撞即回傳 1 (代表 DogArmCollisionSpec 或書寫區設定互相矛盾)；同時輸出最小 clearance
+ *    2. 單次 check() 與 clearance() 的時間 (ns)
+ *    3. firstCollision() 批次檢查一條由書寫區往底座掃描的關節軌跡 (ns / 點，第一個碰撞點)
+ *    4. 可達區域的 ASCII 碰撞地圖 (每格 --map-step mm)：
+ *         '.' 不可達   'o' 無碰撞   'w' 書寫區內無碰撞
+ *         'L' 連桿互撞 'F' 摺疊     'B' 底座     'H' 壓紙條 (多個旗標時取最低位)
+ *  注意：Host 的絕對時間只能當作參考，實機請以 DWT->CYCCNT 量測
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc collision_check_bench.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/collision_checker.cpp -o collision_check_bench
+ * 使用:
+ *   ./collision_check_bench [--step 1.0] [--map-step 10] [--no-map]
+ */
+
+#include "arm_geometry.hpp"
+#include "collision_checker.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+struct Options {
+    float step = 1.0f;       // 書寫區取樣間距 (mm)
+    float map_step = 10.0f;  // 地圖格子 (mm)
+    bool map = true;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--no-map")) { opt->map = false; continue; }
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--step")) opt->step = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--map-step")) opt->map_step = (float)atof(argv[++i]);
+        else return false;
+    }
+    return opt->step > 0.0f && opt->map_step > 0.0f;
+}
+
+// 目標點 -> 構型 (mode 1，與 Robot_SetTargetPosition 的預設手肘方向相同)
+static bool poseAt(const DogArmKinematics& kin, float x, float y, LinkagePose* pose, MotorAngles* q = nullptr) {
+    MotorAngles s = kin.solveIK({x, y}, 1);
+    if (!s.is_reachable) return false;
+    if (q) *q = s;
+    return kin.solveFKLinkage(s.theta1, s.theta2, pose);
+}
+
+static char flagChar(uint32_t f) {
+    if (f & COLLISION_LINK_LINK) return 'L';
+    if (f & COLLISION_FOLD) return 'F';
+    if (f & COLLISION_BASE) return 'B';
+    if (f & COLLISION_PAPER_HOLDER) return 'H';
+    return 'X';
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--step mm] [--map-step mm] [--no-map]\n", argv[0]);
+        return 1;
+    }
+
+    DogArmKinematics kin;
+    CollisionChecker checker(CollisionChecker::fromSpec<DogArmCollisionSpec>(DogArmGeometry::value));
+
+    // 1. 書寫區驗證
+    std::vector<LinkagePose> poses;
+    int failures = 0;
+    float min_clear = 1e9f;
+    Point2D min_at = {0.0f, 0.0f};
+    for (float y = DogArmWritingArea::Y_MIN; y <= DogArmWritingArea::Y_MAX + 1e-3f; y += opt.step) {
+        for (float x = DogArmWritingArea::X_MIN; x <= DogArmWritingArea::X_MAX + 1e-3f; x += opt.step) {
+            LinkagePose pose;
+            uint32_t f = poseAt(kin, x, y, &pose) ? checker.check(pose) : (uint32_t)COLLISION_INVALID;
+            if (f) {
+                if (failures < 10) printf("  collision at (%.1f, %.1f): flags 0x%02x\n", x, y, (unsigned)f);
+                failures++;
+                continue;
+            }
+            poses.push_back(pose);
+            float c = checker.clearance(pose);
+            if (c < min_clear) {
+                min_clear = c;
+                min_at = {x, y};
+            }
+        }
+    }
+    printf("writing area: %zu samples, %d collisions, min clearance %.2f mm at (%.1f, %.1f)\n",
+           poses.size() + failures, failures, min_clear, min_at.x, min_at.y);
+
+    // 2. 單次成本
+    uint32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (const LinkagePose& p : poses) sink += checker.check(p);
+    auto t1 = std::chrono::steady_clock::now();
+    double ns_check = std::chrono::duration<double, std::nano>(t1 - t0).count() / poses.size();
+    float csink = 0.0f;
+    t0 = std::chrono::steady_clock::now();
+    for (const LinkagePose& p : poses) csink += checker.clearance(p);
+    t1 = std::chrono::steady_clock::now();
+    double ns_clear = std::chrono::duration<double, std::nano>(t1 - t0).count() / poses.size();
+    printf("check     : %7.1f ns\nclearance : %7.1f ns\n", ns_check, ns_clear);
+
+    // 3. 批次：由書寫區上緣往下沿 X 來回掃描的關節軌跡 (最後會摺疊 / 碰到底座)
+    std::vector<float> th1, th2;
+    std::vector<Point2D> targets;
+    bool forward = true;
+    for (float y = DogArmWritingArea::Y_MAX; y >= 0.0f; y -= 5.0f) {
+        for (int i = 0; i <= 260; ++i) {
+            float x = forward ? -100.0f + (float)i : 160.0f - (float)i;
+            MotorAngles q;
+            LinkagePose pose;
+            if (!poseAt(kin, x, y, &pose, &q)) continue;
+            th1.push_back(q.theta1);
+            th2.push_back(q.theta2);
+            targets.push_back({x, y});
+        }
+        forward = !forward;
+    }
+    uint32_t flags = 0;
+    t0 = std::chrono::steady_clock::now();
+    size_t hit = checker.firstCollision(kin, th1.data(), th2.data(), th1.size(), &flags);
+    t1 = std::chrono::steady_clock::now();
+    double ns_batch = std::chrono::duration<double, std::nano>(t1 - t0).count() / (hit < th1.size() ? hit + 1 : hit);
+    if (hit < th1.size())
+        printf("batch     : %7.1f ns/point, first collision at #%zu / %zu (%.0f, %.0f) flags 0x%02x\n", ns_batch,
+               hit, th1.size(), targets[hit].x, targets[hit].y, (unsigned)flags);
+    else
+        printf("batch     : %7.1f ns/point, %zu points collision-free\n", ns_batch, th1.size());
+
+    // 4. 碰撞地圖 (上方為 +Y)
+    if (opt.map) {
+        printf("\ncollision map (%.0f mm cells, X %.0f..%.0f, Y %.0f..0)\n", opt.map_step, -100.0f, 160.0f, 260.0f);
+        for (float y = 260.0f; y >= 0.0f; y -= opt.map_step) {
+            for (float x = -100.0f; x <= 160.0f; x += opt.map_step) {
+                LinkagePose pose;
+                char c = '.';
+                if (poseAt(kin, x, y, &pose)) {
+                    uint32_t f = checker.check(pose);
+                    bool in_area = x >= DogArmWritingArea::X_MIN && x <= DogArmWritingArea::X_MAX &&
+                                   y >= DogArmWritingArea::Y_MIN && y <= DogArmWritingArea::Y_MAX;
+                    c = f ? flagChar(f) : (in_area ? 'w' : 'o');
+                }
+                putchar(c);
+            }
+            printf("  %4.0f\n", y);
+        }
+    }
+
+    if (sink == 0xFFFFFFFFu || csink == 1e30f) printf("\n");  // 防止計時迴圈被最佳化掉
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,287 @@
+/**
+ * @file feedrate_override_check.cpp
+ * @brief [Host 工具] 進給率覆寫 (FeedrateOverride) 的時間縮放與前饋一致性
+ * @details
+ *  三種軌跡來源以與 Robot_Loop 相同的方式在覆寫下執行 (1ms tick)：
+ *    - path  ：CartesianMotion (整圓) -> 換算時間後的 CartesianState -> KinematicFeedforward
+ *    - pvt   ：同一條路徑 50Hz 取樣的 TrajectoryPoint -> PvtInterpolator
+ *    - table ：內建筆畫表 (stroke_table_data.cpp) -> StrokeTablePlayer 小數 tick 前進
+ *  覆寫要求依時間表變化 (100% -> 0% 暫停 -> 200% -> 50% -> 150%)，每個 tick 記錄關節設定點，檢查：
+ *    1. 前饋一致性：速度前饋與位置的中央差分、加速度前饋與速度的中央差分之最大差
+ *       (差分誤差本身隨 s 放大，以 100% / 200% 定速執行中較大者為基準，過渡期間不得超過 1.5 倍)
+ *    2. 斜坡：s 的變化率 / 變化率的變化不超過 FeedrateOverride 的上限；確實進入暫停，且暫停期間設定點靜止
+ *    3. 完整性：最後停在軌跡終點 (與 100% 執行的終點相同)
+ *  並列出 50% / 100% / 200% 定速 (從 100% 斜坡過渡) 的完成時間與最大關節加速度 (200% 約為 4 倍)。
+ *  任一項失敗時回傳 1。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc feedrate_override_check.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/scurve_generator.cpp ../Core/Src/path_interpolator.cpp ../Core/Src/stroke_table_data.cpp \
+ *       -o feedrate_override_check
+ * 使用:
+ *   ./feedrate_override_check [--speed 100] [--accel 1000]
+ */
+
+#include "arm_geometry.hpp"
+#include "cartesian_motion.hpp"
+#include "feedrate_override.hpp"
+#include "pvt_interpolator.hpp"
+#include "spsc_ring_buffer.hpp"
+#include "stroke_table.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+static const float DT = 0.001f;
+static const int PVT_EVERY = 20;          // 50Hz
+static const float PAUSE_STILL = 1e-4f;   // 暫停期間的位置變化門檻 (Deg，path 來源每 tick 重解 IK 的收斂殘差)
+static const float MAX_RUN_TIME = 60.0f;  // s
+static const float CONSISTENCY_MARGIN = 1.5f;
+
+struct Options {
+    float speed = 100.0f;
+    float accel = 1000.0f;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--speed")) opt->speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--accel")) opt->accel = (float)atof(argv[++i]);
+        else return false;
+    }
+    return opt->speed > 0.0f && opt->accel > 0.0f;
+}
+
+// 覆寫時間表：從 time 起要求 scale
+struct Request {
+    float time, scale;
+};
+
+static float requestAt(const std::vector<Request>& plan, float t) {
+    float s = 1.0f;
+    for (const Request& r : plan)
+        if (t >= r.time) s = r.scale;
+    return s;
+}
+
+struct Tick {
+    JointSetpoint j1, j2;
+    float s;
+};
+
+// 一種軌跡來源：每個 tick 以 traj_dt (軌跡時間) 前進，輸出對軌跡時間的導數；結束時回傳 false
+class Source {
+public:
+    virtual ~Source() {}
+    virtual void start() = 0;
+    virtual bool step(float traj_dt, const FeedrateOverride& f, JointSetpoint* j1, JointSetpoint* j2) = 0;
+};
+
+class PathSource : public Source {
+public:
+    PathSource(const DogArmKinematics& kin, const Options& opt) : _ik(kin), _ff(kin, _ik), _opt(opt) {
+        _path.beginArc({60.0f, 150.0f}, {30.0f, 150.0f}, 2.0f * 3.14159265f);
+    }
+    void start() override {
+        _ik.reset();
+        _motion.start(_path, _opt.speed, _opt.accel);
+        _cs = {_path.start(), {0.0f, 0.0f}, {0.0f, 0.0f}};
+        JointSetpoint w1, w2;
+        _ff.update(_cs, &w1, &w2, 1);  // 讓增量 IK 先收斂
+        _running = true;
+    }
+    bool step(float traj_dt, const FeedrateOverride& f, JointSetpoint* j1, JointSetpoint* j2) override {
+        // 與 Robot_Loop 相同：軌跡時間為 0 時不前進，換算時間後再交給運動學前饋
+        if (_running && traj_dt > 0.0f) _running = _motion.step(traj_dt, &_cs);
+        CartesianState state = _cs;
+        f.apply(&state);
+        _ff.update(state, j1, j2, 1);
+        return _running;
+    }
+
+private:
+    IncrementalIk<DogArmKinematics> _ik;
+    KinematicFeedforward<DogArmKinematics> _ff;
+    Options _opt;
+    PathInterpolator _path;
+    CartesianMotion _motion;
+    CartesianState _cs;
+    bool _running = false;
+};
+
+class PvtSource : public Source {
+public:
+    PvtSource(const DogArmKinematics& kin, const Options& opt) {
+        // 以 100% 的 path 來源產生 50Hz 的軌跡點
+        PathSource ref(kin, opt);
+        FeedrateOverride unit;
+        ref.start();
+        JointSetpoint j1 = {0.0f, 0.0f, 0.0f}, j2 = {0.0f, 0.0f, 0.0f};
+        bool moving = true;
+        for (int k = 0; moving || k % PVT_EVERY != 0; ++k) {
+            moving = ref.step(DT, unit, &j1, &j2) && moving;
+            if (k == 0) _first = {j1, j2};
+            if (k % PVT_EVERY == 0 && k > 0) _points.push_back({j1.pos, j2.pos, j1.vel, j2.vel, 0.0f, PVT_EVERY * DT});
+        }
+        _points.back().omega1 = _points.back().omega2 = 0.0f;
+    }
+    void start() override {
+        _buf.discard();
+        for (const TrajectoryPoint& p : _points) _buf.push(p);
+        _pvt.start(_first.j1, _first.j2);
+    }
+    bool step(float traj_dt, const FeedrateOverride& f, JointSetpoint* j1, JointSetpoint* j2) override {
+        if (_pvt.active()) _pvt.step(traj_dt, _buf, &_last1, &_last2);
+        *j1 = _last1;
+        *j2 = _last2;
+        f.apply(j1);
+        f.apply(j2);
+        return _pvt.active();
+    }
+
+private:
+    struct {
+        JointSetpoint j1, j2;
+    } _first;
+    std::vector<TrajectoryPoint> _points;
+    SpscRingBuffer<TrajectoryPoint, 1024> _buf;
+    PvtInterpolator _pvt;
+    JointSetpoint _last1 = {0.0f, 0.0f, 0.0f}, _last2 = {0.0f, 0.0f, 0.0f};
+};
+
+class TableSource : public Source {
+public:
+    explicit TableSource(const StrokeTable& table) : _table(table) {}
+    void start() override {
+        _player.start(_table, 0.0f, 0.0f);
+        _last1 = {_player.theta1(), 0.0f, 0.0f};
+        _last2 = {_player.theta2(), 0.0f, 0.0f};
+    }
+    bool step(float traj_dt, const FeedrateOverride& f, JointSetpoint* j1, JointSetpoint* j2) override {
+        if (_player.active()) _player.step(&_last1, &_last2, traj_dt / _table.tick_s);
+        *j1 = _last1;
+        *j2 = _last2;
+        f.apply(j1);
+        f.apply(j2);
+        return _player.active();
+    }
+
+private:
+    const StrokeTable& _table;
+    StrokeTablePlayer _player;
+    JointSetpoint _last1, _last2;
+};
+
+static std::vector<Tick> run(Source& src, const std::vector<Request>& plan) {
+    FeedrateOverride feedrate;
+    src.start();
+    std::vector<Tick> ticks;
+    for (int k = 0; k * DT < MAX_RUN_TIME; ++k) {
+        feedrate.update(requestAt(plan, k * DT), DT);
+        Tick t;
+        bool more = src.step(feedrate.trajectoryDt(DT), feedrate, &t.j1, &t.j2);
+        t.s = feedrate.scale();
+        ticks.push_back(t);
+        if (!more) break;
+    }
+    return ticks;
+}
+
+struct Metrics {
+    float vel_err = 0.0f;   // max |ω - Δθ / 2dt| (Deg/s)
+    float acc_err = 0.0f;   // max |α - Δω / 2dt| (Deg/s²)
+    float max_acc = 0.0f;   // Deg/s²
+    float max_ds = 0.0f;    // max |s'| (1/s)
+    float max_dds = 0.0f;   // max |s''| (1/s²)
+    float paused_move = 0.0f;  // 暫停 (s = 0) 期間設定點的最大位置變化 (Deg)
+    float paused_time = 0.0f;  // s = 0 的時間 (s)
+    float time = 0.0f;
+    float end1 = 0.0f, end2 = 0.0f;
+};
+
+static Metrics analyze(const std::vector<Tick>& t) {
+    Metrics m;
+    auto ds = [&](size_t k) { return (t[k + 1].s - t[k - 1].s) / (2.0f * DT); };
+    for (size_t k = 1; k + 1 < t.size(); ++k) {
+        const JointSetpoint* a[2] = {&t[k].j1, &t[k].j2};
+        const JointSetpoint* p[2] = {&t[k - 1].j1, &t[k - 1].j2};
+        const JointSetpoint* n[2] = {&t[k + 1].j1, &t[k + 1].j2};
+        for (int j = 0; j < 2; ++j) {
+            m.vel_err = std::max(m.vel_err, std::fabs(a[j]->vel - (n[j]->pos - p[j]->pos) / (2.0f * DT)));
+            m.acc_err = std::max(m.acc_err, std::fabs(a[j]->acc - (n[j]->vel - p[j]->vel) / (2.0f * DT)));
+            m.max_acc = std::max(m.max_acc, std::fabs(a[j]->acc));
+            if (t[k].s == 0.0f && t[k - 1].s == 0.0f)
+                m.paused_move = std::max(m.paused_move, std::fabs(a[j]->pos - p[j]->pos));
+        }
+        if (t[k].s == 0.0f) m.paused_time += DT;
+        m.max_ds = std::max(m.max_ds, std::fabs(ds(k)));
+        if (k >= 2 && k + 2 < t.size()) m.max_dds = std::max(m.max_dds, std::fabs(ds(k + 1) - ds(k - 1)) / (2.0f * DT));
+    }
+    m.time = t.size() * DT;
+    m.end1 = t.back().j1.pos;
+    m.end2 = t.back().j2.pos;
+    return m;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--speed mm/s] [--accel mm/s^2]\n", argv[0]);
+        return 1;
+    }
+    DogArmKinematics kin;
+    PathSource path(kin, opt);
+    PvtSource pvt(kin, opt);
+    TableSource table(STROKE_TABLES[0]);
+    struct Case {
+        const char* name;
+        Source* src;
+    } cases[] = {{"path", &path}, {"pvt", &pvt}, {"table", &table}};
+
+    const std::vector<Request> unit = {};
+    const std::vector<Request> fastest = {{0.0f, FeedrateOverride::MAX_SCALE}};
+    const std::vector<Request> plan = {{0.2f, 0.0f}, {2.0f, 2.0f}, {2.6f, 0.5f}, {3.6f, 1.5f}};
+
+    printf("override plan: 100%% -> 0%% @0.2s -> 200%% @2.0s -> 50%% @2.6s -> 150%% @3.6s\n");
+    printf("ramp limits: %.1f /s, %.1f /s^2, %.1f /s^3\n\n", FeedrateOverride::MAX_RATE,
+           FeedrateOverride::MAX_ACCEL, FeedrateOverride::MAX_JERK);
+    printf("%-6s %-8s | %8s %10s | %9s %9s | %8s %8s | %7s %8s\n", "source", "run", "time(s)", "max acc",
+           "vel err", "acc err", "pause(s)", "moved", "max s'", "max s''");
+    bool pass = true;
+    for (Case& c : cases) {
+        Metrics base = analyze(run(*c.src, unit));
+        Metrics fast = analyze(run(*c.src, fastest));
+        Metrics over = analyze(run(*c.src, plan));
+        const char* names[] = {"100%", "200%", "plan"};
+        const Metrics* rows[] = {&base, &fast, &over};
+        for (int i = 0; i < 3; ++i) {
+            const Metrics* m = rows[i];
+            printf("%-6s %-8s | %8.3f %10.1f | %9.4f %9.2f | %8.3f %8.2g | %7.3f %8.3f\n", c.name, names[i],
+                   m->time, m->max_acc, m->vel_err, m->acc_err, m->paused_time, m->paused_move, m->max_ds, m->max_dds);
+        }
+        // 差分誤差本身隨 s 放大 (加速度跳動 ∝ s²)，以定速 100% / 200% 中較大者為基準，過渡不得明顯變差
+        float ref_vel = std::max(base.vel_err, fast.vel_err), ref_acc = std::max(base.acc_err, fast.acc_err);
+        bool ok = over.vel_err <= CONSISTENCY_MARGIN * ref_vel + 0.01f &&
+                  over.acc_err <= CONSISTENCY_MARGIN * ref_acc + 1.0f &&
+                  over.paused_time > 0.1f && over.paused_move <= PAUSE_STILL && over.max_ds <= FeedrateOverride::MAX_RATE * 1.001f &&
+                  over.max_dds <= FeedrateOverride::MAX_ACCEL * 1.01f && std::fabs(over.end1 - base.end1) < 1e-3f &&
+                  std::fabs(over.end2 - base.end2) < 1e-3f && over.time < MAX_RUN_TIME;
+        if (!ok) printf("  FAIL\n");
+        pass = pass && ok;
+    }
+
+    // 定速覆寫 (從 100% 斜坡過渡) 的完成時間與最大加速度
+    printf("\n%-6s %6s | %8s %10s\n", "source", "scale", "time(s)", "max acc");
+    for (Case& c : cases) {
+        for (float s : {0.5f, 1.0f, 2.0f}) {
+            Metrics m = analyze(run(*c.src, {{0.0f, s}}));
+            printf("%-6s %5.0f%% | %8.3f %10.1f\n", c.name, s * 100.0f, m.time, m.max_acc);
+        }
+    }
+    printf("%s\n", pass ? "OK" : "FAIL");
+    return pass ? 0 : 1;
+}
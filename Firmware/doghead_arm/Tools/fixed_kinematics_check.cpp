@@ -0,0 +1,203 @@
+/**
+ * @file fixed_kinematics_check.cpp
+ * @brief [Host 工具] 定點運動學 (FixedFiveBarKinematics) 與浮點版本的等價性檢查 + 執行時間分佈
+ * @details
+ *  1. IK：整個可達包絡 (含書寫區外) 以 0.5mm 掃描，兩種手肘模式都比，
+ *     比較可達判定與關節角 (定點版與 float 版都對 double 參考值)；
+ *     誤差門檻只套用在遠離奇異構型的點，接近奇異的點另外列出
+ *  2. FK：關節空間 [-π, π]^2 以 0.01 rad 掃描，比較末端座標；
+ *     誤差 > 1mm 視為分支翻轉 (兩版本在 Y≈0 附近取了不同交點)，另外計數
+ *  3. 時間：每次呼叫以 TSC 計時，列出 min / p50 / max —— 定點版所有迴圈次數固定，
+ *     分佈應該很窄；浮點 libm 版本會隨輸入變化
+ *  任一項超過門檻時回傳 1，可當作回歸檢查
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc fixed_kinematics_check.cpp ../Core/Src/fixed_kinematics.cpp ../Core/Src/kinematics.cpp -o fixed_kinematics_check
+ */
+
+#include "arm_geometry.hpp"
+#include "fixed_kinematics.hpp"
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+using namespace fixedpoint;
+
+// 通過門檻 (對 double 參考值)
+// 只在條件良好的構型要求 (IK: min(sin βL, sin βR)，FK: singularityDistance，皆需 > WELL_CONDITIONED)；
+// 接近奇異時 acos / 雙圓交點本身病態，float 版本的誤差也會放大，這些點只列出最大值供參考
+static const float WELL_CONDITIONED = 0.05f;
+static const double IK_TOL_RAD = 2e-6;
+static const double FK_TOL_MM = 2e-4;
+static const int REACH_MISMATCH_MAX = 0; // 距離可達邊界 > 1um 的點，可達判定必須一致
+
+static uint64_t cycles() {
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// double 參考解
+static bool refIK(double x, double y, int mode, double* t1, double* t2, double* min_sin_beta) {
+    const double L1 = DogArmSpec::L1, L2 = DogArmSpec::L2, D = DogArmSpec::D;
+    double dL = std::hypot(x, y), dR = std::hypot(x - D, y);
+    if (dL > L1 + L2 || dL < std::fabs(L1 - L2) || dR > L1 + L2 || dR < std::fabs(L1 - L2)) return false;
+    double bL = std::acos(std::max(-1.0, std::min(1.0, (L1 * L1 - L2 * L2 + dL * dL) / (2 * L1 * dL))));
+    double bR = std::acos(std::max(-1.0, std::min(1.0, (L1 * L1 - L2 * L2 + dR * dR) / (2 * L1 * dR))));
+    *t1 = std::atan2(y, x) + mode * bL;
+    *t2 = std::atan2(y, x - D) - mode * bR;
+    *min_sin_beta = std::min(std::sin(bL), std::sin(bR));  // dβ/d(dist) ∝ 1 / sin β
+    return true;
+}
+
+static bool refFK(double t1, double t2, double* x, double* y) {
+    const double L1 = DogArmSpec::L1, L2 = DogArmSpec::L2, D = DogArmSpec::D;
+    double e1x = L1 * std::cos(t1), e1y = L1 * std::sin(t1);
+    double e2x = D + L1 * std::cos(t2), e2y = L1 * std::sin(t2);
+    double dx = e2x - e1x, dy = e2y - e1y, d = std::hypot(dx, dy);
+    if (d > 2 * L2 || d == 0) return false;
+    double h = std::sqrt(std::max(0.0, L2 * L2 - d * d / 4));
+    double mx = e1x + dx / 2, my = e1y + dy / 2;
+    *x = mx - h * dy / d;
+    *y = my + h * dx / d;
+    if (*y < 0) {
+        *x = mx + h * dy / d;
+        *y = my - h * dx / d;
+    }
+    return true;
+}
+
+struct Stats {
+    std::vector<double> v;
+    void add(double e) { v.push_back(e); }
+    double max() const { return v.empty() ? 0 : *std::max_element(v.begin(), v.end()); }
+    double pct(double p) {
+        if (v.empty()) return 0;
+        size_t k = std::min(v.size() - 1, (size_t)(p * v.size()));
+        std::nth_element(v.begin(), v.begin() + k, v.end());
+        return v[k];
+    }
+};
+
+static void printTiming(const char* name, std::vector<uint64_t>& t) {
+    if (t.empty()) return;
+    std::sort(t.begin(), t.end());
+    printf("  %-22s min %5llu  p50 %5llu  p99 %5llu  max %6llu cycles (host TSC)\n", name,
+           (unsigned long long)t.front(), (unsigned long long)t[t.size() / 2],
+           (unsigned long long)t[t.size() * 99 / 100], (unsigned long long)t.back());
+}
+
+int main() {
+    const FiveBarGeometry& G = DogArmGeometry::value;
+    FixedFiveBarKinematics fixed_kin(G);
+    DogArmPreciseKinematics float_kin;
+    bool pass = true;
+
+    // --- 1. IK ---
+    Stats ik_fix, ik_flt, ik_fix_sing, ik_flt_sing;
+    int reach_mismatch = 0, edge_points = 0;
+    std::vector<uint64_t> t_ik_fix, t_ik_flt;
+    const float R = G.reach_max;
+    for (int mode = -1; mode <= 1; mode += 2) {
+        for (float y = -R; y <= R; y += 0.5f) {
+            for (float x = -R; x <= G.d + R; x += 0.5f) {
+                double r1 = 0, r2 = 0, cond = 0;
+                bool ref_ok = refIK(x, y, mode, &r1, &r2, &cond);
+
+                Point2Q q = {toQ16(x), toQ16(y)};
+                uint64_t c0 = cycles();
+                MotorAnglesQ a = fixed_kin.solveIK(q, mode);
+                uint64_t c1 = cycles();
+                MotorAngles f = float_kin.solveIK({x, y}, mode);
+                uint64_t c2 = cycles();
+                if (ref_ok) {
+                    t_ik_fix.push_back(c1 - c0);
+                    t_ik_flt.push_back(c2 - c1);
+                }
+
+                if (a.is_reachable != ref_ok) {
+                    // 距離可達邊界 1um 以內的點，捨入可能讓判定不同
+                    double dL = std::hypot(x, y), dR = std::hypot(x - G.d, y);
+                    double margin = std::min({std::fabs(dL - G.reach_max), std::fabs(dL - G.reach_min),
+                                              std::fabs(dR - G.reach_max), std::fabs(dR - G.reach_min)});
+                    if (margin < 1e-3) edge_points++;
+                    else reach_mismatch++;
+                    continue;
+                }
+                if (!ref_ok) continue;
+                bool well = cond > WELL_CONDITIONED;
+                (well ? ik_fix : ik_fix_sing).add(std::max(std::fabs(fromQ28(a.theta1) - r1),
+                                                           std::fabs(fromQ28(a.theta2) - r2)));
+                if (f.is_reachable)
+                    (well ? ik_flt : ik_flt_sing).add(std::max(std::fabs(f.theta1 - r1), std::fabs(f.theta2 - r2)));
+            }
+        }
+    }
+    printf("[IK] full envelope, both modes (%zu well-conditioned + %zu near-singular points)\n",
+           ik_fix.v.size(), ik_fix_sing.v.size());
+    printf("  fixed |theta - ref|     p50 %.2e  p99 %.2e  max %.2e rad  (near-singular max %.2e)\n",
+           ik_fix.pct(0.5), ik_fix.pct(0.99), ik_fix.max(), ik_fix_sing.max());
+    printf("  float |theta - ref|     p50 %.2e  p99 %.2e  max %.2e rad  (near-singular max %.2e)\n",
+           ik_flt.pct(0.5), ik_flt.pct(0.99), ik_flt.max(), ik_flt_sing.max());
+    printf("  reachability mismatch   %d  (+%d within 1um of the reach limit)\n", reach_mismatch, edge_points);
+    if (ik_fix.max() > IK_TOL_RAD || reach_mismatch > REACH_MISMATCH_MAX) pass = false;
+
+    // --- 2. FK ---
+    Stats fk_fix, fk_flt, fk_fix_sing, fk_flt_sing;
+    int flips = 0, fk_mismatch = 0;
+    std::vector<uint64_t> t_fk_fix, t_fk_flt;
+    for (float t1 = -3.14f; t1 <= 3.14f; t1 += 0.01f) {
+        for (float t2 = -3.14f; t2 <= 3.14f; t2 += 0.01f) {
+            double rx = 0, ry = 0;
+            bool ref_ok = refFK(t1, t2, &rx, &ry);
+
+            uint64_t c0 = cycles();
+            Point2Q p = fixed_kin.solveFK(toQ28(t1), toQ28(t2));
+            uint64_t c1 = cycles();
+            Point2D f = float_kin.solveFK(t1, t2);
+            uint64_t c2 = cycles();
+            if (!ref_ok) continue;
+            t_fk_fix.push_back(c1 - c0);
+            t_fk_flt.push_back(c2 - c1);
+
+            if (p.x == 0 && p.y == 0) {
+                fk_mismatch++;  // 參考有解但定點版判定無解 (兩臂剛好 2*L2 的邊界)
+                continue;
+            }
+            double e = std::hypot(fromQ16(p.x) - rx, fromQ16(p.y) - ry);
+            if (e > 1.0) {
+                flips++;
+                continue;
+            }
+            bool well = float_kin.singularityDistance(t1, t2) > WELL_CONDITIONED;
+            (well ? fk_fix : fk_fix_sing).add(e);
+            double ef = std::hypot(f.x - rx, f.y - ry);
+            if (ef <= 1.0) (well ? fk_flt : fk_flt_sing).add(ef);
+        }
+    }
+    printf("[FK] joint space [-pi, pi]^2 (%zu well-conditioned + %zu near-singular points)\n",
+           fk_fix.v.size(), fk_fix_sing.v.size());
+    printf("  fixed |p - ref|         p50 %.2e  p99 %.2e  max %.2e mm  (near-singular max %.2e)\n",
+           fk_fix.pct(0.5), fk_fix.pct(0.99), fk_fix.max(), fk_fix_sing.max());
+    printf("  float |p - ref|         p50 %.2e  p99 %.2e  max %.2e mm  (near-singular max %.2e)\n",
+           fk_flt.pct(0.5), fk_flt.pct(0.99), fk_flt.max(), fk_flt_sing.max());
+    printf("  branch flips (> 1mm)    %d,  unsolved at d = 2*L2: %d\n", flips, fk_mismatch);
+    if (fk_fix.max() > FK_TOL_MM) pass = false;
+
+    // --- 3. 時間分佈 ---
+    printf("[timing]\n");
+    printTiming("fixed solveIK", t_ik_fix);
+    printTiming("float solveIK (libm)", t_ik_flt);
+    printTiming("fixed solveFK", t_fk_fix);
+    printTiming("float solveFK (libm)", t_fk_flt);
+
+    printf("\n%s (tolerance: IK %.0e rad, FK %.0e mm)\n", pass ? "PASS" : "FAIL", IK_TOL_RAD, FK_TOL_MM);
+    return pass ? 0 : 1;
+}
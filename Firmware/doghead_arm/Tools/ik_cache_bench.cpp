@@ -0,0 +1,155 @@
+/**
+ * @file ik_cache_bench.cpp
+ * @brief [Host 工具] IK 記憶快取 (IkCache) 的命中率、速度與誤差保證驗證
+ * @details
+ *  模擬書法作業：同一個字 (「永」的簡化筆畫) 在同一位置重複描寫 --reps 次，
+ *  目標點以上位機送出 Robot_SetTargetPosition 的頻率 (--rate，預設 50Hz) 取樣；
+ *  --jitter 在每個目標點加上均勻雜訊，模擬上位機重新計算路徑造成的微小差異
+ *  (0 = 每次送出完全相同的座標)。
+ *  對 MCU 用的容量 (256，robot_arm_core.cpp) 與 Host 軌跡編譯器用的容量 (4096) 各跑一次，輸出：
+ *    - 命中 / miss / 替換次數與命中率
+ *    - 每次呼叫的時間：快取 (miss 走封閉解) 與直接封閉解
+ *    - 命中結果相對重新求解的最大關節角誤差，超過 tolerance 回傳 1
+ *  快取的保證是「相對於填入它的解算器」：這裡用 DogArmPreciseKinematics 填入，量到的就是
+ *  快取本身引入的誤差 (FastMath 的 solveIK 本身就和精確解差 ~8e-5 rad，且不是平滑的，
+ *  拿它比較會把多項式近似的誤差也算進來)
+ *  注意：Host 的相對比例只能當作參考，實機請以 DWT->CYCCNT 量測
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc ik_cache_bench.cpp ../Core/Src/kinematics.cpp -o ik_cache_bench
+ * 使用:
+ *   ./ik_cache_bench [--reps 10] [--speed 50] [--rate 50] [--jitter 0.001] [--resolution 0.05] [--tolerance 1e-4]
+ */
+
+#include "arm_geometry.hpp"
+#include "ik_cache.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+struct Options {
+    int reps = 10;
+    float speed = 50.0f;      // mm/s
+    float rate = 50.0f;       // Hz
+    float jitter = 0.001f;    // mm
+    float resolution = 0.05f;
+    float tolerance = 1e-4f;  // rad
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--reps")) opt->reps = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--speed")) opt->speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--rate")) opt->rate = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--jitter")) opt->jitter = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--resolution")) opt->resolution = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tolerance")) opt->tolerance = (float)atof(argv[++i]);
+        else return false;
+    }
+    return opt->reps >= 1 && opt->speed > 0.0f && opt->rate > 0.0f && opt->jitter >= 0.0f && opt->resolution > 0.0f &&
+           opt->tolerance > 0.0f;
+}
+
+// 「永」字的簡化筆畫 (與 incremental_ik_bench 相同)，以固定速度取樣
+static std::vector<Point2D> makeGlyph(float speed, float rate) {
+    const Point2D strokes[][2] = {
+        {{28, 185}, {34, 178}}, {{0, 165}, {60, 165}}, {{30, 170}, {30, 110}},
+        {{25, 145}, {-20, 110}}, {{35, 145}, {85, 108}},
+    };
+    std::vector<Point2D> out;
+    const float ds = speed / rate;
+    for (const auto& s : strokes) {
+        float len = std::hypot(s[1].x - s[0].x, s[1].y - s[0].y);
+        int n = std::max(1, (int)std::ceil(len / ds));
+        for (int i = 0; i <= n; ++i) {
+            float t = (float)i / n;
+            out.push_back({s[0].x + t * (s[1].x - s[0].x), s[0].y + t * (s[1].y - s[0].y)});
+        }
+    }
+    return out;
+}
+
+struct Result {
+    uint32_t hits, misses, evictions, size;
+    double ns_cache, ns_closed;
+    float max_err;      // 命中樣本的最大關節角誤差 (rad)
+    int violations;     // 超過 tolerance 的命中數
+};
+
+template <uint32_t Capacity>
+static Result run(const Options& opt, const std::vector<Point2D>& job) {
+    DogArmPreciseKinematics kin;
+    static IkCache<DogArmPreciseKinematics, Capacity> cache(kin, opt.resolution, opt.tolerance);
+    cache.clear();
+    Result r = {};
+
+    // 1. 計時 (快取)
+    std::vector<MotorAngles> out(job.size());
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < job.size(); ++i) out[i] = cache.solve(job[i]);
+    auto t1 = std::chrono::steady_clock::now();
+    r.ns_cache = std::chrono::duration<double, std::nano>(t1 - t0).count() / job.size();
+    r.hits = cache.hits();
+    r.misses = cache.misses();
+    r.evictions = cache.evictions();
+    r.size = cache.size();
+
+    // 2. 計時 (直接封閉解)
+    std::vector<MotorAngles> closed(job.size());
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < job.size(); ++i) closed[i] = kin.solveIK(job[i]);
+    t1 = std::chrono::steady_clock::now();
+    r.ns_closed = std::chrono::duration<double, std::nano>(t1 - t0).count() / job.size();
+
+    // 3. 誤差：再跑一次 (不計時)，命中的樣本與重新求解的結果比較
+    cache.clear();
+    for (size_t i = 0; i < job.size(); ++i) {
+        uint32_t before = cache.hits();
+        MotorAngles a = cache.solve(job[i]);
+        if (cache.hits() == before) continue;
+        MotorAngles exact = kin.solveIK(job[i]);
+        float err = std::max(std::fabs(a.theta1 - exact.theta1), std::fabs(a.theta2 - exact.theta2));
+        r.max_err = std::max(r.max_err, err);
+        if (err > opt.tolerance) r.violations++;
+    }
+    return r;
+}
+
+static void print(const char* name, uint32_t capacity, const Result& r) {
+    uint32_t total = r.hits + r.misses;
+    printf("%-6s %6u %8u %8u %8u %6u %7.1f%% | %8.1f %8.1f | %9.2e %4d\n", name, capacity, r.hits, r.misses,
+           r.evictions, r.size, total ? 100.0 * r.hits / total : 0.0, r.ns_cache, r.ns_closed, r.max_err,
+           r.violations);
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--reps n] [--speed mm/s] [--jitter mm] [--resolution mm] [--tolerance rad]\n",
+                argv[0]);
+        return 1;
+    }
+
+    std::vector<Point2D> glyph = makeGlyph(opt.speed, opt.rate);
+    std::vector<Point2D> job;
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> noise(-opt.jitter, opt.jitter);
+    for (int k = 0; k < opt.reps; ++k)
+        for (const Point2D& p : glyph) job.push_back({p.x + noise(rng), p.y + noise(rng)});
+
+    printf("job: %d x %zu points (%.0f mm/s @ %.0f Hz), jitter %.4f mm, resolution %.3f mm, tolerance %.1e rad\n\n",
+           opt.reps, glyph.size(), opt.speed, opt.rate, opt.jitter, opt.resolution, opt.tolerance);
+    printf("%-6s %6s %8s %8s %8s %6s %8s | %8s %8s | %9s %4s\n", "target", "cap", "hits", "misses", "evict",
+           "size", "hit", "ns_cache", "ns_ik", "max_err", "viol");
+    Result mcu = run<256>(opt, job);
+    Result host = run<4096>(opt, job);
+    print("mcu", 256, mcu);
+    print("host", 4096, host);
+    return (mcu.violations || host.violations) ? 1 : 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file ik_grid_gen.cpp
+ * @brief [Host 工具] 產生書寫區 IK 查表網格 (Core/Src/ik_grid_table.cpp) 與誤差地圖
+ * @details
+ *  1. 以 DogArmPreciseKinematics::solveIK 解出每個網格節點的 (theta1, theta2)
+ *  2. 量化為 int16 定點 (每個關節一個 offset，LSB = 2*pi / 65536)
+ *  3. 用韌體同一份 IkLookupGrid::lookup 在每格內取 8x8 個點，和解析解比較，
+ *     輸出每格的最大角度誤差 / 位置誤差 (CSV)，並在終端印出粗略熱圖
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc ik_grid_gen.cpp ../Core/Src/ik_lookup_grid.cpp ../Core/Src/kinematics.cpp -o ik_grid_gen
+ * 使用:
+ *   ./ik_grid_gen [--step 2.0] [--tol-mm 0.02] [--out ../Core/Src/ik_grid_table.cpp] [--error-map ik_grid_error.csv]
+ */
+
+#include "arm_geometry.hpp"
+#include "ik_lookup_grid.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+static const int SUBSAMPLES = 8;  // 每格每個方向的驗證取樣數
+
+struct Options {
+    float step = 2.0f;
+    float tol_mm = 0.02f;
+    const char* out_path = "../Core/Src/ik_grid_table.cpp";
+    const char* error_path = "ik_grid_error.csv";
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--step")) opt->step = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tol-mm")) opt->tol_mm = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out")) opt->out_path = argv[++i];
+        else if (!strcmp(argv[i], "--error-map")) opt->error_path = argv[++i];
+        else return false;
+    }
+    return opt->step > 0.0f;
+}
+
+// 輸出合法的 C++ float 常值 (避免 "-60f" 這種沒有小數點的寫法)
+static const char* floatLiteral(float v, char* buf, size_t len) {
+    snprintf(buf, len, "%.9g", v);
+    if (!strpbrk(buf, ".eEn")) strncat(buf, ".0", len - strlen(buf) - 1);
+    strncat(buf, "f", len - strlen(buf) - 1);
+    return buf;
+}
+
+// 產生時的幾何：DogArmSpec 改變 (arm_calibration.hpp 更新) 而本表沒有重新產生時編譯失敗
+static void writeGeometryCheck(FILE* f) {
+    char l1[32], l2[32], d[32];
+    fprintf(f, "#include \"arm_geometry.hpp\"\n\n");
+    fprintf(f, "// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)\n");
+    fprintf(f, "static_assert(dogArmGeometryMatches(%s, %s, %s),\n", floatLiteral(DogArmSpec::L1, l1, sizeof(l1)),
+            floatLiteral(DogArmSpec::L2, l2, sizeof(l2)), floatLiteral(DogArmSpec::D, d, sizeof(d)));
+    fprintf(f, "              \"ik_grid_table.cpp was generated for another geometry: rerun Tools/ik_grid_gen\");\n\n");
+}
+
+static void writeArray(FILE* f, const char* name, const std::vector<int16_t>& v, int nx) {
+    fprintf(f, "static const int16_t %s[%zu] = {\n", name, v.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        if (i % nx == 0) fprintf(f, "    ");
+        fprintf(f, "%d,", v[i]);
+        fprintf(f, ((i + 1) % nx == 0) ? "\n" : " ");
+    }
+    fprintf(f, "};\n\n");
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--step mm] [--tol-mm mm] [--out file.cpp] [--error-map file.csv]\n", argv[0]);
+        return 1;
+    }
+
+    DogArmPreciseKinematics kin;
+    const float x0 = DogArmWritingArea::X_MIN;
+    const float y0 = DogArmWritingArea::Y_MIN;
+    const int nx = (int)std::ceil((DogArmWritingArea::X_MAX - x0) / opt.step - 1e-4f) + 1;
+    const int ny = (int)std::ceil((DogArmWritingArea::Y_MAX - y0) / opt.step - 1e-4f) + 1;
+
+    // --- 1. 解出所有節點 ---
+    std::vector<float> t1(nx * ny), t2(nx * ny);
+    for (int iy = 0; iy < ny; ++iy) {
+        for (int ix = 0; ix < nx; ++ix) {
+            Point2D p = {x0 + ix * opt.step, y0 + iy * opt.step};
+            MotorAngles a = kin.solveIK(p);
+            if (!a.is_reachable) {
+                fprintf(stderr, "node (%.2f, %.2f) is unreachable; shrink DogArmWritingArea\n", p.x, p.y);
+                return 1;
+            }
+            t1[iy * nx + ix] = a.theta1;
+            t2[iy * nx + ix] = a.theta2;
+        }
+    }
+
+    // --- 2. 量化 ---
+    const float lsb = 6.28318530718f / 65536.0f;
+    auto mid = [](const std::vector<float>& v) {
+        auto mm = std::minmax_element(v.begin(), v.end());
+        return 0.5f * (*mm.first + *mm.second);
+    };
+    const float off1 = mid(t1), off2 = mid(t2);
+    std::vector<int16_t> q1(nx * ny), q2(nx * ny);
+    for (int i = 0; i < nx * ny; ++i) {
+        float r1 = std::round((t1[i] - off1) / lsb);
+        float r2 = std::round((t2[i] - off2) / lsb);
+        if (std::fabs(r1) > 32767.0f || std::fabs(r2) > 32767.0f) {
+            fprintf(stderr, "joint angle span exceeds 2*pi, cannot encode as int16\n");
+            return 1;
+        }
+        q1[i] = (int16_t)r1;
+        q2[i] = (int16_t)r2;
+    }
+
+    IkGridTable table = {x0, y0, opt.step, 1.0f / opt.step, (uint16_t)nx, (uint16_t)ny,
+                         lsb, off1, off2, 0.0f, q1.data(), q2.data()};
+    IkLookupGrid grid(table);
+
+    // --- 3. 誤差地圖 ---
+    FILE* csv = fopen(opt.error_path, "w");
+    if (!csv) {
+        perror(opt.error_path);
+        return 1;
+    }
+    fprintf(csv, "ix,iy,x_center_mm,y_center_mm,max_angle_err_rad,max_pos_err_mm\n");
+
+    std::vector<float> cell_pos_err((nx - 1) * (ny - 1));
+    float worst_angle = 0.0f, worst_pos = 0.0f;
+    int coarse_cells = 0;
+    for (int iy = 0; iy < ny - 1; ++iy) {
+        for (int ix = 0; ix < nx - 1; ++ix) {
+            float cell_angle = 0.0f, cell_pos = 0.0f;
+            for (int sy = 0; sy < SUBSAMPLES; ++sy) {
+                for (int sx = 0; sx < SUBSAMPLES; ++sx) {
+                    Point2D p = {x0 + (ix + (sx + 0.5f) / SUBSAMPLES) * opt.step,
+                                 y0 + (iy + (sy + 0.5f) / SUBSAMPLES) * opt.step};
+                    MotorAngles exact = kin.solveIK(p);
+                    MotorAngles approx = grid.lookup(p);
+                    if (!exact.is_reachable || !approx.is_reachable) continue;
+                    float ea = std::max(std::fabs(exact.theta1 - approx.theta1),
+                                        std::fabs(exact.theta2 - approx.theta2));
+                    Point2D q = kin.solveFK(approx.theta1, approx.theta2);
+                    float ep = std::hypot(q.x - p.x, q.y - p.y);
+                    cell_angle = std::max(cell_angle, ea);
+                    cell_pos = std::max(cell_pos, ep);
+                }
+            }
+            cell_pos_err[iy * (nx - 1) + ix] = cell_pos;
+            worst_angle = std::max(worst_angle, cell_angle);
+            worst_pos = std::max(worst_pos, cell_pos);
+            if (cell_pos > opt.tol_mm) coarse_cells++;
+            fprintf(csv, "%d,%d,%.3f,%.3f,%.3e,%.4f\n", ix, iy,
+                    x0 + (ix + 0.5f) * opt.step, y0 + (iy + 0.5f) * opt.step, cell_angle, cell_pos);
+        }
+    }
+    fclose(csv);
+    table.max_error = worst_angle;
+
+    // --- 4. 輸出表格原始碼 ---
+    FILE* f = fopen(opt.out_path, "w");
+    if (!f) {
+        perror(opt.out_path);
+        return 1;
+    }
+    fprintf(f, "/**\n");
+    fprintf(f, " * @file ik_grid_table.cpp\n");
+    fprintf(f, " * @brief [自動產生] 書寫區 IK 查表網格，請勿手動修改\n");
+    fprintf(f, " * @details 產生器: Tools/ik_grid_gen --step %.3f\n", opt.step);
+    fprintf(f, " *   幾何 L1=%.3f L2=%.3f D=%.3f mm，書寫區 X[%.1f, %.1f] Y[%.1f, %.1f] mm\n",
+            DogArmSpec::L1, DogArmSpec::L2, DogArmSpec::D,
+            DogArmWritingArea::X_MIN, DogArmWritingArea::X_MAX,
+            DogArmWritingArea::Y_MIN, DogArmWritingArea::Y_MAX);
+    fprintf(f, " *   %d x %d 節點 (%d bytes)，最大內插誤差 %.2e rad / %.4f mm\n",
+            nx, ny, nx * ny * 4, worst_angle, worst_pos);
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"ik_lookup_grid.hpp\"\n");
+    writeGeometryCheck(f);
+    writeArray(f, "IK_GRID_THETA1", q1, nx);
+    writeArray(f, "IK_GRID_THETA2", q2, nx);
+    fprintf(f, "const IkGridTable IK_GRID_DOGARM = {\n");
+    char b1[32], b2[32];
+    fprintf(f, "    %s, %s,   // x_min, y_min\n", floatLiteral(x0, b1, sizeof(b1)), floatLiteral(y0, b2, sizeof(b2)));
+    fprintf(f, "    %s, %s,   // step, inv_step\n",
+            floatLiteral(opt.step, b1, sizeof(b1)), floatLiteral(1.0f / opt.step, b2, sizeof(b2)));
+    fprintf(f, "    %d, %d,   // nx, ny\n", nx, ny);
+    fprintf(f, "    %s,   // angle_lsb\n", floatLiteral(lsb, b1, sizeof(b1)));
+    fprintf(f, "    %s, %s,   // theta1_offset, theta2_offset\n",
+            floatLiteral(off1, b1, sizeof(b1)), floatLiteral(off2, b2, sizeof(b2)));
+    fprintf(f, "    %s,   // max_error (rad)\n", floatLiteral(worst_angle, b1, sizeof(b1)));
+    fprintf(f, "    IK_GRID_THETA1,\n");
+    fprintf(f, "    IK_GRID_THETA2,\n");
+    fprintf(f, "};\n");
+    fclose(f);
+
+    // --- 5. 終端摘要 + 熱圖 (每字元約 10mm) ---
+    printf("grid %d x %d, step %.3f mm, %d bytes flash\n", nx, ny, opt.step, nx * ny * 4);
+    printf("max angle error %.3e rad, max position error %.4f mm\n", worst_angle, worst_pos);
+    printf("cells above %.3f mm: %d / %d\n\n", opt.tol_mm, coarse_cells, (nx - 1) * (ny - 1));
+    printf("position error map (top row = Y max;  . < tol/4  - < tol/2  + < tol  # >= tol)\n");
+    int bx = std::max(1, (int)(10.0f / opt.step));
+    for (int iy = ny - 2; iy >= 0; iy -= bx) {
+        for (int ix = 0; ix < nx - 1; ix += bx) {
+            float e = 0.0f;
+            for (int j = std::max(0, iy - bx + 1); j <= iy; ++j)
+                for (int i = ix; i < std::min(nx - 1, ix + bx); ++i)
+                    e = std::max(e, cell_pos_err[j * (nx - 1) + i]);
+            putchar(e < opt.tol_mm / 4 ? '.' : e < opt.tol_mm / 2 ? '-' : e < opt.tol_mm ? '+' : '#');
+        }
+        putchar('\n');
+    }
+    printf("\nwrote %s and %s\n", opt.out_path, opt.error_path);
+    return 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file incremental_ik_bench.cpp
+ * @brief [Host 工具] 熱啟動增量 IK (IncrementalIk) 與封閉解 (solveIK) 的速度 / 精度比較
+ * @details
+ *  沿著實際書寫會出現的筆畫，以 1kHz 取樣產生目標點序列：
+ *    line   : 書寫區對角直線
+ *    circle : 半徑 30mm 的圓
+ *    glyph  : 數個短筆畫 (筆畫之間抬筆跳到下一個起點，測試 fallback)
+ *  每條路徑以 20 / 100 / 300 mm/s 三種速度執行，輸出：
+ *    - 每次呼叫的時間 (ns) 與 TSC cycles (x86)：封閉解 FastMath / PreciseMath、增量解 (FastMath)
+ *    - 相對 DogArmPreciseKinematics 的最大角度誤差：封閉解 FastMath、增量解 (只計牛頓路徑的樣本，
+ *      fallback 樣本就是封閉解本身)，以及增量解的 FK 位置誤差
+ *    - 牛頓路徑 / 封閉解 fallback 次數，以及手肘模式是否一致
+ *  注意：Host 的相對比例只能當作參考，Cortex-M4 上 atan2/acos 與 sincos 的成本比例不同，
+ *        實機請以 DWT->CYCCNT 量測
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc incremental_ik_bench.cpp ../Core/Src/kinematics.cpp -o incremental_ik_bench
+ */
+
+#include "arm_geometry.hpp"
+#include "incremental_ik.hpp"
+#include <cstdio>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+static const float CONTROL_DT = 0.001f;  // 1kHz
+static const int REPEAT = 20;            // 計時重複次數
+
+static uint64_t cycles() {
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// 以固定速度沿折線取樣 (每段結束後 pen_up 為 true 的段直接跳到下一點)
+struct Segment {
+    Point2D a, b;
+};
+
+static void sampleSegments(const std::vector<Segment>& segs, float speed, std::vector<Point2D>* out) {
+    const float ds = speed * CONTROL_DT;
+    for (const Segment& s : segs) {
+        float len = std::hypot(s.b.x - s.a.x, s.b.y - s.a.y);
+        int n = std::max(1, (int)std::ceil(len / ds));
+        for (int i = 0; i <= n; ++i) {
+            float t = (float)i / n;
+            out->push_back({s.a.x + t * (s.b.x - s.a.x), s.a.y + t * (s.b.y - s.a.y)});
+        }
+    }
+}
+
+static std::vector<Point2D> makePath(const char* name, float speed) {
+    std::vector<Point2D> path;
+    std::vector<Segment> segs;
+    if (name[0] == 'l') {
+        segs.push_back({{DogArmWritingArea::X_MIN + 5, DogArmWritingArea::Y_MIN + 5},
+                        {DogArmWritingArea::X_MAX - 5, DogArmWritingArea::Y_MAX - 5}});
+        sampleSegments(segs, speed, &path);
+    } else if (name[0] == 'c') {
+        const float cx = 30.0f, cy = 150.0f, r = 30.0f;
+        int n = (int)std::ceil(2.0f * 3.14159265f * r / (speed * CONTROL_DT));
+        for (int i = 0; i <= n; ++i) {
+            float a = 2.0f * 3.14159265f * i / n;
+            path.push_back({cx + r * std::cos(a), cy + r * std::sin(a)});
+        }
+    } else {
+        // 「永」字的簡化筆畫：點、橫、豎、撇、捺 (起點彼此分離，中間抬筆)
+        segs.push_back({{28, 185}, {34, 178}});
+        segs.push_back({{0, 165}, {60, 165}});
+        segs.push_back({{30, 170}, {30, 110}});
+        segs.push_back({{25, 145}, {-20, 110}});
+        segs.push_back({{35, 145}, {85, 108}});
+        sampleSegments(segs, speed, &path);
+    }
+    return path;
+}
+
+struct Result {
+    double ns_fast, ns_precise, ns_incr;
+    double cyc_fast, cyc_precise, cyc_incr;
+    float err_fast, err_incr;        // 最大角度誤差 (rad)
+    float pos_err_incr;              // 最大 FK 位置誤差 (mm)
+    uint32_t newton, fallback;
+    int mode_mismatch;
+};
+
+// 封閉解計時：每次呼叫的輸入都依賴上一次的輸出 (0 * theta 不會被編譯器消去)，
+// 量到的是「一個 tick 一次」的延遲，與增量解的相依鏈條件相同；
+// 否則亂序執行的 CPU 會把獨立的封閉解呼叫重疊，低估實際控制迴圈的成本
+template <typename Kinematics>
+static void timeClosedForm(const Kinematics& kin, const std::vector<Point2D>& path,
+                           std::vector<MotorAngles>* out, double* ns, double* cyc) {
+    const size_t n = path.size();
+    float chain = 0.0f;
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = cycles();
+    for (int k = 0; k < REPEAT; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            Point2D p = {path[i].x + chain, path[i].y};
+            (*out)[i] = kin.solveIK(p);
+            chain = 0.0f * (*out)[i].theta1;
+        }
+    }
+    uint64_t c1 = cycles();
+    auto t1 = std::chrono::steady_clock::now();
+    *ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (REPEAT * n);
+    *cyc = (double)(c1 - c0) / (REPEAT * n);
+}
+
+static Result run(const std::vector<Point2D>& path) {
+    DogArmKinematics fast;
+    DogArmPreciseKinematics ref;
+    Result r = {};
+    const size_t n = path.size();
+
+    std::vector<MotorAngles> exact(n), closed(n), incr(n);
+    std::vector<bool> via_newton(n);
+
+    // --- 封閉解 ---
+    timeClosedForm(ref, path, &exact, &r.ns_precise, &r.cyc_precise);
+    timeClosedForm(fast, path, &closed, &r.ns_fast, &r.cyc_fast);
+
+    // --- 增量解 (每輪重新開始，模擬一次完整書寫) ---
+    IncrementalIk<DogArmKinematics> ik(fast);
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = cycles();
+    for (int k = 0; k < REPEAT; ++k) {
+        ik.reset();
+        for (size_t i = 0; i < n; ++i) incr[i] = ik.solve(path[i]);
+    }
+    uint64_t c1 = cycles();
+    auto t1 = std::chrono::steady_clock::now();
+    r.ns_incr = std::chrono::duration<double, std::nano>(t1 - t0).count() / (REPEAT * n);
+    r.cyc_incr = (double)(c1 - c0) / (REPEAT * n);
+    r.newton = ik.newtonCount() / REPEAT;
+    r.fallback = ik.fallbackCount() / REPEAT;
+
+    // 再跑一次 (不計時) 記錄每個樣本走的是哪條路徑
+    IncrementalIk<DogArmKinematics> probe(fast);
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t before = probe.newtonCount();
+        probe.solve(path[i]);
+        via_newton[i] = probe.newtonCount() != before;
+    }
+
+    // --- 精度 ---
+    for (size_t i = 0; i < n; ++i) {
+        r.err_fast = std::max(r.err_fast, std::max(std::fabs(closed[i].theta1 - exact[i].theta1),
+                                                   std::fabs(closed[i].theta2 - exact[i].theta2)));
+
+        Jacobian2x2 inv_j;
+        int mode;
+        ref.solveFKWithInverseJacobian(incr[i].theta1, incr[i].theta2, &inv_j, &mode);
+        if (mode != 1) r.mode_mismatch++;
+
+        if (!via_newton[i]) continue;  // fallback 樣本就是封閉解本身
+        r.err_incr = std::max(r.err_incr, std::max(std::fabs(incr[i].theta1 - exact[i].theta1),
+                                                   std::fabs(incr[i].theta2 - exact[i].theta2)));
+        Point2D p = ref.solveFK(incr[i].theta1, incr[i].theta2);
+        r.pos_err_incr = std::max(r.pos_err_incr, std::hypot(p.x - path[i].x, p.y - path[i].y));
+    }
+    return r;
+}
+
+int main() {
+    const char* paths[] = {"line", "circle", "glyph"};
+    const float speeds[] = {20.0f, 100.0f, 300.0f};
+
+    printf("%-7s %6s %6s | %8s %8s %8s | %8s %8s %8s | %9s %9s %9s | %7s %5s %4s\n",
+           "path", "mm/s", "pts", "ns_fast", "ns_prec", "ns_incr", "cyc_fast", "cyc_prec", "cyc_incr",
+           "err_fast", "err_incr", "pos_mm", "newton", "fallb", "mode");
+    for (const char* name : paths) {
+        for (float v : speeds) {
+            std::vector<Point2D> path = makePath(name, v);
+            Result r = run(path);
+            printf("%-7s %6.0f %6zu | %8.1f %8.1f %8.1f | %8.0f %8.0f %8.0f | %9.2e %9.2e %9.2e | %7u %5u %4d\n",
+                   name, v, path.size(), r.ns_fast, r.ns_precise, r.ns_incr,
+                   r.cyc_fast, r.cyc_precise, r.cyc_incr,
+                   r.err_fast, r.err_incr, r.pos_err_incr, r.newton, r.fallback, r.mode_mismatch);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file joint_sim.hpp
+ * @brief [Host 工具共用] 關節受控體模擬：韌體的 PositionController + 一階延遲速度控制馬達
+ * @details
+ *  與 Robot_Loop 相同的 1kHz tick。PositionController 輸出的 RPM 命令即關節 RPM (與其前饋換算相同)，
+ *  實際轉速以一階延遲 (時間常數 tau) 追命令，積分得到關節角。
+ *  Kp / Ki / Kd / Kv / max_rpm 取自 motor_params.h (與 robot_arm_core.cpp 的 joint1_pid / joint2_pid 相同)；
+ *  加速度前饋 Ka 依受控體延遲取 tau / 6 (RPM per Deg/s²，剛好抵消一階延遲)，韌體的 Ka 需以實機調校，不在此模擬。
+ *  linear_move_check、lookahead_planner_check、pvt_executor_check 共用。
+ */
+
+#ifndef JOINT_SIM_HPP
+#define JOINT_SIM_HPP
+
+#include "pid_controller.hpp"
+#include "motor_params.h"
+
+// 控制週期 (s)：與 ControlTask 呼叫 Robot_Loop 的週期相同
+static const float DT = 0.001f;
+
+struct Joint {
+    PositionController pid;
+    float tau;    // 馬達轉速的一階延遲 (s)
+    float theta;  // Deg
+    float omega;  // Deg/s
+    Joint(float kp, float ki, float kd, float kv, float max_rpm, float tau, float theta0)
+        : pid(kp, ki, kd, kv, tau / 6.0f, max_rpm), tau(tau), theta(theta0), omega(0.0f) {}
+    void step(const JointSetpoint& sp) {
+        float rpm = pid.update(sp.pos, sp.vel, sp.acc, theta, DT);
+        omega += (rpm * 6.0f - omega) * (DT / tau);
+        theta += omega * DT;
+    }
+
+    // 關節 1 / 2 (joint1_pid / joint2_pid 的增益)，從 theta0 (Deg) 靜止開始
+    static Joint joint1(float tau, float theta0) {
+        return Joint(JOINT1_PID_KP, JOINT1_PID_KI, JOINT1_PID_KD, JOINT1_PID_KV, JOINT1_PID_MAX_RPM, tau, theta0);
+    }
+    static Joint joint2(float tau, float theta0) {
+        return Joint(JOINT2_PID_KP, JOINT2_PID_KI, JOINT2_PID_KD, JOINT2_PID_KV, JOINT2_PID_MAX_RPM, tau, theta0);
+    }
+};
+
+#endif // JOINT_SIM_HPP
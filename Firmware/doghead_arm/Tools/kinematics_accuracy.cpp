@@ -0,0 +1,145 @@
+/**
+ * @file kinematics_accuracy.cpp
+ * @brief [Host 工具] PreciseMath / FastMath 全工作空間精度報告
+ * @details
+ *  1. IK: 以 0.5mm 網格掃描整個可達區域，和 double 參考解比較關節角誤差
+ *  2. FK: 以 0.2 度網格掃描關節空間，和 double 參考解比較末端位置誤差
+ *  3. 書寫區 FK(IK(p)) - p 往返誤差
+ *  solveFK 以 P.y < 0 選交點，在 y ~ 0 附近 float/double 可能選到不同分支，
+ *  這類點另外計數 (branch flips)，不併入誤差統計
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc kinematics_accuracy.cpp ../Core/Src/kinematics.cpp -o kinematics_accuracy
+ */
+
+#include "arm_geometry.hpp"
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// 與韌體相同的機構參數 (arm_geometry.hpp)
+static const double L1 = DogArmSpec::L1;
+static const double L2 = DogArmSpec::L2;
+static const double D  = DogArmSpec::D;
+
+// 書寫區 (mm)
+static const double AREA_X_MIN = DogArmWritingArea::X_MIN, AREA_X_MAX = DogArmWritingArea::X_MAX;
+static const double AREA_Y_MIN = DogArmWritingArea::Y_MIN, AREA_Y_MAX = DogArmWritingArea::Y_MAX;
+
+// ==========================================================
+// double 參考解 (與 kinematics.hpp 相同的幾何，mode = 1)
+// ==========================================================
+static bool refIK(double x, double y, double* t1, double* t2) {
+    double dl = std::hypot(x, y);
+    double dr = std::hypot(x - D, y);
+    if (dl > L1 + L2 || dl < std::fabs(L1 - L2)) return false;
+    if (dr > L1 + L2 || dr < std::fabs(L1 - L2)) return false;
+    double cl = std::max(-1.0, std::min(1.0, (L1 * L1 + dl * dl - L2 * L2) / (2 * L1 * dl)));
+    double cr = std::max(-1.0, std::min(1.0, (L1 * L1 + dr * dr - L2 * L2) / (2 * L1 * dr)));
+    *t1 = std::atan2(y, x) + std::acos(cl);
+    *t2 = std::atan2(y, x - D) - std::acos(cr);
+    return true;
+}
+
+static bool refFK(double t1, double t2, double* x, double* y) {
+    double e1x = L1 * std::cos(t1), e1y = L1 * std::sin(t1);
+    double e2x = D + L1 * std::cos(t2), e2y = L1 * std::sin(t2);
+    double dx = e2x - e1x, dy = e2y - e1y;
+    double d = std::hypot(dx, dy);
+    if (d > 2 * L2 || d == 0) return false;
+    double a = d / 2;
+    double h = std::sqrt(std::max(0.0, L2 * L2 - a * a));
+    double mx = e1x + a * dx / d, my = e1y + a * dy / d;
+    *x = mx - h * dy / d;
+    *y = my + h * dx / d;
+    if (*y < 0) {
+        *x = mx + h * dy / d;
+        *y = my - h * dx / d;
+    }
+    return true;
+}
+
+// ==========================================================
+// 統計
+// ==========================================================
+struct ErrorStats {
+    std::vector<double> samples;
+
+    void add(double e) { samples.push_back(e); }
+
+    void print(const char* name, const char* unit) {
+        if (samples.empty()) {
+            printf("  %-28s (no samples)\n", name);
+            return;
+        }
+        std::sort(samples.begin(), samples.end());
+        double sum = 0;
+        for (double e : samples) sum += e;
+        size_t n = samples.size();
+        printf("  %-28s mean %.3e  p99 %.3e  max %.3e %s  (n=%zu)\n", name,
+               sum / n, samples[(size_t)(0.99 * (n - 1))], samples[n - 1], unit, n);
+    }
+};
+
+template <class Kin>
+static void report(const char* title, Kin& kin) {
+    ErrorStats ik_err, fk_err, round_trip;
+    size_t fk_flips = 0;
+
+    // 1. IK：整個可達包絡 (兩馬達各自的環形區域交集)
+    for (double y = -250.0; y <= 250.0; y += 0.5) {
+        for (double x = -250.0; x <= 310.0; x += 0.5) {
+            double r1, r2;
+            if (!refIK(x, y, &r1, &r2)) continue;
+            MotorAngles a = kin.solveIK({(float)x, (float)y});
+            if (!a.is_reachable) continue;  // 邊界上 float/double 判斷差一點點
+            ik_err.add(std::max(std::fabs(a.theta1 - r1), std::fabs(a.theta2 - r2)));
+        }
+    }
+
+    // 2. FK：關節空間 [-180, 180] 度
+    for (double d1 = -180.0; d1 <= 180.0; d1 += 0.2) {
+        for (double d2 = -180.0; d2 <= 180.0; d2 += 0.2) {
+            double t1 = d1 * M_PI / 180.0, t2 = d2 * M_PI / 180.0;
+            double rx, ry;
+            if (!refFK(t1, t2, &rx, &ry)) continue;
+            Point2D p = kin.solveFK((float)t1, (float)t2);
+            if (p.x == 0.0f && p.y == 0.0f) continue;
+            double e = std::hypot(p.x - rx, p.y - ry);
+            if (e > 1.0) {
+                fk_flips++;
+                continue;
+            }
+            fk_err.add(e);
+        }
+    }
+
+    // 3. 書寫區往返
+    for (double y = AREA_Y_MIN; y <= AREA_Y_MAX; y += 0.25) {
+        for (double x = AREA_X_MIN; x <= AREA_X_MAX; x += 0.25) {
+            MotorAngles a = kin.solveIK({(float)x, (float)y});
+            if (!a.is_reachable) continue;
+            Point2D p = kin.solveFK(a.theta1, a.theta2);
+            round_trip.add(std::hypot(p.x - x, p.y - y));
+        }
+    }
+
+    printf("%s\n", title);
+    ik_err.print("IK |theta - ref|", "rad");
+    fk_err.print("FK |p - ref|", "mm");
+    printf("  %-28s %zu\n", "FK branch flips", fk_flips);
+    round_trip.print("area FK(IK(p)) - p", "mm");
+}
+
+int main() {
+    printf("Five-bar kinematics accuracy (L1=%.0f L2=%.0f D=%.0f mm)\n", L1, L2, D);
+    printf("Encoder 1 count: 13-Pin %.2e rad, 8-Pin %.2e rad\n\n",
+           2 * M_PI / (100 * 4 * 50), 2 * M_PI / (100 * 4 * 30));
+
+    DogArmPreciseKinematics precise;
+    DogArmKinematics fast;
+    report("[PreciseMath]", precise);
+    report("[FastMath]", fast);
+    return 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * @file kinematics_batch_check.cpp
+ * @brief [Host 工具] 批次 IK/FK (solveIKBatch / solveFKBatch) 與單點 solveIK / solveFK 的逐點等價性檢查
+ * @details
+ *  單點版本兩種都比：DogArmKinematics (FastMath，控制迴圈使用) 與 DogArmPreciseKinematics (libm)；
+ *  批次核心與 MathPolicy 無關 (vector_math.hpp 的多項式)，對 libm 的門檻較緊，對 FastMath 的門檻是 FastMath 本身的誤差
+ *  1. IK：整個可達包絡外加 5mm (含不可達點) 以 0.5mm 掃描，兩種手肘模式都比：
+ *     可達遮罩必須與 solveIK 的 is_reachable 逐位元一致 (距離可達邊界 1um 以內的點另外計數)，
+ *     可達點比較 theta1 / theta2，不可達的 lane 必須輸出 0
+ *  2. FK：關節空間 [-π, π]^2 以 0.01 rad 掃描，比較 x / y；無解的構型兩邊都必須是 (0, 0)，
+ *     誤差 > 1mm 視為分支翻轉 (Y≈0 附近兩邊取了不同交點)，另外計數
+ *  3. 尾端：n = 0 .. 2*32 + 2*W + 1、起點偏移 0 .. W-1 的所有組合 (W = SIMD 寬度)，
+ *     涵蓋 n 不是 W 倍數的純量尾端、跨遮罩 word 的組與未對齊的指標；
+ *     遮罩先填滿 1 (必須被清掉)，輸出陣列尾端放哨兵值 (不得被寫到)
+ *  誤差門檻只套用在條件良好的構型 (同 fixed_kinematics_check)，接近奇異的點只列出最大值；
+ *  任一項超過門檻時回傳 1，可當作回歸檢查
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc kinematics_batch_check.cpp ../Core/Src/kinematics.cpp -o kinematics_batch_check
+ *   (x86-64 預設為 SSE2 核心；加上 -mavx 檢查 AVX 核心，-mno-sse2 檢查 Cortex-M4 使用的純量核心)
+ */
+
+#include "arm_geometry.hpp"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+// 通過門檻 (批次對單點，只套用在條件良好的構型)
+// FastMath 的 acos 誤差 6.8e-5 rad (kinematics_math.hpp)，批次核心對 libm 約 5e-7 rad
+static const float WELL_CONDITIONED = 0.05f;
+struct Tolerance {
+    double ik_rad;
+    double fk_mm;
+};
+static const Tolerance TOL_FAST = {1e-4, 1e-4};
+static const Tolerance TOL_PRECISE = {5e-6, 5e-4};
+static const float SENTINEL = 12345.0f;
+
+#if defined(__AVX__)
+static const size_t SIMD_WIDTH = 8;
+static const char* SIMD_NAME = "avx";
+#elif defined(__SSE2__)
+static const size_t SIMD_WIDTH = 4;
+static const char* SIMD_NAME = "sse2";
+#else
+static const size_t SIMD_WIDTH = 1;
+static const char* SIMD_NAME = "scalar";
+#endif
+
+static bool maskBit(const std::vector<uint32_t>& mask, size_t i) {
+    return (mask[i >> 5] >> (i & 31)) & 1u;
+}
+
+// 距離可達邊界的最小距離 (mm)
+static float reachMargin(const FiveBarGeometry& G, float x, float y) {
+    float dL = std::hypot(x, y), dR = std::hypot(x - G.d, y);
+    return std::min({std::fabs(dL - G.reach_max), std::fabs(dL - G.reach_min),
+                     std::fabs(dR - G.reach_max), std::fabs(dR - G.reach_min)});
+}
+
+// IK 條件數指標：min(sin βL, sin βR) (dβ/d(dist) ∝ 1 / sin β)
+static float ikCondition(const FiveBarGeometry& G, float x, float y) {
+    float dL = std::hypot(x, y), dR = std::hypot(x - G.d, y);
+    float cL = (G.k + dL * dL) * G.inv_2l1 / dL, cR = (G.k + dR * dR) * G.inv_2l1 / dR;
+    return std::sqrt(std::max(0.0f, 1.0f - std::max(cL * cL, cR * cR)));
+}
+
+struct Stats {
+    double well = 0, sing = 0;  // 條件良好 / 接近奇異 的最大誤差
+    size_t n_well = 0, n_sing = 0;
+    void add(double e, bool well_conditioned) {
+        if (well_conditioned) { well = std::max(well, e); n_well++; }
+        else { sing = std::max(sing, e); n_sing++; }
+    }
+};
+
+struct IkResult {
+    Stats err;
+    int reach_mismatch = 0, edge_points = 0, nonzero_unreachable = 0, overwrite = 0;
+};
+
+// 批次 IK 的 [0, n) 與單點 solveIK 逐點比較
+template <typename Scalar>
+static void compareIK(const DogArmKinematics& batch, const Scalar& scalar, const float* xs, const float* ys,
+                      size_t n, int mode, IkResult* r) {
+    const FiveBarGeometry& G = batch.geometry();
+    std::vector<float> t1(n + SIMD_WIDTH, SENTINEL), t2(n + SIMD_WIDTH, SENTINEL);
+    std::vector<uint32_t> mask(DogArmKinematics::reachableMaskWords(n) + 1, 0xFFFFFFFFu);
+    batch.solveIKBatch(xs, ys, t1.data(), t2.data(), mask.data(), n, mode);
+
+    for (size_t i = 0; i < n; ++i) {
+        MotorAngles s = scalar.solveIK({xs[i], ys[i]}, mode);
+        bool batch_ok = maskBit(mask, i);
+        if (batch_ok != s.is_reachable) {
+            // 距離可達邊界 1um 以內的點，sqrt 的捨入可能讓判定不同
+            if (reachMargin(G, xs[i], ys[i]) < 1e-3f) r->edge_points++;
+            else r->reach_mismatch++;
+            continue;
+        }
+        if (!batch_ok) {
+            if (t1[i] != 0.0f || t2[i] != 0.0f) r->nonzero_unreachable++;
+            continue;
+        }
+        r->err.add(std::max(std::fabs((double)t1[i] - s.theta1), std::fabs((double)t2[i] - s.theta2)),
+                   ikCondition(G, xs[i], ys[i]) > WELL_CONDITIONED);
+    }
+    // 哨兵：n 之後的輸出與遮罩 word 都不得被寫到，最後一個 word 超過 n 的位元必須是 0
+    for (size_t i = n; i < t1.size(); ++i)
+        if (t1[i] != SENTINEL || t2[i] != SENTINEL) r->overwrite++;
+    if (mask.back() != 0xFFFFFFFFu) r->overwrite++;
+    if (n % 32 && (mask[n / 32] >> (n % 32)) != 0) r->overwrite++;
+}
+
+struct FkResult {
+    Stats err;
+    int flips = 0, solve_mismatch = 0, overwrite = 0;
+};
+
+template <typename Scalar>
+static void compareFK(const DogArmKinematics& batch, const Scalar& scalar, const float* t1, const float* t2,
+                      size_t n, FkResult* r) {
+    std::vector<float> x(n + SIMD_WIDTH, SENTINEL), y(n + SIMD_WIDTH, SENTINEL);
+    batch.solveFKBatch(t1, t2, x.data(), y.data(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        Point2D s = scalar.solveFK(t1[i], t2[i]);
+        bool s_ok = s.x != 0.0f || s.y != 0.0f;
+        bool b_ok = x[i] != 0.0f || y[i] != 0.0f;
+        if (s_ok != b_ok) {
+            r->solve_mismatch++;  // 兩臂剛好 2*L2 的邊界，一邊判定有解、另一邊無解
+            continue;
+        }
+        if (!s_ok) continue;
+        double e = std::hypot((double)x[i] - s.x, (double)y[i] - s.y);
+        if (e > 1.0) {
+            r->flips++;
+            continue;
+        }
+        r->err.add(e, batch.singularityDistance(t1[i], t2[i]) > WELL_CONDITIONED);
+    }
+    for (size_t i = n; i < x.size(); ++i)
+        if (x[i] != SENTINEL || y[i] != SENTINEL) r->overwrite++;
+}
+
+// 測試資料 (兩種單點版本共用)
+struct Inputs {
+    std::vector<float> xs, ys;  // IK：可達包絡 + 5mm (含不可達點)
+    std::vector<float> t1, t2;  // FK：關節空間
+    std::vector<float> tx, ty;  // 尾端：可達 / 不可達交錯
+    std::vector<float> ta, tb;
+};
+
+static Inputs makeInputs(const DogArmKinematics& kin) {
+    const FiveBarGeometry& G = kin.geometry();
+    const float R = G.reach_max + 5.0f;
+    Inputs in;
+    for (float y = -R; y <= R; y += 0.5f) {
+        for (float x = -R; x <= G.d + R; x += 0.5f) {
+            in.xs.push_back(x);
+            in.ys.push_back(y);
+        }
+    }
+    for (float a = -3.14f; a <= 3.14f; a += 0.01f) {
+        for (float b = -3.14f; b <= 3.14f; b += 0.01f) {
+            in.t1.push_back(a);
+            in.t2.push_back(b);
+        }
+    }
+    // 書寫區內的點與包絡外的點交錯，讓每一組 SIMD lane 都混有兩種；
+    // FK 輸入取對應的 IK 解，不可達點換成兩臂距離 > 2*L2 (無解) 的角度
+    for (int i = 0; i < 128; ++i) {
+        bool far = (i * 7) % 3 == 0;
+        in.tx.push_back(far ? G.d + R + (float)i : DogArmWritingArea::X_MIN + 1.37f * (float)i);
+        in.ty.push_back(far ? R : DogArmWritingArea::Y_MIN + 0.61f * (float)i);
+        MotorAngles a = kin.solveIK({in.tx.back(), in.ty.back()});
+        in.ta.push_back(a.is_reachable ? a.theta1 : 3.1f);
+        in.tb.push_back(a.is_reachable ? a.theta2 : 0.0f);
+    }
+    return in;
+}
+
+template <typename Scalar>
+static bool check(const char* name, const Scalar& scalar, const Tolerance& tol, const Inputs& in) {
+    DogArmKinematics batch;
+    bool pass = true;
+
+    // --- 1. IK：可達包絡 + 5mm ---
+    IkResult ik;
+    for (int mode = -1; mode <= 1; mode += 2) {
+        compareIK(batch, scalar, in.xs.data(), in.ys.data(), in.xs.size(), mode, &ik);
+    }
+    printf("[%s] tolerance IK %.0e rad, FK %.0e mm\n", name, tol.ik_rad, tol.fk_mm);
+    printf("  IK  envelope + 5mm, both modes (%zu points, n %% W = %zu)\n", in.xs.size(), in.xs.size() % SIMD_WIDTH);
+    printf("      |theta - solveIK|     max %.2e rad  (%zu well-conditioned; near-singular max %.2e, %zu pts)\n",
+           ik.err.well, ik.err.n_well, ik.err.sing, ik.err.n_sing);
+    printf("      reachability mismatch %d  (+%d within 1um of the reach limit), unreachable lane != 0: %d\n",
+           ik.reach_mismatch, ik.edge_points, ik.nonzero_unreachable);
+    if (ik.err.well > tol.ik_rad || ik.reach_mismatch || ik.nonzero_unreachable || ik.overwrite) pass = false;
+
+    // --- 2. FK：關節空間 ---
+    FkResult fk;
+    compareFK(batch, scalar, in.t1.data(), in.t2.data(), in.t1.size(), &fk);
+    printf("  FK  joint space [-pi, pi]^2 (%zu points, n %% W = %zu)\n", in.t1.size(), in.t1.size() % SIMD_WIDTH);
+    printf("      |p - solveFK|         max %.2e mm   (%zu well-conditioned; near-singular max %.2e, %zu pts)\n",
+           fk.err.well, fk.err.n_well, fk.err.sing, fk.err.n_sing);
+    printf("      branch flips (> 1mm)  %d,  solvable mismatch at d = 2*L2: %d\n", fk.flips, fk.solve_mismatch);
+    if (fk.err.well > tol.fk_mm || fk.overwrite) pass = false;
+
+    // --- 3. 尾端 / 未對齊 / 遮罩 word 邊界：所有 lane 都要符合門檻 ---
+    IkResult tail_ik;
+    FkResult tail_fk;
+    int runs = 0;
+    const size_t max_n = 2 * 32 + 2 * SIMD_WIDTH + 1;
+    for (size_t off = 0; off < SIMD_WIDTH; ++off) {
+        for (size_t n = 0; n <= max_n; ++n) {
+            compareIK(batch, scalar, in.tx.data() + off, in.ty.data() + off, n, 1, &tail_ik);
+            compareIK(batch, scalar, in.tx.data() + off, in.ty.data() + off, n, -1, &tail_ik);
+            compareFK(batch, scalar, in.ta.data() + off, in.tb.data() + off, n, &tail_fk);
+            runs++;
+        }
+    }
+    double tail_ik_max = std::max(tail_ik.err.well, tail_ik.err.sing);
+    double tail_fk_max = std::max(tail_fk.err.well, tail_fk.err.sing);
+    printf("  tail n = 0..%zu x offset 0..%zu (%d runs, %zu of %zu input points unreachable)\n",
+           max_n, SIMD_WIDTH - 1, runs, (size_t)std::count(in.ta.begin(), in.ta.end(), 3.1f), in.ta.size());
+    printf("      IK max %.2e rad, reachability mismatch %d, unreachable lane != 0: %d, overwritten %d\n",
+           tail_ik_max, tail_ik.reach_mismatch + tail_ik.edge_points, tail_ik.nonzero_unreachable,
+           tail_ik.overwrite);
+    printf("      FK max %.2e mm,  solvable mismatch %d, flips %d, overwritten %d\n",
+           tail_fk_max, tail_fk.solve_mismatch, tail_fk.flips, tail_fk.overwrite);
+    if (tail_ik_max > tol.ik_rad || tail_ik.reach_mismatch || tail_ik.edge_points || tail_ik.nonzero_unreachable ||
+        tail_ik.overwrite)
+        pass = false;
+    if (tail_fk_max > tol.fk_mm || tail_fk.solve_mismatch || tail_fk.flips || tail_fk.overwrite) pass = false;
+    printf("  %s\n\n", pass ? "PASS" : "FAIL");
+    return pass;
+}
+
+int main() {
+    DogArmKinematics fast;
+    DogArmPreciseKinematics precise;
+    Inputs in = makeInputs(fast);
+
+    printf("kinematics_batch_check: simd %s (width %zu)\n\n", SIMD_NAME, SIMD_WIDTH);
+    bool pass = check("vs DogArmKinematics (FastMath)", fast, TOL_FAST, in);
+    pass = check("vs DogArmPreciseKinematics (libm)", precise, TOL_PRECISE, in) && pass;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,415 @@
+/**
+ * @file kinematics_bench.cpp
+ * @brief [Host 工具] 運動學速度 / 往返精度基準測試，結果輸出 JSON 供逐次比較
+ * @details
+ *  1. 測試點：書寫區 (DogArmWritingArea) 的密集網格 (預設 0.25mm)
+ *  2. 速度 (ns/call)：每個實作各量 --repeat 次取中位數
+ *       throughput : 呼叫彼此獨立 (批次 / 離線工具的情境)
+ *       latency    : 每次輸入依賴上一次輸出 (控制迴圈一個 tick 一次的情境，見 incremental_ik_bench)
+ *     實作：FiveBarKinematics (執行期幾何)、DogArmPreciseKinematics、DogArmKinematics (FastMath)、
+ *           solveIKBatch / solveFKBatch、FixedFiveBarKinematics (定點 CORDIC)、IkLookupGrid (只有 IK)
+ *  3. 往返誤差：|FK(IK(p)) - p| (同一個實作的 IK 與 FK；查表 IK 配 PreciseMath FK)，
+ *     輸出 最大 / RMS / p50 / p99 與對數分箱的直方圖
+ *     (批次與單點 solveIK / solveFK 的逐點比較見 kinematics_batch_check)
+ *  4. 寫出 JSON (--json)，包含編譯器與 SIMD 寬度，方便比較不同次執行或不同機器
+ *  注意：Host 的絕對數字只能當作相對比較，實機請以 DWT->CYCCNT 量測
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   cmake -S . -B build -DCMAKE_BUILD_TYPE=Release && cmake --build build --target kinematics_bench
+ *   (或 g++ -O2 -std=gnu++14 -I../Core/Inc kinematics_bench.cpp ../Core/Src/kinematics.cpp
+ *        ../Core/Src/fixed_kinematics.cpp ../Core/Src/ik_lookup_grid.cpp ../Core/Src/ik_grid_table.cpp -o kinematics_bench)
+ * 使用:
+ *   ./kinematics_bench [--step 0.25] [--repeat 7] [--json kinematics_bench.json]
+ */
+
+#include "arm_geometry.hpp"
+#include "fixed_kinematics.hpp"
+#include "ik_lookup_grid.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+struct Options {
+    float step = 0.25f;
+    int repeat = 7;
+    const char* json_path = "kinematics_bench.json";
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--step")) opt->step = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--repeat")) opt->repeat = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--json")) opt->json_path = argv[++i];
+        else return false;
+    }
+    return opt->step > 0.0f && opt->repeat >= 1;
+}
+
+static const char* simdName() {
+#if defined(__AVX__)
+    return "avx";
+#elif defined(__SSE2__)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+// 防止編譯器把結果消去
+static volatile float g_sink;
+
+// ==========================================================
+// 計時
+// ==========================================================
+struct Timing {
+    const char* op;       // "solveIK" / "solveFK"
+    const char* variant;
+    double throughput_ns;
+    double latency_ns;    // 批次實作沒有意義，為負值
+};
+
+// 執行 repeat 次，回傳每次呼叫的中位數 ns
+template <typename Fn>
+static double medianNs(int repeat, size_t calls, Fn fn) {
+    std::vector<double> samples;
+    for (int k = 0; k < repeat; ++k) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / calls);
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+// 浮點 IK：throughput 與 latency (輸入加上 0 * 上一次輸出，形成相依鏈)
+template <typename Kinematics>
+static Timing timeIK(const char* variant, const Kinematics& kin, const std::vector<Point2D>& pts, int repeat) {
+    const size_t n = pts.size();
+    Timing t = {"solveIK", variant, 0, 0};
+    t.throughput_ns = medianNs(repeat, n, [&] {
+        float acc = 0.0f;
+        for (size_t i = 0; i < n; ++i) acc += kin.solveIK(pts[i]).theta1;
+        g_sink = acc;
+    });
+    t.latency_ns = medianNs(repeat, n, [&] {
+        float chain = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            MotorAngles a = kin.solveIK({pts[i].x + chain, pts[i].y});
+            chain = 0.0f * a.theta1;
+        }
+        g_sink = chain;
+    });
+    return t;
+}
+
+template <typename Kinematics>
+static Timing timeFK(const char* variant, const Kinematics& kin,
+                     const std::vector<float>& t1, const std::vector<float>& t2, int repeat) {
+    const size_t n = t1.size();
+    Timing t = {"solveFK", variant, 0, 0};
+    t.throughput_ns = medianNs(repeat, n, [&] {
+        float acc = 0.0f;
+        for (size_t i = 0; i < n; ++i) acc += kin.solveFK(t1[i], t2[i]).x;
+        g_sink = acc;
+    });
+    t.latency_ns = medianNs(repeat, n, [&] {
+        float chain = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            Point2D p = kin.solveFK(t1[i] + chain, t2[i]);
+            chain = 0.0f * p.x;
+        }
+        g_sink = chain;
+    });
+    return t;
+}
+
+// ==========================================================
+// 往返誤差統計
+// ==========================================================
+static const int HIST_BINS = 8;
+// 分箱上界 (mm)：[0, 1e-6) [1e-6, 1e-5) ... [0.1, 1) [1, inf)
+static const double HIST_EDGES[HIST_BINS - 1] = {1e-6, 1e-5, 1e-4, 1e-3, 1e-2, 1e-1, 1.0};
+
+struct RoundTrip {
+    const char* variant;
+    size_t points;
+    size_t unreachable;   // IK 回報無解 (書寫區內不應該出現)
+    double max_mm, rms_mm, p50_mm, p99_mm;
+    size_t hist[HIST_BINS];
+};
+
+static RoundTrip summarize(const char* variant, std::vector<double>& err, size_t unreachable) {
+    RoundTrip r = {};
+    r.variant = variant;
+    r.points = err.size() + unreachable;
+    r.unreachable = unreachable;
+    if (err.empty()) return r;
+    double sum_sq = 0.0;
+    for (double e : err) {
+        sum_sq += e * e;
+        int b = 0;
+        while (b < HIST_BINS - 1 && e >= HIST_EDGES[b]) b++;
+        r.hist[b]++;
+    }
+    std::sort(err.begin(), err.end());
+    r.max_mm = err.back();
+    r.rms_mm = std::sqrt(sum_sq / err.size());
+    r.p50_mm = err[err.size() / 2];
+    r.p99_mm = err[std::min(err.size() - 1, (size_t)(0.99 * err.size()))];
+    return r;
+}
+
+template <typename IkFn, typename FkFn>
+static RoundTrip roundTrip(const char* variant, const std::vector<Point2D>& pts, IkFn ik, FkFn fk) {
+    std::vector<double> err;
+    err.reserve(pts.size());
+    size_t unreachable = 0;
+    for (const Point2D& p : pts) {
+        MotorAngles a = ik(p);
+        if (!a.is_reachable) {
+            unreachable++;
+            continue;
+        }
+        Point2D q = fk(a.theta1, a.theta2);
+        err.push_back(std::hypot((double)q.x - p.x, (double)q.y - p.y));
+    }
+    return summarize(variant, err, unreachable);
+}
+
+// ==========================================================
+// JSON 輸出
+// ==========================================================
+static bool writeJson(const char* path, const Options& opt, size_t n_points,
+                      const std::vector<Timing>& timing, const std::vector<RoundTrip>& rt) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"tool\": \"kinematics_bench\",\n");
+    fprintf(f, "  \"format\": 1,\n");
+    fprintf(f, "  \"build\": {\"compiler\": \"%s\", \"simd\": \"%s\"},\n", __VERSION__, simdName());
+    fprintf(f, "  \"geometry\": {\"l1\": %.4f, \"l2\": %.4f, \"d\": %.4f},\n",
+            DogArmSpec::L1, DogArmSpec::L2, DogArmSpec::D);
+    fprintf(f, "  \"grid\": {\"x_min\": %.3f, \"x_max\": %.3f, \"y_min\": %.3f, \"y_max\": %.3f, "
+               "\"step_mm\": %.4f, \"points\": %zu},\n",
+            DogArmWritingArea::X_MIN, DogArmWritingArea::X_MAX, DogArmWritingArea::Y_MIN,
+            DogArmWritingArea::Y_MAX, opt.step, n_points);
+    fprintf(f, "  \"repeat\": %d,\n", opt.repeat);
+
+    fprintf(f, "  \"timing\": [\n");
+    for (size_t i = 0; i < timing.size(); ++i) {
+        const Timing& t = timing[i];
+        fprintf(f, "    {\"op\": \"%s\", \"variant\": \"%s\", \"throughput_ns\": %.3f, \"latency_ns\": ",
+                t.op, t.variant, t.throughput_ns);
+        if (t.latency_ns >= 0.0) fprintf(f, "%.3f}", t.latency_ns);
+        else fprintf(f, "null}");
+        fprintf(f, "%s\n", (i + 1 < timing.size()) ? "," : "");
+    }
+    fprintf(f, "  ],\n");
+
+    fprintf(f, "  \"round_trip_edges_mm\": [");
+    for (int b = 0; b < HIST_BINS - 1; ++b) fprintf(f, "%s%g", b ? ", " : "", HIST_EDGES[b]);
+    fprintf(f, "],\n");
+    fprintf(f, "  \"round_trip\": [\n");
+    for (size_t i = 0; i < rt.size(); ++i) {
+        const RoundTrip& r = rt[i];
+        fprintf(f, "    {\"variant\": \"%s\", \"points\": %zu, \"unreachable\": %zu, "
+                   "\"max_mm\": %.3e, \"rms_mm\": %.3e, \"p50_mm\": %.3e, \"p99_mm\": %.3e, \"histogram\": [",
+                r.variant, r.points, r.unreachable, r.max_mm, r.rms_mm, r.p50_mm, r.p99_mm);
+        for (int b = 0; b < HIST_BINS; ++b) fprintf(f, "%s%zu", b ? ", " : "", r.hist[b]);
+        fprintf(f, "]}%s\n", (i + 1 < rt.size()) ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--step mm] [--repeat n] [--json file.json]\n", argv[0]);
+        return 1;
+    }
+
+    // --- 測試點 ---
+    std::vector<Point2D> pts;
+    const int nx = (int)std::floor((DogArmWritingArea::X_MAX - DogArmWritingArea::X_MIN) / opt.step + 1e-4f) + 1;
+    const int ny = (int)std::floor((DogArmWritingArea::Y_MAX - DogArmWritingArea::Y_MIN) / opt.step + 1e-4f) + 1;
+    pts.reserve((size_t)nx * ny);
+    for (int iy = 0; iy < ny; ++iy)
+        for (int ix = 0; ix < nx; ++ix)
+            pts.push_back({DogArmWritingArea::X_MIN + ix * opt.step, DogArmWritingArea::Y_MIN + iy * opt.step});
+    const size_t n = pts.size();
+
+    FiveBarKinematics runtime(FiveBarGeometry(DogArmSpec::L1, DogArmSpec::L2, DogArmSpec::D));
+    DogArmPreciseKinematics precise;
+    DogArmKinematics fast;
+    FixedFiveBarKinematics fixed(DogArmGeometry::value);
+    IkLookupGrid grid(IK_GRID_DOGARM);
+
+    // FK 的輸入：書寫區各點的關節角 (SoA，同時給批次版本使用)
+    std::vector<float> xs(n), ys(n), t1(n), t2(n);
+    std::vector<uint32_t> mask(DogArmKinematics::reachableMaskWords(n));
+    for (size_t i = 0; i < n; ++i) {
+        xs[i] = pts[i].x;
+        ys[i] = pts[i].y;
+        MotorAngles a = precise.solveIK(pts[i]);
+        t1[i] = a.theta1;
+        t2[i] = a.theta2;
+    }
+    std::vector<Point2Q> pts_q(n);
+    std::vector<q28_t> t1_q(n), t2_q(n);
+    for (size_t i = 0; i < n; ++i) {
+        pts_q[i] = {fixedpoint::toQ16(pts[i].x), fixedpoint::toQ16(pts[i].y)};
+        t1_q[i] = fixedpoint::toQ28(t1[i]);
+        t2_q[i] = fixedpoint::toQ28(t2[i]);
+    }
+
+    // --- 1. 速度 ---
+    std::vector<Timing> timing;
+    std::vector<float> out1(n), out2(n);
+    timing.push_back(timeIK("runtime_precise", runtime, pts, opt.repeat));
+    timing.push_back(timeIK("static_precise", precise, pts, opt.repeat));
+    timing.push_back(timeIK("static_fast", fast, pts, opt.repeat));
+    {
+        Timing t = {"solveIK", "batch_fast", 0, -1};
+        t.throughput_ns = medianNs(opt.repeat, n, [&] {
+            fast.solveIKBatch(xs.data(), ys.data(), out1.data(), out2.data(), mask.data(), n);
+            g_sink = out1[n / 2];
+        });
+        timing.push_back(t);
+    }
+    {
+        Timing t = {"solveIK", "fixed_cordic", 0, 0};
+        t.throughput_ns = medianNs(opt.repeat, n, [&] {
+            int32_t acc = 0;
+            for (size_t i = 0; i < n; ++i) acc += fixed.solveIK(pts_q[i]).theta1;
+            g_sink = (float)acc;
+        });
+        t.latency_ns = medianNs(opt.repeat, n, [&] {
+            q16_t chain = 0;
+            for (size_t i = 0; i < n; ++i) {
+                MotorAnglesQ a = fixed.solveIK({pts_q[i].x + chain, pts_q[i].y});
+                chain = a.theta1 & 0;
+            }
+            g_sink = (float)chain;
+        });
+        timing.push_back(t);
+    }
+    {
+        Timing t = {"solveIK", "grid_lookup", 0, 0};
+        t.throughput_ns = medianNs(opt.repeat, n, [&] {
+            float acc = 0.0f;
+            for (size_t i = 0; i < n; ++i) acc += grid.lookup(pts[i]).theta1;
+            g_sink = acc;
+        });
+        t.latency_ns = medianNs(opt.repeat, n, [&] {
+            float chain = 0.0f;
+            for (size_t i = 0; i < n; ++i) {
+                MotorAngles a = grid.lookup({pts[i].x + chain, pts[i].y});
+                chain = 0.0f * a.theta1;
+            }
+            g_sink = chain;
+        });
+        timing.push_back(t);
+    }
+
+    timing.push_back(timeFK("runtime_precise", runtime, t1, t2, opt.repeat));
+    timing.push_back(timeFK("static_precise", precise, t1, t2, opt.repeat));
+    timing.push_back(timeFK("static_fast", fast, t1, t2, opt.repeat));
+    {
+        Timing t = {"solveFK", "batch_fast", 0, -1};
+        t.throughput_ns = medianNs(opt.repeat, n, [&] {
+            fast.solveFKBatch(t1.data(), t2.data(), out1.data(), out2.data(), n);
+            g_sink = out1[n / 2];
+        });
+        timing.push_back(t);
+    }
+    {
+        Timing t = {"solveFK", "fixed_cordic", 0, 0};
+        t.throughput_ns = medianNs(opt.repeat, n, [&] {
+            int32_t acc = 0;
+            for (size_t i = 0; i < n; ++i) acc += fixed.solveFK(t1_q[i], t2_q[i]).x;
+            g_sink = (float)acc;
+        });
+        t.latency_ns = medianNs(opt.repeat, n, [&] {
+            q28_t chain = 0;
+            for (size_t i = 0; i < n; ++i) {
+                Point2Q p = fixed.solveFK(t1_q[i] + chain, t2_q[i]);
+                chain = p.x & 0;
+            }
+            g_sink = (float)chain;
+        });
+        timing.push_back(t);
+    }
+
+    // --- 2. 往返誤差 ---
+    std::vector<RoundTrip> rt;
+    auto ikOf = [](const auto& kin) { return [&kin](Point2D p) { return kin.solveIK(p); }; };
+    auto fkOf = [](const auto& kin) { return [&kin](float a, float b) { return kin.solveFK(a, b); }; };
+    rt.push_back(roundTrip("runtime_precise", pts, ikOf(runtime), fkOf(runtime)));
+    rt.push_back(roundTrip("static_precise", pts, ikOf(precise), fkOf(precise)));
+    rt.push_back(roundTrip("static_fast", pts, ikOf(fast), fkOf(fast)));
+    {
+        fast.solveIKBatch(xs.data(), ys.data(), out1.data(), out2.data(), mask.data(), n);
+        std::vector<float> bx(n), by(n);
+        fast.solveFKBatch(out1.data(), out2.data(), bx.data(), by.data(), n);
+        std::vector<double> err;
+        size_t unreachable = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (!(mask[i >> 5] & (1u << (i & 31)))) {
+                unreachable++;
+                continue;
+            }
+            err.push_back(std::hypot((double)bx[i] - xs[i], (double)by[i] - ys[i]));
+        }
+        rt.push_back(summarize("batch_fast", err, unreachable));
+    }
+    rt.push_back(roundTrip("fixed_cordic", pts,
+        [&](Point2D p) {
+            MotorAnglesQ q = fixed.solveIK({fixedpoint::toQ16(p.x), fixedpoint::toQ16(p.y)});
+            MotorAngles a = {fixedpoint::fromQ28(q.theta1), fixedpoint::fromQ28(q.theta2), q.is_reachable};
+            return a;
+        },
+        [&](float a, float b) {
+            Point2Q q = fixed.solveFK(fixedpoint::toQ28(a), fixedpoint::toQ28(b));
+            Point2D p = {fixedpoint::fromQ16(q.x), fixedpoint::fromQ16(q.y)};
+            return p;
+        }));
+    rt.push_back(roundTrip("grid_lookup", pts, [&](Point2D p) { return grid.lookup(p); }, fkOf(precise)));
+
+    // --- 3. 輸出 ---
+    printf("kinematics_bench: %zu points (%d x %d, %.3f mm), %d repeats, %s, simd %s\n\n",
+           n, nx, ny, opt.step, opt.repeat, __VERSION__, simdName());
+    printf("  %-8s %-16s %14s %12s\n", "op", "variant", "throughput ns", "latency ns");
+    for (const Timing& t : timing) {
+        printf("  %-8s %-16s %14.2f ", t.op, t.variant, t.throughput_ns);
+        if (t.latency_ns >= 0.0) printf("%12.2f\n", t.latency_ns);
+        else printf("%12s\n", "-");
+    }
+    printf("\n  FK(IK(p)) - p (mm)\n");
+    printf("  %-16s %10s %10s %10s %10s %7s  histogram <1e-6 .. >=1\n", "variant", "max", "rms", "p50", "p99", "unreach");
+    for (const RoundTrip& r : rt) {
+        printf("  %-16s %10.2e %10.2e %10.2e %10.2e %7zu ", r.variant, r.max_mm, r.rms_mm, r.p50_mm, r.p99_mm,
+               r.unreachable);
+        for (int b = 0; b < HIST_BINS; ++b) printf(" %zu", r.hist[b]);
+        printf("\n");
+    }
+
+    if (!writeJson(opt.json_path, opt, n, timing, rt)) return 1;
+    printf("\nwrote %s\n", opt.json_path);
+
+    // 書寫區內任何實作回報無解都視為失敗 (讓腳本 / CI 可以直接判斷)
+    for (const RoundTrip& r : rt)
+        if (r.unreachable) return 1;
+    return 0;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file linear_move_check.cpp
+ * @brief [Host 工具] 笛卡兒路徑插補 (Robot_MoveLinear / MoveArc / MoveBezier) 的路徑偏差，與關節空間點到點比較
+ * @details
+ *  以與 Robot_Loop 相同的控制鏈模擬幾條典型筆畫 (1kHz)，直線另外與關節空間點到點比較：
+ *    cartesian : CartesianMotion -> KinematicFeedforward (IK + J^-1) -> PositionController
+ *    joint     : 終點 IK -> 兩關節各自的 SCurveGenerator -> PositionController (Robot_SetTargetPosition)
+ *  受控體見 joint_sim.hpp (PositionController + 一階延遲速度馬達，--tau 預設 10ms，Ka = tau / 6)，
+ *  末端位置由 FK 計算後交給 StraightnessMeter (與韌體相同的量測)，輸出最大 / RMS 垂直偏差、
+ *  最大追蹤誤差、完成時間與命令點沿路徑的最大速度 (弧長參數化時應等於 --speed)。
+ *  cartesian 的最大偏差超過 --limit (預設 0.1mm)，或沿路徑速度超過 --speed 1% 以上時回傳 1。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc linear_move_check.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/scurve_generator.cpp ../Core/Src/path_interpolator.cpp -o linear_move_check
+ * 使用:
+ *   ./linear_move_check [--speed 100] [--accel 1000] [--tau 0.01] [--limit 0.1]
+ */
+
+#include "arm_geometry.hpp"
+#include "cartesian_motion.hpp"
+#include "joint_sim.hpp"
+#include "motor_params.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+static const float SETTLE_TIME = 0.1f;
+
+struct Options {
+    float speed = 100.0f;
+    float accel = 1000.0f;
+    float tau = 0.01f;
+    float limit = 0.1f;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--speed")) opt->speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--accel")) opt->accel = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tau")) opt->tau = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--limit")) opt->limit = (float)atof(argv[++i]);
+        else return false;
+    }
+    return opt->speed > 0.0f && opt->accel > 0.0f && opt->tau > 0.0f && opt->limit > 0.0f;
+}
+
+struct Result {
+    StraightnessStats stats;
+    float time;       // 插補完成時間 (s)
+    float max_speed;  // 命令點的最大移動速度 (mm/s)
+};
+
+// next(s1, s2, 命令點, 命令點切線) 產生本 tick 的關節設定點，回傳是否仍在插補
+template <typename Setpoints>
+static Result run(const DogArmKinematics& kin, Point2D from, float tau, Setpoints next) {
+    MotorAngles q0 = kin.solveIK(from, 1);
+    Joint j1 = Joint::joint1(tau, DogArmKinematics::rad2deg(q0.theta1));
+    Joint j2 = Joint::joint2(tau, DogArmKinematics::rad2deg(q0.theta2));
+    StraightnessMeter meter;
+
+    Result r = {{}, 0.0f, 0.0f};
+    Point2D commanded = from, tangent = {1.0f, 0.0f};
+    float settle = SETTLE_TIME;
+    for (int k = 0; k < 20000 && settle > 0.0f; ++k) {
+        Point2D p = kin.solveFK(DogArmKinematics::deg2rad(j1.theta), DogArmKinematics::deg2rad(j2.theta));
+        if (k > 0) meter.add(p, commanded, tangent, DT);
+        JointSetpoint s1 = {0.0f, 0.0f, 0.0f}, s2 = {0.0f, 0.0f, 0.0f};
+        Point2D last = commanded;
+        bool moving = next(&s1, &s2, &commanded, &tangent);
+        float v = std::hypot(commanded.x - last.x, commanded.y - last.y) / DT;
+        if (v > r.max_speed) r.max_speed = v;
+        if (moving) r.time = (k + 1) * DT;
+        else settle -= DT;
+        j1.step(s1);
+        j2.step(s2);
+    }
+    r.stats = meter.stats();
+    return r;
+}
+
+static void printRow(const char* name, const char* mode, const Result& r, const char* verdict) {
+    printf("%-11s %-9s | %9.4f %9.4f %9.4f | %7.3f %7.1f %s\n", name, mode, r.stats.max_deviation,
+           r.stats.rms_deviation, r.stats.max_tracking, r.time, r.max_speed, verdict);
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--speed mm/s] [--accel mm/s^2] [--tau s] [--limit mm]\n", argv[0]);
+        return 1;
+    }
+    DogArmKinematics kin;
+
+    struct Stroke {
+        const char* name;
+        PathInterpolator path;
+    };
+    Stroke strokes[9];
+    strokes[0].name = "horizontal";
+    strokes[0].path.beginLine({-50.0f, 150.0f}, {110.0f, 150.0f});
+    strokes[1].name = "vertical";
+    strokes[1].path.beginLine({30.0f, 105.0f}, {30.0f, 195.0f});
+    strokes[2].name = "diagonal";
+    strokes[2].path.beginLine({-40.0f, 110.0f}, {100.0f, 190.0f});
+    strokes[3].name = "short 10mm";
+    strokes[3].path.beginLine({20.0f, 160.0f}, {28.0f, 154.0f});
+    strokes[4].name = "edge";
+    strokes[4].path.beginLine({-60.0f, 200.0f}, {120.0f, 200.0f});
+    strokes[5].name = "circle r40";
+    strokes[5].path.beginArc({70.0f, 150.0f}, {30.0f, 150.0f}, 2.0f * 3.14159265f);
+    strokes[6].name = "arc r10 cw";
+    strokes[6].path.beginArc({10.0f, 170.0f}, {10.0f, 160.0f}, -3.14159265f);
+    strokes[7].name = "bezier S";
+    strokes[7].path.beginBezier({-40.0f, 120.0f}, {40.0f, 120.0f}, {20.0f, 190.0f}, {100.0f, 180.0f});
+    strokes[8].name = "bezier cusp";  // p1 = p0：起點切線由 B'' 決定
+    strokes[8].path.beginBezier({0.0f, 130.0f}, {0.0f, 130.0f}, {60.0f, 190.0f}, {90.0f, 140.0f});
+
+    printf("speed %.0f mm/s, accel %.0f mm/s^2, motor lag %.0f ms\n\n", opt.speed, opt.accel, opt.tau * 1000.0f);
+    printf("%-11s %-9s | %9s %9s %9s | %7s %7s\n", "stroke", "mode", "max_dev", "rms_dev", "max_trk", "t (s)",
+           "v_max");
+    int failures = 0;
+    for (Stroke& st : strokes) {
+        Point2D from = st.path.start(), to = st.path.end();
+
+        // 1. 笛卡兒插補
+        IncrementalIk<DogArmKinematics> ik(kin);
+        KinematicFeedforward<DogArmKinematics> ff(kin, ik);
+        CartesianMotion motion;
+        motion.start(st.path, opt.speed, opt.accel);
+        Result c = run(kin, from, opt.tau, [&](JointSetpoint* s1, JointSetpoint* s2, Point2D* cmd, Point2D* tan) {
+            CartesianState cs;
+            bool moving = motion.step(DT, &cs);
+            ff.update(cs, s1, s2, 1);
+            *cmd = cs.pos;
+            *tan = motion.tangent();
+            return moving;
+        });
+        bool ok = c.stats.max_deviation <= opt.limit && c.max_speed <= opt.speed * 1.01f;
+        if (!ok) failures++;
+        printRow(st.name, "cartesian", c, ok ? "" : "FAIL");
+        if (st.path.type() != PATH_LINE) continue;
+
+        // 2. 關節空間點到點 (兩關節同時出發、各自的 S 曲線)
+        MotorAngles qe = kin.solveIK(to, 1);
+        MotorAngles q0 = kin.solveIK(from, 1);
+        SCurveGenerator g1(JOINT1_MAX_VELOCITY, JOINT1_MAX_ACCEL, 36000.0f), g2(JOINT2_MAX_VELOCITY, JOINT2_MAX_ACCEL, 36000.0f);
+        g1.reset(DogArmKinematics::rad2deg(q0.theta1));
+        g2.reset(DogArmKinematics::rad2deg(q0.theta2));
+        float t1 = DogArmKinematics::rad2deg(qe.theta1), t2 = DogArmKinematics::rad2deg(qe.theta2);
+        Point2D dir = st.path.sample(0.0f).tangent;
+        Result j = run(kin, from, opt.tau, [&](JointSetpoint* s1, JointSetpoint* s2, Point2D* cmd, Point2D* tan) {
+            g1.update(t1, DT);
+            g2.update(t2, DT);
+            *s1 = {g1.getPosition(), g1.getVelocity(), g1.getAcceleration()};
+            *s2 = {g2.getPosition(), g2.getVelocity(), g2.getAcceleration()};
+            // 命令點本身就不在直線上：以它在直線上的投影為量測基準，偏差即為到理想直線的距離
+            Point2D q = kin.solveFK(DogArmKinematics::deg2rad(s1->pos), DogArmKinematics::deg2rad(s2->pos));
+            float along = (q.x - from.x) * dir.x + (q.y - from.y) * dir.y;
+            *cmd = {from.x + dir.x * along, from.y + dir.y * along};
+            *tan = dir;
+            return !(g1.getVelocity() == 0.0f && g2.getVelocity() == 0.0f && g1.getPosition() == t1 &&
+                     g2.getPosition() == t2);
+        });
+        printRow("", "joint", j, "");
+    }
+    return failures ? 1 : 0;
+}
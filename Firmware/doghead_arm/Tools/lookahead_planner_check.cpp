@@ -0,0 +1,236 @@
+/**
+ * @file lookahead_planner_check.cpp
+ * @brief [Host 工具] 轉角圓化前瞻 (Robot_QueueSegments) 的完成時間、圓化量與 jerk
+ * @details
+ *  以與 Robot_Loop 相同的控制鏈模擬幾個多段筆畫 (1kHz)：
+ *    LookaheadPlanner -> KinematicFeedforward (IK + J^-1) -> PositionController -> 一階延遲速度馬達
+ *  規劃器與韌體一樣逐步補入線段 (最多 CAPACITY 段前瞻)。每個筆畫分別以
+ *    δ = 0 (每個轉角都停下，等同點到點) 與 δ = 0.05 / 0.2 / 0.5mm 執行，輸出：
+ *    - 完成時間與相對點到點的加速倍數
+ *    - cmd_dev：命令點到折線的最大距離 (轉角圓化量)，必須 <= δ
+ *    - track：實測末端 (FK) 到命令點的最大距離 (追蹤誤差)；max_dev：實測末端到折線的最大距離
+ *    - 命令速度、加速度大小、加速度變化率 (jerk) 的最大值
+ *  受控體見 joint_sim.hpp (Ka = tau / 6)。目前的結果 (預設參數)：36 邊形 2.3-2.5x、S 曲線 3.2x；
+ *  星形 (144° 轉向)、鋸齒與方形螺旋 (90°) 1.00x —— 這些轉角以 jerk 限制的速度走圓化反而比停下慢，
+ *  規劃器改為停在角點。
+ *  以下任一成立時回傳 1：cmd_dev > δ、track > --limit (預設 0.2mm)、速度 > --speed、
+ *  加速度 > sqrt(2) --accel (圓化上切向與法向各 <= a)、jerk > 2.5J (J = accel / JERK_TIME；切向 <= J，
+ *  另加圓化上的曲率項，以及停在角點時最後一兩個 tick 對齊停止點的加速度跳動)、或比點到點慢。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc lookahead_planner_check.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/path_interpolator.cpp ../Core/Src/lookahead_planner.cpp -o lookahead_planner_check
+ * 使用:
+ *   ./lookahead_planner_check [--speed 100] [--accel 1000] [--tau 0.01] [--limit 0.2]
+ */
+
+#include "arm_geometry.hpp"
+#include "lookahead_planner.hpp"
+#include "joint_sim.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+
+static const float SETTLE_TIME = 0.1f;
+// 命令點偏差的浮點容許 (mm)：float 座標在 150mm 附近的解析度約 1e-5mm
+static const float DEVIATION_TOLERANCE = 1e-4f;
+// 圓化上切向、法向加速度各 <= a，合成 <= sqrt(2) a
+static const float ACCEL_MARGIN = 1.415f;
+// 與韌體相同的 jerk 時間 (J = accel / JERK_TIME)，jerk 容許 JERK_MARGIN × J
+static const float JERK_TIME = 0.05f;
+static const float JERK_MARGIN = 2.5f;
+static const float PI_F = 3.14159265f;
+
+struct Options {
+    float speed = 100.0f;
+    float accel = 1000.0f;
+    float tau = 0.01f;
+    float limit = 0.2f;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--speed")) opt->speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--accel")) opt->accel = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tau")) opt->tau = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--limit")) opt->limit = (float)atof(argv[++i]);
+        else return false;
+    }
+    return opt->speed > 0.0f && opt->accel > 0.0f && opt->tau > 0.0f && opt->limit > 0.0f;
+}
+
+// 點到折線的最短距離
+static float polylineDistance(const std::vector<Point2D>& pts, Point2D p) {
+    float best = 1e9f;
+    for (size_t i = 0; i + 1 < pts.size(); ++i) {
+        Point2D a = pts[i], b = pts[i + 1];
+        float dx = b.x - a.x, dy = b.y - a.y;
+        float l2 = dx * dx + dy * dy;
+        float t = (l2 > 0.0f) ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / l2 : 0.0f;
+        t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+        float ex = p.x - (a.x + t * dx), ey = p.y - (a.y + t * dy);
+        float d = std::sqrt(ex * ex + ey * ey);
+        if (d < best) best = d;
+    }
+    return best;
+}
+
+struct Result {
+    float time;       // 完成時間 (s)
+    float cmd_dev;    // 命令點到折線的最大距離 = 轉角圓化量 (mm)，不得超過 δ
+    float track;      // 實測末端 (FK) 到命令點的最大距離 (mm)
+    float max_dev;    // 實測末端到折線的最大距離 (mm)
+    float max_speed;  // 命令速度最大值 (mm/s)
+    float max_acc;    // 命令加速度大小的最大值 (mm/s²)
+    float max_jerk;   // 命令加速度的最大變化率 (mm/s³)
+};
+
+static Result run(const DogArmKinematics& kin, const std::vector<Point2D>& pts, float deviation,
+                  const Options& opt) {
+    IncrementalIk<DogArmKinematics> ik(kin);
+    KinematicFeedforward<DogArmKinematics> ff(kin, ik);
+    LookaheadPlanner planner(deviation, JERK_TIME);
+    planner.setStart(pts[0]);
+    size_t next = 1;
+
+    MotorAngles q0 = kin.solveIK(pts[0], 1);
+    Joint j1 = Joint::joint1(opt.tau, DogArmKinematics::rad2deg(q0.theta1));
+    Joint j2 = Joint::joint2(opt.tau, DogArmKinematics::rad2deg(q0.theta2));
+
+    Result r = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    Point2D cmd = pts[0];
+    Point2D acc_prev = {0.0f, 0.0f};
+    float settle = SETTLE_TIME;
+    for (int k = 0; k < 120000 && settle > 0.0f; ++k) {
+        Point2D p = kin.solveFK(DogArmKinematics::deg2rad(j1.theta), DogArmKinematics::deg2rad(j2.theta));
+        float d = polylineDistance(pts, p);
+        if (d > r.max_dev) r.max_dev = d;
+        float e = std::hypot(p.x - cmd.x, p.y - cmd.y);
+        if (e > r.track) r.track = e;
+
+        // 與韌體相同：每個 tick 補入線段直到規劃器滿
+        while (next < pts.size() && !planner.full()) planner.append(pts[next++], opt.speed, opt.accel);
+
+        CartesianState cs;
+        bool moving = planner.step(DT, &cs) || next < pts.size();
+        cmd = cs.pos;
+        float c = polylineDistance(pts, cs.pos);
+        if (c > r.cmd_dev) r.cmd_dev = c;
+        float v = std::hypot(cs.vel.x, cs.vel.y);
+        if (v > r.max_speed) r.max_speed = v;
+        float a = std::hypot(cs.acc.x, cs.acc.y);
+        if (a > r.max_acc) r.max_acc = a;
+        float jerk = std::hypot(cs.acc.x - acc_prev.x, cs.acc.y - acc_prev.y) / DT;
+        if (jerk > r.max_jerk) r.max_jerk = jerk;
+        acc_prev = cs.acc;
+        JointSetpoint s1 = {0.0f, 0.0f, 0.0f}, s2 = {0.0f, 0.0f, 0.0f};
+        ff.update(cs, &s1, &s2, 1);
+        if (moving) r.time = (k + 1) * DT;
+        else settle -= DT;
+        j1.step(s1);
+        j2.step(s2);
+    }
+    return r;
+}
+
+// ==========================================================
+// 測試筆畫
+// ==========================================================
+
+// 正多邊形近似的圓 (轉角很鈍，前瞻幾乎不需減速)
+static std::vector<Point2D> polygonCircle(Point2D c, float r, int n) {
+    std::vector<Point2D> pts;
+    for (int i = 0; i <= n; ++i) {
+        float a = 2.0f * PI_F * (float)i / (float)n;
+        pts.push_back({c.x + r * std::cos(a), c.y + r * std::sin(a)});
+    }
+    return pts;
+}
+
+// 五角星 (36° 尖角)
+static std::vector<Point2D> star(Point2D c, float r) {
+    std::vector<Point2D> pts;
+    for (int i = 0; i <= 5; ++i) {
+        float a = PI_F / 2.0f + 4.0f * PI_F / 5.0f * (float)i;
+        pts.push_back({c.x + r * std::cos(a), c.y + r * std::sin(a)});
+    }
+    return pts;
+}
+
+// 三次 Bézier S 形筆畫以 n 段折線近似 (字型輪廓轉成線段的典型情況)
+static std::vector<Point2D> bezierPolyline(Point2D p0, Point2D p1, Point2D p2, Point2D p3, int n) {
+    std::vector<Point2D> pts;
+    for (int i = 0; i <= n; ++i) {
+        float t = (float)i / (float)n, u = 1.0f - t;
+        float b0 = u * u * u, b1 = 3.0f * u * u * t, b2 = 3.0f * u * t * t, b3 = t * t * t;
+        pts.push_back({b0 * p0.x + b1 * p1.x + b2 * p2.x + b3 * p3.x, b0 * p0.y + b1 * p1.y + b2 * p2.y + b3 * p3.y});
+    }
+    return pts;
+}
+
+// 鋸齒 (30 段，90° 轉角)
+static std::vector<Point2D> zigzag(Point2D from, float step, int n) {
+    std::vector<Point2D> pts;
+    for (int i = 0; i <= n; ++i) pts.push_back({from.x + step * (float)i, from.y + ((i & 1) ? step : 0.0f)});
+    return pts;
+}
+
+// 方形螺旋 (段長遞增，90° 轉角)
+static std::vector<Point2D> squareSpiral(Point2D c, int n) {
+    std::vector<Point2D> pts;
+    Point2D p = c;
+    pts.push_back(p);
+    const Point2D dirs[4] = {{1.0f, 0.0f}, {0.0f, 1.0f}, {-1.0f, 0.0f}, {0.0f, -1.0f}};
+    for (int i = 0; i < n; ++i) {
+        float len = 3.0f * (float)(i + 1);
+        p = {p.x + dirs[i & 3].x * len, p.y + dirs[i & 3].y * len};
+        pts.push_back(p);
+    }
+    return pts;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--speed mm/s] [--accel mm/s^2] [--tau s] [--limit mm]\n", argv[0]);
+        return 1;
+    }
+    DogArmKinematics kin;
+
+    struct Stroke {
+        const char* name;
+        std::vector<Point2D> pts;
+    };
+    const Stroke strokes[] = {
+        {"circle 36", polygonCircle({30.0f, 150.0f}, 30.0f, 36)},
+        {"S curve 30", bezierPolyline({-40.0f, 120.0f}, {40.0f, 120.0f}, {20.0f, 190.0f}, {100.0f, 180.0f}, 30)},
+        {"star", star({30.0f, 150.0f}, 40.0f)},
+        {"zigzag 30", zigzag({-45.0f, 140.0f}, 5.0f, 30)},
+        {"spiral 20", squareSpiral({30.0f, 150.0f}, 20)},
+    };
+    const float deviations[] = {0.0f, 0.05f, 0.2f, 0.5f};
+
+    printf("speed %.0f mm/s, accel %.0f mm/s^2, motor lag %.0f ms, look-ahead %u segments\n\n", opt.speed,
+           opt.accel, opt.tau * 1000.0f, (unsigned)LookaheadPlanner::CAPACITY);
+    printf("%-10s %5s %9s | %7s %7s | %7s %7s %7s | %6s %6s %7s\n", "stroke", "segs", "delta(mm)", "t (s)",
+           "speedup", "cmd_dev", "track", "max_dev", "v_max", "a_max", "j_max");
+    int failures = 0;
+    for (const Stroke& st : strokes) {
+        float t_stop = 0.0f;
+        for (float dev : deviations) {
+            Result r = run(kin, st.pts, dev, opt);
+            if (dev == 0.0f) t_stop = r.time;
+            bool ok = r.cmd_dev <= dev + DEVIATION_TOLERANCE && r.track <= opt.limit &&
+                      r.max_speed <= opt.speed * 1.001f && r.max_acc <= opt.accel * ACCEL_MARGIN &&
+                      r.max_jerk <= opt.accel / JERK_TIME * JERK_MARGIN && r.time <= t_stop;
+            if (!ok) failures++;
+            printf("%-10s %5u %9.2f | %7.3f %6.2fx | %7.4f %7.4f %7.4f | %6.1f %6.0f %7.0f %s\n",
+                   dev == 0.0f ? st.name : "", (unsigned)(st.pts.size() - 1), dev, r.time, t_stop / r.time,
+                   r.cmd_dev, r.track, r.max_dev, r.max_speed, r.max_acc, r.max_jerk, ok ? "" : "FAIL");
+        }
+    }
+    return failures ? 1 : 0;
+}
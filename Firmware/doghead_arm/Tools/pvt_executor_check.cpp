@@ -0,0 +1,249 @@
+/**
+ * @file pvt_executor_check.cpp
+ * @brief [Host 工具] PVT 軌跡點 (Robot_PushTrajectory) 的 Hermite 插補誤差、C¹ 連續性與斷流處理
+ * @details
+ *  參考軌跡：CartesianMotion (S 曲線弧長插補) -> KinematicFeedforward，每 1ms 的關節設定點 (θ, ω, α)。
+ *  以 100 / 50 / 20Hz 取樣成 TrajectoryPoint (θ、ω、duration)，經 SpscRingBuffer 逐 tick 補點
+ *  (模擬 CommTask) 交給 PvtInterpolator 重建 1kHz 的設定點，與參考軌跡比較：
+ *    - 插補誤差：關節角最大誤差，與兩組關節角 FK 後的末端距離 (mm)
+ *    - 只有位置 (點間線性插值) 時的末端誤差，作為對照
+ *    - 連續性：相鄰 tick 的速度設定點最大變化 / dt (C¹ 時與參考軌跡的最大加速度同級，速度跳動會使它暴增)
+ *    - 追蹤：joint_sim.hpp 的受控體 (PositionController + 一階延遲馬達) 的末端誤差
+ *    - 頻寬：每秒需要傳送的 bytes
+ *  另外模擬斷流：50Hz 串流送到一半就停止，依 Robot_Loop 的處理由 SCurveGenerator 從當下的狀態
+ *  停到最後一點，檢查加速度不超過 motor_params.h 的上限、最後停在該點且只計一次 underrun。
+ *  任何插補誤差超過 --limit (預設 0.01mm)、速度跳動超過參考的 2 倍或斷流處理失敗時回傳 1。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc pvt_executor_check.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/scurve_generator.cpp ../Core/Src/path_interpolator.cpp -o pvt_executor_check
+ * 使用:
+ *   ./pvt_executor_check [--speed 100] [--accel 1000] [--tau 0.01] [--limit 0.01]
+ */
+
+#include "arm_geometry.hpp"
+#include "cartesian_motion.hpp"
+#include "pvt_interpolator.hpp"
+#include "spsc_ring_buffer.hpp"
+#include "joint_sim.hpp"
+#include "motor_params.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+
+// 與 robot_arm_core.cpp 相同 (速度 / 加速度上限來自 motor_params.h)
+static const float JOINT_MAX_JERK_TIME = 0.05f;
+
+struct Options {
+    float speed = 100.0f;
+    float accel = 1000.0f;
+    float tau = 0.01f;
+    float limit = 0.01f;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--speed")) opt->speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--accel")) opt->accel = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tau")) opt->tau = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--limit")) opt->limit = (float)atof(argv[++i]);
+        else return false;
+    }
+    return opt->speed > 0.0f && opt->accel > 0.0f && opt->tau > 0.0f && opt->limit > 0.0f;
+}
+
+struct Sample {
+    JointSetpoint j1, j2;
+};
+
+// 參考軌跡：[0] 為起點 (靜止)，[k] 為第 k 個 tick 之後的設定點；結尾補靜止點到 pad 的倍數
+static std::vector<Sample> reference(const DogArmKinematics& kin, const PathInterpolator& path, const Options& opt,
+                                     int pad) {
+    IncrementalIk<DogArmKinematics> ik(kin);
+    KinematicFeedforward<DogArmKinematics> ff(kin, ik);
+    CartesianMotion motion;
+    motion.start(path, opt.speed, opt.accel);
+    std::vector<Sample> ref;
+    CartesianState cs = {path.start(), {0.0f, 0.0f}, {0.0f, 0.0f}};
+    Sample warm;
+    ff.update(cs, &warm.j1, &warm.j2, 1);  // 讓增量 IK 先收斂 (冷啟動的封閉解近似約差 0.004 Deg)
+    bool moving = true;
+    while (moving || ref.size() % pad != 1) {
+        Sample s = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+        ff.update(cs, &s.j1, &s.j2, 1);
+        ref.push_back(s);
+        moving = motion.step(DT, &cs);
+    }
+    return ref;
+}
+
+static Point2D fkDeg(const DogArmKinematics& kin, float t1, float t2) {
+    return kin.solveFK(DogArmKinematics::deg2rad(t1), DogArmKinematics::deg2rad(t2));
+}
+
+static float distance(Point2D a, Point2D b) {
+    return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+static TrajectoryPoint waypoint(const Sample& s, int every) {
+    return {s.j1.pos, s.j2.pos, s.j1.vel, s.j2.vel, 0.0f, every * DT};
+}
+
+struct Result {
+    float max_joint_err;  // Deg
+    float max_err;        // 插補後的末端誤差 (mm)
+    float max_linear;     // 線性插值的末端誤差 (mm)
+    float max_dv;         // max |Δω| / dt (Deg/s²)
+    float max_track;      // 受控體末端與參考路徑的最大距離 (mm)
+    uint32_t underruns;
+};
+
+static Result run(const DogArmKinematics& kin, const std::vector<Sample>& ref, int every, const Options& opt) {
+    SpscRingBuffer<TrajectoryPoint, 128> buf;
+    PvtInterpolator pvt;
+    pvt.start(ref[0].j1, ref[0].j2);
+    size_t next = (size_t)every;  // 下一個要送的參考點
+
+    Joint j1 = Joint::joint1(opt.tau, ref[0].j1.pos);
+    Joint j2 = Joint::joint2(opt.tau, ref[0].j2.pos);
+
+    Result r = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0};
+    JointSetpoint s1 = ref[0].j1, s2 = ref[0].j2;
+    for (size_t k = 1; k < ref.size(); ++k) {
+        // CommTask：保持緩衝區有幾個點
+        while (next < ref.size() && buf.size() < 4) {
+            buf.push(waypoint(ref[next], every));
+            next += every;
+        }
+        float v1 = s1.vel, v2 = s2.vel;
+        pvt.step(DT, buf, &s1, &s2);
+
+        const Sample& e = ref[k];
+        float dj = std::fmax(std::fabs(s1.pos - e.j1.pos), std::fabs(s2.pos - e.j2.pos));
+        r.max_joint_err = std::fmax(r.max_joint_err, dj);
+        Point2D p_ref = fkDeg(kin, e.j1.pos, e.j2.pos);
+        r.max_err = std::fmax(r.max_err, distance(fkDeg(kin, s1.pos, s2.pos), p_ref));
+        float dv = std::fmax(std::fabs(s1.vel - v1), std::fabs(s2.vel - v2)) / DT;
+        r.max_dv = std::fmax(r.max_dv, dv);
+
+        // 只有位置的點：線性插值
+        size_t k0 = k / every * every, k1 = k0 + every < ref.size() ? k0 + every : k0;
+        float u = (float)(k - k0) / (float)every;
+        float l1 = ref[k0].j1.pos + u * (ref[k1].j1.pos - ref[k0].j1.pos);
+        float l2 = ref[k0].j2.pos + u * (ref[k1].j2.pos - ref[k0].j2.pos);
+        r.max_linear = std::fmax(r.max_linear, distance(fkDeg(kin, l1, l2), p_ref));
+
+        j1.step(s1);
+        j2.step(s2);
+        r.max_track = std::fmax(r.max_track, distance(fkDeg(kin, j1.theta, j2.theta), p_ref));
+    }
+    r.underruns = buf.underruns();
+    return r;
+}
+
+// 參考軌跡的最大 |Δω| / dt 與直接以 1kHz 設定點驅動時的追蹤誤差
+static Result runReference(const DogArmKinematics& kin, const std::vector<Sample>& ref, const Options& opt) {
+    Joint j1 = Joint::joint1(opt.tau, ref[0].j1.pos);
+    Joint j2 = Joint::joint2(opt.tau, ref[0].j2.pos);
+    Result r = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0};
+    for (size_t k = 1; k < ref.size(); ++k) {
+        float dv = std::fmax(std::fabs(ref[k].j1.vel - ref[k - 1].j1.vel), std::fabs(ref[k].j2.vel - ref[k - 1].j2.vel));
+        r.max_dv = std::fmax(r.max_dv, dv / DT);
+        j1.step(ref[k].j1);
+        j2.step(ref[k].j2);
+        Point2D p_ref = fkDeg(kin, ref[k].j1.pos, ref[k].j2.pos);
+        r.max_track = std::fmax(r.max_track, distance(fkDeg(kin, j1.theta, j2.theta), p_ref));
+    }
+    return r;
+}
+
+// 斷流：只送前半的點，之後由 S 曲線產生器接手 (Robot_Loop 的處理)
+static bool runUnderrun(const std::vector<Sample>& ref, int every) {
+    SpscRingBuffer<TrajectoryPoint, 128> buf;
+    size_t last = ref.size() / 2 / every * every;
+    for (size_t k = every; k <= last; k += every) buf.push(waypoint(ref[k], every));
+
+    SCurveGenerator g1(JOINT1_MAX_VELOCITY, JOINT1_MAX_ACCEL, JOINT1_MAX_ACCEL / JOINT_MAX_JERK_TIME);
+    SCurveGenerator g2(JOINT2_MAX_VELOCITY, JOINT2_MAX_ACCEL, JOINT2_MAX_ACCEL / JOINT_MAX_JERK_TIME);
+    g1.reset(ref[0].j1.pos);
+    g2.reset(ref[0].j2.pos);
+    PvtInterpolator pvt;
+    pvt.start(ref[0].j1, ref[0].j2);
+
+    float max_acc = 0.0f, v_cut = 0.0f, t_stop = 0.0f;
+    bool cut = false;
+    int k_cut = 0;
+    for (int k = 0; k < 5000; ++k) {
+        JointSetpoint s1, s2;
+        if (pvt.active() && pvt.step(DT, buf, &s1, &s2)) {
+            g1.sync(s1.pos, s1.vel, s1.acc);
+            g2.sync(s2.pos, s2.vel, s2.acc);
+        } else {
+            if (!cut) {
+                cut = true;
+                k_cut = k;
+                v_cut = std::fmax(std::fabs(g1.getVelocity()), std::fabs(g2.getVelocity()));
+            }
+            g1.update(pvt.endTheta1(), DT);
+            g2.update(pvt.endTheta2(), DT);
+            max_acc = std::fmax(max_acc, std::fmax(std::fabs(g1.getAcceleration()) / JOINT1_MAX_ACCEL,
+                                                   std::fabs(g2.getAcceleration()) / JOINT2_MAX_ACCEL));
+            if (g1.getVelocity() != 0.0f || g2.getVelocity() != 0.0f) t_stop = (k + 1 - k_cut) * DT;
+        }
+    }
+    float err = std::fmax(std::fabs(g1.getPosition() - pvt.endTheta1()), std::fabs(g2.getPosition() - pvt.endTheta2()));
+    bool ok = cut && buf.underruns() == 1 && max_acc <= 1.001f && err < 1e-3f;
+    printf("underrun at %.0f%%: joint speed %.1f Deg/s -> stop in %.3f s, peak accel %.2f of limit, "
+           "final error %.5f Deg, underruns %u %s\n",
+           100.0f * (float)last / (float)ref.size(), v_cut, t_stop, max_acc, err, (unsigned)buf.underruns(),
+           ok ? "" : "FAIL");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--speed mm/s] [--accel mm/s^2] [--tau s] [--limit mm]\n", argv[0]);
+        return 1;
+    }
+    DogArmKinematics kin;
+
+    struct Stroke {
+        const char* name;
+        PathInterpolator path;
+    };
+    Stroke strokes[3];
+    strokes[0].name = "line";
+    strokes[0].path.beginLine({-50.0f, 120.0f}, {110.0f, 190.0f});
+    strokes[1].name = "circle";
+    strokes[1].path.beginArc({60.0f, 150.0f}, {30.0f, 150.0f}, 2.0f * 3.14159265f);
+    strokes[2].name = "S curve";
+    strokes[2].path.beginBezier({-40.0f, 120.0f}, {40.0f, 120.0f}, {20.0f, 190.0f}, {100.0f, 180.0f});
+    const int rates[] = {100, 50, 20};  // Hz
+
+    printf("speed %.0f mm/s, accel %.0f mm/s^2, motor lag %.0f ms, sizeof(TrajectoryPoint) %zu\n\n", opt.speed,
+           opt.accel, opt.tau * 1000.0f, sizeof(TrajectoryPoint));
+    printf("%-8s %5s %7s | %9s %9s %9s | %10s %9s\n", "stroke", "rate", "B/s", "err(Deg)", "err(mm)", "linear",
+           "max dw/dt", "track");
+    int failures = 0;
+    for (Stroke& st : strokes) {
+        std::vector<Sample> ref = reference(kin, st.path, opt, 1000);
+        Result base = runReference(kin, ref, opt);
+        printf("%-8s %5s %7u | %9s %9s %9s | %10.0f %9.4f\n", st.name, "1kHz",
+               (unsigned)(1000 * sizeof(TrajectoryPoint)), "-", "-", "-", base.max_dv, base.max_track);
+        for (int hz : rates) {
+            Result r = run(kin, ref, 1000 / hz, opt);
+            bool ok = r.max_err <= opt.limit && r.max_dv <= 2.0f * base.max_dv && r.underruns == 0;
+            if (!ok) failures++;
+            printf("%-8s %4dHz %7u | %9.5f %9.5f %9.4f | %10.0f %9.4f %s\n", "", hz,
+                   (unsigned)(hz * sizeof(TrajectoryPoint)), r.max_joint_err, r.max_err, r.max_linear, r.max_dv,
+                   r.max_track, ok ? "" : "FAIL");
+        }
+    }
+    printf("\n");
+    if (!runUnderrun(reference(kin, strokes[2].path, opt, 20), 20)) failures++;
+    return failures ? 1 : 0;
+}
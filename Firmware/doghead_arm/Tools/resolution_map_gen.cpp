@@ -0,0 +1,245 @@
+/**
+ * @file resolution_map_gen.cpp
+ * @brief [Host 工具] 產生編碼器量化解析度地圖 (Core/Src/resolution_map_table.cpp)
+ * @details
+ *  1. 關節量化：qi = 2π / (PPRi * 4 * 減速比i)，數值來自 motor_params.h (與 Motor_System_Config 相同)，
+ *     可用 --ppr1/--gear1/--ppr2/--gear2 覆寫以評估其他馬達 / 減速機
+ *  2. 書寫區 (DogArmWritingArea) 切成 --cell 大小的格子，每格取 (samples+1)^2 個點，
+ *     以 DogArmPreciseKinematics 求 IK 與 J，取最大值：
+ *       resolution  = max(|J e1| q1, |J e2| q2)
+ *       uncertainty = max |J (e1, e2)|, ei ∈ [0, qi]
+ *  3. 蒙地卡羅驗證：隨機點 + 隨機的截斷誤差 (0~1 count)，以非線性 FK 計算實際末端誤差，
+ *     確認沒有超過地圖值 (線性化誤差在 0.1mm 尺度下可忽略)
+ *  4. 終端印出地圖與最佳書寫位置 (20 / 40 / 60mm 方框)
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc resolution_map_gen.cpp ../Core/Src/kinematics.cpp -o resolution_map_gen
+ * 使用:
+ *   ./resolution_map_gen [--cell 5] [--samples 4] [--ppr1 100 --gear1 50 --ppr2 100 --gear2 30]
+ *                        [--out ../Core/Src/resolution_map_table.cpp]
+ */
+
+#include "arm_geometry.hpp"
+#include "motor_params.h"
+#include "resolution_map.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+static const int VERIFY_POINTS = 1000000;
+static const float UNIT_MM = 1e-4f;  // 表格 LSB = 0.1um (uint16 上限約 6.5mm)
+static const double TWO_PI = 6.283185307179586;
+
+struct Options {
+    float cell = 5.0f;
+    int samples = 4;
+    float ppr1 = JOINT1_ENCODER_PPR, gear1 = JOINT1_GEAR_RATIO;
+    float ppr2 = JOINT2_ENCODER_PPR, gear2 = JOINT2_GEAR_RATIO;
+    const char* out_path = "../Core/Src/resolution_map_table.cpp";
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--cell")) opt->cell = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--samples")) opt->samples = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--ppr1")) opt->ppr1 = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--gear1")) opt->gear1 = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--ppr2")) opt->ppr2 = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--gear2")) opt->gear2 = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out")) opt->out_path = argv[++i];
+        else return false;
+    }
+    return opt->cell > 0.0f && opt->samples >= 1 && opt->ppr1 > 0.0f && opt->gear1 > 0.0f &&
+           opt->ppr2 > 0.0f && opt->gear2 > 0.0f;
+}
+
+// 輸出合法的 C++ float 常值 (避免 "-60f" 這種沒有小數點的寫法)
+static const char* floatLiteral(float v, char* buf, size_t len) {
+    snprintf(buf, len, "%.9g", v);
+    if (!strpbrk(buf, ".eEn")) strncat(buf, ".0", len - strlen(buf) - 1);
+    strncat(buf, "f", len - strlen(buf) - 1);
+    return buf;
+}
+
+// 產生時的幾何：DogArmSpec 改變 (arm_calibration.hpp 更新) 而本表沒有重新產生時編譯失敗
+static void writeGeometryCheck(FILE* f) {
+    char l1[32], l2[32], d[32];
+    fprintf(f, "#include \"arm_geometry.hpp\"\n\n");
+    fprintf(f, "// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)\n");
+    fprintf(f, "static_assert(dogArmGeometryMatches(%s, %s, %s),\n", floatLiteral(DogArmSpec::L1, l1, sizeof(l1)),
+            floatLiteral(DogArmSpec::L2, l2, sizeof(l2)), floatLiteral(DogArmSpec::D, d, sizeof(d)));
+    fprintf(f, "              \"resolution_map_table.cpp was generated for another geometry: rerun Tools/resolution_map_gen\");\n\n");
+}
+
+static void writeArray(FILE* f, const char* name, const std::vector<uint16_t>& v, int per_row) {
+    fprintf(f, "static const uint16_t %s[%zu] = {\n", name, v.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        if (i % per_row == 0) fprintf(f, "    ");
+        fprintf(f, "%u,", (unsigned)v[i]);
+        fprintf(f, ((i + 1) % per_row == 0 || i + 1 == v.size()) ? "\n" : " ");
+    }
+    fprintf(f, "};\n\n");
+}
+
+// 單點：回傳 false 表示 IK 無解或 J 無效
+static bool pointMetrics(const DogArmPreciseKinematics& kin, float x, float y, double q1, double q2,
+                         double* resolution, double* uncertainty) {
+    MotorAngles a = kin.solveIK({x, y});
+    if (!a.is_reachable) return false;
+    Jacobian2x2 J = kin.jacobian(a.theta1, a.theta2);
+    if (!J.is_valid) return false;
+    // J 的兩欄 = 單一關節轉動時的末端速度方向
+    double c1x = J.m11 * q1, c1y = J.m21 * q1;
+    double c2x = J.m12 * q2, c2y = J.m22 * q2;
+    double n1 = std::hypot(c1x, c1y), n2 = std::hypot(c2x, c2y);
+    *resolution = std::max(n1, n2);
+    *uncertainty = std::max(std::max(n1, n2), std::hypot(c1x + c2x, c1y + c2y));
+    return true;
+}
+
+static uint16_t toUnits(double mm) {
+    double u = std::ceil(mm / UNIT_MM);  // 無條件進位，保持保守
+    return (uint16_t)std::min(u, 65535.0);
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--cell mm] [--samples n] [--ppr1 p --gear1 g --ppr2 p --gear2 g] [--out file.cpp]\n",
+                argv[0]);
+        return 1;
+    }
+
+    DogArmPreciseKinematics kin;
+    const double q1 = TWO_PI / (opt.ppr1 * ENCODER_COUNTS_PER_PULSE * opt.gear1);
+    const double q2 = TWO_PI / (opt.ppr2 * ENCODER_COUNTS_PER_PULSE * opt.gear2);
+    const float x0 = DogArmWritingArea::X_MIN;
+    const float y0 = DogArmWritingArea::Y_MIN;
+    const int nx = (int)std::ceil((DogArmWritingArea::X_MAX - x0) / opt.cell - 1e-4f);
+    const int ny = (int)std::ceil((DogArmWritingArea::Y_MAX - y0) / opt.cell - 1e-4f);
+    if (nx > 65535 || ny > 65535) {
+        fprintf(stderr, "cell too small\n");
+        return 1;
+    }
+
+    // --- 1. 逐格取樣 ---
+    std::vector<uint16_t> res(nx * ny), unc(nx * ny);
+    int bad_cells = 0;
+    for (int iy = 0; iy < ny; ++iy) {
+        for (int ix = 0; ix < nx; ++ix) {
+            double worst_res = 0.0, worst_unc = 0.0;
+            bool ok = true;
+            for (int sy = 0; sy <= opt.samples && ok; ++sy) {
+                for (int sx = 0; sx <= opt.samples && ok; ++sx) {
+                    float x = x0 + (ix + (float)sx / opt.samples) * opt.cell;
+                    float y = y0 + (iy + (float)sy / opt.samples) * opt.cell;
+                    double r = 0.0, u = 0.0;
+                    ok = pointMetrics(kin, x, y, q1, q2, &r, &u);
+                    worst_res = std::max(worst_res, r);
+                    worst_unc = std::max(worst_unc, u);
+                }
+            }
+            if (!ok) {
+                bad_cells++;
+                worst_res = worst_unc = 65535.0 * UNIT_MM;  // 不可達：標成最差
+            }
+            res[iy * nx + ix] = toUnits(worst_res);
+            unc[iy * nx + ix] = toUnits(worst_unc);
+        }
+    }
+
+    ResolutionMapTable table = {x0, y0, opt.cell, 1.0f / opt.cell, (uint16_t)nx, (uint16_t)ny,
+                                UNIT_MM, res.data(), unc.data()};
+    ResolutionMap map(table);
+
+    // --- 2. 蒙地卡羅驗證 (非線性 FK) ---
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> ux(x0, x0 + nx * opt.cell), uy(y0, y0 + ny * opt.cell);
+    std::uniform_real_distribution<double> u01(0.0, 1.0);
+    int exceed = 0, tested = 0;
+    double worst_ratio = 0.0;
+    for (int i = 0; i < VERIFY_POINTS; ++i) {
+        float x = ux(rng), y = uy(rng);
+        MotorAngles a = kin.solveIK({x, y});
+        if (!a.is_reachable) continue;
+        // 實際角度 = 讀值 + 截斷誤差；讀值 (整數 count) 做 FK 與實際位置比較
+        Point2D p = kin.solveFK((float)(a.theta1 - u01(rng) * q1), (float)(a.theta2 - u01(rng) * q2));
+        double err = std::hypot(p.x - x, p.y - y);
+        double bound = map.uncertaintyAt(x, y);
+        tested++;
+        worst_ratio = std::max(worst_ratio, err / bound);
+        if (err > bound * 1.01) exceed++;  // 1%：float FK 本身的捨入
+    }
+
+    // --- 3. 最佳書寫位置 ---
+    const float boxes[] = {20.0f, 40.0f, 60.0f};
+    Point2D best_origin[3];
+    float best_worst[3];
+    for (int i = 0; i < 3; ++i) map.bestRegion(boxes[i], boxes[i], &best_origin[i], &best_worst[i]);
+
+    // --- 4. 輸出表格原始碼 ---
+    FILE* f = fopen(opt.out_path, "w");
+    if (!f) {
+        perror(opt.out_path);
+        return 1;
+    }
+    uint16_t unc_min = *std::min_element(unc.begin(), unc.end());
+    uint16_t unc_max = *std::max_element(unc.begin(), unc.end());
+    fprintf(f, "/**\n");
+    fprintf(f, " * @file resolution_map_table.cpp\n");
+    fprintf(f, " * @brief [自動產生] 書寫區編碼器量化解析度地圖，請勿手動修改\n");
+    fprintf(f, " * @details 產生器: Tools/resolution_map_gen --cell %.3f --samples %d\n", opt.cell, opt.samples);
+    fprintf(f, " *   幾何 L1=%.3f L2=%.3f D=%.3f mm，書寫區 X[%.1f, %.1f] Y[%.1f, %.1f] mm\n",
+            DogArmSpec::L1, DogArmSpec::L2, DogArmSpec::D, x0, x0 + nx * opt.cell, y0, y0 + ny * opt.cell);
+    fprintf(f, " *   編碼器 關節1 %.0f PPR x4 x %.1f:1 (%.3e rad/count)，關節2 %.0f PPR x4 x %.1f:1 (%.3e rad/count)\n",
+            opt.ppr1, opt.gear1, q1, opt.ppr2, opt.gear2, q2);
+    fprintf(f, " *   %d x %d 格 (%d bytes)，不確定度 %.4f ~ %.4f mm\n", nx, ny, nx * ny * 4,
+            unc_min * UNIT_MM, unc_max * UNIT_MM);
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"resolution_map.hpp\"\n");
+    writeGeometryCheck(f);
+    writeArray(f, "RESOLUTION_MAP_RESOLUTION", res, nx);
+    writeArray(f, "RESOLUTION_MAP_UNCERTAINTY", unc, nx);
+    char b1[32], b2[32];
+    fprintf(f, "const ResolutionMapTable RESOLUTION_MAP_DOGARM = {\n");
+    fprintf(f, "    %s, %s,   // x_min, y_min\n", floatLiteral(x0, b1, sizeof(b1)), floatLiteral(y0, b2, sizeof(b2)));
+    fprintf(f, "    %s, %s,   // cell, inv_cell\n",
+            floatLiteral(opt.cell, b1, sizeof(b1)), floatLiteral(1.0f / opt.cell, b2, sizeof(b2)));
+    fprintf(f, "    %d, %d,   // nx, ny\n", nx, ny);
+    fprintf(f, "    %s,   // unit_mm\n", floatLiteral(UNIT_MM, b1, sizeof(b1)));
+    fprintf(f, "    RESOLUTION_MAP_RESOLUTION,\n");
+    fprintf(f, "    RESOLUTION_MAP_UNCERTAINTY,\n");
+    fprintf(f, "};\n");
+    fclose(f);
+
+    // --- 5. 終端摘要 + 地圖 ---
+    printf("joint quantization: q1 %.3e rad (%.4f deg), q2 %.3e rad (%.4f deg) per count\n",
+           q1, q1 * 360.0 / TWO_PI, q2, q2 * 360.0 / TWO_PI);
+    printf("map %d x %d cells, %.1f mm, %d bytes flash, %d unreachable cells\n", nx, ny, opt.cell, nx * ny * 4,
+           bad_cells);
+    printf("resolution  %.4f ~ %.4f mm/count\n", *std::min_element(res.begin(), res.end()) * UNIT_MM,
+           *std::max_element(res.begin(), res.end()) * UNIT_MM);
+    printf("uncertainty %.4f ~ %.4f mm\n", unc_min * UNIT_MM, unc_max * UNIT_MM);
+    printf("verify (%d random points, nonlinear FK): %d exceed the map, worst error / bound %.3f\n",
+           tested, exceed, worst_ratio);
+    for (int i = 0; i < 3; ++i)
+        printf("best %2.0f mm box: origin (%.1f, %.1f), worst uncertainty %.4f mm\n", boxes[i],
+               best_origin[i].x, best_origin[i].y, best_worst[i]);
+
+    // 每格一個字元：0 = 最好 ... 9 = 最差 (線性分成 10 級)
+    printf("\nuncertainty (top row = Y max;  0 best .. 9 worst)\n");
+    for (int iy = ny - 1; iy >= 0; --iy) {
+        for (int ix = 0; ix < nx; ++ix) {
+            int level = (unc_max > unc_min) ? (int)(9.999 * (unc[iy * nx + ix] - unc_min) / (unc_max - unc_min)) : 0;
+            putchar('0' + level);
+        }
+        putchar('\n');
+    }
+    printf("\nwrote %s\n", opt.out_path);
+    return (exceed || bad_cells) ? 1 : 0;
+}
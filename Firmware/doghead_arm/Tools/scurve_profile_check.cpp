@@ -0,0 +1,158 @@
+/**
+ * @file scurve_profile_check.cpp
+ * @brief [Host 工具] SCurveGenerator 的限制、時間最佳性與中途換目標驗證
+ * @details
+ *  以韌體的關節限制 (robot_arm_core.cpp：V = 360 Deg/s、A = 1800 Deg/s²、J = 36000 Deg/s³) 與 1kHz tick：
+ *    1. 靜止到靜止的點到點移動 (0.05 ~ 720 Deg)：到達時間與 7 段式封閉解的時間最佳值比較、
+ *       過衝量、|v| / |a| / |j| 峰值
+ *    2. 移動中途換目標 (同向延長、反向折返、縮短到已經來不及停的位置) 與中途降速
+ *    3. p / v / a 一致性：v 積分與 p 的差、a 積分與 v 的差
+ *  任何一項超過限制 (容許 0.5%)、沒有收斂或過衝超過 1e-3 Deg 時回傳 1。
+ *  --csv 會把第 2 項的反向折返輪廓 (t, p, v, a, j) 輸出到檔案，方便畫圖。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc scurve_profile_check.cpp ../Core/Src/scurve_generator.cpp -o scurve_profile_check
+ * 使用:
+ *   ./scurve_profile_check [--csv profile.csv]
+ */
+
+#include "scurve_generator.hpp"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+static const float V = 360.0f;
+static const float A = 1800.0f;
+static const float J = 36000.0f;
+static const float DT = 0.001f;
+static const float LIMIT_SLACK = 1.005f;
+static const float OVERSHOOT_TOL = 1e-3f;
+
+// 靜止到靜止的時間最佳 7 段式總時間 (封閉解)
+static double optimalTime(double D, double v, double a, double j) {
+    double t_acc = (v >= a * a / j) ? v / a + a / j : 2.0 * std::sqrt(v / j);
+    if (D >= v * t_acc) return t_acc + D / v;
+    double vp = 0.5 * (-a * a / j + std::sqrt(a * a * a * a / (j * j) + 4.0 * a * D));
+    if (vp >= a * a / j) return 2.0 * (vp / a + a / j);
+    vp = std::cbrt(D * D * j / 4.0);
+    return 4.0 * std::sqrt(vp / j);
+}
+
+struct Stats {
+    int ticks;           // 到達 (狀態對齊到目標) 的 tick 數，-1 表示沒有收斂
+    float v_peak, a_peak, j_peak;
+    float overshoot;     // 超過最終目標的最大量
+    float v_drift, a_drift;  // 一致性：積分誤差
+};
+
+// 跑到收斂；schedule(tick, &target, &vmax) 可以在中途改目標或限速
+template <typename Schedule>
+static Stats simulate(SCurveGenerator& gen, Schedule schedule, int max_ticks, FILE* csv = nullptr) {
+    Stats st = {-1, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    float target = 0.0f, vmax = V;
+    double p_int = gen.getPosition(), v_int = gen.getVelocity();
+    float final_target = 0.0f;
+    for (int k = 0; k < max_ticks; ++k) {
+        schedule(k, &target, &vmax);
+        final_target = target;
+        float v0 = gen.getVelocity(), a0 = gen.getAcceleration();
+        gen.update(target, DT, vmax);
+        // 梯形積分 (含 jerk 修正) 檢查一致性
+        p_int += DT * 0.5 * (v0 + gen.getVelocity()) - DT * DT / 12.0 * (gen.getAcceleration() - a0);
+        v_int += DT * 0.5 * (a0 + gen.getAcceleration());
+        st.v_drift = std::max(st.v_drift, (float)std::fabs(v_int - gen.getVelocity()));
+        st.a_drift = std::max(st.a_drift, (float)std::fabs(p_int - gen.getPosition()));
+        st.v_peak = std::max(st.v_peak, std::fabs(gen.getVelocity()));
+        st.a_peak = std::max(st.a_peak, std::fabs(gen.getAcceleration()));
+        st.j_peak = std::max(st.j_peak, std::fabs(gen.getJerk()));
+        if (csv)
+            fprintf(csv, "%.4f,%.6f,%.4f,%.3f,%.1f\n", (k + 1) * DT, gen.getPosition(), gen.getVelocity(),
+                    gen.getAcceleration(), gen.getJerk());
+        if (gen.getPosition() == target && gen.getVelocity() == 0.0f && gen.getAcceleration() == 0.0f) {
+            st.ticks = k + 1;
+            break;
+        }
+    }
+    (void)final_target;
+    return st;
+}
+
+static bool limitsOk(const Stats& s, float vmax) {
+    return s.v_peak <= vmax * LIMIT_SLACK && s.a_peak <= A * LIMIT_SLACK && s.j_peak <= J * LIMIT_SLACK;
+}
+
+int main(int argc, char** argv) {
+    const char* csv_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--csv") && i + 1 < argc) csv_path = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [--csv file]\n", argv[0]);
+            return 1;
+        }
+    }
+    int failures = 0;
+    SCurveGenerator gen(V, A, J);
+
+    // 1. 點到點
+    printf("limits V %.0f Deg/s  A %.0f Deg/s^2  J %.0f Deg/s^3  dt %.0f ms\n\n", V, A, J, DT * 1000.0f);
+    printf("%9s %9s %9s %7s | %8s %8s %8s %9s | %s\n", "move", "t (s)", "t* (s)", "ratio", "v_peak", "a_peak",
+           "j_peak", "overshoot", "");
+    const float moves[] = {0.05f, 0.5f, 2.0f, 10.0f, 45.0f, 90.0f, 180.0f, 720.0f, -30.0f};
+    for (float D : moves) {
+        gen.reset(10.0f);
+        float goal = 10.0f + D;
+        Stats s = simulate(gen, [&](int, float* t, float* vm) { *t = goal; *vm = V; }, 20000);
+        // 過衝：重新跑一次記錄越過目標的量
+        gen.reset(10.0f);
+        float over = 0.0f;
+        for (int k = 0; k < s.ticks; ++k) {
+            gen.update(goal, DT);
+            over = std::max(over, (D > 0.0f ? 1.0f : -1.0f) * (gen.getPosition() - goal));
+        }
+        double t = s.ticks * DT, topt = optimalTime(std::fabs(D), V, A, J);
+        bool ok = s.ticks > 0 && limitsOk(s, V) && over <= OVERSHOOT_TOL && t <= topt + 3.0 * DT;
+        if (!ok) failures++;
+        printf("%9.2f %9.3f %9.3f %7.3f | %8.1f %8.1f %8.0f %9.2e | %s\n", D, t, topt, t / topt, s.v_peak, s.a_peak,
+               s.j_peak, over, ok ? "ok" : "FAIL");
+    }
+
+    // 2. 中途換目標 / 降速
+    struct Scenario {
+        const char* name;
+        float first, second;
+        int switch_tick;
+        float vmax_after;
+    };
+    const Scenario scenarios[] = {
+        {"extend 90 -> 180 @150ms", 90.0f, 180.0f, 150, V},
+        {"reverse 90 -> -30 @150ms", 90.0f, -30.0f, 150, V},
+        {"shorten 90 -> 20 @200ms", 90.0f, 20.0f, 200, V},
+        {"slow down 180, V/4 @200ms", 180.0f, 180.0f, 200, V * 0.25f},
+    };
+    printf("\n%-28s %9s | %8s %8s %8s | %9s %9s | %s\n", "scenario", "t (s)", "v_peak", "a_peak", "j_peak",
+           "v_drift", "p_drift", "");
+    for (const Scenario& sc : scenarios) {
+        gen.reset(0.0f);
+        FILE* csv = nullptr;
+        if (csv_path && sc.second < 0.0f) {
+            csv = fopen(csv_path, "w");
+            if (csv) fprintf(csv, "t,p,v,a,j\n");
+        }
+        Stats s = simulate(gen,
+                           [&](int k, float* t, float* vm) {
+                               *t = (k < sc.switch_tick) ? sc.first : sc.second;
+                               *vm = (k < sc.switch_tick) ? V : sc.vmax_after;
+                           },
+                           20000, csv);
+        if (csv) fclose(csv);
+        // 降速情境：降速前的峰值以 V 為限，之後由產生器以 jerk 限制減速 (峰值檢查用 V)
+        bool ok = s.ticks > 0 && limitsOk(s, V) && s.v_drift < 0.05f && s.a_drift < 1e-3f;
+        if (!ok) failures++;
+        printf("%-28s %9.3f | %8.1f %8.1f %8.0f | %9.2e %9.2e | %s\n", sc.name, s.ticks * DT, s.v_peak, s.a_peak,
+               s.j_peak, s.v_drift, s.a_drift, ok ? "ok" : "FAIL");
+    }
+
+    printf("\n%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
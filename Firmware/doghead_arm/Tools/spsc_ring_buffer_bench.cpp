@@ -0,0 +1,105 @@
+/**
+ * @file spsc_ring_buffer_bench.cpp
+ * @brief [Host 工具] SpscRingBuffer 的雙執行緒正確性與吞吐量
+ * @details
+ *  生產者執行緒以 push / pushBulk (--bulk 點一批) 送入帶序號的 TrajectoryPoint，
+ *  消費者執行緒以 pop 取出並檢查序號連續、內容未被撕裂 (theta2 = -theta1)；
+ *  被拒絕的點由生產者重送，因此 overrun / underrun 只影響速度不影響資料。
+ *  輸出每點時間、最高水位、overrun / underrun 次數，資料錯誤時回傳 1。
+ *  與韌體相同容量 (128) 與 TrajectoryPoint 定義 (mainpp.h)。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -pthread -I../Core/Inc spsc_ring_buffer_bench.cpp -o spsc_ring_buffer_bench
+ * 使用:
+ *   ./spsc_ring_buffer_bench [--count 2000000] [--bulk 8]
+ */
+
+#include "mainpp.h"
+#include "spsc_ring_buffer.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+struct Options {
+    uint32_t count = 2000000;
+    uint32_t bulk = 8;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--count")) opt->count = (uint32_t)atol(argv[++i]);
+        else if (!strcmp(argv[i], "--bulk")) opt->bulk = (uint32_t)atol(argv[++i]);
+        else return false;
+    }
+    return opt->count >= 1 && opt->bulk >= 1;
+}
+
+static TrajectoryPoint makePoint(uint32_t seq) {
+    float f = (float)(seq & 0xFFFFFF);  // float 可精確表示的範圍
+    return {f, -f, 0.0f, 0.0f, 0.0f, (float)(seq >> 24)};
+}
+
+// 單一 run：bulk == 1 時用 push，否則用 pushBulk
+static int run(uint32_t count, uint32_t bulk) {
+    static SpscRingBuffer<TrajectoryPoint, 128> rb;
+    rb.discard();
+    rb.resetStats();
+    uint32_t errors = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        std::vector<TrajectoryPoint> batch(bulk);
+        uint32_t seq = 0;
+        while (seq < count) {
+            if (bulk == 1) {
+                if (rb.push(makePoint(seq))) seq++;
+                else std::this_thread::yield();
+                continue;
+            }
+            uint32_t n = (count - seq < bulk) ? count - seq : bulk;
+            for (uint32_t i = 0; i < n; ++i) batch[i] = makePoint(seq + i);
+            uint32_t pushed = rb.pushBulk(batch.data(), n);
+            if (pushed == 0) std::this_thread::yield();
+            seq += pushed;
+        }
+    });
+    std::thread consumer([&] {
+        uint32_t seq = 0;
+        TrajectoryPoint p;
+        while (seq < count) {
+            if (!rb.pop(&p)) {
+                std::this_thread::yield();  // 單核主機上讓出 CPU 給生產者
+                continue;
+            }
+            TrajectoryPoint e = makePoint(seq);
+            if (p.theta1 != e.theta1 || p.theta2 != e.theta2 || p.duration != e.duration) errors++;
+            seq++;
+        }
+    });
+    producer.join();
+    consumer.join();
+    auto t1 = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / count;
+    printf("%6u %10u %8.1f %10u %10u %10u %8u\n", bulk, count, ns, rb.highWatermark(), rb.overruns(),
+           rb.underruns(), errors);
+    return (errors || !rb.empty()) ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--count n] [--bulk n]\n", argv[0]);
+        return 1;
+    }
+    printf("capacity 128, sizeof(TrajectoryPoint) %zu\n", sizeof(TrajectoryPoint));
+    printf("%6s %10s %8s %10s %10s %10s %8s\n", "bulk", "points", "ns/pt", "watermark", "overruns", "underruns",
+           "errors");
+    int fail = run(opt.count, 1);
+    if (opt.bulk > 1) fail |= run(opt.count, opt.bulk);
+    return fail;
+}
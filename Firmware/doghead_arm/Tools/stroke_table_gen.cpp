@@ -0,0 +1,366 @@
+/**
+ * @file stroke_table_gen.cpp
+ * @brief [Host 工具] 筆畫編譯器：固定內容 (永字八法、練習字、校正圖形) -> 關節空間定點表
+ *        (Core/Src/stroke_table_data.cpp)
+ * @details
+ *  1. 每個字 / 圖形由數筆組成，每筆是直線 / 圓弧 / 三次 Bézier 的串接 (字框內 0~1 的座標，Y 向上)，
+ *     筆與筆之間加入直線空移 (pen up)
+ *  2. 每一段以韌體相同的 CartesianMotion (S 曲線弧長插補，靜止到靜止) 在 1ms tick 上排時間，
+ *     每個 tick 以 DogArmPreciseKinematics::solveIK (手肘模式 1) 解出關節角，並檢查碰撞模型
+ *  3. 量化為 LSB = 2^-16 Deg 的整數：起點 int32，之後每個 tick 的差分 int16 (超出範圍時報錯)
+ *  4. 以韌體同一份 StrokeTablePlayer 解碼，與原始路徑比較：
+ *       - 解碼角度 FK 後到命令點的最大距離 (mm)
+ *       - 中央差分速度前饋與 J^-1 v 的最大差 (Deg/s)
+ *  5. 輸出 const 陣列 (Flash)，終端印出每個表格的時間、大小與誤差
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc stroke_table_gen.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/scurve_generator.cpp ../Core/Src/path_interpolator.cpp ../Core/Src/collision_checker.cpp \
+ *       -o stroke_table_gen
+ * 使用:
+ *   ./stroke_table_gen [--speed 80] [--accel 800] [--travel-speed 150] [--tol-mm 0.001]
+ *                      [--out ../Core/Src/stroke_table_data.cpp]
+ */
+
+#include "arm_geometry.hpp"
+#include "cartesian_motion.hpp"
+#include "collision_checker.hpp"
+#include "stroke_table.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+static const float DT = 0.001f;
+static const float ANGLE_LSB = 1.0f / 65536.0f;  // Deg (2 的冪次：整數 -> float 精確)
+static const float PI_F = 3.14159265f;
+
+struct Options {
+    float speed = 80.0f;
+    float accel = 800.0f;
+    float travel_speed = 150.0f;
+    float tol_mm = 0.001f;
+    const char* out_path = "../Core/Src/stroke_table_data.cpp";
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--speed")) opt->speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--accel")) opt->accel = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--travel-speed")) opt->travel_speed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--tol-mm")) opt->tol_mm = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out")) opt->out_path = argv[++i];
+        else return false;
+    }
+    return opt->speed > 0.0f && opt->accel > 0.0f && opt->travel_speed > 0.0f && opt->tol_mm > 0.0f;
+}
+
+// ==========================================================
+// 筆畫定義 (字框內的座標 0~1，Y 向上)
+// ==========================================================
+
+struct Primitive {
+    char kind;          // 'L' 直線到 p[0]、'C' Bézier 控制點 p[0] p[1] 終點 p[2]、'A' 繞 p[0] 掃過 sweep_deg
+    Point2D p[3];
+    float sweep_deg;
+};
+
+struct Stroke {
+    Point2D start;
+    std::vector<Primitive> prims;
+};
+
+struct Glyph {
+    const char* name;
+    Point2D origin;  // 字框左下角 (mm)
+    float size;      // 字框邊長 (mm)
+    std::vector<Stroke> strokes;
+};
+
+static Primitive line(float x, float y) { return {'L', {{x, y}, {0, 0}, {0, 0}}, 0.0f}; }
+static Primitive bezier(float x1, float y1, float x2, float y2, float x3, float y3) {
+    return {'C', {{x1, y1}, {x2, y2}, {x3, y3}}, 0.0f};
+}
+static Primitive arc(float cx, float cy, float sweep_deg) { return {'A', {{cx, cy}, {0, 0}, {0, 0}}, sweep_deg}; }
+
+static std::vector<Glyph> repertoire() {
+    std::vector<Glyph> g;
+    // 永：點、橫折鉤、橫撇、撇、捺 (五筆涵蓋側勒努趯策掠啄磔八法)
+    g.push_back({"yong", {0.0f, 112.0f}, 80.0f, {
+        {{0.45f, 0.95f}, {bezier(0.50f, 0.93f, 0.55f, 0.89f, 0.56f, 0.84f)}},
+        {{0.30f, 0.72f}, {line(0.58f, 0.75f), line(0.56f, 0.08f), line(0.47f, 0.15f)}},
+        {{0.22f, 0.55f}, {line(0.42f, 0.57f), bezier(0.35f, 0.42f, 0.25f, 0.30f, 0.12f, 0.22f)}},
+        {{0.82f, 0.66f}, {bezier(0.76f, 0.58f, 0.68f, 0.50f, 0.60f, 0.46f)}},
+        {{0.60f, 0.46f}, {bezier(0.70f, 0.32f, 0.80f, 0.20f, 0.92f, 0.12f)}},
+    }});
+    // 十：橫、豎
+    g.push_back({"shi", {0.0f, 120.0f}, 70.0f, {
+        {{0.10f, 0.55f}, {line(0.90f, 0.57f)}},
+        {{0.50f, 0.92f}, {line(0.50f, 0.05f)}},
+    }});
+    // 口：豎、橫折、橫
+    g.push_back({"kou", {0.0f, 120.0f}, 70.0f, {
+        {{0.20f, 0.80f}, {line(0.22f, 0.15f)}},
+        {{0.20f, 0.80f}, {line(0.80f, 0.82f), line(0.78f, 0.15f)}},
+        {{0.22f, 0.18f}, {line(0.78f, 0.18f)}},
+    }});
+    // 校正圖形：60mm 正方形 (一筆，四個角停下) 與半徑 30mm 的整圓
+    g.push_back({"calib_square", {0.0f, 120.0f}, 60.0f, {
+        {{0.0f, 0.0f}, {line(1.0f, 0.0f), line(1.0f, 1.0f), line(0.0f, 1.0f), line(0.0f, 0.0f)}},
+    }});
+    g.push_back({"calib_circle", {0.0f, 120.0f}, 60.0f, {
+        {{1.0f, 0.5f}, {arc(0.5f, 0.5f, 360.0f)}},
+    }});
+    return g;
+}
+
+// ==========================================================
+// 編譯
+// ==========================================================
+
+struct Sample {
+    Point2D pos;  // 命令點 (mm)
+    Point2D vel;  // mm/s
+};
+
+struct Compiled {
+    std::vector<Sample> path;
+    std::vector<StrokeTableSegment> segments;
+    std::vector<int32_t> q1, q2;   // 量化後的絕對角 (LSB)
+    std::vector<int16_t> deltas;
+    float max_error_mm;
+    float max_vel_error;           // Deg/s
+    int max_delta;
+    uint32_t strokes;
+};
+
+static Point2D toMm(const Glyph& g, Point2D p) { return {g.origin.x + p.x * g.size, g.origin.y + p.y * g.size}; }
+
+// 以 CartesianMotion 走完 path，樣本接在 out 之後 (起點不重複)
+static void sampleMotion(const PathInterpolator& path, float speed, float accel, std::vector<Sample>* out) {
+    CartesianMotion motion;
+    motion.start(path, speed, accel);
+    CartesianState cs;
+    bool moving = true;
+    while (moving) {
+        moving = motion.step(DT, &cs);
+        out->push_back({cs.pos, cs.vel});
+    }
+}
+
+static bool compile(const Glyph& g, const Options& opt, Compiled* c) {
+    DogArmPreciseKinematics kin;
+    CollisionChecker collision(CollisionChecker::fromSpec<DogArmCollisionSpec>(DogArmGeometry::value));
+
+    // --- 1. 路徑樣本 ---
+    Point2D cur = toMm(g, g.strokes[0].start);
+    c->path.assign(1, {cur, {0.0f, 0.0f}});
+    for (const Stroke& st : g.strokes) {
+        Point2D s = toMm(g, st.start);
+        if (std::hypot(s.x - cur.x, s.y - cur.y) > 1e-3f) {
+            c->segments.push_back({(uint32_t)c->path.size() - 1, 0});
+            PathInterpolator travel;
+            travel.beginLine(cur, s);
+            sampleMotion(travel, opt.travel_speed, opt.accel, &c->path);
+            cur = s;
+        }
+        c->segments.push_back({(uint32_t)c->path.size() - 1, 1});
+        for (const Primitive& p : st.prims) {
+            PathInterpolator path;
+            if (p.kind == 'L') {
+                path.beginLine(cur, toMm(g, p.p[0]));
+            } else if (p.kind == 'C') {
+                path.beginBezier(cur, toMm(g, p.p[0]), toMm(g, p.p[1]), toMm(g, p.p[2]));
+            } else if (!path.beginArc(cur, toMm(g, p.p[0]), p.sweep_deg * PI_F / 180.0f)) {
+                fprintf(stderr, "%s: arc starts at its center\n", g.name);
+                return false;
+            }
+            sampleMotion(path, opt.speed, opt.accel, &c->path);
+            cur = path.end();
+        }
+    }
+    c->strokes = (uint32_t)g.strokes.size();
+
+    // --- 2. IK、碰撞檢查與量化 ---
+    const size_t n = c->path.size();
+    c->q1.resize(n);
+    c->q2.resize(n);
+    std::vector<float> t1(n), t2(n);
+    for (size_t k = 0; k < n; ++k) {
+        MotorAngles a = kin.solveIK(c->path[k].pos, 1);
+        LinkagePose pose;
+        if (!a.is_reachable || !kin.solveFKLinkage(a.theta1, a.theta2, &pose) || collision.check(pose) != 0) {
+            fprintf(stderr, "%s: (%.2f, %.2f) is unreachable or collides\n", g.name, c->path[k].pos.x,
+                    c->path[k].pos.y);
+            return false;
+        }
+        t1[k] = DogArmPreciseKinematics::rad2deg(a.theta1);
+        t2[k] = DogArmPreciseKinematics::rad2deg(a.theta2);
+        // 相鄰樣本不跨越 ±180 的切點
+        if (k > 0) {
+            t1[k] += 360.0f * std::round((t1[k - 1] - t1[k]) / 360.0f);
+            t2[k] += 360.0f * std::round((t2[k - 1] - t2[k]) / 360.0f);
+        }
+        c->q1[k] = (int32_t)std::lround(t1[k] / ANGLE_LSB);
+        c->q2[k] = (int32_t)std::lround(t2[k] / ANGLE_LSB);
+    }
+    c->deltas.clear();
+    c->max_delta = 0;
+    for (size_t k = 1; k < n; ++k) {
+        int32_t d1 = c->q1[k] - c->q1[k - 1], d2 = c->q2[k] - c->q2[k - 1];
+        c->max_delta = std::max(c->max_delta, (int)std::max(std::abs(d1), std::abs(d2)));
+        if (std::abs(d1) > 32767 || std::abs(d2) > 32767) {
+            fprintf(stderr, "%s: joint step %.3f Deg/tick exceeds int16; lower --speed\n", g.name,
+                    std::max(std::abs(d1), std::abs(d2)) * ANGLE_LSB);
+            return false;
+        }
+        c->deltas.push_back((int16_t)d1);
+        c->deltas.push_back((int16_t)d2);
+    }
+
+    // --- 3. 以韌體的播放器解碼驗證 ---
+    StrokeTable table = {g.name, DT, ANGLE_LSB, 1, c->q1[0], c->q2[0], (uint32_t)n, c->deltas.data(),
+                         c->segments.data(), (uint32_t)c->segments.size(), 0.0f};
+    StrokeTablePlayer player;
+    player.start(table, 0.0f, 0.0f);
+    c->max_error_mm = 0.0f;
+    c->max_vel_error = 0.0f;
+    JointSetpoint s1, s2;
+    for (size_t k = 1; player.step(&s1, &s2); ++k) {
+        float r1 = DogArmPreciseKinematics::deg2rad(s1.pos), r2 = DogArmPreciseKinematics::deg2rad(s2.pos);
+        Point2D p = kin.solveFK(r1, r2);
+        c->max_error_mm = std::max(c->max_error_mm, std::hypot(p.x - c->path[k].pos.x, p.y - c->path[k].pos.y));
+        JointRates jr = kin.jointRates(DogArmPreciseKinematics::deg2rad(t1[k]), DogArmPreciseKinematics::deg2rad(t2[k]),
+                                       c->path[k].vel, {0.0f, 0.0f});
+        if (jr.is_valid) {
+            float e = std::max(std::fabs(s1.vel - DogArmPreciseKinematics::rad2deg(jr.vel1)),
+                               std::fabs(s2.vel - DogArmPreciseKinematics::rad2deg(jr.vel2)));
+            c->max_vel_error = std::max(c->max_vel_error, e);
+        }
+    }
+    return true;
+}
+
+// ==========================================================
+// 輸出
+// ==========================================================
+
+// 輸出合法的 C++ float 常值 (避免 "-60f" 這種沒有小數點的寫法)
+static const char* floatLiteral(float v, char* buf, size_t len) {
+    snprintf(buf, len, "%.9g", v);
+    if (!strpbrk(buf, ".eEn")) strncat(buf, ".0", len - strlen(buf) - 1);
+    strncat(buf, "f", len - strlen(buf) - 1);
+    return buf;
+}
+
+// 產生時的幾何：DogArmSpec 改變 (arm_calibration.hpp 更新) 而本表沒有重新產生時編譯失敗
+static void writeGeometryCheck(FILE* f) {
+    char l1[32], l2[32], d[32];
+    fprintf(f, "#include \"arm_geometry.hpp\"\n\n");
+    fprintf(f, "// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)\n");
+    fprintf(f, "static_assert(dogArmGeometryMatches(%s, %s, %s),\n", floatLiteral(DogArmSpec::L1, l1, sizeof(l1)),
+            floatLiteral(DogArmSpec::L2, l2, sizeof(l2)), floatLiteral(DogArmSpec::D, d, sizeof(d)));
+    fprintf(f, "              \"stroke_table_data.cpp was generated for another geometry: rerun Tools/stroke_table_gen\");\n\n");
+}
+
+static std::string upper(const char* s) {
+    std::string r(s);
+    for (char& ch : r) ch = (char)toupper((unsigned char)ch);
+    return r;
+}
+
+static size_t tableBytes(const Compiled& c) {
+    return c.deltas.size() * sizeof(int16_t) + c.segments.size() * sizeof(StrokeTableSegment) + sizeof(StrokeTable);
+}
+
+static bool writeSource(const Options& opt, const std::vector<Glyph>& glyphs, const std::vector<Compiled>& tables) {
+    FILE* f = fopen(opt.out_path, "w");
+    if (!f) {
+        perror(opt.out_path);
+        return false;
+    }
+    size_t total = 0;
+    for (const Compiled& c : tables) total += tableBytes(c);
+    fprintf(f, "/**\n");
+    fprintf(f, " * @file stroke_table_data.cpp\n");
+    fprintf(f, " * @brief [自動產生] 離線編譯的關節空間筆畫表，請勿手動修改\n");
+    fprintf(f, " * @details 產生器: Tools/stroke_table_gen --speed %.0f --accel %.0f --travel-speed %.0f\n", opt.speed,
+            opt.accel, opt.travel_speed);
+    fprintf(f, " *   幾何 L1=%.3f L2=%.3f D=%.3f mm，tick %.0f ms，LSB 2^-16 Deg，共 %zu bytes Flash\n",
+            DogArmSpec::L1, DogArmSpec::L2, DogArmSpec::D, DT * 1000.0f, total);
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        const Compiled& c = tables[i];
+        fprintf(f, " *   %-13s %u 筆 %6.3f s %6zu bytes，最大誤差 %.5f mm\n", glyphs[i].name, (unsigned)c.strokes,
+                (c.path.size() - 1) * DT, tableBytes(c), c.max_error_mm);
+    }
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"stroke_table.hpp\"\n");
+    writeGeometryCheck(f);
+
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        const Compiled& c = tables[i];
+        std::string id = "STROKE_" + upper(glyphs[i].name);
+        fprintf(f, "static const int16_t %s_DELTAS[%zu] = {\n", id.c_str(), c.deltas.size());
+        const size_t per_line = 16;
+        for (size_t k = 0; k < c.deltas.size(); ++k) {
+            if (k % per_line == 0) fprintf(f, "    ");
+            fprintf(f, "%d,", c.deltas[k]);
+            fprintf(f, ((k + 1) % per_line == 0 || k + 1 == c.deltas.size()) ? "\n" : " ");
+        }
+        fprintf(f, "};\n\n");
+        fprintf(f, "static const StrokeTableSegment %s_SEGMENTS[%zu] = {\n", id.c_str(), c.segments.size());
+        for (const StrokeTableSegment& s : c.segments) fprintf(f, "    {%u, %u},\n", (unsigned)s.start_tick, s.pen_down);
+        fprintf(f, "};\n\n");
+    }
+
+    char b1[32], b2[32], b3[32];
+    fprintf(f, "const StrokeTable STROKE_TABLES[] = {\n");
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        const Compiled& c = tables[i];
+        std::string id = "STROKE_" + upper(glyphs[i].name);
+        fprintf(f, "    {\"%s\", %s, %s, 1, %d, %d, %zu, %s_DELTAS, %s_SEGMENTS, %zu, %s},\n", glyphs[i].name,
+                floatLiteral(DT, b1, sizeof(b1)), floatLiteral(ANGLE_LSB, b2, sizeof(b2)), c.q1[0], c.q2[0],
+                c.path.size(), id.c_str(), id.c_str(), c.segments.size(),
+                floatLiteral(c.max_error_mm, b3, sizeof(b3)));
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "const uint32_t STROKE_TABLE_COUNT = sizeof(STROKE_TABLES) / sizeof(STROKE_TABLES[0]);\n");
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr,
+                "usage: %s [--speed mm/s] [--accel mm/s^2] [--travel-speed mm/s] [--tol-mm mm] [--out file.cpp]\n",
+                argv[0]);
+        return 1;
+    }
+
+    std::vector<Glyph> glyphs = repertoire();
+    std::vector<Compiled> tables(glyphs.size());
+    printf("%-13s %6s %5s %8s %8s %9s | %10s %12s\n", "table", "strokes", "segs", "time(s)", "bytes", "max|d|",
+           "err(mm)", "vel err(D/s)");
+    bool ok = true;
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        Compiled& c = tables[i];
+        if (!compile(glyphs[i], opt, &c)) return 1;
+        bool pass = c.max_error_mm <= opt.tol_mm;
+        if (!pass) ok = false;
+        printf("%-13s %6u %5zu %8.3f %8zu %9d | %10.6f %12.4f %s\n", glyphs[i].name, (unsigned)c.strokes,
+               c.segments.size(), (c.path.size() - 1) * DT, tableBytes(c), c.max_delta, c.max_error_mm,
+               c.max_vel_error, pass ? "" : "FAIL");
+    }
+    if (!ok) {
+        fprintf(stderr, "decoded error exceeds --tol-mm %.4f, table not written\n", opt.tol_mm);
+        return 1;
+    }
+    if (!writeSource(opt, glyphs, tables)) return 1;
+    printf("\nwrote %s\n", opt.out_path);
+    return 0;
+}
@@ -0,0 +1,497 @@
+/**
+ * @file topp_retime.cpp
+ * @brief [Host 工具] 筆畫路徑的時間最佳參數化 (TOPP，關節速度 / 加速度限制)
+ * @details
+ *  五連桿的 J^-1 隨位置變化很大：固定的笛卡兒進給率在中央太慢、在邊緣讓 max_rpm 飽和。
+ *  本工具把每個筆畫的幾何路徑 (直線 / 圓弧 / 三次 Bézier，PathInterpolator 與韌體相同) 重新計時，
+ *  在每個關節的速度 / 加速度上限內走最快：
+ *    1. 以弧長 s 等距取樣 (--ds，預設 0.5mm)，每點 IK 得 q(s)，中央差分得 q'(s)、q''(s)
+ *    2. 相平面 (s, x = ṡ²)：q̇ = q' ṡ、q̈ = q' s̈ + q'' x，每個關節
+ *         |q' ṡ| <= V        ->  x <= (V / |q'|)²
+ *         |q' u + q'' x| <= A ->  u (= s̈) 的上下界皆為 x 的一次函數
+ *       最大速度曲線 (MVC) = 速度上限、--feed 上限與「上下界交叉」處的最小值
+ *    3. 可達性 (reachability) 兩次掃描，區間內 u 為常數 (x_{i+1} = x_i + 2 u Δs)：
+ *         反向：從終點 x = 0 往回，x_i 取「以最大煞車仍能到達 x_{i+1}」的上界 (下界為 x 的一次函數，封閉解)
+ *         正向：從起點 x = 0 往前，x_{i+1} = min(反向上界, x_i + 2 u_max(x_i) Δs)
+ *       結果在取樣點上滿足所有限制，時間 Δt = 2Δs / (√x_i + √x_{i+1})
+ *  筆畫之間 (抬筆) 各自從靜止開始、停在終點；筆畫內的轉角 (基元交界的切線不連續、Bézier 尖點) 由 q'' 的
+ *  尖峰自然限速，相當於以半徑 ~Δs 的圓角通過 (速度約 sqrt(A Δs / |Δq'|))，--ds 越小轉角越慢。
+ *
+ *  關節限制：速度 = min(JOINTn_MAX_VELOCITY (控制迴圈的上限)，MotorConfig_t 的 max_rpm × --margin / 減速比)
+ *  (motor_params.h 的 JOINTn_MAX_RPM / JOINTn_GEAR_RATIO，預設 margin 0.5 保留 PID 修正的餘量)，
+ *  加速度 = JOINTn_MAX_ACCEL (與控制迴圈的 S 曲線產生器相同)，皆為輸出軸 Deg/s、Deg/s²。
+ *
+ *  --feed (預設 500mm/s) 為筆尖速度上限。輸出：筆畫數、總長、TOPP 總時間，與固定笛卡兒限制比較：
+ *    - 固定 --feed 時路徑上超過關節速度上限的比例 (會讓 max_rpm 飽和)
+ *    - 整頁單一的笛卡兒速度 / 加速度上限 (依最不利位置的 |q'| 決定，全頁都不飽和) 以同樣的掃描計時
+ *  以及規劃耗時 (一整頁要 < 1s)。重新計時後在每個取樣點驗證 |q̇| / |q̈|，超過 0.1% 時回傳 1。
+ *  --out 以 --dt (預設 10ms) 輸出 PVT 點 (筆畫, t, x, y, θ1, θ2, ω1, ω2)，可直接轉成 TrajectoryPoint 串流。
+ *
+ *  筆畫檔 (沒有 --in 時使用內建的隨機整頁：--rows × --cols 個 --cell (預設 10mm) 字格，每格 6~12 筆直線 / 圓弧 / Bézier)：
+ *    # 註解
+ *    M x y                      新筆畫起點 (mm)
+ *    L x y                      直線
+ *    A cx cy sweep_deg          圓弧 (圓心、掃掠角，逆時針為正)
+ *    C x1 y1 x2 y2 x3 y3        三次 Bézier (控制點、終點)
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc topp_retime.cpp ../Core/Src/kinematics.cpp \
+ *       ../Core/Src/path_interpolator.cpp -o topp_retime
+ * 使用:
+ *   ./topp_retime [--in strokes.txt] [--out pvt.csv] [--dt 0.01] [--ds 0.5] [--feed 500] [--margin 0.5]
+ *                 [--cell 10] [--rows 10] [--cols 18] [--seed 1]
+ */
+
+#include "arm_geometry.hpp"
+#include "motor_params.h"
+#include "path_interpolator.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <algorithm>
+
+static const float PI_F = 3.14159265f;
+static const float RAD2DEG = 57.2957795f;
+static const float LIMIT_SLACK = 1.001f;
+
+struct Options {
+    const char* in = nullptr;
+    const char* out = nullptr;
+    float dt = 0.01f;
+    float ds = 0.5f;
+    float feed = 500.0f;
+    float margin = 0.5f;
+    float cell = 10.0f;  // 內建頁面的字格大小 (mm)
+    int rows = 10;
+    int cols = 18;
+    unsigned seed = 1;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--in")) opt->in = argv[++i];
+        else if (!strcmp(argv[i], "--out")) opt->out = argv[++i];
+        else if (!strcmp(argv[i], "--dt")) opt->dt = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--ds")) opt->ds = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--feed")) opt->feed = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--margin")) opt->margin = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--cell")) opt->cell = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--rows")) opt->rows = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--cols")) opt->cols = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seed")) opt->seed = (unsigned)atoi(argv[++i]);
+        else return false;
+    }
+    return opt->dt > 0.0f && opt->ds > 0.0f && opt->feed > 0.0f && opt->margin > 0.0f && opt->cell > 0.0f &&
+           opt->rows > 0 && opt->cols > 0 && opt->cell * (float)opt->cols <= DogArmWritingArea::X_MAX - DogArmWritingArea::X_MIN &&
+           opt->cell * (float)opt->rows <= DogArmWritingArea::Y_MAX - DogArmWritingArea::Y_MIN;
+}
+
+struct JointLimits {
+    float v[2];  // Deg/s
+    float a[2];  // Deg/s²
+};
+
+// motor_params.h (MotorConfig_t 的數值來源)：馬達 RPM / 減速比 -> 輸出軸 Deg/s，不超過控制迴圈的速度上限
+static JointLimits limitsFromMotorParams(float margin) {
+    JointLimits lim;
+    lim.v[0] = std::min(JOINT1_MAX_VELOCITY, (float)JOINT1_MAX_RPM * margin / JOINT1_GEAR_RATIO * 6.0f);
+    lim.v[1] = std::min(JOINT2_MAX_VELOCITY, (float)JOINT2_MAX_RPM * margin / JOINT2_GEAR_RATIO * 6.0f);
+    lim.a[0] = JOINT1_MAX_ACCEL;
+    lim.a[1] = JOINT2_MAX_ACCEL;
+    return lim;
+}
+
+typedef std::vector<PathInterpolator> Stroke;
+
+// ==========================================================
+// 筆畫來源
+// ==========================================================
+
+static bool loadStrokes(const char* path, std::vector<Stroke>* strokes) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    char line[256];
+    Point2D cur = {0.0f, 0.0f};
+    int lineno = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f)) {
+        lineno++;
+        float v[6];
+        char cmd = 0;
+        if (sscanf(line, " %c", &cmd) != 1 || cmd == '#') continue;
+        PathInterpolator p;
+        if (cmd == 'M' && sscanf(line, " M %f %f", &v[0], &v[1]) == 2) {
+            cur = {v[0], v[1]};
+            strokes->push_back(Stroke());
+            continue;
+        } else if (strokes->empty()) {
+            ok = false;
+        } else if (cmd == 'L' && sscanf(line, " L %f %f", &v[0], &v[1]) == 2) {
+            p.beginLine(cur, {v[0], v[1]});
+        } else if (cmd == 'A' && sscanf(line, " A %f %f %f", &v[0], &v[1], &v[2]) == 3) {
+            ok = p.beginArc(cur, {v[0], v[1]}, v[2] / RAD2DEG);
+        } else if (cmd == 'C' && sscanf(line, " C %f %f %f %f %f %f", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) == 6) {
+            p.beginBezier(cur, {v[0], v[1]}, {v[2], v[3]}, {v[4], v[5]});
+        } else {
+            ok = false;
+        }
+        if (ok && p.length() > 0.0f) {
+            strokes->back().push_back(p);
+            cur = p.end();
+        }
+    }
+    fclose(f);
+    if (!ok) fprintf(stderr, "%s:%d: bad stroke command\n", path, lineno);
+    return ok;
+}
+
+// 內建整頁：書寫區左上角起 rows × cols 個字格，每格 6~12 筆：
+// 直線 (40%)、圓弧 (20%)、1~3 段切線連續的 Bézier (40%，筆畫骨架的典型形狀)，全部留在字格內
+static void generatePage(const Options& opt, std::vector<Stroke>* strokes) {
+    std::mt19937 rng(opt.seed);
+    std::uniform_real_distribution<float> u01(0.0f, 1.0f);
+    const float cell = opt.cell;
+    for (int r = 0; r < opt.rows; ++r) {
+        for (int c = 0; c < opt.cols; ++c) {
+            float x0 = DogArmWritingArea::X_MIN + cell * (float)c;
+            float y0 = DogArmWritingArea::Y_MAX - cell * (float)(r + 1);
+            auto inCell = [&](Point2D p) {
+                return Point2D{std::min(std::max(p.x, x0 + 0.1f * cell), x0 + 0.9f * cell),
+                               std::min(std::max(p.y, y0 + 0.1f * cell), y0 + 0.9f * cell)};
+            };
+            auto pick = [&]() { return inCell({x0 + cell * u01(rng), y0 + cell * u01(rng)}); };
+            int n = 6 + (int)(u01(rng) * 7.0f);
+            for (int k = 0; k < n; ++k) {
+                Stroke st;
+                PathInterpolator p;
+                float kind = u01(rng);
+                if (kind < 0.4f) {
+                    p.beginLine(pick(), pick());
+                    st.push_back(p);
+                } else if (kind < 0.6f) {
+                    // 圓心在字格中央、半徑 0.15 ~ 0.4 格
+                    Point2D ctr = {x0 + 0.5f * cell, y0 + 0.5f * cell};
+                    float radius = cell * (0.15f + 0.25f * u01(rng)), a = 2.0f * PI_F * u01(rng);
+                    p.beginArc({ctr.x + radius * std::cos(a), ctr.y + radius * std::sin(a)}, ctr,
+                               (u01(rng) - 0.5f) * 3.0f * PI_F);
+                    st.push_back(p);
+                } else {
+                    // 下一段的第一個控制點取上一段 p2 對端點的鏡射 (切線連續)
+                    Point2D p0 = pick(), p1 = pick();
+                    int segs = 1 + (int)(u01(rng) * 3.0f);
+                    for (int m = 0; m < segs; ++m) {
+                        Point2D p2 = pick(), p3 = pick();
+                        p.beginBezier(p0, p1, p2, p3);
+                        st.push_back(p);
+                        p1 = inCell({2.0f * p3.x - p2.x, 2.0f * p3.y - p2.y});
+                        p0 = p3;
+                    }
+                }
+                strokes->push_back(st);
+            }
+        }
+    }
+}
+
+// ==========================================================
+// TOPP
+// ==========================================================
+
+struct Sample {
+    float s;
+    Point2D pos;
+    float q[2];    // Deg
+    float dq[2];   // Deg/mm
+    float ddq[2];  // Deg/mm²
+    float x;       // ṡ² (mm²/s²)
+    double t;      // s
+    bool rest;     // 區間 i -> i+1 以靜止到靜止 (先加速後減速) 走完
+};
+
+struct StrokeTiming {
+    std::vector<Sample> samples;
+    float length;
+    float delta;     // 取樣間距 Δs
+    double time;
+    bool reachable;
+};
+
+// u = s̈ 的上下界 (x 的一次函數 lo_a + lo_b x <= u <= hi_a + hi_b x)，與純速度上限 (|q'| ≈ 0 的關節)
+struct AccelBounds {
+    float lo_a[2], lo_b[2], hi_a[2], hi_b[2];
+    bool active[2];
+    float x_cap;
+};
+
+// dq_floor > 0：|q'| 至少取整頁的最大值 (固定笛卡兒速度 / 加速度的比較基準)
+static float effectiveDq(float dq, float dq_floor) {
+    if (std::fabs(dq) >= dq_floor) return dq;
+    return (dq < 0.0f) ? -dq_floor : dq_floor;
+}
+
+static AccelBounds accelBounds(const Sample& p, const JointLimits& lim, const float dq_floor[2]) {
+    AccelBounds b;
+    b.x_cap = 1e12f;
+    for (int j = 0; j < 2; ++j) {
+        float dq = effectiveDq(p.dq[j], dq_floor[j]), ddq = p.ddq[j], A = lim.a[j];
+        b.active[j] = std::fabs(dq) > 1e-6f;
+        if (!b.active[j]) {
+            // q' ≈ 0：q̈ = q'' x，只限制 x
+            if (std::fabs(ddq) > 0.0f) b.x_cap = std::min(b.x_cap, A / std::fabs(ddq));
+            b.lo_a[j] = b.lo_b[j] = b.hi_a[j] = b.hi_b[j] = 0.0f;
+            continue;
+        }
+        float inv = 1.0f / dq;
+        float a1 = -A * inv, a2 = A * inv;  // 對應 q̈ = -A / +A
+        b.lo_a[j] = std::min(a1, a2);
+        b.hi_a[j] = std::max(a1, a2);
+        b.lo_b[j] = b.hi_b[j] = -ddq * inv;
+    }
+    return b;
+}
+
+static float uMax(const AccelBounds& b, float x) {
+    float u = 1e12f;
+    for (int j = 0; j < 2; ++j)
+        if (b.active[j]) u = std::min(u, b.hi_a[j] + b.hi_b[j] * x);
+    return u;
+}
+
+// 1. 弧長等距取樣 + IK + 差分
+static void sampleStroke(const Stroke& stroke, const DogArmKinematics& kin, const Options& opt, StrokeTiming* out) {
+    float L = 0.0f;
+    for (const PathInterpolator& p : stroke) L += p.length();
+    int n = std::max(2, (int)std::ceil(L / opt.ds));
+    float delta = L / (float)n;
+    out->length = L;
+    out->delta = delta;
+    out->reachable = true;
+    std::vector<Sample>& S = out->samples;
+    S.assign(n + 1, Sample());
+
+    Stroke prims = stroke;  // sample() 會移動游標
+    size_t k = 0;
+    float base = 0.0f;
+    for (int i = 0; i <= n; ++i) {
+        float s = delta * (float)i;
+        while (k + 1 < prims.size() && s > base + prims[k].length()) base += prims[k++].length();
+        S[i].s = s;
+        S[i].pos = prims[k].sample(s - base).pos;
+        MotorAngles q = kin.solveIK(S[i].pos, 1);
+        if (!q.is_reachable) out->reachable = false;
+        S[i].q[0] = q.theta1 * RAD2DEG;
+        S[i].q[1] = q.theta2 * RAD2DEG;
+    }
+    for (int i = 0; i <= n; ++i) {
+        int a = std::max(i - 1, 0), b = std::min(i + 1, n);
+        for (int j = 0; j < 2; ++j) {
+            S[i].dq[j] = (S[b].q[j] - S[a].q[j]) / (delta * (float)(b - a));
+            S[i].ddq[j] = (i > 0 && i < n) ? (S[b].q[j] - 2.0f * S[i].q[j] + S[a].q[j]) / (delta * delta) : 0.0f;
+        }
+    }
+    if (n >= 2) {
+        for (int j = 0; j < 2; ++j) {
+            S[0].ddq[j] = S[1].ddq[j];
+            S[n].ddq[j] = S[n - 1].ddq[j];
+        }
+    }
+}
+
+// 2, 3. 最大速度曲線 + 反向 / 正向掃描，結果寫回 samples 的 x、t
+static void timeStroke(const JointLimits& lim, const Options& opt, const float dq_floor[2], StrokeTiming* out) {
+    std::vector<Sample>& S = out->samples;
+    const int n = (int)S.size() - 1;
+    const float delta = out->delta;
+    std::vector<AccelBounds> B(n + 1);
+    std::vector<float> cap(n + 1);
+    for (int i = 0; i <= n; ++i) {
+        B[i] = accelBounds(S[i], lim, dq_floor);
+        float c = std::min(opt.feed * opt.feed, B[i].x_cap);
+        for (int j = 0; j < 2; ++j) {
+            float adq = std::fabs(effectiveDq(S[i].dq[j], dq_floor[j]));
+            if (adq > 1e-6f) c = std::min(c, (lim.v[j] / adq) * (lim.v[j] / adq));
+        }
+        // 不同關節的上下界交叉：lo_j(x) <= hi_m(x)
+        for (int j = 0; j < 2; ++j)
+            for (int m = 0; m < 2; ++m) {
+                if (j == m || !B[i].active[j] || !B[i].active[m]) continue;
+                float slope = B[i].lo_b[j] - B[i].hi_b[m];
+                if (slope > 0.0f) c = std::min(c, (B[i].hi_a[m] - B[i].lo_a[j]) / slope);
+            }
+        // 離散化：以最大加速走完這個區間後 x 不可為負 (轉角處 q'' 的尖峰讓 u 的上界為負)
+        for (int j = 0; j < 2; ++j) {
+            float slope = 1.0f + 2.0f * delta * B[i].hi_b[j];
+            if (B[i].active[j] && slope < 0.0f) c = std::min(c, 2.0f * delta * B[i].hi_a[j] / -slope);
+        }
+        cap[i] = std::max(c, 0.0f);
+    }
+
+    // 3. 反向：x_i + 2Δ lo(x_i) <= x_{i+1}，lo 為各關節下界的最大值 (每個都是一次函數；
+    //    係數 1 + 2Δ lo_b <= 0 時左邊恆為負，不構成限制)
+    std::vector<float> bw(n + 1);
+    bw[n] = 0.0f;
+    for (int i = n - 1; i >= 0; --i) {
+        float x = cap[i];
+        for (int j = 0; j < 2; ++j) {
+            if (!B[i].active[j]) continue;
+            float denom = 1.0f + 2.0f * delta * B[i].lo_b[j];
+            if (denom > 1e-6f) x = std::min(x, (bw[i + 1] - 2.0f * delta * B[i].lo_a[j]) / denom);
+        }
+        bw[i] = std::max(x, 0.0f);
+    }
+    // 正向
+    S[0].x = 0.0f;
+    S[0].t = 0.0;
+    for (int i = 0; i < n; ++i) {
+        float x = std::min(bw[i + 1], S[i].x + 2.0f * delta * uMax(B[i], S[i].x));
+        S[i + 1].x = std::max(x, 0.0f);
+        // 兩端都幾乎靜止的區間 (轉角緊接著終點時) 以 u 常數計算的時間趨近無限大，
+        // 改成靜止到靜止：以 x = 0 時的加速度上限先加速、後減速
+        double v_sum = std::sqrt((double)S[i].x) + std::sqrt((double)S[i + 1].x);
+        double dt = (v_sum > 0.0) ? 2.0 * delta / v_sum : 1e30;
+        double u_rest = uMax(B[i], 0.0f);
+        double dt_rest = (u_rest > 0.0 && u_rest < 1e12) ? 2.0 * std::sqrt(delta / u_rest) : 1e30;
+        S[i].rest = dt_rest < dt;
+        S[i + 1].t = S[i].t + std::min(dt, dt_rest);
+    }
+    S[n].rest = false;
+    out->time = S[n].t;
+}
+
+// 重新計時後的關節速度 / 加速度峰值與限制的比值 (取樣點，區間 i 的 u 為常數)
+static float limitRatio(const StrokeTiming& st, const JointLimits& lim) {
+    float worst = 0.0f;
+    const std::vector<Sample>& S = st.samples;
+    for (size_t i = 0; i + 1 < S.size(); ++i) {
+        float u = (S[i + 1].x - S[i].x) / (2.0f * st.delta);
+        float v = std::sqrt(S[i].x);
+        for (int j = 0; j < 2; ++j) {
+            worst = std::max(worst, std::fabs(S[i].dq[j] * v) / lim.v[j]);
+            worst = std::max(worst, std::fabs(S[i].dq[j] * u + S[i].ddq[j] * S[i].x) / lim.a[j]);
+        }
+    }
+    return worst;
+}
+
+// 以固定時間間隔輸出 PVT (區間內 s = s_i + ṡ_i τ + u τ² / 2，q 線性內插)
+static void writePvt(FILE* f, int index, const StrokeTiming& st, float dt) {
+    const std::vector<Sample>& S = st.samples;
+    size_t i = 0;
+    for (double t = 0.0;; t += dt) {
+        bool last = t >= S.back().t;
+        if (last) t = S.back().t;
+        while (i + 2 < S.size() && S[i + 1].t <= t) ++i;
+        const Sample& a = S[i];
+        const Sample& b = S[i + 1];
+        float tau = (float)(t - a.t);
+        float ds, sdot;
+        if (a.rest) {
+            float T = (float)(b.t - a.t), u = 4.0f * st.delta / (T * T), rem = std::max(T - tau, 0.0f);
+            ds = (tau < 0.5f * T) ? 0.5f * u * tau * tau : st.delta - 0.5f * u * rem * rem;
+            sdot = (tau < 0.5f * T) ? u * tau : u * rem;
+        } else {
+            float u = (b.x - a.x) / (2.0f * st.delta);
+            ds = std::min(std::max(std::sqrt(a.x) * tau + 0.5f * u * tau * tau, 0.0f), st.delta);
+            sdot = std::sqrt(std::max(a.x + 2.0f * u * ds, 0.0f));
+        }
+        float r = ds / st.delta;
+        float x = a.pos.x + r * (b.pos.x - a.pos.x), y = a.pos.y + r * (b.pos.y - a.pos.y);
+        float q1 = a.q[0] + r * (b.q[0] - a.q[0]), q2 = a.q[1] + r * (b.q[1] - a.q[1]);
+        float w1 = (a.dq[0] + r * (b.dq[0] - a.dq[0])) * sdot, w2 = (a.dq[1] + r * (b.dq[1] - a.dq[1])) * sdot;
+        fprintf(f, "%d,%.4f,%.4f,%.4f,%.5f,%.5f,%.3f,%.3f\n", index, t, x, y, q1, q2, w1, w2);
+        if (last) break;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr,
+                "usage: %s [--in strokes.txt] [--out pvt.csv] [--dt s] [--ds mm] [--feed mm/s] [--margin 0~1]\n"
+                "          [--cell mm] [--rows n] [--cols n] [--seed n]\n",
+                argv[0]);
+        return 1;
+    }
+    DogArmKinematics kin;
+    JointLimits lim = limitsFromMotorParams(opt.margin);
+
+    std::vector<Stroke> strokes;
+    if (opt.in) {
+        if (!loadStrokes(opt.in, &strokes)) return 1;
+    } else {
+        generatePage(opt, &strokes);
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    const float no_floor[2] = {0.0f, 0.0f};
+    std::vector<StrokeTiming> timing(strokes.size());
+    for (size_t i = 0; i < strokes.size(); ++i) {
+        sampleStroke(strokes[i], kin, opt, &timing[i]);
+        timeStroke(lim, opt, no_floor, &timing[i]);
+    }
+    double plan_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    // 統計；固定進給率在路徑上需要的關節速度
+    double total_len = 0.0, total_time = 0.0, saturated_len = 0.0;
+    float worst = 0.0f, dq_max[2] = {0.0f, 0.0f};
+    size_t samples = 0;
+    int unreachable = 0;
+    for (const StrokeTiming& st : timing) {
+        if (!st.reachable) unreachable++;
+        total_len += st.length;
+        total_time += st.time;
+        samples += st.samples.size();
+        worst = std::max(worst, limitRatio(st, lim));
+        for (size_t i = 0; i + 1 < st.samples.size(); ++i) {
+            const Sample& p = st.samples[i];
+            float need = 0.0f;  // 每 mm/s 進給率需要的關節速度 / 上限
+            for (int j = 0; j < 2; ++j) {
+                need = std::max(need, std::fabs(p.dq[j]) / lim.v[j]);
+                dq_max[j] = std::max(dq_max[j], std::fabs(p.dq[j]));
+            }
+            if (need * opt.feed > 1.0f) saturated_len += st.delta;
+        }
+    }
+
+    // 比較基準：整頁單一的笛卡兒速度 / 加速度上限，依最不利的位置 (最大 |q'|) 決定
+    double uniform_time = 0.0;
+    for (const StrokeTiming& st : timing) {
+        StrokeTiming copy = st;
+        timeStroke(lim, opt, dq_max, &copy);
+        uniform_time += copy.time;
+    }
+    float v_uniform = std::min(opt.feed, std::min(lim.v[0] / dq_max[0], lim.v[1] / dq_max[1]));
+    float a_uniform = std::min(lim.a[0] / dq_max[0], lim.a[1] / dq_max[1]);
+
+    printf("joint limits: v = %.0f / %.0f Deg/s (cap %.0f / %.0f, max_rpm %d / %d x %.2f, gear %.0f / %.0f), a = %.0f / %.0f Deg/s^2\n",
+           lim.v[0], lim.v[1], JOINT1_MAX_VELOCITY, JOINT2_MAX_VELOCITY, JOINT1_MAX_RPM, JOINT2_MAX_RPM, opt.margin,
+           JOINT1_GEAR_RATIO, JOINT2_GEAR_RATIO, lim.a[0], lim.a[1]);
+    printf("strokes %zu, length %.1f mm, samples %zu (ds %.2f mm)%s\n", strokes.size(), total_len, samples, opt.ds,
+           unreachable ? " [UNREACHABLE STROKES]" : "");
+    printf("fixed feed %.0f mm/s      : %.1f%% of the path exceeds a joint velocity limit\n", opt.feed,
+           100.0 * saturated_len / std::max(total_len, 1e-9));
+    printf("uniform limits (worst case): v %.0f mm/s, a %.0f mm/s^2 -> %.2f s\n", v_uniform, a_uniform, uniform_time);
+    printf("TOPP (per-point limits)    : %.2f s (%.2fx faster), avg %.1f mm/s\n", total_time,
+           uniform_time / total_time, total_len / total_time);
+    printf("limit check                : peak %.4f of limit %s\n", worst, worst <= LIMIT_SLACK ? "ok" : "FAIL");
+    printf("planning time              : %.1f ms\n", plan_ms);
+
+    if (opt.out) {
+        FILE* f = fopen(opt.out, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", opt.out);
+            return 1;
+        }
+        fprintf(f, "stroke,t,x,y,theta1,theta2,omega1,omega2\n");
+        for (size_t i = 0; i < timing.size(); ++i) writePvt(f, (int)i, timing[i], opt.dt);
+        fclose(f);
+        printf("PVT points written to %s (dt %.3f s)\n", opt.out, opt.dt);
+    }
+    return (worst <= LIMIT_SLACK && unreachable == 0) ? 0 : 1;
+}
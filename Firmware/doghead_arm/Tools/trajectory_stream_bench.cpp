@@ -0,0 +1,293 @@
+/**
+ * @file trajectory_stream_bench.cpp
+ * @brief [Host 工具] 壓縮軌跡串流 (trajectory_codec.hpp) 的壓縮率、解碼時間與錯誤恢復
+ * @details
+ *  錄製的筆畫取自內建筆畫表 (stroke_table_data.cpp，1kHz 的關節角)，以 20 / 50 / 100Hz 取樣成 PVT 軌跡點
+ *  (θ 與 StrokeTablePlayer 的中央差分 ω，z 落筆 0 / 抬筆 PEN_UP_Z，duration = 1 / rate)。
+ *  每個表格 × 頻率 × 預測階數 (一階 / 二階)：
+ *    1. 編碼後的 bytes / 點、壓縮率 (對 24 bytes 的 TrajectoryPoint)、115200 baud 8N1 可傳的點數 / s
+ *    2. 逐 byte 解碼 (等同 UART ISR) 進 SpscRingBuffer，檢查點數與量化誤差 (每個欄位 ≤ LSB / 2)
+ *    3. 解碼時間：逐 byte 與整段餵入的 host TSC cycles / 點 (MCU 的 cycles 需以 DWT->CYCCNT 實測，
+ *       這裡只做格式之間的相對比較)
+ *  最後把所有表格 (50Hz) 重複 --repeat 次串成一個串流，注入隨機位元錯誤 (--ber) 並以隨機長度切段餵入：
+ *  被接受的區塊必須與原始區塊完全相同，遺失的區塊數不得超過受損區塊數的兩倍 (失去同步最多再賠一塊)。
+ *  任一項失敗時回傳 1。
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc trajectory_stream_bench.cpp ../Core/Src/stroke_table_data.cpp -o trajectory_stream_bench
+ * 使用:
+ *   ./trajectory_stream_bench [--ber 1e-4] [--seed 1] [--repeat 20]
+ */
+
+#include "mainpp.h"
+#include "spsc_ring_buffer.hpp"
+#include "stroke_table.hpp"
+#include "trajectory_codec.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+static const float PEN_UP_Z = 2.0f;         // mm
+static const float LINK_BYTES_PER_S = 11520.0f;  // 115200 baud 8N1
+static const int TIMING_REPEAT = 200;
+
+struct Options {
+    double ber = 1e-4;
+    uint32_t seed = 1;
+    uint32_t repeat = 20;
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--ber")) opt->ber = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed")) opt->seed = (uint32_t)atol(argv[++i]);
+        else if (!strcmp(argv[i], "--repeat")) opt->repeat = (uint32_t)atol(argv[++i]);
+        else return false;
+    }
+    return opt->ber >= 0.0 && opt->ber < 0.1 && opt->repeat >= 1;
+}
+
+static uint64_t cycles() {
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// 以 rate Hz 取樣筆畫表 (第一點的 duration 為 0，最後一點停在表格終點)
+static std::vector<TrajectoryPoint> record(const StrokeTable& table, int rate) {
+    const uint32_t every = (uint32_t)(1000 / rate);
+    StrokeTablePlayer player;
+    player.start(table, 0.0f, 0.0f);
+    std::vector<TrajectoryPoint> pts;
+    pts.push_back({player.theta1(), player.theta2(), 0.0f, 0.0f, player.penDown() ? 0.0f : PEN_UP_Z, 0.0f});
+    JointSetpoint j1, j2;
+    uint32_t since = 0;
+    while (player.step(&j1, &j2)) {
+        if (++since == every || !player.active()) {
+            float z = player.penDown() ? 0.0f : PEN_UP_Z;
+            pts.push_back({j1.pos, j2.pos, j1.vel, j2.vel, z, (float)since * table.tick_s});
+            since = 0;
+        }
+    }
+    return pts;
+}
+
+// 編碼整個軌跡；blocks 記錄每個區塊在串流中的範圍與點數
+struct Block {
+    size_t offset, bytes;
+    uint32_t first, count;
+};
+
+static std::vector<uint8_t> encode(const std::vector<TrajectoryPoint>& pts, bool second_order,
+                                   std::vector<Block>* blocks) {
+    TrajectoryEncoder enc(second_order);
+    std::vector<uint8_t> stream;
+    uint8_t buf[trajectory_wire::MAX_BLOCK_BYTES];
+    uint32_t first = 0;
+    for (size_t i = 0; i <= pts.size(); ++i) {
+        uint32_t pending = enc.pending() + (i < pts.size() ? 1 : 0);
+        uint32_t n = (i < pts.size()) ? enc.push(pts[i], buf) : enc.flush(buf);
+        if (n == 0) continue;
+        if (blocks) blocks->push_back({stream.size(), n, first, pending});
+        first += pending;
+        stream.insert(stream.end(), buf, buf + n);
+    }
+    return stream;
+}
+
+typedef SpscRingBuffer<TrajectoryPoint, 4096> Buffer;
+
+// 逐 byte 解碼並取出所有點
+static std::vector<TrajectoryPoint> decodeAll(const std::vector<uint8_t>& stream, TrajectoryDecoder* dec) {
+    static Buffer rb;
+    rb.discard();
+    std::vector<TrajectoryPoint> out;
+    TrajectoryPoint p;
+    for (uint8_t b : stream) {
+        uint32_t n = dec->feed(&b, 1, rb);
+        for (uint32_t i = 0; i < n && rb.pop(&p); ++i) out.push_back(p);
+    }
+    return out;
+}
+
+struct Result {
+    size_t points = 0, bytes = 0;
+    float max_err[trajectory_wire::FIELDS] = {0, 0, 0, 0, 0, 0};
+    bool ok = true;
+    double cyc_byte = 0.0, cyc_bulk = 0.0, ns_byte = 0.0;
+};
+
+static Result measure(const std::vector<TrajectoryPoint>& pts, bool second_order) {
+    using namespace trajectory_wire;
+    Result r;
+    std::vector<uint8_t> stream = encode(pts, second_order, nullptr);
+    r.points = pts.size();
+    r.bytes = stream.size();
+
+    TrajectoryDecoder dec;
+    std::vector<TrajectoryPoint> got = decodeAll(stream, &dec);
+    if (got.size() != pts.size() || dec.stats().crc_errors || dec.stats().format_errors) r.ok = false;
+    for (size_t i = 0; i < got.size() && i < pts.size(); ++i) {
+        const float a[FIELDS] = {pts[i].theta1, pts[i].theta2, pts[i].omega1, pts[i].omega2, pts[i].z, pts[i].duration};
+        const float b[FIELDS] = {got[i].theta1, got[i].theta2, got[i].omega1, got[i].omega2, got[i].z, got[i].duration};
+        for (uint32_t f = 0; f < FIELDS; ++f) {
+            float e = std::fabs(a[f] - b[f]);
+            r.max_err[f] = std::max(r.max_err[f], e);
+            if (e > 0.5f * LSB[f] * 1.001f + std::fabs(a[f]) * 1e-7f) r.ok = false;
+        }
+    }
+
+    // 解碼時間 (取多次中最快的一次，排除排程干擾)
+    static Buffer rb;
+    uint64_t best_byte = UINT64_MAX, best_bulk = UINT64_MAX;
+    double best_ns = 1e30;
+    for (int rep = 0; rep < TIMING_REPEAT; ++rep) {
+        rb.discard();
+        TrajectoryDecoder d;
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t c0 = cycles();
+        for (uint8_t b : stream) {
+            if (d.feed(&b, 1, rb)) rb.discard();
+        }
+        uint64_t c1 = cycles();
+        auto t1 = std::chrono::steady_clock::now();
+        best_byte = std::min(best_byte, c1 - c0);
+        best_ns = std::min(best_ns, std::chrono::duration<double, std::nano>(t1 - t0).count());
+
+        rb.discard();
+        TrajectoryDecoder d2;
+        c0 = cycles();
+        d2.feed(stream.data(), (uint32_t)stream.size(), rb);
+        c1 = cycles();
+        best_bulk = std::min(best_bulk, c1 - c0);
+    }
+    r.cyc_byte = (double)best_byte / pts.size();
+    r.cyc_bulk = (double)best_bulk / pts.size();
+    r.ns_byte = best_ns / pts.size();
+    return r;
+}
+
+static bool samePoints(const TrajectoryPoint* a, const TrajectoryPoint* b, uint32_t n) {
+    return memcmp(a, b, n * sizeof(TrajectoryPoint)) == 0;
+}
+
+// 注入位元錯誤：被接受的區塊必須完全正確
+static bool errorRecovery(const std::vector<TrajectoryPoint>& pts, const Options& opt) {
+    std::vector<Block> blocks;
+    std::vector<uint8_t> clean = encode(pts, true, &blocks);
+    TrajectoryDecoder ref_dec;
+    std::vector<TrajectoryPoint> ref = decodeAll(clean, &ref_dec);
+
+    std::mt19937 rng(opt.seed);
+    std::vector<uint8_t> noisy = clean;
+    std::vector<bool> hit(blocks.size(), false);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    size_t flips = 0;
+    for (size_t i = 0; i < noisy.size(); ++i) {
+        for (int bit = 0; bit < 8; ++bit) {
+            if (u(rng) < opt.ber) {
+                noisy[i] ^= (uint8_t)(1u << bit);
+                flips++;
+                for (size_t k = 0; k < blocks.size(); ++k)
+                    if (i >= blocks[k].offset && i < blocks[k].offset + blocks[k].bytes) hit[k] = true;
+            }
+        }
+    }
+
+    // 隨機長度切段餵入 (1 ~ 64 bytes)，每次取出新發佈的點並對回原始區塊
+    static Buffer rb;
+    rb.discard();
+    TrajectoryDecoder dec;
+    std::uniform_int_distribution<int> chunk(1, 64);
+    size_t next_block = 0, accepted = 0, wrong = 0;
+    std::vector<TrajectoryPoint> got;
+    for (size_t i = 0; i < noisy.size();) {
+        uint32_t len = (uint32_t)std::min<size_t>((size_t)chunk(rng), noisy.size() - i);
+        dec.feed(&noisy[i], len, rb);
+        i += len;
+        TrajectoryPoint p;
+        while (rb.pop(&p)) got.push_back(p);
+        // 發佈的點一定是整個區塊；依序找出對應的原始區塊
+        while (!got.empty()) {
+            size_t k = next_block;
+            while (k < blocks.size() &&
+                   !(blocks[k].count <= got.size() && samePoints(&ref[blocks[k].first], got.data(), blocks[k].count)))
+                k++;
+            if (k == blocks.size()) {
+                wrong++;
+                got.clear();
+                break;
+            }
+            got.erase(got.begin(), got.begin() + blocks[k].count);
+            accepted++;
+            next_block = k + 1;
+        }
+    }
+    size_t damaged = (size_t)std::count(hit.begin(), hit.end(), true);
+    size_t lost = blocks.size() - accepted;
+    const TrajectoryStreamStats& s = dec.stats();
+    printf("\nbit errors: ber %.0e, %zu flips, %zu / %zu blocks damaged -> accepted %zu, lost %zu, wrong %zu "
+           "(crc %u, format %u)\n",
+           opt.ber, flips, damaged, blocks.size(), accepted, lost, wrong, (unsigned)s.crc_errors,
+           (unsigned)s.format_errors);
+    return wrong == 0 && lost <= 2 * damaged;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--ber 1e-4] [--seed 1] [--repeat 20]\n", argv[0]);
+        return 1;
+    }
+    const int rates[] = {100, 50, 20};  // Hz
+    const float raw = (float)sizeof(TrajectoryPoint);
+
+    printf("raw TrajectoryPoint %zu bytes -> %.0f points/s at 115200 baud\n\n", sizeof(TrajectoryPoint),
+           LINK_BYTES_PER_S / raw);
+    printf("%-13s %4s %5s %3s | %7s %6s %7s | %9s %9s | %8s %8s %7s\n", "table", "rate", "pts", "ord", "B/pt",
+           "ratio", "pts/s", "err(Deg)", "err(D/s)", "cyc/pt", "bulk", "ns/pt");
+    bool pass = true;
+    double total_bytes[2] = {0, 0}, total_points = 0;
+    for (uint32_t t = 0; t < STROKE_TABLE_COUNT; ++t) {
+        for (int rate : rates) {
+            std::vector<TrajectoryPoint> pts = record(STROKE_TABLES[t], rate);
+            for (int order = 1; order <= 2; ++order) {
+                Result r = measure(pts, order == 2);
+                float bpp = (float)r.bytes / r.points;
+                total_bytes[order - 1] += r.bytes;
+                if (order == 1) total_points += r.points;
+                printf("%-13s %4d %5zu %3d | %7.2f %5.1fx %7.0f | %9.6f %9.5f | %8.1f %8.1f %7.1f%s\n",
+                       STROKE_TABLES[t].name, rate, r.points, order, bpp, raw / bpp, LINK_BYTES_PER_S / bpp,
+                       std::max(r.max_err[0], r.max_err[1]), std::max(r.max_err[2], r.max_err[3]), r.cyc_byte,
+                       r.cyc_bulk, r.ns_byte, r.ok ? "" : "  FAIL");
+                pass = pass && r.ok;
+            }
+        }
+    }
+    printf("\noverall: 1st order %.2f B/pt (%.1fx), 2nd order %.2f B/pt (%.1fx)\n", total_bytes[0] / total_points,
+           raw * total_points / total_bytes[0], total_bytes[1] / total_points, raw * total_points / total_bytes[1]);
+
+    // 錯誤注入用較長的串流：所有表格 50Hz 重複 --repeat 次
+    std::vector<TrajectoryPoint> all;
+    for (uint32_t k = 0; k < opt.repeat; ++k) {
+        for (uint32_t t = 0; t < STROKE_TABLE_COUNT; ++t) {
+            std::vector<TrajectoryPoint> pts = record(STROKE_TABLES[t], 50);
+            all.insert(all.end(), pts.begin(), pts.end());
+        }
+    }
+    pass = errorRecovery(all, opt) && pass;
+    printf("%s\n", pass ? "OK" : "FAIL");
+    return pass ? 0 : 1;
+}
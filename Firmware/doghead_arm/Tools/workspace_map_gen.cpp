@@ -0,0 +1,221 @@
+/**
+ * @file workspace_map_gen.cpp
+ * @brief [Host 工具] 產生工作空間地圖 (Core/Src/workspace_map_table.cpp)：可達 / 奇異構型 bitmap
+ * @details
+ *  1. 範圍：整個可達包絡在 Y 虛擬圍籬 (DogArmSafety::Y_FENCE) 以上的部分，
+ *     X [-(L1+L2), D+L1+L2]、Y [Y_FENCE, L1+L2]
+ *  2. 每格取 (samples+1)^2 個點 (含四個角與邊)，以 DogArmPreciseKinematics::solveIK
+ *     (控制迴圈使用的手肘模式 1) 求解，再算 singularityDistance：
+ *       全部有解 -> reachable；再加上全部 >= min-sd -> writable
+ *  3. 以韌體同一份 WorkspaceMap 對隨機點做蒙地卡羅驗證：
+ *       誤判 (地圖說可以、實際不行) 與保守損失 (實際可以、地圖說不行) 的比例
+ *  4. 終端印出粗略地圖，並檢查書寫區 (DogArmWritingArea) 是否整塊可寫
+ *
+ * 編譯 (於 Tools/ 目錄):
+ *   g++ -O2 -std=gnu++14 -I../Core/Inc workspace_map_gen.cpp ../Core/Src/kinematics.cpp -o workspace_map_gen
+ * 使用:
+ *   ./workspace_map_gen [--cell 2.0] [--samples 4] [--min-sd 0.3] [--out ../Core/Src/workspace_map_table.cpp]
+ */
+
+#include "arm_geometry.hpp"
+#include "workspace_map.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+static const int VERIFY_POINTS = 2000000;
+
+struct Options {
+    float cell = 2.0f;
+    int samples = 4;
+    float min_sd = 0.3f;  // 與 Robot_Loop 的 SINGULARITY_SLOWDOWN_BAND 相同：writable 區內不需要降速
+    const char* out_path = "../Core/Src/workspace_map_table.cpp";
+};
+
+static bool parseArgs(int argc, char** argv, Options* opt) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) return false;
+        if (!strcmp(argv[i], "--cell")) opt->cell = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--samples")) opt->samples = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--min-sd")) opt->min_sd = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out")) opt->out_path = argv[++i];
+        else return false;
+    }
+    return opt->cell > 0.0f && opt->samples >= 1 && opt->min_sd >= 0.0f;
+}
+
+// 輸出合法的 C++ float 常值 (避免 "-60f" 這種沒有小數點的寫法)
+static const char* floatLiteral(float v, char* buf, size_t len) {
+    snprintf(buf, len, "%.9g", v);
+    if (!strpbrk(buf, ".eEn")) strncat(buf, ".0", len - strlen(buf) - 1);
+    strncat(buf, "f", len - strlen(buf) - 1);
+    return buf;
+}
+
+// 產生時的幾何：DogArmSpec 改變 (arm_calibration.hpp 更新) 而本表沒有重新產生時編譯失敗
+static void writeGeometryCheck(FILE* f) {
+    char l1[32], l2[32], d[32];
+    fprintf(f, "#include \"arm_geometry.hpp\"\n\n");
+    fprintf(f, "// 產生時的幾何 (arm_calibration.hpp 更新後請重新產生)\n");
+    fprintf(f, "static_assert(dogArmGeometryMatches(%s, %s, %s),\n", floatLiteral(DogArmSpec::L1, l1, sizeof(l1)),
+            floatLiteral(DogArmSpec::L2, l2, sizeof(l2)), floatLiteral(DogArmSpec::D, d, sizeof(d)));
+    fprintf(f, "              \"workspace_map_table.cpp was generated for another geometry: rerun Tools/workspace_map_gen\");\n\n");
+}
+
+static void writeArray(FILE* f, const char* name, const std::vector<uint32_t>& v) {
+    fprintf(f, "static const uint32_t %s[%zu] = {\n", name, v.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        if (i % 8 == 0) fprintf(f, "    ");
+        fprintf(f, "0x%08X,", (unsigned)v[i]);
+        fprintf(f, ((i + 1) % 8 == 0 || i + 1 == v.size()) ? "\n" : " ");
+    }
+    fprintf(f, "};\n\n");
+}
+
+// 單點判定：0 = 不可達，1 = 可達但接近奇異，2 = 可寫
+static int classify(const DogArmPreciseKinematics& kin, float x, float y, float min_sd, float* sd_out) {
+    *sd_out = 0.0f;
+    if (y < DogArmSafety::Y_FENCE) return 0;
+    MotorAngles a = kin.solveIK({x, y});
+    if (!a.is_reachable) return 0;
+    *sd_out = kin.singularityDistance(a.theta1, a.theta2);
+    return (*sd_out >= min_sd) ? 2 : 1;
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, &opt)) {
+        fprintf(stderr, "usage: %s [--cell mm] [--samples n] [--min-sd s] [--out file.cpp]\n", argv[0]);
+        return 1;
+    }
+
+    DogArmPreciseKinematics kin;
+    const FiveBarGeometry& G = kin.geometry();
+    const float x0 = -G.reach_max;
+    const float y0 = DogArmSafety::Y_FENCE;
+    const int nx = (int)std::ceil((G.d + G.reach_max - x0) / opt.cell - 1e-4f);
+    const int ny = (int)std::ceil((G.reach_max - y0) / opt.cell - 1e-4f);
+    const int words = (nx * ny + 31) / 32;
+    if (nx > 65535 || ny > 65535) {
+        fprintf(stderr, "cell too small\n");
+        return 1;
+    }
+
+    // --- 1. 逐格取樣 ---
+    std::vector<uint32_t> reach_bits(words, 0), write_bits(words, 0);
+    int n_reach = 0, n_write = 0;
+    for (int iy = 0; iy < ny; ++iy) {
+        for (int ix = 0; ix < nx; ++ix) {
+            int worst = 2;
+            for (int sy = 0; sy <= opt.samples && worst > 0; ++sy) {
+                for (int sx = 0; sx <= opt.samples && worst > 0; ++sx) {
+                    float x = x0 + (ix + (float)sx / opt.samples) * opt.cell;
+                    float y = y0 + (iy + (float)sy / opt.samples) * opt.cell;
+                    float sd;
+                    worst = std::min(worst, classify(kin, x, y, opt.min_sd, &sd));
+                }
+            }
+            int bit = iy * nx + ix;
+            if (worst >= 1) {
+                reach_bits[bit >> 5] |= 1u << (bit & 31);
+                n_reach++;
+            }
+            if (worst == 2) {
+                write_bits[bit >> 5] |= 1u << (bit & 31);
+                n_write++;
+            }
+        }
+    }
+
+    WorkspaceMapTable table = {x0, y0, opt.cell, 1.0f / opt.cell, (uint16_t)nx, (uint16_t)ny,
+                               opt.min_sd, reach_bits.data(), write_bits.data()};
+    WorkspaceMap map(table);
+
+    // --- 2. 蒙地卡羅驗證 ---
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> ux(x0, x0 + nx * opt.cell);
+    std::uniform_real_distribution<float> uy(y0, y0 + ny * opt.cell);
+    int false_reach = 0, false_write = 0, truly_write = 0, missed_write = 0;
+    float worst_sd_in_writable = 1.0f;
+    for (int i = 0; i < VERIFY_POINTS; ++i) {
+        float x = ux(rng), y = uy(rng);
+        float sd;
+        int c = classify(kin, x, y, opt.min_sd, &sd);
+        bool mr = map.isReachable(x, y), mw = map.isWritable(x, y);
+        if (mr && c == 0) false_reach++;
+        if (mw && c < 2) false_write++;
+        if (mw) worst_sd_in_writable = std::min(worst_sd_in_writable, sd);
+        if (c == 2) {
+            truly_write++;
+            if (!mw) missed_write++;
+        }
+    }
+
+    // --- 3. 書寫區檢查 ---
+    int area_bad = 0, area_total = 0;
+    for (float y = DogArmWritingArea::Y_MIN; y <= DogArmWritingArea::Y_MAX; y += 0.5f) {
+        for (float x = DogArmWritingArea::X_MIN; x <= DogArmWritingArea::X_MAX; x += 0.5f) {
+            area_total++;
+            if (!map.isWritable(x, y)) area_bad++;
+        }
+    }
+
+    // --- 4. 輸出表格原始碼 ---
+    FILE* f = fopen(opt.out_path, "w");
+    if (!f) {
+        perror(opt.out_path);
+        return 1;
+    }
+    fprintf(f, "/**\n");
+    fprintf(f, " * @file workspace_map_table.cpp\n");
+    fprintf(f, " * @brief [自動產生] 工作空間地圖 (可達 / 可寫 bitmap)，請勿手動修改\n");
+    fprintf(f, " * @details 產生器: Tools/workspace_map_gen --cell %.3f --samples %d --min-sd %.3f\n",
+            opt.cell, opt.samples, opt.min_sd);
+    fprintf(f, " *   幾何 L1=%.3f L2=%.3f D=%.3f mm，範圍 X[%.1f, %.1f] Y[%.1f, %.1f] mm (手肘模式 1)\n",
+            DogArmSpec::L1, DogArmSpec::L2, DogArmSpec::D,
+            x0, x0 + nx * opt.cell, y0, y0 + ny * opt.cell);
+    fprintf(f, " *   %d x %d 格 (%d bytes)，可達 %d 格、可寫 %d 格\n", nx, ny, words * 8, n_reach, n_write);
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"workspace_map.hpp\"\n");
+    writeGeometryCheck(f);
+    writeArray(f, "WORKSPACE_REACHABLE", reach_bits);
+    writeArray(f, "WORKSPACE_WRITABLE", write_bits);
+    char b1[32], b2[32];
+    fprintf(f, "const WorkspaceMapTable WORKSPACE_MAP_DOGARM = {\n");
+    fprintf(f, "    %s, %s,   // x_min, y_min\n", floatLiteral(x0, b1, sizeof(b1)), floatLiteral(y0, b2, sizeof(b2)));
+    fprintf(f, "    %s, %s,   // cell, inv_cell\n",
+            floatLiteral(opt.cell, b1, sizeof(b1)), floatLiteral(1.0f / opt.cell, b2, sizeof(b2)));
+    fprintf(f, "    %d, %d,   // nx, ny\n", nx, ny);
+    fprintf(f, "    %s,   // min_singularity\n", floatLiteral(opt.min_sd, b1, sizeof(b1)));
+    fprintf(f, "    WORKSPACE_REACHABLE,\n");
+    fprintf(f, "    WORKSPACE_WRITABLE,\n");
+    fprintf(f, "};\n");
+    fclose(f);
+
+    // --- 5. 終端摘要 + 地圖 (每字元約 10mm 寬、20mm 高) ---
+    printf("map %d x %d cells, %.3f mm, %d bytes flash\n", nx, ny, opt.cell, words * 8);
+    printf("reachable %d cells, writable %d cells (min singularityDistance %.2f)\n", n_reach, n_write, opt.min_sd);
+    printf("verify (%d random points):\n", VERIFY_POINTS);
+    printf("  false reachable %d, false writable %d, min sd inside writable %.3f\n",
+           false_reach, false_write, worst_sd_in_writable);
+    printf("  conservative loss %.2f%% of truly writable points\n",
+           truly_write ? 100.0 * missed_write / truly_write : 0.0);
+    printf("  writing area X[%.0f, %.0f] Y[%.0f, %.0f]: %d / %d points not writable\n\n",
+           DogArmWritingArea::X_MIN, DogArmWritingArea::X_MAX, DogArmWritingArea::Y_MIN,
+           DogArmWritingArea::Y_MAX, area_bad, area_total);
+    printf("workspace (top row = Y max;  # writable  + near-singular  (blank) unreachable)\n");
+    const int bx = std::max(1, (int)(10.0f / opt.cell));
+    for (int iy = ny - 1; iy >= 0; iy -= 2 * bx) {
+        for (int ix = 0; ix < nx; ix += bx) {
+            float x = x0 + (ix + 0.5f) * opt.cell, y = y0 + (iy + 0.5f) * opt.cell;
+            putchar(map.isWritable(x, y) ? '#' : map.isReachable(x, y) ? '+' : ' ');
+        }
+        putchar('\n');
+    }
+    printf("\nwrote %s\n", opt.out_path);
+    return (false_reach || false_write || area_bad) ? 1 : 0;
+}